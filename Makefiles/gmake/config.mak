@@ -0,0 +1,2 @@
+_NO_DBG_BUILD := 1
+_NO_STLDBG_BUILD := 1
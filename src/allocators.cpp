@@ -225,6 +225,17 @@ __oom_handler_type _STLP_CALL __malloc_alloc::set_malloc_handler(__oom_handler_t
 #  define _STLP_USE_LOCK_FREE_IMPLEMENTATION
 #endif
 
+/* Per-thread magazines (see _STLP_USE_NODE_ALLOC_MAGAZINES in host.h) need
+ * thread specific storage with a destructor, we take it from POSIX threads.
+ * Memory cleanup of the node allocator pool can't be combined with them as
+ * magazines of running threads would keep references to freed chunks.
+ */
+#if defined (_STLP_USE_NODE_ALLOC_MAGAZINES) && defined (_STLP_PTHREADS) && \
+    !defined (_STLP_NO_THREADS) && !defined (_STLP_DO_CLEAN_NODE_ALLOC)
+#  define _STLP_NODE_ALLOC_USE_MAGAZINES
+class _Node_alloc_magazines;
+#endif
+
 #if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 #  if defined (_STLP_THREADS)
 
@@ -268,6 +279,10 @@ class __node_alloc_impl {
   static inline size_t _STLP_CALL _S_round_up(size_t __bytes)
   { return (((__bytes) + (size_t)_ALIGN-1) & ~((size_t)_ALIGN - 1)); }
 
+#if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+  friend class _Node_alloc_magazines;
+#endif
+
 #if defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
   typedef _STLP_atomic_freelist::item   _Obj;
   typedef _STLP_atomic_freelist         _Freelist;
@@ -333,8 +348,33 @@ public:
   static void* _M_allocate(size_t& __n);
   /* __p may not be 0 */
   static void _M_deallocate(void *__p, size_t __n);
+
+#if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+private:
+  // Links __nobjs objects of size __n carved from __chunk into 0-terminated list.
+  static _Obj* _S_link_chunk(char* __chunk, size_t __n, int __nobjs);
+  /* Detaches up to __nobjs objects of size __n (already rounded up) from
+   * the free list in one go; __nobjs is updated with the number of
+   * objects in the returned 0-terminated list, that is never empty. */
+  static _Obj* _M_allocate_batch(size_t __n, int& __nobjs);
+  /* Returns list [__first, __last] of objects of size __n to free list */
+  static void _M_deallocate_batch(_Obj* __first, _Obj* __last, size_t __n);
+#endif
 };
 
+#if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+__node_alloc_impl::_Obj* __node_alloc_impl::_S_link_chunk(char* __chunk, size_t __n, int __nobjs) {
+  _Obj* __result = __REINTERPRET_CAST(_Obj*, __chunk);
+  _Obj* __cur_item = __result;
+  for (--__nobjs; __nobjs != 0; --__nobjs) {
+    __cur_item->_M_next = __REINTERPRET_CAST(_Obj*, __REINTERPRET_CAST(char*, __cur_item) + __n);
+    __cur_item = __cur_item->_M_next;
+  }
+  __cur_item->_M_next = 0;
+  return __result;
+}
+#endif
+
 #if !defined (_STLP_USE_LOCK_FREE_IMPLEMENTATION)
 void* __node_alloc_impl::_M_allocate(size_t& __n) {
   __n = _S_round_up(__n);
@@ -475,6 +515,39 @@ _Node_alloc_obj* __node_alloc_impl::_S_refill(size_t __n) {
   return __result;
 }
 
+#  if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+__node_alloc_impl::_Obj* __node_alloc_impl::_M_allocate_batch(size_t __n, int& __nobjs) {
+  _Obj * _STLP_VOLATILE * __my_free_list = _S_free_list + _S_FREELIST_INDEX(__n);
+
+  _Node_Alloc_Lock __lock_instance;
+
+  _Obj* __r = *__my_free_list;
+  if (__r != 0) {
+    _Obj* __last = __r;
+    int __cnt = 1;
+    for ( ; (__cnt < __nobjs) && (__last->_M_next != 0); ++__cnt) {
+      __last = __last->_M_next;
+    }
+    *__my_free_list = __last->_M_next;
+    __last->_M_next = 0;
+    __nobjs = __cnt;
+    return __r;
+  }
+
+  // lock is held here, as _S_chunk_alloc expect
+  return _S_link_chunk(_S_chunk_alloc(__n, __nobjs), __n, __nobjs);
+}
+
+void __node_alloc_impl::_M_deallocate_batch(_Obj* __first, _Obj* __last, size_t __n) {
+  _Obj * _STLP_VOLATILE * __my_free_list = _S_free_list + _S_FREELIST_INDEX(__n);
+
+  _Node_Alloc_Lock __lock_instance;
+  __last->_M_next = *__my_free_list;
+  *__my_free_list = __first;
+  // lock is released here
+}
+#  endif
+
 #  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
 void __node_alloc_impl::_S_alloc_call()
 { ++_S_alloc_counter(); }
@@ -543,6 +616,31 @@ __node_alloc_impl::_Obj* __node_alloc_impl::_S_refill(size_t __n) {
   return __result;
 }
 
+#  if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+__node_alloc_impl::_Obj* __node_alloc_impl::_M_allocate_batch(size_t __n, int& __nobjs) {
+  _Freelist* __my_freelist = _S_free_list + _S_FREELIST_INDEX(__n);
+  _Obj* __r = 0;
+  int __cnt = 0;
+  for ( ; __cnt < __nobjs; ++__cnt) {
+    _Obj* __p = __my_freelist->pop();
+    if (__p == 0)
+      break;
+    __p->_M_next = __r;
+    __r = __p;
+  }
+  if (__cnt != 0) {
+    __nobjs = __cnt;
+    return __r;
+  }
+
+  return _S_link_chunk(_S_chunk_alloc(__n, __nobjs), __n, __nobjs);
+}
+
+void __node_alloc_impl::_M_deallocate_batch(_Obj* __first, _Obj* __last, size_t __n) {
+  _S_free_list[_S_FREELIST_INDEX(__n)].push_list(__first, __last);
+}
+#  endif
+
 #  if defined (_STLP_DO_CLEAN_NODE_ALLOC)
 #    define _STLP_OFFSET _ALIGN
 #  else
@@ -760,12 +858,198 @@ _Node_alloc_obj* __node_alloc_impl::_S_chunks  = 0;
 #  endif
 #endif
 
+#if defined (_STLP_NODE_ALLOC_USE_MAGAZINES)
+
+// *******************************************************
+// Per-thread magazines in front of the node allocator.
+//
+// Every thread owns a bounded stack of free objects (magazine) per size
+// class. Allocation and deallocation work on it without locks or atomic
+// operations; shared free lists of __node_alloc_impl are accessed only
+// to refill an empty magazine or to flush half of a full one, each time
+// with a batch of objects, so synchronization cost is paid once per batch.
+// On thread exit all magazines of the thread are returned to free lists.
+
+#  if defined (__GNUC__)
+// Fast access to thread's magazines, pthread key is used for cleanup only
+#    define _STLP_NODE_ALLOC_TLS __thread
+#  endif
+
+class _Node_alloc_magazines {
+  typedef __node_alloc_impl::_Obj _Obj;
+
+  // Capacity of magazine is _S_BYTES / (object size), within [_S_MIN_OBJS, _S_MAX_OBJS]
+  enum { _S_BYTES = 4096, _S_MIN_OBJS = 8, _S_MAX_OBJS = 128 };
+
+  struct _Magazine {
+    _Obj* _M_head;
+    int   _M_count;
+  };
+
+  _Magazine _M_mag[_STLP_NFREELISTS];
+
+  static int _STLP_CALL _S_capacity(size_t __n) {
+    size_t __cap = (size_t)_S_BYTES / __n;
+    return __cap < (size_t)_S_MIN_OBJS ? (int)_S_MIN_OBJS :
+           __cap > (size_t)_S_MAX_OBJS ? (int)_S_MAX_OBJS : (int)__cap;
+  }
+
+  // Returns last object of list of __cnt objects starting from __first
+  static _Obj* _STLP_CALL _S_tail(_Obj* __first, int __cnt) {
+    while (--__cnt > 0) {
+      __first = __first->_M_next;
+    }
+    return __first;
+  }
+
+  static pthread_key_t  _S_key;
+  static pthread_once_t _S_once;
+  static bool           _S_key_initialized;
+  // Marks threads whose magazines were already released
+  static _Node_alloc_magazines _S_retired;
+#  if defined (_STLP_NODE_ALLOC_TLS)
+  static _STLP_NODE_ALLOC_TLS _Node_alloc_magazines* _S_local;
+#  endif
+
+  static void _S_key_init();
+  static void _S_destructor(void* __instance);
+  static _Node_alloc_magazines* _S_create();
+
+  // Magazines of current thread, 0 if not available
+  static _Node_alloc_magazines* _S_get() {
+#  if defined (_STLP_NODE_ALLOC_TLS)
+    _Node_alloc_magazines* __m = _S_local;
+#  else
+    _Node_alloc_magazines* __m = _S_key_initialized ?
+      __STATIC_CAST(_Node_alloc_magazines*, pthread_getspecific(_S_key)) : 0;
+#  endif
+    if (__m == 0) {
+      return _S_create();
+    }
+    return __m == &_S_retired ? 0 : __m;
+  }
+
+public:
+  static void* _M_allocate(size_t& __n);
+  static void _M_deallocate(void *__p, size_t __n);
+};
+
+pthread_key_t  _Node_alloc_magazines::_S_key;
+pthread_once_t _Node_alloc_magazines::_S_once = PTHREAD_ONCE_INIT;
+bool           _Node_alloc_magazines::_S_key_initialized = false;
+_Node_alloc_magazines _Node_alloc_magazines::_S_retired;
+#  if defined (_STLP_NODE_ALLOC_TLS)
+_STLP_NODE_ALLOC_TLS _Node_alloc_magazines* _Node_alloc_magazines::_S_local = 0;
+#  endif
+
+void _Node_alloc_magazines::_S_key_init()
+{ _S_key_initialized = (pthread_key_create(&_S_key, _S_destructor) == 0); }
+
+_Node_alloc_magazines* _Node_alloc_magazines::_S_create() {
+  pthread_once(&_S_once, _S_key_init);
+  if (!_S_key_initialized) {
+    return 0;
+  }
+
+  _Node_alloc_magazines* __m = __STATIC_CAST(_Node_alloc_magazines*, __malloc_alloc::allocate(sizeof(_Node_alloc_magazines)));
+  memset(__m, 0, sizeof(_Node_alloc_magazines));
+  if (pthread_setspecific(_S_key, __m) != 0) {
+    __malloc_alloc::deallocate(__m, sizeof(_Node_alloc_magazines));
+    return 0;
+  }
+#  if defined (_STLP_NODE_ALLOC_TLS)
+  _S_local = __m;
+#  endif
+  return __m;
+}
+
+void _Node_alloc_magazines::_S_destructor(void* __instance) {
+  _Node_alloc_magazines* __m = __STATIC_CAST(_Node_alloc_magazines*, __instance);
+  if (__m != &_S_retired) {
+    for (size_t __i = 0; __i < _STLP_NFREELISTS; ++__i) {
+      _Magazine& __mag = __m->_M_mag[__i];
+      if (__mag._M_head != 0) {
+        __node_alloc_impl::_M_deallocate_batch(__mag._M_head, _S_tail(__mag._M_head, __mag._M_count),
+                                               (__i + 1) * (size_t)_ALIGN);
+      }
+    }
+    __malloc_alloc::deallocate(__m, sizeof(_Node_alloc_magazines));
+  }
+  // Other thread specific destructors may still free nodes, they go
+  // directly to free lists from now
+#  if defined (_STLP_NODE_ALLOC_TLS)
+  _S_local = &_S_retired;
+#  else
+  /* Value is reset to 0 before destructor call; keep the mark for the
+   * rest of destructor iterations (this call is repeated for it) */
+  pthread_setspecific(_S_key, &_S_retired);
+#  endif
+}
+
+void* _Node_alloc_magazines::_M_allocate(size_t& __n) {
+  _Node_alloc_magazines* __m = _S_get();
+  if (__m == 0) {
+    return __node_alloc_impl::_M_allocate(__n);
+  }
+
+  __n = __node_alloc_impl::_S_round_up(__n);
+  _Magazine& __mag = __m->_M_mag[_S_FREELIST_INDEX(__n)];
+  _Obj* __r = __mag._M_head;
+
+  if (__r == 0) {
+    int __nobjs = _S_capacity(__n) / 2;
+    __r = __node_alloc_impl::_M_allocate_batch(__n, __nobjs);
+    __mag._M_count = __nobjs;
+  }
+  __mag._M_head = __r->_M_next;
+  --__mag._M_count;
+  return __r;
+}
+
+void _Node_alloc_magazines::_M_deallocate(void *__p, size_t __n) {
+  _Node_alloc_magazines* __m = _S_get();
+  if (__m == 0) {
+    __node_alloc_impl::_M_deallocate(__p, __n);
+    return;
+  }
+
+  __n = __node_alloc_impl::_S_round_up(__n);
+  _Magazine& __mag = __m->_M_mag[_S_FREELIST_INDEX(__n)];
+  int __cap = _S_capacity(__n);
+
+  if (__mag._M_count == __cap) {
+    // Keep the recently freed (hot) half, flush the rest
+    _Obj* __last_kept = _S_tail(__mag._M_head, __cap / 2);
+    _Obj* __first = __last_kept->_M_next;
+    __last_kept->_M_next = 0;
+    __node_alloc_impl::_M_deallocate_batch(__first, _S_tail(__first, __cap - __cap / 2), __n);
+    __mag._M_count = __cap / 2;
+  }
+
+  _Obj* __pobj = __STATIC_CAST(_Obj*, __p);
+  __pobj->_M_next = __mag._M_head;
+  __mag._M_head = __pobj;
+  ++__mag._M_count;
+}
+
+#  undef _STLP_NODE_ALLOC_TLS
+
+void * _STLP_CALL __node_alloc::_M_allocate(size_t& __n)
+{ return _Node_alloc_magazines::_M_allocate(__n); }
+
+void _STLP_CALL __node_alloc::_M_deallocate(void *__p, size_t __n)
+{ _Node_alloc_magazines::_M_deallocate(__p, __n); }
+
+#else
+
 void * _STLP_CALL __node_alloc::_M_allocate(size_t& __n)
 { return __node_alloc_impl::_M_allocate(__n); }
 
 void _STLP_CALL __node_alloc::_M_deallocate(void *__p, size_t __n)
 { __node_alloc_impl::_M_deallocate(__p, __n); }
 
+#endif
+
 #if defined (_STLP_PTHREADS) && !defined (_STLP_NO_THREADS)
 
 #  define _STLP_DATA_ALIGNMENT 8
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "stlport_prefix.h"
+
+#include <atomic>
+
+_STLP_BEGIN_NAMESPACE
+
+namespace detail {
+
+// spinlocks for atomic<T> that can't be lock-free; zero-initialized, i.e. free
+__atomic_spin __atomic_spin_table[__atomic_spin_table_size];
+
+} // namespace detail
+
+_STLP_END_NAMESPACE
@@ -19,136 +19,178 @@
 #include "stlport_prefix.h"
 
 #include <bitset>
+#include <cstring>
+
+/*
+ * Counting of long buffers: AVX2 or popcnt kernel, chosen at runtime if CPU
+ * support it (CPUID, via __builtin_cpu_supports); portable code otherwise.
+ */
+
+#if defined (__GNUC__) && !defined (_STLP_NO_SSE2) && (defined (__x86_64__) || defined (__i386__)) && \
+    (defined (__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#  define _STLP_BITSET_AVX2
+#  include <immintrin.h>
+#endif
 
 _STLP_BEGIN_NAMESPACE
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
 
 // ------------------------------------------------------------
-// Lookup tables for find and count operations.
+// Count and find operations, word at a time.
+
+namespace {
+
+// word at __p, and with word at __q for _And
+template <bool _And>
+#if defined (__GNUC__)
+__attribute__((always_inline))
+#endif
+inline size_t __load_word_count(const unsigned char* __p, const unsigned char* __q)
+{
+  unsigned long __w;
+  memcpy(&__w, __p, sizeof(__w));
+  if (_And) {
+    unsigned long __v;
+    memcpy(&__v, __q, sizeof(__v));
+    __w &= __v;
+  }
+  return __bit_popcount(__w);
+}
+
+// Kernel body; inlined into variants compiled for different instruction sets
+template <bool _And>
+#if defined (__GNUC__)
+__attribute__((always_inline))
+#endif
+inline size_t __count_words(const unsigned char* __first, const unsigned char* __last, const unsigned char* __q)
+{
+  const size_t __w = sizeof(unsigned long);
+  size_t __result = 0;
+  // four independent sums: popcnt latency is hidden
+  size_t __r1 = 0, __r2 = 0, __r3 = 0;
+  for ( ; __last - __first >= static_cast<ptrdiff_t>(4 * __w); __first += 4 * __w, __q += 4 * __w ) {
+    __result += __load_word_count<_And>(__first, __q);
+    __r1 += __load_word_count<_And>(__first + __w, __q + __w);
+    __r2 += __load_word_count<_And>(__first + 2 * __w, __q + 2 * __w);
+    __r3 += __load_word_count<_And>(__first + 3 * __w, __q + 3 * __w);
+  }
+  for ( ; __last - __first >= static_cast<ptrdiff_t>(__w); __first += __w, __q += __w ) {
+    __result += __load_word_count<_And>(__first, __q);
+  }
+  for ( ; __first != __last; ++__first, ++__q ) {
+    __result += __bit_popcount(static_cast<unsigned int>(_And ? *__first & *__q : *__first));
+  }
+  return __result + __r1 + __r2 + __r3;
+}
+
+template <bool _And>
+size_t __generic_count(const unsigned char* __first, const unsigned char* __last, const unsigned char* __q)
+{ return __count_words<_And>(__first, __last, __q); }
+
+#if defined (_STLP_BITSET_AVX2)
+
+template <bool _And>
+__attribute__((target("popcnt")))
+size_t __popcnt_count(const unsigned char* __first, const unsigned char* __last, const unsigned char* __q)
+{ return __count_words<_And>(__first, __last, __q); }
+
+/*
+ * Population count of 32 bytes per step by nibble lookup (vpshufb),
+ * byte sums accumulated for up to 8 steps, then added into four 64-bit
+ * lanes by vpsadbw. Harley-Seal would be a bit faster on very long
+ * buffers, but bitsets are rarely longer than a few kilobytes.
+ */
+template <bool _And>
+__attribute__((target("avx2,popcnt")))
+size_t __avx2_count(const unsigned char* __first, const unsigned char* __last, const unsigned char* __q)
+{
+  const __m256i __table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i __nibble = _mm256_set1_epi8(0x0f);
+  __m256i __total = _mm256_setzero_si256();
+
+  while ( __last - __first >= 32 ) {
+    __m256i __acc = _mm256_setzero_si256();
+    // byte counters can't overflow: at most 8 * 8 = 64 per step group
+    for ( int __k = 0; __k < 8 && __last - __first >= 32; ++__k, __first += 32, __q += 32 ) {
+      __m256i __v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first));
+      if (_And) {
+        __v = _mm256_and_si256(__v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__q)));
+      }
+      const __m256i __lo = _mm256_shuffle_epi8(__table, _mm256_and_si256(__v, __nibble));
+      const __m256i __hi = _mm256_shuffle_epi8(__table, _mm256_and_si256(_mm256_srli_epi16(__v, 4), __nibble));
+      __acc = _mm256_add_epi8(__acc, _mm256_add_epi8(__lo, __hi));
+    }
+    __total = _mm256_add_epi64(__total, _mm256_sad_epu8(__acc, _mm256_setzero_si256()));
+  }
+
+  unsigned long long __lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(__lanes), __total);
+  size_t __result = static_cast<size_t>(__lanes[0] + __lanes[1] + __lanes[2] + __lanes[3]);
+  return __result + __count_words<_And>(__first, __last, __q);
+}
+
+typedef size_t (*_Count_fn)(const unsigned char*, const unsigned char*, const unsigned char*);
+
+struct _Count_kernels
+{
+    _Count_fn _M_short[2]; // index: _And
+    _Count_fn _M_long[2];
+};
+
+_Count_kernels __select_kernels()
+{
+  __builtin_cpu_init();
+  _Count_kernels __k = { { __generic_count<false>, __generic_count<true> },
+                         { __generic_count<false>, __generic_count<true> } };
+  if (__builtin_cpu_supports("popcnt")) {
+    __k._M_short[0] = __k._M_long[0] = __popcnt_count<false>;
+    __k._M_short[1] = __k._M_long[1] = __popcnt_count<true>;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    __k._M_long[0] = __avx2_count<false>;
+    __k._M_long[1] = __avx2_count<true>;
+  }
+  return __k;
+}
+
+// AVX2 kernel pay off only on long buffers
+const size_t __min_avx2_len = 256;
+
+inline _Count_fn __count_kernel(size_t __n, bool __and)
+{
+  static const _Count_kernels __k = __select_kernels();
+  return __n >= __min_avx2_len ? __k._M_long[__and] : __k._M_short[__and];
+}
+#endif
+
+} // namespace
 
 size_t _Bs_G::_S_count(const unsigned char *__first,
                        const unsigned char *__last)
 {
-  static const unsigned char _bit_count[256] = {
-  0, /*   0 */ 1, /*   1 */ 1, /*   2 */ 2, /*   3 */ 1, /*   4 */
-  2, /*   5 */ 2, /*   6 */ 3, /*   7 */ 1, /*   8 */ 2, /*   9 */
-  2, /*  10 */ 3, /*  11 */ 2, /*  12 */ 3, /*  13 */ 3, /*  14 */
-  4, /*  15 */ 1, /*  16 */ 2, /*  17 */ 2, /*  18 */ 3, /*  19 */
-  2, /*  20 */ 3, /*  21 */ 3, /*  22 */ 4, /*  23 */ 2, /*  24 */
-  3, /*  25 */ 3, /*  26 */ 4, /*  27 */ 3, /*  28 */ 4, /*  29 */
-  4, /*  30 */ 5, /*  31 */ 1, /*  32 */ 2, /*  33 */ 2, /*  34 */
-  3, /*  35 */ 2, /*  36 */ 3, /*  37 */ 3, /*  38 */ 4, /*  39 */
-  2, /*  40 */ 3, /*  41 */ 3, /*  42 */ 4, /*  43 */ 3, /*  44 */
-  4, /*  45 */ 4, /*  46 */ 5, /*  47 */ 2, /*  48 */ 3, /*  49 */
-  3, /*  50 */ 4, /*  51 */ 3, /*  52 */ 4, /*  53 */ 4, /*  54 */
-  5, /*  55 */ 3, /*  56 */ 4, /*  57 */ 4, /*  58 */ 5, /*  59 */
-  4, /*  60 */ 5, /*  61 */ 5, /*  62 */ 6, /*  63 */ 1, /*  64 */
-  2, /*  65 */ 2, /*  66 */ 3, /*  67 */ 2, /*  68 */ 3, /*  69 */
-  3, /*  70 */ 4, /*  71 */ 2, /*  72 */ 3, /*  73 */ 3, /*  74 */
-  4, /*  75 */ 3, /*  76 */ 4, /*  77 */ 4, /*  78 */ 5, /*  79 */
-  2, /*  80 */ 3, /*  81 */ 3, /*  82 */ 4, /*  83 */ 3, /*  84 */
-  4, /*  85 */ 4, /*  86 */ 5, /*  87 */ 3, /*  88 */ 4, /*  89 */
-  4, /*  90 */ 5, /*  91 */ 4, /*  92 */ 5, /*  93 */ 5, /*  94 */
-  6, /*  95 */ 2, /*  96 */ 3, /*  97 */ 3, /*  98 */ 4, /*  99 */
-  3, /* 100 */ 4, /* 101 */ 4, /* 102 */ 5, /* 103 */ 3, /* 104 */
-  4, /* 105 */ 4, /* 106 */ 5, /* 107 */ 4, /* 108 */ 5, /* 109 */
-  5, /* 110 */ 6, /* 111 */ 3, /* 112 */ 4, /* 113 */ 4, /* 114 */
-  5, /* 115 */ 4, /* 116 */ 5, /* 117 */ 5, /* 118 */ 6, /* 119 */
-  4, /* 120 */ 5, /* 121 */ 5, /* 122 */ 6, /* 123 */ 5, /* 124 */
-  6, /* 125 */ 6, /* 126 */ 7, /* 127 */ 1, /* 128 */ 2, /* 129 */
-  2, /* 130 */ 3, /* 131 */ 2, /* 132 */ 3, /* 133 */ 3, /* 134 */
-  4, /* 135 */ 2, /* 136 */ 3, /* 137 */ 3, /* 138 */ 4, /* 139 */
-  3, /* 140 */ 4, /* 141 */ 4, /* 142 */ 5, /* 143 */ 2, /* 144 */
-  3, /* 145 */ 3, /* 146 */ 4, /* 147 */ 3, /* 148 */ 4, /* 149 */
-  4, /* 150 */ 5, /* 151 */ 3, /* 152 */ 4, /* 153 */ 4, /* 154 */
-  5, /* 155 */ 4, /* 156 */ 5, /* 157 */ 5, /* 158 */ 6, /* 159 */
-  2, /* 160 */ 3, /* 161 */ 3, /* 162 */ 4, /* 163 */ 3, /* 164 */
-  4, /* 165 */ 4, /* 166 */ 5, /* 167 */ 3, /* 168 */ 4, /* 169 */
-  4, /* 170 */ 5, /* 171 */ 4, /* 172 */ 5, /* 173 */ 5, /* 174 */
-  6, /* 175 */ 3, /* 176 */ 4, /* 177 */ 4, /* 178 */ 5, /* 179 */
-  4, /* 180 */ 5, /* 181 */ 5, /* 182 */ 6, /* 183 */ 4, /* 184 */
-  5, /* 185 */ 5, /* 186 */ 6, /* 187 */ 5, /* 188 */ 6, /* 189 */
-  6, /* 190 */ 7, /* 191 */ 2, /* 192 */ 3, /* 193 */ 3, /* 194 */
-  4, /* 195 */ 3, /* 196 */ 4, /* 197 */ 4, /* 198 */ 5, /* 199 */
-  3, /* 200 */ 4, /* 201 */ 4, /* 202 */ 5, /* 203 */ 4, /* 204 */
-  5, /* 205 */ 5, /* 206 */ 6, /* 207 */ 3, /* 208 */ 4, /* 209 */
-  4, /* 210 */ 5, /* 211 */ 4, /* 212 */ 5, /* 213 */ 5, /* 214 */
-  6, /* 215 */ 4, /* 216 */ 5, /* 217 */ 5, /* 218 */ 6, /* 219 */
-  5, /* 220 */ 6, /* 221 */ 6, /* 222 */ 7, /* 223 */ 3, /* 224 */
-  4, /* 225 */ 4, /* 226 */ 5, /* 227 */ 4, /* 228 */ 5, /* 229 */
-  5, /* 230 */ 6, /* 231 */ 4, /* 232 */ 5, /* 233 */ 5, /* 234 */
-  6, /* 235 */ 5, /* 236 */ 6, /* 237 */ 6, /* 238 */ 7, /* 239 */
-  4, /* 240 */ 5, /* 241 */ 5, /* 242 */ 6, /* 243 */ 5, /* 244 */
-  6, /* 245 */ 6, /* 246 */ 7, /* 247 */ 5, /* 248 */ 6, /* 249 */
-  6, /* 250 */ 7, /* 251 */ 6, /* 252 */ 7, /* 253 */ 7, /* 254 */
-  8  /* 255 */
-  };
-
-  size_t __result(0);
-  while ( __first < __last ) {
-    __result += _bit_count[*(__first++)];
-  }
-  return __result;
+#if defined (_STLP_BITSET_AVX2)
+  return __count_kernel(__last - __first, false)(__first, __last, __first);
+#else
+  return __generic_count<false>(__first, __last, __first);
+#endif
+}
+
+size_t _Bs_G::_S_count_and(const unsigned char *__first1,
+                           const unsigned char *__last1,
+                           const unsigned char *__first2)
+{
+#if defined (_STLP_BITSET_AVX2)
+  return __count_kernel(__last1 - __first1, true)(__first1, __last1, __first2);
+#else
+  return __generic_count<true>(__first1, __last1, __first2);
+#endif
 }
 
 unsigned char _Bs_G::_S_first_one(unsigned char __byte)
 {
-  static const unsigned char _first_one[256] = {
-  0, /*   0 */ 0, /*   1 */ 1, /*   2 */ 0, /*   3 */ 2, /*   4 */
-  0, /*   5 */ 1, /*   6 */ 0, /*   7 */ 3, /*   8 */ 0, /*   9 */
-  1, /*  10 */ 0, /*  11 */ 2, /*  12 */ 0, /*  13 */ 1, /*  14 */
-  0, /*  15 */ 4, /*  16 */ 0, /*  17 */ 1, /*  18 */ 0, /*  19 */
-  2, /*  20 */ 0, /*  21 */ 1, /*  22 */ 0, /*  23 */ 3, /*  24 */
-  0, /*  25 */ 1, /*  26 */ 0, /*  27 */ 2, /*  28 */ 0, /*  29 */
-  1, /*  30 */ 0, /*  31 */ 5, /*  32 */ 0, /*  33 */ 1, /*  34 */
-  0, /*  35 */ 2, /*  36 */ 0, /*  37 */ 1, /*  38 */ 0, /*  39 */
-  3, /*  40 */ 0, /*  41 */ 1, /*  42 */ 0, /*  43 */ 2, /*  44 */
-  0, /*  45 */ 1, /*  46 */ 0, /*  47 */ 4, /*  48 */ 0, /*  49 */
-  1, /*  50 */ 0, /*  51 */ 2, /*  52 */ 0, /*  53 */ 1, /*  54 */
-  0, /*  55 */ 3, /*  56 */ 0, /*  57 */ 1, /*  58 */ 0, /*  59 */
-  2, /*  60 */ 0, /*  61 */ 1, /*  62 */ 0, /*  63 */ 6, /*  64 */
-  0, /*  65 */ 1, /*  66 */ 0, /*  67 */ 2, /*  68 */ 0, /*  69 */
-  1, /*  70 */ 0, /*  71 */ 3, /*  72 */ 0, /*  73 */ 1, /*  74 */
-  0, /*  75 */ 2, /*  76 */ 0, /*  77 */ 1, /*  78 */ 0, /*  79 */
-  4, /*  80 */ 0, /*  81 */ 1, /*  82 */ 0, /*  83 */ 2, /*  84 */
-  0, /*  85 */ 1, /*  86 */ 0, /*  87 */ 3, /*  88 */ 0, /*  89 */
-  1, /*  90 */ 0, /*  91 */ 2, /*  92 */ 0, /*  93 */ 1, /*  94 */
-  0, /*  95 */ 5, /*  96 */ 0, /*  97 */ 1, /*  98 */ 0, /*  99 */
-  2, /* 100 */ 0, /* 101 */ 1, /* 102 */ 0, /* 103 */ 3, /* 104 */
-  0, /* 105 */ 1, /* 106 */ 0, /* 107 */ 2, /* 108 */ 0, /* 109 */
-  1, /* 110 */ 0, /* 111 */ 4, /* 112 */ 0, /* 113 */ 1, /* 114 */
-  0, /* 115 */ 2, /* 116 */ 0, /* 117 */ 1, /* 118 */ 0, /* 119 */
-  3, /* 120 */ 0, /* 121 */ 1, /* 122 */ 0, /* 123 */ 2, /* 124 */
-  0, /* 125 */ 1, /* 126 */ 0, /* 127 */ 7, /* 128 */ 0, /* 129 */
-  1, /* 130 */ 0, /* 131 */ 2, /* 132 */ 0, /* 133 */ 1, /* 134 */
-  0, /* 135 */ 3, /* 136 */ 0, /* 137 */ 1, /* 138 */ 0, /* 139 */
-  2, /* 140 */ 0, /* 141 */ 1, /* 142 */ 0, /* 143 */ 4, /* 144 */
-  0, /* 145 */ 1, /* 146 */ 0, /* 147 */ 2, /* 148 */ 0, /* 149 */
-  1, /* 150 */ 0, /* 151 */ 3, /* 152 */ 0, /* 153 */ 1, /* 154 */
-  0, /* 155 */ 2, /* 156 */ 0, /* 157 */ 1, /* 158 */ 0, /* 159 */
-  5, /* 160 */ 0, /* 161 */ 1, /* 162 */ 0, /* 163 */ 2, /* 164 */
-  0, /* 165 */ 1, /* 166 */ 0, /* 167 */ 3, /* 168 */ 0, /* 169 */
-  1, /* 170 */ 0, /* 171 */ 2, /* 172 */ 0, /* 173 */ 1, /* 174 */
-  0, /* 175 */ 4, /* 176 */ 0, /* 177 */ 1, /* 178 */ 0, /* 179 */
-  2, /* 180 */ 0, /* 181 */ 1, /* 182 */ 0, /* 183 */ 3, /* 184 */
-  0, /* 185 */ 1, /* 186 */ 0, /* 187 */ 2, /* 188 */ 0, /* 189 */
-  1, /* 190 */ 0, /* 191 */ 6, /* 192 */ 0, /* 193 */ 1, /* 194 */
-  0, /* 195 */ 2, /* 196 */ 0, /* 197 */ 1, /* 198 */ 0, /* 199 */
-  3, /* 200 */ 0, /* 201 */ 1, /* 202 */ 0, /* 203 */ 2, /* 204 */
-  0, /* 205 */ 1, /* 206 */ 0, /* 207 */ 4, /* 208 */ 0, /* 209 */
-  1, /* 210 */ 0, /* 211 */ 2, /* 212 */ 0, /* 213 */ 1, /* 214 */
-  0, /* 215 */ 3, /* 216 */ 0, /* 217 */ 1, /* 218 */ 0, /* 219 */
-  2, /* 220 */ 0, /* 221 */ 1, /* 222 */ 0, /* 223 */ 5, /* 224 */
-  0, /* 225 */ 1, /* 226 */ 0, /* 227 */ 2, /* 228 */ 0, /* 229 */
-  1, /* 230 */ 0, /* 231 */ 3, /* 232 */ 0, /* 233 */ 1, /* 234 */
-  0, /* 235 */ 2, /* 236 */ 0, /* 237 */ 1, /* 238 */ 0, /* 239 */
-  4, /* 240 */ 0, /* 241 */ 1, /* 242 */ 0, /* 243 */ 2, /* 244 */
-  0, /* 245 */ 1, /* 246 */ 0, /* 247 */ 3, /* 248 */ 0, /* 249 */
-  1, /* 250 */ 0, /* 251 */ 2, /* 252 */ 0, /* 253 */ 1, /* 254 */
-  0, /* 255 */
-  };
-  return _first_one[__byte];
+  return __byte == 0 ? 0 : static_cast<unsigned char>(__bit_ctz(static_cast<unsigned int>(__byte)));
 }
 
 _STLP_MOVE_TO_STD_NAMESPACE
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "stlport_prefix.h"
+
+#include <string>
+#include <cstring>
+
+/*
+ * Kernels: SSE2 (baseline of x86_64) and AVX2, latter is chosen at runtime
+ * if CPU support it (CPUID, via __builtin_cpu_supports). Both are generated
+ * from char_search_kernels.h. Short input and other platforms use scalar
+ * code: memchr and 256-bit bitmap for sets.
+ */
+
+#if defined (__GNUC__) && !defined (_STLP_NO_SSE2) && defined (__SSE2__)
+#  define _STLP_CHAR_SEARCH_SSE2
+#  include <emmintrin.h>
+#  if (defined (__x86_64__) || defined (__i386__)) && \
+      (defined (__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#    define _STLP_CHAR_SEARCH_AVX2
+#    include <immintrin.h>
+#  endif
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+namespace {
+
+/*
+ * Set of chars as 256-bit bitmap, in layout suitable for nibble lookup
+ * by byte shuffle: char c is bit ((c >> 4) & 7) of _M_tbl[c & 0xf] for
+ * c < 0x80 and of _M_tbl[16 + (c & 0xf)] for c >= 0x80.
+ */
+struct _Set_bitmap
+{
+    unsigned char _M_tbl[32];
+
+    _Set_bitmap(const char* __set, size_t __m)
+      {
+        memset(_M_tbl, 0, sizeof(_M_tbl));
+        for (size_t __k = 0; __k < __m; ++__k) {
+          const unsigned char __c = static_cast<unsigned char>(__set[__k]);
+          _M_tbl[(__c & 0xf) | ((__c >> 3) & 0x10)] |= static_cast<unsigned char>(1 << ((__c >> 4) & 7));
+        }
+      }
+
+    bool test(char __ch) const
+      {
+        const unsigned char __c = static_cast<unsigned char>(__ch);
+        return ((_M_tbl[(__c & 0xf) | ((__c >> 3) & 0x10)] >> ((__c >> 4) & 7)) & 1) != 0;
+      }
+};
+
+const char* __scalar_find(const char* __s, size_t __n, char __c)
+{ return __n == 0 ? 0 : static_cast<const char*>(memchr(__s, static_cast<unsigned char>(__c), __n)); }
+
+const char* __scalar_rfind(const char* __s, size_t __n, char __c)
+{
+  while (__n-- > 0) {
+    if (__s[__n] == __c) {
+      return __s + __n;
+    }
+  }
+  return 0;
+}
+
+const char* __scalar_search(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  const char* const __last = __s + (__n - __m) + 1; // past last candidate
+  while (__s != __last) {
+    __s = static_cast<const char*>(memchr(__s, static_cast<unsigned char>(__p[0]), __last - __s));
+    if (__s == 0) {
+      return 0;
+    }
+    if (memcmp(__s + 1, __p + 1, __m - 1) == 0) {
+      return __s;
+    }
+    ++__s;
+  }
+  return 0;
+}
+
+const char* __scalar_rsearch(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  size_t __i = __n - __m + 1;
+  while (__i-- > 0) {
+    if (__s[__i] == __p[0] && memcmp(__s + __i + 1, __p + 1, __m - 1) == 0) {
+      return __s + __i;
+    }
+  }
+  return 0;
+}
+
+const char* __scalar_find_of(const char* __s, size_t __n, const _Set_bitmap& __bm, bool __in)
+{
+  for (const char* __e = __s + __n; __s != __e; ++__s) {
+    if (__bm.test(*__s) == __in) {
+      return __s;
+    }
+  }
+  return 0;
+}
+
+const char* __scalar_rfind_of(const char* __s, size_t __n, const _Set_bitmap& __bm, bool __in)
+{
+  while (__n-- > 0) {
+    if (__bm.test(__s[__n]) == __in) {
+      return __s + __n;
+    }
+  }
+  return 0;
+}
+
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+
+inline unsigned __low_bit(unsigned __x)
+{ return __builtin_ctz(__x); }
+
+inline unsigned __high_bit(unsigned __x)
+{ return 31 - __builtin_clz(__x); }
+
+inline unsigned __full_mask(unsigned __w)
+{ return __w >= 32 ? ~0U : (1U << __w) - 1; }
+
+#  define _CS_W 16
+#  define _CS_V __m128i
+#  define _CS_LOAD(p) _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+#  define _CS_SET1(c) _mm_set1_epi8(c)
+#  define _CS_CMPEQ(a, b) _mm_cmpeq_epi8(a, b)
+#  define _CS_AND(a, b) _mm_and_si128(a, b)
+#  define _CS_OR(a, b) _mm_or_si128(a, b)
+#  define _CS_MASK(v) static_cast<unsigned>(_mm_movemask_epi8(v))
+#  define _CS_FN(name) __sse2_##name
+#  define _CS_ATTR
+#  define _CS_SMALL_SET 8
+#  include "char_search_kernels.h"
+
+#  if defined (_STLP_CHAR_SEARCH_AVX2)
+
+// chars of __x that are in set: row of bitmap by low nibble (two 16-bytes
+// tables, for chars below and above 0x80), bit in row by high nibble
+__attribute__((target("avx2")))
+static inline __m256i __avx2_bitmap_match(const _Set_bitmap& __bm, __m256i __x)
+{
+  const __m256i __tlo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__bm._M_tbl)));
+  const __m256i __thi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__bm._M_tbl + 16)));
+  const __m256i __bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i __nibble = _mm256_set1_epi8(0x0f);
+  const __m256i __lo = _mm256_and_si256(__x, __nibble);
+  const __m256i __hi = _mm256_and_si256(_mm256_srli_epi16(__x, 4), __nibble);
+  // sign bit of char select table for chars >= 0x80
+  const __m256i __row = _mm256_blendv_epi8(_mm256_shuffle_epi8(__tlo, __lo), _mm256_shuffle_epi8(__thi, __lo), __x);
+  const __m256i __bit = _mm256_shuffle_epi8(__bits, __hi);
+  return _mm256_cmpeq_epi8(_mm256_and_si256(__row, __bit), __bit);
+}
+
+#    define _CS_W 32
+#    define _CS_V __m256i
+#    define _CS_LOAD(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+#    define _CS_SET1(c) _mm256_set1_epi8(c)
+#    define _CS_CMPEQ(a, b) _mm256_cmpeq_epi8(a, b)
+#    define _CS_AND(a, b) _mm256_and_si256(a, b)
+#    define _CS_OR(a, b) _mm256_or_si256(a, b)
+#    define _CS_MASK(v) static_cast<unsigned>(_mm256_movemask_epi8(v))
+#    define _CS_FN(name) __avx2_##name
+#    define _CS_ATTR __attribute__((target("avx2")))
+#    define _CS_SMALL_SET 2
+#    define _CS_BITMAP
+#    include "char_search_kernels.h"
+
+#  endif /* _STLP_CHAR_SEARCH_AVX2 */
+
+struct _Kernels
+{
+    size_t _M_width;     // kernels require at least _M_width chars
+    size_t _M_small_set; // find_of without _M_bitmap accept sets not bigger than this
+    bool _M_bitmap;
+    const char* (*_M_find)(const char*, size_t, char);
+    const char* (*_M_rfind)(const char*, size_t, char);
+    const char* (*_M_search)(const char*, size_t, const char*, size_t);
+    const char* (*_M_rsearch)(const char*, size_t, const char*, size_t);
+    const char* (*_M_find_of)(const char*, size_t, const char*, size_t, const _Set_bitmap&, bool);
+    const char* (*_M_rfind_of)(const char*, size_t, const char*, size_t, const _Set_bitmap&, bool);
+};
+
+const _Kernels __sse2_kernels = {
+  16, 8, false,
+  __sse2_find, __sse2_rfind, __sse2_search, __sse2_rsearch, __sse2_find_of, __sse2_rfind_of
+};
+
+#  if defined (_STLP_CHAR_SEARCH_AVX2)
+const _Kernels __avx2_kernels = {
+  32, 2, true,
+  __avx2_find, __avx2_rfind, __avx2_search, __avx2_rsearch, __avx2_find_of, __avx2_rfind_of
+};
+#  endif
+
+const _Kernels* __select_kernels()
+{
+#  if defined (_STLP_CHAR_SEARCH_AVX2)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return &__avx2_kernels;
+  }
+#  endif
+  return &__sse2_kernels;
+}
+
+// shorter input is scanned by scalar code whatever kernels are
+const size_t __min_simd_len = 16;
+
+// Precondition: __n >= __min_simd_len
+inline const _Kernels& __kernels(size_t __n)
+{
+  static const _Kernels* __k = __select_kernels();
+  return __n >= __k->_M_width ? *__k : __sse2_kernels;
+}
+
+#endif /* _STLP_CHAR_SEARCH_SSE2 */
+
+} // namespace
+
+const char* _STLP_CALL _Char_search::_S_find(const char* __s, size_t __n, char __c)
+{
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    return __kernels(__n)._M_find(__s, __n, __c);
+  }
+#endif
+  return __scalar_find(__s, __n, __c);
+}
+
+const char* _STLP_CALL _Char_search::_S_rfind(const char* __s, size_t __n, char __c)
+{
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    return __kernels(__n)._M_rfind(__s, __n, __c);
+  }
+#endif
+  return __scalar_rfind(__s, __n, __c);
+}
+
+const char* _STLP_CALL _Char_search::_S_search(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  if (__m > __n) {
+    return 0;
+  }
+  if (__m <= 1) {
+    return __m == 0 ? __s : _S_find(__s, __n, *__p);
+  }
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    return __kernels(__n)._M_search(__s, __n, __p, __m);
+  }
+#endif
+  return __scalar_search(__s, __n, __p, __m);
+}
+
+const char* _STLP_CALL _Char_search::_S_rsearch(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  if (__m > __n) {
+    return 0;
+  }
+  if (__m <= 1) {
+    return __m == 0 ? __s + __n : _S_rfind(__s, __n, *__p);
+  }
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    return __kernels(__n)._M_rsearch(__s, __n, __p, __m);
+  }
+#endif
+  return __scalar_rsearch(__s, __n, __p, __m);
+}
+
+const char* _STLP_CALL _Char_search::_S_find_of(const char* __s, size_t __n, const char* __set, size_t __m, bool __in)
+{
+  if (__m == 0) {
+    return (__in || __n == 0) ? 0 : __s;
+  }
+  if (__m == 1 && __in) {
+    return _S_find(__s, __n, *__set);
+  }
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    const _Kernels& __k = __kernels(__n);
+    if (__k._M_bitmap || __m <= __k._M_small_set) {
+      return __k._M_find_of(__s, __n, __set, __m, _Set_bitmap(__set, __m), __in);
+    }
+  }
+#endif
+  return __scalar_find_of(__s, __n, _Set_bitmap(__set, __m), __in);
+}
+
+const char* _STLP_CALL _Char_search::_S_rfind_of(const char* __s, size_t __n, const char* __set, size_t __m, bool __in)
+{
+  if (__m == 0) {
+    return (__in || __n == 0) ? 0 : __s + __n - 1;
+  }
+  if (__m == 1 && __in) {
+    return _S_rfind(__s, __n, *__set);
+  }
+#if defined (_STLP_CHAR_SEARCH_SSE2)
+  if (__n >= __min_simd_len) {
+    const _Kernels& __k = __kernels(__n);
+    if (__k._M_bitmap || __m <= __k._M_small_set) {
+      return __k._M_rfind_of(__s, __n, __set, __m, _Set_bitmap(__set, __m), __in);
+    }
+  }
+#endif
+  return __scalar_rfind_of(__s, __n, _Set_bitmap(__set, __m), __in);
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/*
+ * Search kernels of char_search.cpp. This file is included once per
+ * instruction set (no include guard); includer define:
+ *
+ *   _CS_W              vector width, in bytes (16 or 32)
+ *   _CS_V              vector type
+ *   _CS_LOAD(p)        unaligned load of _CS_W bytes
+ *   _CS_SET1(c)        broadcast char
+ *   _CS_CMPEQ(a, b)    bytewise compare, 0xff if equal
+ *   _CS_AND(a, b), _CS_OR(a, b)
+ *   _CS_MASK(v)        bit per byte (unsigned), lower bit for lower address
+ *   _CS_FN(name)       kernel name for this instruction set
+ *   _CS_ATTR           function attribute (target), may be empty
+ *   _CS_SMALL_SET      max set size for find_of by direct compares
+ *
+ * and optionally _CS_BITMAP: then _CS_FN(bitmap_match)(tbl, x) return
+ * vector with 0xff for chars of x present in set, for sets given by
+ * 256-bit bitmap tbl (see _Set_bitmap); otherwise sets that are bigger
+ * than _CS_SMALL_SET are checked by scalar bitmap lookup.
+ *
+ * All kernels are called with __n >= _CS_W (shorter input is scanned by
+ * scalar code).
+ */
+
+_CS_ATTR static const char* _CS_FN(find)(const char* __s, size_t __n, char __c)
+{
+  const char* const __e = __s + __n;
+  const _CS_V __vc = _CS_SET1(__c);
+
+  for ( ; __s + _CS_W <= __e; __s += _CS_W) {
+    unsigned __m = _CS_MASK(_CS_CMPEQ(_CS_LOAD(__s), __vc));
+    if (__m != 0) {
+      return __s + __low_bit(__m);
+    }
+  }
+  if (__s != __e) {
+    // last block overlap with already scanned chars: shift them out
+    const char* __t = __e - _CS_W;
+    unsigned __m = _CS_MASK(_CS_CMPEQ(_CS_LOAD(__t), __vc)) >> (__s - __t);
+    if (__m != 0) {
+      return __s + __low_bit(__m);
+    }
+  }
+  return 0;
+}
+
+_CS_ATTR static const char* _CS_FN(rfind)(const char* __s, size_t __n, char __c)
+{
+  const char* __e = __s + __n;
+  const _CS_V __vc = _CS_SET1(__c);
+
+  for ( ; __e - __s >= _CS_W; ) {
+    __e -= _CS_W;
+    unsigned __m = _CS_MASK(_CS_CMPEQ(_CS_LOAD(__e), __vc));
+    if (__m != 0) {
+      return __e + __high_bit(__m);
+    }
+  }
+  if (__e != __s) {
+    unsigned __m = _CS_MASK(_CS_CMPEQ(_CS_LOAD(__s), __vc)) & ((1U << (__e - __s)) - 1);
+    if (__m != 0) {
+      return __s + __high_bit(__m);
+    }
+  }
+  return 0;
+}
+
+/*
+ * Substring search by first and last char filter: candidate positions
+ * are ones where both first and last chars of pattern match (one vector
+ * compare each, for _CS_W positions at once); only candidates are
+ * compared with whole pattern. Precondition: 2 <= __m <= __n.
+ */
+_CS_ATTR static const char* _CS_FN(search)(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  const size_t __cnt = __n - __m + 1; // number of positions to check
+  const _CS_V __first = _CS_SET1(__p[0]);
+  const _CS_V __last = _CS_SET1(__p[__m - 1]);
+  size_t __i = 0;
+
+  for ( ; __i + _CS_W <= __cnt; __i += _CS_W) {
+    unsigned __mask = _CS_MASK(_CS_AND(_CS_CMPEQ(_CS_LOAD(__s + __i), __first),
+                                       _CS_CMPEQ(_CS_LOAD(__s + __i + __m - 1), __last)));
+    while (__mask != 0) {
+      const size_t __j = __i + __low_bit(__mask);
+      if (memcmp(__s + __j + 1, __p + 1, __m - 2) == 0) {
+        return __s + __j;
+      }
+      __mask &= __mask - 1;
+    }
+  }
+  for ( ; __i < __cnt; ++__i) {
+    if (__s[__i] == __p[0] && __s[__i + __m - 1] == __p[__m - 1] &&
+        memcmp(__s + __i + 1, __p + 1, __m - 2) == 0) {
+      return __s + __i;
+    }
+  }
+  return 0;
+}
+
+_CS_ATTR static const char* _CS_FN(rsearch)(const char* __s, size_t __n, const char* __p, size_t __m)
+{
+  size_t __cnt = __n - __m + 1;
+  const _CS_V __first = _CS_SET1(__p[0]);
+  const _CS_V __last = _CS_SET1(__p[__m - 1]);
+
+  for ( ; __cnt >= _CS_W; ) {
+    __cnt -= _CS_W;
+    unsigned __mask = _CS_MASK(_CS_AND(_CS_CMPEQ(_CS_LOAD(__s + __cnt), __first),
+                                       _CS_CMPEQ(_CS_LOAD(__s + __cnt + __m - 1), __last)));
+    while (__mask != 0) {
+      const unsigned __b = __high_bit(__mask);
+      if (memcmp(__s + __cnt + __b + 1, __p + 1, __m - 2) == 0) {
+        return __s + __cnt + __b;
+      }
+      __mask &= ~(1U << __b);
+    }
+  }
+  while (__cnt-- > 0) {
+    if (__s[__cnt] == __p[0] && __s[__cnt + __m - 1] == __p[__m - 1] &&
+        memcmp(__s + __cnt + 1, __p + 1, __m - 2) == 0) {
+      return __s + __cnt;
+    }
+  }
+  return 0;
+}
+
+// bit per char of block at __s that is in set (__in) or out of set (!__in)
+_CS_ATTR static inline unsigned _CS_FN(set_mask)(const char* __s, const _CS_V* __set, size_t __m,
+                                                 const _Set_bitmap& __bm, bool __in)
+{
+  const _CS_V __x = _CS_LOAD(__s);
+  unsigned __mask;
+#if defined (_CS_BITMAP)
+  if (__m > _CS_SMALL_SET) {
+    __mask = _CS_MASK(_CS_FN(bitmap_match)(__bm, __x));
+  } else
+#endif
+  {
+    _CS_V __acc = _CS_CMPEQ(__x, __set[0]);
+    for (size_t __k = 1; __k < __m; ++__k) {
+      __acc = _CS_OR(__acc, _CS_CMPEQ(__x, __set[__k]));
+    }
+    __mask = _CS_MASK(__acc);
+  }
+  return __in ? __mask : ~__mask & __full_mask(_CS_W);
+}
+
+/*
+ * Precondition: 0 < __m and, without _CS_BITMAP, __m <= _CS_SMALL_SET.
+ */
+_CS_ATTR static const char* _CS_FN(find_of)(const char* __s, size_t __n, const char* __set, size_t __m,
+                                            const _Set_bitmap& __bm, bool __in)
+{
+  const char* const __e = __s + __n;
+  _CS_V __vset[_CS_SMALL_SET];
+
+  for (size_t __k = 0; __k < __m && __k < _CS_SMALL_SET; ++__k) {
+    __vset[__k] = _CS_SET1(__set[__k]);
+  }
+  for ( ; __s + _CS_W <= __e; __s += _CS_W) {
+    unsigned __mask = _CS_FN(set_mask)(__s, __vset, __m, __bm, __in);
+    if (__mask != 0) {
+      return __s + __low_bit(__mask);
+    }
+  }
+  if (__s != __e) {
+    const char* __t = __e - _CS_W;
+    unsigned __mask = _CS_FN(set_mask)(__t, __vset, __m, __bm, __in) >> (__s - __t);
+    if (__mask != 0) {
+      return __s + __low_bit(__mask);
+    }
+  }
+  return 0;
+}
+
+_CS_ATTR static const char* _CS_FN(rfind_of)(const char* __s, size_t __n, const char* __set, size_t __m,
+                                             const _Set_bitmap& __bm, bool __in)
+{
+  const char* __e = __s + __n;
+  _CS_V __vset[_CS_SMALL_SET];
+
+  for (size_t __k = 0; __k < __m && __k < _CS_SMALL_SET; ++__k) {
+    __vset[__k] = _CS_SET1(__set[__k]);
+  }
+  for ( ; __e - __s >= _CS_W; ) {
+    __e -= _CS_W;
+    unsigned __mask = _CS_FN(set_mask)(__e, __vset, __m, __bm, __in);
+    if (__mask != 0) {
+      return __e + __high_bit(__mask);
+    }
+  }
+  if (__e != __s) {
+    unsigned __mask = _CS_FN(set_mask)(__s, __vset, __m, __bm, __in) & ((1U << (__e - __s)) - 1);
+    if (__mask != 0) {
+      return __s + __high_bit(__mask);
+    }
+  }
+  return 0;
+}
+
+#undef _CS_W
+#undef _CS_V
+#undef _CS_LOAD
+#undef _CS_SET1
+#undef _CS_CMPEQ
+#undef _CS_AND
+#undef _CS_OR
+#undef _CS_MASK
+#undef _CS_FN
+#undef _CS_ATTR
+#undef _CS_SMALL_SET
+#undef _CS_BITMAP
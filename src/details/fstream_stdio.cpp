@@ -153,7 +153,8 @@ size_t _Filebuf_base::_M_page_size = 4096;
 _Filebuf_base::_Filebuf_base() :
     _M_file_id(INVALID_STLP_FD),
     _M_openmode(0),
-    int_flags_(0)
+    int_flags_(0),
+    _M_writer(0)
 {}
 
 void _Filebuf_base::_S_initialize()
@@ -345,6 +346,18 @@ bool _Filebuf_base::_M_write(char* buf, ptrdiff_t n)
   }
 }
 
+// Two blocks one after another; no gather write here.
+bool _Filebuf_base::_M_write(char* buf1, ptrdiff_t n1, char* buf2, ptrdiff_t n2)
+{
+  return (n1 == 0 || _M_write(buf1, n1)) && (n2 == 0 || _M_write(buf2, n2));
+}
+
+// stdio has no way to force data to disk; at least leave FILE buffer.
+bool _Filebuf_base::_M_sync_file()
+{
+  return fflush(_M_file) == 0;
+}
+
 // Wrapper for lseek or the like.
 streamoff _Filebuf_base::_M_seek(streamoff offset, ios_base::seekdir dir)
 {
@@ -391,4 +404,8 @@ void _Filebuf_base::_M_unmap(void*, streamoff)
   // precondition : there is a valid mapping at the moment
 }
 
+void _Filebuf_base::_M_advise(void*, streamoff, int)
+{
+}
+
 _STLP_END_NAMESPACE
@@ -41,6 +41,8 @@ extern "C" {
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/uio.h>            // For writev
+#include <errno.h>
 }
 
 #ifdef __APPLE__
@@ -124,7 +126,8 @@ size_t _Filebuf_base::_M_page_size = 4096;
 _Filebuf_base::_Filebuf_base() :
     _M_file_id(INVALID_STLP_FD),
     _M_openmode(0),
-    int_flags_(0)
+    int_flags_(0),
+    _M_writer(0)
 {}
 
 void _Filebuf_base::_S_initialize()
@@ -290,6 +293,57 @@ bool _Filebuf_base::_M_write(char* buf, ptrdiff_t n)
   }
 }
 
+// Two blocks with one writev; on partial write, continue from the
+// first byte not written yet.
+bool _Filebuf_base::_M_write(char* buf1, ptrdiff_t n1, char* buf2, ptrdiff_t n2)
+{
+  struct iovec iov[2];
+  int cnt = 0;
+
+  if (n1 > 0) {
+    iov[cnt].iov_base = buf1;
+    iov[cnt].iov_len = n1;
+    ++cnt;
+  }
+  if (n2 > 0) {
+    iov[cnt].iov_base = buf2;
+    iov[cnt].iov_len = n2;
+    ++cnt;
+  }
+
+  struct iovec* v = iov;
+  while (cnt > 0) {
+    ptrdiff_t written = writev(_M_file_id, v, cnt);
+
+    if (written <= 0) {
+      return false;
+    }
+
+    while (cnt > 0 && static_cast<size_t>(written) >= v->iov_len) {
+      written -= v->iov_len;
+      ++v;
+      --cnt;
+    }
+    if (cnt > 0) {
+      v->iov_base = static_cast<char*>(v->iov_base) + written;
+      v->iov_len -= written;
+    }
+  }
+  return true;
+}
+
+// Data written so far to disk.  Special files (pipes, terminals) have
+// nothing to sync.
+bool _Filebuf_base::_M_sync_file()
+{
+#if defined (_POSIX_SYNCHRONIZED_IO) && (_POSIX_SYNCHRONIZED_IO > 0)
+  int ret = fdatasync(_M_file_id);
+#else
+  int ret = fsync(_M_file_id);
+#endif
+  return ret == 0 || errno == EINVAL || errno == EROFS;
+}
+
 // Wrapper for lseek or the like.
 streamoff _Filebuf_base::_M_seek(streamoff offset, ios_base::seekdir dir)
 {
@@ -352,4 +406,24 @@ void _Filebuf_base::_M_unmap(void* base, streamoff len)
 #endif
 }
 
+// Hints for read-ahead and paging of mapped range.
+void _Filebuf_base::_M_advise(void* base, streamoff len, int advice)
+{
+#if defined (MADV_SEQUENTIAL)
+  if (advice & _S_adv_sequential)
+    madvise((char*)base, len, MADV_SEQUENTIAL);
+  if (advice & _S_adv_random)
+    madvise((char*)base, len, MADV_RANDOM);
+  if (advice & _S_adv_willneed)
+    madvise((char*)base, len, MADV_WILLNEED);
+#endif
+#if defined (MADV_HUGEPAGE)
+  if (advice & _S_adv_hugepage)
+    madvise((char*)base, len, MADV_HUGEPAGE);
+#endif
+  _STLP_MARK_PARAMETER_AS_UNUSED(&len)
+  _STLP_MARK_PARAMETER_AS_UNUSED(base)
+  _STLP_MARK_PARAMETER_AS_UNUSED(&advice)
+}
+
 _STLP_END_NAMESPACE
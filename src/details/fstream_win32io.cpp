@@ -198,7 +198,8 @@ _Filebuf_base::_Filebuf_base() :
     _M_file_id(INVALID_STLP_FD),
     _M_openmode(0),
     int_flags_(0),
-    _M_view_id(0)
+    _M_view_id(0),
+    _M_writer(0)
 {}
 
 void _Filebuf_base::_S_initialize() {
@@ -543,6 +544,15 @@ bool _Filebuf_base::_M_write(char* buf, ptrdiff_t n) {
   }
 }
 
+// Two blocks one after another; no gather write here.
+bool _Filebuf_base::_M_write(char* buf1, ptrdiff_t n1, char* buf2, ptrdiff_t n2) {
+  return (n1 == 0 || _M_write(buf1, n1)) && (n2 == 0 || _M_write(buf2, n2));
+}
+
+bool _Filebuf_base::_M_sync_file() {
+  return FlushFileBuffers(_M_file_id) != 0;
+}
+
 // Wrapper for lseek or the like.
 streamoff _Filebuf_base::_M_seek(streamoff offset, ios_base::seekdir dir) {
   streamoff result = -1;
@@ -639,4 +649,8 @@ void _Filebuf_base::_M_unmap(void* base, streamoff len) {
   (void)len; //unused variable
 }
 
+void _Filebuf_base::_M_advise(void*, streamoff, int) {
+  // no hints for views of file mapping
+}
+
 _STLP_END_NAMESPACE
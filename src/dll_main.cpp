@@ -184,6 +184,7 @@ template class _STLP_CLASS_DECLSPEC _List_global<bool>;
 
 template class _STLP_CLASS_DECLSPEC _Sl_global<bool>;
 template class _STLP_CLASS_DECLSPEC _Stl_prime<bool>;
+template class _STLP_CLASS_DECLSPEC _Stl_pow2<bool>;
 
 template class _STLP_CLASS_DECLSPEC _LimG<bool>;
 
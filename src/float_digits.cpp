@@ -0,0 +1,806 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "stlport_prefix.h"
+
+#include <cstring>
+
+#if (defined (__GNUC__) && !defined (__sun) && !defined (__hpux)) || \
+    defined (__DMC__)
+#  include <stdint.h>
+#endif
+
+#include "float_digits.h"
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+namespace {
+
+#if defined (_STLP_MSVC) || defined (__BORLANDC__) || defined (__ICL)
+typedef unsigned long uint32;
+typedef unsigned __int64 uint64;
+#  define ULL(x) x##Ui64
+#else
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+#  define ULL(x) x##ULL
+#endif
+
+/*
+ * Value is _M_f * 2^_M_e, _M_f with hidden bit (if any). Lower neighbour
+ * is closer than upper one when _M_f is power of 2 (except smallest normal
+ * value: neighbour below is denormal, with same distance).
+ */
+struct _Float_parts
+{
+    uint64 _M_f;
+    int _M_e;
+    bool _M_lower_closer;
+};
+
+inline _Float_parts __decompose(double __x)
+{
+  uint64 __bits;
+  memcpy(&__bits, &__x, sizeof(__bits));
+  const int __be = static_cast<int>((__bits >> 52) & 0x7ff);
+  _Float_parts __p;
+  __p._M_f = __bits & ((ULL(1) << 52) - 1);
+  if (__be == 0) {
+    __p._M_e = 1 - 1075;
+    __p._M_lower_closer = false;
+  } else {
+    __p._M_lower_closer = __p._M_f == 0 && __be > 1;
+    __p._M_f |= ULL(1) << 52;
+    __p._M_e = __be - 1075;
+  }
+  return __p;
+}
+
+inline _Float_parts __decompose(float __x)
+{
+  uint32 __bits;
+  memcpy(&__bits, &__x, sizeof(__bits));
+  const int __be = static_cast<int>((__bits >> 23) & 0xff);
+  _Float_parts __p;
+  __p._M_f = __bits & ((1U << 23) - 1);
+  if (__be == 0) {
+    __p._M_e = 1 - 150;
+    __p._M_lower_closer = false;
+  } else {
+    __p._M_lower_closer = __p._M_f == 0 && __be > 1;
+    __p._M_f |= 1U << 23;
+    __p._M_e = __be - 150;
+  }
+  return __p;
+}
+
+inline int __bit_length(uint64 __f)
+{
+#if defined (__GNUC__)
+  return 64 - __builtin_clzll(__f);
+#else
+  int __n = 0;
+  for ( ; __f != 0; __f >>= 1) {
+    ++__n;
+  }
+  return __n;
+#endif
+}
+
+/*
+ * Decimal exponent k of __f * 2^__e (i.e. 10^(k-1) <= v < 10^k), or k - 1:
+ * floor(m * log10(2)) + 1 for m = floor(log2(v)); 78913 / 2^18 give exact
+ * floor of m * log10(2) for |m| < 1650.
+ */
+inline int __estimate_k(uint64 __f, int __e)
+{
+  const int __t = (__e + __bit_length(__f) - 1) * 78913;
+  return (__t >= 0 ? __t >> 18 : -((-__t + (1 << 18) - 1) >> 18)) + 1;
+}
+
+const uint32 __pow10_32[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/*
+ * Non-negative big integer, as much as need for binary64: 2^1074 and
+ * 10^324 scaled by few powers of 2 and 10 fit into 1280 bits.
+ */
+class _Bignum
+{
+  public:
+    _Bignum() :
+        _M_n(0)
+      { }
+
+    void assign(uint64 __v)
+      {
+        for (_M_n = 0; __v != 0; __v >>= 32) {
+          _M_d[_M_n++] = static_cast<uint32>(__v);
+        }
+      }
+
+    bool is_zero() const
+      { return _M_n == 0; }
+
+    void shl(int __bits)
+      {
+        if (_M_n == 0) {
+          return;
+        }
+        const int __w = __bits / 32;
+        const int __b = __bits % 32;
+        if (__b != 0) {
+          _M_d[_M_n] = 0;
+          for (int __i = _M_n; __i > 0; --__i) {
+            _M_d[__i] = (_M_d[__i] << __b) | (_M_d[__i - 1] >> (32 - __b));
+          }
+          _M_d[0] <<= __b;
+          if (_M_d[_M_n] != 0) {
+            ++_M_n;
+          }
+        }
+        if (__w != 0) {
+          memmove(_M_d + __w, _M_d, _M_n * sizeof(uint32));
+          memset(_M_d, 0, __w * sizeof(uint32));
+          _M_n += __w;
+        }
+      }
+
+    void mul(uint32 __m)
+      {
+        uint64 __carry = 0;
+        for (int __i = 0; __i < _M_n; ++__i) {
+          __carry += static_cast<uint64>(_M_d[__i]) * __m;
+          _M_d[__i] = static_cast<uint32>(__carry);
+          __carry >>= 32;
+        }
+        if (__carry != 0) {
+          _M_d[_M_n++] = static_cast<uint32>(__carry);
+        }
+      }
+
+    void mul_pow10(int __k)
+      {
+        for ( ; __k >= 9; __k -= 9) {
+          mul(__pow10_32[9]);
+        }
+        if (__k > 0) {
+          mul(__pow10_32[__k]);
+        }
+      }
+
+    void add(const _Bignum& __b)
+      {
+        uint64 __carry = 0;
+        int __i = 0;
+        for ( ; __i < __b._M_n; ++__i) {
+          __carry += static_cast<uint64>(__i < _M_n ? _M_d[__i] : 0) + __b._M_d[__i];
+          _M_d[__i] = static_cast<uint32>(__carry);
+          __carry >>= 32;
+        }
+        for ( ; __carry != 0 && __i < _M_n; ++__i) {
+          __carry += _M_d[__i];
+          _M_d[__i] = static_cast<uint32>(__carry);
+          __carry >>= 32;
+        }
+        if (__i > _M_n) {
+          _M_n = __i;
+        }
+        if (__carry != 0) {
+          _M_d[_M_n++] = static_cast<uint32>(__carry);
+        }
+      }
+
+    // *this -= __q * __b; precondition: result is not negative
+    void sub_mul(const _Bignum& __b, uint32 __q)
+      {
+        uint64 __carry = 0;
+        uint32 __borrow = 0;
+        for (int __i = 0; __i < _M_n; ++__i) {
+          if (__i < __b._M_n) {
+            __carry += static_cast<uint64>(__b._M_d[__i]) * __q;
+          } else if (__carry == 0) {
+            if (__borrow == 0) {
+              break;
+            }
+          }
+          const uint64 __diff = static_cast<uint64>(_M_d[__i]) - static_cast<uint32>(__carry) - __borrow;
+          _M_d[__i] = static_cast<uint32>(__diff);
+          __borrow = static_cast<uint32>(__diff >> 32) & 1;
+          __carry >>= 32;
+        }
+        _M_trim();
+      }
+
+    /*
+     * Quotient of *this / __s, *this become remainder. Precondition:
+     * quotient is small (digit).
+     */
+    uint32 divmod(const _Bignum& __s)
+      {
+        uint32 __q = 0;
+        if (_M_n == __s._M_n + 1 || (_M_n == __s._M_n && _M_n != 0)) {
+          // quotient estimation, from top words, never above exact value
+          uint64 __top = _M_d[_M_n - 1];
+          if (_M_n != __s._M_n) {
+            __top = (__top << 32) | _M_d[_M_n - 2];
+          }
+          __q = static_cast<uint32>(__top / (static_cast<uint64>(__s._M_d[__s._M_n - 1]) + 1));
+          if (__q != 0) {
+            sub_mul(__s, __q);
+          }
+        }
+        while (compare(*this, __s) >= 0) {
+          sub_mul(__s, 1);
+          ++__q;
+        }
+        return __q;
+      }
+
+    static int compare(const _Bignum& __a, const _Bignum& __b)
+      {
+        if (__a._M_n != __b._M_n) {
+          return __a._M_n < __b._M_n ? -1 : 1;
+        }
+        for (int __i = __a._M_n; __i-- > 0; ) {
+          if (__a._M_d[__i] != __b._M_d[__i]) {
+            return __a._M_d[__i] < __b._M_d[__i] ? -1 : 1;
+          }
+        }
+        return 0;
+      }
+
+    // compare __a + __b with __c
+    static int compare_sum(const _Bignum& __a, const _Bignum& __b, const _Bignum& __c)
+      {
+        _Bignum __s(__a);
+        __s.add(__b);
+        return compare(__s, __c);
+      }
+
+  private:
+    void _M_trim()
+      {
+        while (_M_n > 0 && _M_d[_M_n - 1] == 0) {
+          --_M_n;
+        }
+      }
+
+    uint32 _M_d[40 + 1];
+    int _M_n;
+};
+
+/*
+ * Shortest digits by exact arithmetic (Burger & Dybvig free-format
+ * algorithm): r / s is v scaled to [0.1, 1), __mp and __mm are distances
+ * to upper and lower rounding boundaries, in the same scale. Boundaries
+ * itself round to v when mantissa is even (round half to even).
+ */
+int __bignum_shortest(const _Float_parts& __p, char* __buf, int* __decpt)
+{
+  const bool __even = (__p._M_f & 1) == 0;
+  const int __shift = __p._M_lower_closer ? 2 : 1;
+  _Bignum __r, __s, __mp, __mm;
+
+  __r.assign(__p._M_f);
+  __s.assign(1);
+  __mm.assign(1);
+  if (__p._M_e >= 0) {
+    __r.shl(__p._M_e + __shift);
+    __s.shl(__shift);
+    __mm.shl(__p._M_e);
+  } else {
+    __r.shl(__shift);
+    __s.shl(__shift - __p._M_e);
+  }
+  __mp = __mm;
+  if (__p._M_lower_closer) {
+    __mp.shl(1);
+  }
+
+  int __k = __estimate_k(__p._M_f, __p._M_e);
+  if (__k >= 0) {
+    __s.mul_pow10(__k);
+  } else {
+    __r.mul_pow10(-__k);
+    __mp.mul_pow10(-__k);
+    __mm.mul_pow10(-__k);
+  }
+  // upper boundary may be above next power of 10 too
+  for (;;) {
+    const int __c = _Bignum::compare_sum(__r, __mp, __s);
+    if (__even ? __c < 0 : __c <= 0) {
+      break;
+    }
+    __s.mul(10);
+    ++__k;
+  }
+
+  int __n = 0;
+  for (;;) {
+    __r.mul(10);
+    __mp.mul(10);
+    __mm.mul(10);
+    uint32 __d = __r.divmod(__s);
+    const int __cl = _Bignum::compare(__r, __mm);
+    const int __ch = _Bignum::compare_sum(__r, __mp, __s);
+    const bool __low = __even ? __cl <= 0 : __cl < 0;
+    const bool __high = __even ? __ch >= 0 : __ch > 0;
+    if (!__low && !__high) {
+      __buf[__n++] = static_cast<char>('0' + __d);
+      continue;
+    }
+    if (__low && __high) {
+      // both d and d + 1 are in interval: closest to v
+      _Bignum __r2(__r);
+      __r2.shl(1);
+      const int __c = _Bignum::compare(__r2, __s);
+      if (__c > 0 || (__c == 0 && (__d & 1) != 0)) {
+        ++__d;
+      }
+    } else if (__high) {
+      ++__d;
+    }
+    __buf[__n++] = static_cast<char>('0' + __d);
+    break;
+  }
+  __buf[__n] = 0;
+  *__decpt = __k;
+  return __n;
+}
+
+/*
+ * __count significant digits (precision mode) or digits down to 10^-__count
+ * (fixed mode) by exact arithmetic; last digit rounded half to even.
+ */
+int __bignum_digits(const _Float_parts& __p, bool __fixed, int __count, char* __buf, int* __decpt)
+{
+  _Bignum __r, __s;
+
+  __r.assign(__p._M_f);
+  __s.assign(1);
+  if (__p._M_e >= 0) {
+    __r.shl(__p._M_e);
+  } else {
+    __s.shl(-__p._M_e);
+  }
+  int __k = __estimate_k(__p._M_f, __p._M_e);
+  if (__k >= 0) {
+    __s.mul_pow10(__k);
+  } else {
+    __r.mul_pow10(-__k);
+  }
+  if (_Bignum::compare(__r, __s) >= 0) {
+    __s.mul(10);
+    ++__k;
+  }
+
+  const int __frac = __count;
+  if (__fixed) {
+    __count += __k;
+    if (__count <= 0) {
+      // v < 10^-__frac: 0 or 10^-__frac, v / 10^k in [0.1, 1)
+      bool __up = false;
+      if (__count == 0) {
+        __r.shl(1);
+        __up = _Bignum::compare(__r, __s) > 0;
+      }
+      __buf[0] = '1';
+      __buf[__up ? 1 : 0] = 0;
+      *__decpt = __up ? 1 - __frac : -__frac;
+      return __up ? 1 : 0;
+    }
+  }
+
+  int __n = 0;
+  for ( ; __n < __count && !__r.is_zero(); ++__n) {
+    __r.mul(10);
+    __buf[__n] = static_cast<char>('0' + __r.divmod(__s));
+  }
+  if (__n < __count) {
+    // exact
+    memset(__buf + __n, '0', __count - __n);
+  } else {
+    __r.shl(1);
+    const int __c = _Bignum::compare(__r, __s);
+    if (__c > 0 || (__c == 0 && ((__buf[__count - 1] - '0') & 1) != 0)) {
+      int __i = __count - 1;
+      for ( ; __i >= 0 && __buf[__i] == '9'; --__i) {
+        __buf[__i] = '0';
+      }
+      if (__i >= 0) {
+        ++__buf[__i];
+      } else {
+        // 99..9 -> 100..0; in fixed mode one digit more
+        __buf[0] = '1';
+        ++__k;
+        if (__fixed) {
+          __buf[__count++] = '0';
+        }
+      }
+    }
+  }
+  __buf[__count] = 0;
+  *__decpt = __k;
+  return __count;
+}
+
+/*
+ * Grisu: diy_fp is 64-bit significand with binary exponent, without
+ * hidden bit or special values. v is multiplied by cached power 10^mk,
+ * so that product is in [2^alpha, 2^gamma) after normalization
+ * (alpha = -60, gamma = -32); then integral part of it fit into 32 bits,
+ * and digits are generated by 32-bit and 64-bit integer arithmetic only.
+ */
+struct _Diy_fp
+{
+    uint64 f;
+    int e;
+};
+
+inline _Diy_fp __diy_fp(uint64 __f, int __e)
+{
+  _Diy_fp __r;
+  __r.f = __f;
+  __r.e = __e;
+  return __r;
+}
+
+// rounded upper 64 bits of product
+inline _Diy_fp __mul(const _Diy_fp& __x, const _Diy_fp& __y)
+{
+  const uint64 __m32 = ULL(0xffffffff);
+  const uint64 __a = __x.f >> 32;
+  const uint64 __b = __x.f & __m32;
+  const uint64 __c = __y.f >> 32;
+  const uint64 __d = __y.f & __m32;
+  const uint64 __ac = __a * __c;
+  const uint64 __bc = __b * __c;
+  const uint64 __ad = __a * __d;
+  const uint64 __bd = __b * __d;
+  uint64 __tmp = (__bd >> 32) + (__ad & __m32) + (__bc & __m32);
+  __tmp += 1U << 31;
+  return __diy_fp(__ac + (__ad >> 32) + (__bc >> 32) + (__tmp >> 32), __x.e + __y.e + 64);
+}
+
+inline _Diy_fp __normalize(_Diy_fp __x)
+{
+  const int __s = 64 - __bit_length(__x.f);
+  __x.f <<= __s;
+  __x.e -= __s;
+  return __x;
+}
+
+struct _Cached_power
+{
+    uint64 f;
+    short e;
+    short k;
+};
+
+// normalized approximation of 10^k, k = -348 + 8i, rounded to nearest
+const _Cached_power __cached_powers[] = {
+  { ULL(0xfa8fd5a0081c0288), -1220, -348 }, { ULL(0xbaaee17fa23ebf76), -1193, -340 },
+  { ULL(0x8b16fb203055ac76), -1166, -332 }, { ULL(0xcf42894a5dce35ea), -1140, -324 },
+  { ULL(0x9a6bb0aa55653b2d), -1113, -316 }, { ULL(0xe61acf033d1a45df), -1087, -308 },
+  { ULL(0xab70fe17c79ac6ca), -1060, -300 }, { ULL(0xff77b1fcbebcdc4f), -1034, -292 },
+  { ULL(0xbe5691ef416bd60c), -1007, -284 }, { ULL(0x8dd01fad907ffc3c), -980, -276 },
+  { ULL(0xd3515c2831559a83), -954, -268 }, { ULL(0x9d71ac8fada6c9b5), -927, -260 },
+  { ULL(0xea9c227723ee8bcb), -901, -252 }, { ULL(0xaecc49914078536d), -874, -244 },
+  { ULL(0x823c12795db6ce57), -847, -236 }, { ULL(0xc21094364dfb5637), -821, -228 },
+  { ULL(0x9096ea6f3848984f), -794, -220 }, { ULL(0xd77485cb25823ac7), -768, -212 },
+  { ULL(0xa086cfcd97bf97f4), -741, -204 }, { ULL(0xef340a98172aace5), -715, -196 },
+  { ULL(0xb23867fb2a35b28e), -688, -188 }, { ULL(0x84c8d4dfd2c63f3b), -661, -180 },
+  { ULL(0xc5dd44271ad3cdba), -635, -172 }, { ULL(0x936b9fcebb25c996), -608, -164 },
+  { ULL(0xdbac6c247d62a584), -582, -156 }, { ULL(0xa3ab66580d5fdaf6), -555, -148 },
+  { ULL(0xf3e2f893dec3f126), -529, -140 }, { ULL(0xb5b5ada8aaff80b8), -502, -132 },
+  { ULL(0x87625f056c7c4a8b), -475, -124 }, { ULL(0xc9bcff6034c13053), -449, -116 },
+  { ULL(0x964e858c91ba2655), -422, -108 }, { ULL(0xdff9772470297ebd), -396, -100 },
+  { ULL(0xa6dfbd9fb8e5b88f), -369, -92 }, { ULL(0xf8a95fcf88747d94), -343, -84 },
+  { ULL(0xb94470938fa89bcf), -316, -76 }, { ULL(0x8a08f0f8bf0f156b), -289, -68 },
+  { ULL(0xcdb02555653131b6), -263, -60 }, { ULL(0x993fe2c6d07b7fac), -236, -52 },
+  { ULL(0xe45c10c42a2b3b06), -210, -44 }, { ULL(0xaa242499697392d3), -183, -36 },
+  { ULL(0xfd87b5f28300ca0e), -157, -28 }, { ULL(0xbce5086492111aeb), -130, -20 },
+  { ULL(0x8cbccc096f5088cc), -103, -12 }, { ULL(0xd1b71758e219652c), -77, -4 },
+  { ULL(0x9c40000000000000), -50, 4 }, { ULL(0xe8d4a51000000000), -24, 12 },
+  { ULL(0xad78ebc5ac620000), 3, 20 }, { ULL(0x813f3978f8940984), 30, 28 },
+  { ULL(0xc097ce7bc90715b3), 56, 36 }, { ULL(0x8f7e32ce7bea5c70), 83, 44 },
+  { ULL(0xd5d238a4abe98068), 109, 52 }, { ULL(0x9f4f2726179a2245), 136, 60 },
+  { ULL(0xed63a231d4c4fb27), 162, 68 }, { ULL(0xb0de65388cc8ada8), 189, 76 },
+  { ULL(0x83c7088e1aab65db), 216, 84 }, { ULL(0xc45d1df942711d9a), 242, 92 },
+  { ULL(0x924d692ca61be758), 269, 100 }, { ULL(0xda01ee641a708dea), 295, 108 },
+  { ULL(0xa26da3999aef774a), 322, 116 }, { ULL(0xf209787bb47d6b85), 348, 124 },
+  { ULL(0xb454e4a179dd1877), 375, 132 }, { ULL(0x865b86925b9bc5c2), 402, 140 },
+  { ULL(0xc83553c5c8965d3d), 428, 148 }, { ULL(0x952ab45cfa97a0b3), 455, 156 },
+  { ULL(0xde469fbd99a05fe3), 481, 164 }, { ULL(0xa59bc234db398c25), 508, 172 },
+  { ULL(0xf6c69a72a3989f5c), 534, 180 }, { ULL(0xb7dcbf5354e9bece), 561, 188 },
+  { ULL(0x88fcf317f22241e2), 588, 196 }, { ULL(0xcc20ce9bd35c78a5), 614, 204 },
+  { ULL(0x98165af37b2153df), 641, 212 }, { ULL(0xe2a0b5dc971f303a), 667, 220 },
+  { ULL(0xa8d9d1535ce3b396), 694, 228 }, { ULL(0xfb9b7cd9a4a7443c), 720, 236 },
+  { ULL(0xbb764c4ca7a44410), 747, 244 }, { ULL(0x8bab8eefb6409c1a), 774, 252 },
+  { ULL(0xd01fef10a657842c), 800, 260 }, { ULL(0x9b10a4e5e9913129), 827, 268 },
+  { ULL(0xe7109bfba19c0c9d), 853, 276 }, { ULL(0xac2820d9623bf429), 880, 284 },
+  { ULL(0x80444b5e7aa7cf85), 907, 292 }, { ULL(0xbf21e44003acdd2d), 933, 300 },
+  { ULL(0x8e679c2f5e44ff8f), 960, 308 }, { ULL(0xd433179d9c8cb841), 986, 316 },
+  { ULL(0x9e19db92b4e31ba9), 1013, 324 }, { ULL(0xeb96bf6ebadf77d9), 1039, 332 },
+  { ULL(0xaf87023b9bf0ee6b), 1066, 340 }
+};
+
+const int __cached_powers_offset = 348;
+const int __cached_powers_step = 8;
+
+// alpha of Grisu; gamma is -32
+const int __min_target_exp = -60;
+
+/*
+ * Cached power 10^mk such that binary exponent of product with value of
+ * binary exponent __e (normalized) is in [alpha, gamma].
+ */
+inline _Diy_fp __cached_power(int __e, int* __mk)
+{
+  // k = ceil((alpha - e - 1) * log10(2)), same approximation as __estimate_k
+  const int __t = (__min_target_exp - (__e + 64) + 63) * 78913;
+  const int __k = (__t >= 0 ? __t >> 18 : -((-__t + (1 << 18) - 1) >> 18)) + 1;
+  const _Cached_power& __c = __cached_powers[(__cached_powers_offset + __k - 1) / __cached_powers_step + 1];
+  *__mk = __c.k;
+  return __diy_fp(__c.f, __c.e);
+}
+
+// biggest power of 10 not above __x (__x < 2^__bits), and its exponent + 1
+inline uint32 __biggest_pow10(uint32 __x, int __bits, int* __exp_plus_one)
+{
+  int __g = ((__bits + 1) * 1233 >> 12) + 1;
+  if (__g > 10) {
+    __g = 10;
+  }
+  while (__g > 0 && __x < __pow10_32[__g - 1]) {
+    --__g;
+  }
+  *__exp_plus_one = __g;
+  return __g == 0 ? 0 : __pow10_32[__g - 1];
+}
+
+/*
+ * Last digit of Grisu's shortest output: move it to w as close as
+ * possible, and check that result is provably in rounding interval and
+ * closest to v (otherwise Grisu give up, about 0.5% of doubles).
+ */
+bool __round_weed(char* __buf, int __len, uint64 __dist_high_w, uint64 __unsafe_interval,
+                  uint64 __rest, uint64 __ten_kappa, uint64 __unit)
+{
+  const uint64 __small_dist = __dist_high_w - __unit;
+  const uint64 __big_dist = __dist_high_w + __unit;
+  while (__rest < __small_dist && __unsafe_interval - __rest >= __ten_kappa &&
+         (__rest + __ten_kappa < __small_dist ||
+          __small_dist - __rest >= __rest + __ten_kappa - __small_dist)) {
+    --__buf[__len - 1];
+    __rest += __ten_kappa;
+  }
+  if (__rest < __big_dist && __unsafe_interval - __rest >= __ten_kappa &&
+      (__rest + __ten_kappa < __big_dist ||
+       __big_dist - __rest > __rest + __ten_kappa - __big_dist)) {
+    return false;
+  }
+  return 2 * __unit <= __rest && __rest <= __unsafe_interval - 4 * __unit;
+}
+
+bool __grisu_shortest(const _Float_parts& __p, char* __buf, int* __len, int* __decpt)
+{
+  const _Diy_fp __w = __normalize(__diy_fp(__p._M_f, __p._M_e));
+  const _Diy_fp __high = __normalize(__diy_fp((__p._M_f << 1) + 1, __p._M_e - 1));
+  _Diy_fp __low = __p._M_lower_closer ? __diy_fp((__p._M_f << 2) - 1, __p._M_e - 2)
+                                      : __diy_fp((__p._M_f << 1) - 1, __p._M_e - 1);
+  __low.f <<= __low.e - __high.e;
+  __low.e = __high.e;
+
+  int __mk;
+  const _Diy_fp __c = __cached_power(__w.e, &__mk);
+  const _Diy_fp __sw = __mul(__w, __c);
+  const _Diy_fp __slow = __mul(__low, __c);
+  const _Diy_fp __shigh = __mul(__high, __c);
+
+  // boundaries are inexact (by one unit): generate digits for widest
+  // interval, then check that result is in narrowest one
+  uint64 __unit = 1;
+  const uint64 __too_low = __slow.f - __unit;
+  const uint64 __too_high = __shigh.f + __unit;
+  uint64 __unsafe_interval = __too_high - __too_low;
+  const int __shift = -__sw.e;
+  const uint64 __one = ULL(1) << __shift;
+  uint32 __integrals = static_cast<uint32>(__too_high >> __shift);
+  uint64 __fractionals = __too_high & (__one - 1);
+  int __kappa;
+  uint32 __divisor = __biggest_pow10(__integrals, 64 - __shift, &__kappa);
+  int __n = 0;
+
+  while (__kappa > 0) {
+    __buf[__n++] = static_cast<char>('0' + __integrals / __divisor);
+    __integrals %= __divisor;
+    --__kappa;
+    const uint64 __rest = (static_cast<uint64>(__integrals) << __shift) + __fractionals;
+    if (__rest < __unsafe_interval) {
+      *__len = __n;
+      *__decpt = __n - __mk + __kappa;
+      return __round_weed(__buf, __n, __too_high - __sw.f, __unsafe_interval, __rest,
+                          static_cast<uint64>(__divisor) << __shift, __unit);
+    }
+    __divisor /= 10;
+  }
+  for (;;) {
+    __fractionals *= 10;
+    __unit *= 10;
+    __unsafe_interval *= 10;
+    __buf[__n++] = static_cast<char>('0' + (__fractionals >> __shift));
+    __fractionals &= __one - 1;
+    --__kappa;
+    if (__fractionals < __unsafe_interval) {
+      *__len = __n;
+      *__decpt = __n - __mk + __kappa;
+      return __round_weed(__buf, __n, (__too_high - __sw.f) * __unit, __unsafe_interval,
+                          __fractionals, __one, __unit);
+    }
+  }
+}
+
+/*
+ * Round up counted digits if rest (in units of ten_kappa) is above half,
+ * provided error __unit can't change decision.
+ */
+bool __round_weed_counted(char* __buf, int __len, uint64 __rest, uint64 __ten_kappa,
+                          uint64 __unit, int* __kappa)
+{
+  if (__unit >= __ten_kappa || __ten_kappa - __unit <= __unit) {
+    return false;
+  }
+  if (__ten_kappa - __rest > __rest && __ten_kappa - 2 * __rest >= 2 * __unit) {
+    return true;
+  }
+  if (__rest > __unit && __ten_kappa - (__rest - __unit) <= (__rest - __unit)) {
+    ++__buf[__len - 1];
+    for (int __i = __len - 1; __i > 0 && __buf[__i] == '0' + 10; --__i) {
+      __buf[__i] = '0';
+      ++__buf[__i - 1];
+    }
+    if (__buf[0] == '0' + 10) {
+      __buf[0] = '1';
+      ++*__kappa;
+    }
+    return true;
+  }
+  return false;
+}
+
+// exactly __count digits, correctly rounded, or false
+bool __grisu_counted(const _Float_parts& __p, int __count, char* __buf, int* __decpt)
+{
+  const _Diy_fp __w = __normalize(__diy_fp(__p._M_f, __p._M_e));
+  int __mk;
+  const _Diy_fp __sw = __mul(__w, __cached_power(__w.e, &__mk));
+
+  uint64 __error = 1;
+  const int __shift = -__sw.e;
+  const uint64 __one = ULL(1) << __shift;
+  uint32 __integrals = static_cast<uint32>(__sw.f >> __shift);
+  uint64 __fractionals = __sw.f & (__one - 1);
+  int __kappa;
+  uint32 __divisor = __biggest_pow10(__integrals, 64 - __shift, &__kappa);
+  int __n = 0;
+  bool __ok;
+
+  while (__kappa > 0) {
+    __buf[__n++] = static_cast<char>('0' + __integrals / __divisor);
+    __integrals %= __divisor;
+    --__kappa;
+    if (__n == __count) {
+      break;
+    }
+    __divisor /= 10;
+  }
+  if (__n == __count) {
+    __ok = __round_weed_counted(__buf, __n, (static_cast<uint64>(__integrals) << __shift) + __fractionals,
+                                static_cast<uint64>(__divisor) << __shift, __error, &__kappa);
+  } else {
+    while (__n < __count && __fractionals > __error) {
+      __fractionals *= 10;
+      __error *= 10;
+      __buf[__n++] = static_cast<char>('0' + (__fractionals >> __shift));
+      __fractionals &= __one - 1;
+      --__kappa;
+    }
+    __ok = __n == __count && __round_weed_counted(__buf, __n, __fractionals, __one, __error, &__kappa);
+  }
+  *__decpt = __n - __mk + __kappa;
+  return __ok;
+}
+
+template <class _Tp>
+int __shortest(_Tp __x, char* __buf, int* __decpt)
+{
+  const _Float_parts __p = __decompose(__x);
+  if (__p._M_f == 0) {
+    __buf[0] = '0';
+    __buf[1] = 0;
+    *__decpt = 1;
+    return 1;
+  }
+  int __n;
+  if (__grisu_shortest(__p, __buf, &__n, __decpt)) {
+    __buf[__n] = 0;
+    return __n;
+  }
+  return __bignum_shortest(__p, __buf, __decpt);
+}
+
+} // namespace
+
+int __float_digits_shortest(double __x, char* __buf, int* __decpt)
+{ return __shortest(__x, __buf, __decpt); }
+
+int __float_digits_shortest(float __x, char* __buf, int* __decpt)
+{ return __shortest(__x, __buf, __decpt); }
+
+int __float_digits_precision(double __x, int __n, char* __buf, int* __decpt)
+{
+  const _Float_parts __p = __decompose(__x);
+  if (__p._M_f == 0) {
+    memset(__buf, '0', __n);
+    __buf[__n] = 0;
+    *__decpt = 1;
+    return __n;
+  }
+  // beyond 17 digits Grisu fail anyway
+  if (__n <= 17 && __grisu_counted(__p, __n, __buf, __decpt)) {
+    __buf[__n] = 0;
+    return __n;
+  }
+  return __bignum_digits(__p, false, __n, __buf, __decpt);
+}
+
+int __float_digits_fixed(double __x, int __n, char* __buf, int* __decpt)
+{
+  const _Float_parts __p = __decompose(__x);
+  if (__p._M_f == 0) {
+    __buf[0] = 0;
+    *__decpt = -__n;
+    return 0;
+  }
+  /* Number of significant digits depends on decimal exponent, that is
+   * known up to one here: try both, result is good if position of last
+   * digit is 10^-__n. Rounding up to power of 10 move this position, so
+   * such values go to exact arithmetic, as well as tiny values (that has
+   * no significant digits).
+   */
+  const int __k = __estimate_k(__p._M_f, __p._M_e);
+  for (int __count = __k + __n; __count <= __k + __n + 1; ++__count) {
+    if (__count < 1 || __count > 17) {
+      continue;
+    }
+    if (__grisu_counted(__p, __count, __buf, __decpt) && *__decpt + __n == __count) {
+      __buf[__count] = 0;
+      return __count;
+    }
+  }
+  return __bignum_digits(__p, true, __n, __buf, __decpt);
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef FLOAT_DIGITS_H
+#define FLOAT_DIGITS_H
+
+/*
+ * Binary to decimal conversion of IEEE 754 binary64 (double) and binary32
+ * (float) values, without libc and without locale.
+ *
+ * All functions write decimal digits of |x| into __buf, '\0' terminated,
+ * and return number of digits; value is 0.d1d2...dn * 10^(*__decpt).
+ * Sign, NaN and infinity are not handled here: caller check it before.
+ *
+ * Digits are produced by Grisu (Loitsch, "Printing floating-point numbers
+ * quickly and accurately with integers", PLDI 2010) for most of values;
+ * when Grisu can't guarantee result, exact bignum arithmetic is used
+ * (Dragon4, Steele & White / Burger & Dybvig), so result always correct.
+ */
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// max number of digits for __float_digits_fixed, without trailing '\0'
+#define _STLP_FLOAT_DIGITS_FIXED_MAX(__n) (309 + (__n) + 1)
+
+/*
+ * Shortest digits string that read back (round to nearest) give __x;
+ * if there are few of such strings, one that closest to __x.
+ * At most 17 (9 for float) digits; zero is "0" with decpt 1.
+ */
+int __float_digits_shortest(double __x, char* __buf, int* __decpt);
+int __float_digits_shortest(float __x, char* __buf, int* __decpt);
+
+/*
+ * Exactly __n (> 0) significant digits, correctly rounded (ties to even),
+ * like ecvt; zero is __n '0' with decpt 1.
+ */
+int __float_digits_precision(double __x, int __n, char* __buf, int* __decpt);
+
+/*
+ * Digits down to 10^-__n (__n >= 0), correctly rounded (ties to even),
+ * like fcvt: no leading zeros, so if value round to zero result is empty
+ * string (with decpt -__n). Buffer should have place for
+ * _STLP_FLOAT_DIGITS_FIXED_MAX(__n) + 1 chars.
+ */
+int __float_digits_fixed(double __x, int __n, char* __buf, int* __decpt);
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* FLOAT_DIGITS_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -28,22 +28,39 @@
 #  error "Can't recognize IO scheme to use"
 #endif
 
+#if defined (_STLP_THREADS)
+#  include <cstring>
+#  include <mutex>
+#  include <condition_variable>
+#  include <thread>
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 // fbp : let us map 1 MB maximum, just be sure not to trash VM
 #define MMAP_CHUNK 0x100000L
 
+// Default window: 64 MB where address space is large, MMAP_CHUNK otherwise.
+// Whole file may be mapped up to 1 TB there, up to 256 MB otherwise.
+#define MMAP_WINDOW (sizeof(void*) >= 8 ? 0x4000000L : MMAP_CHUNK)
+#define MMAP_WHOLE_MAX (streamoff(0x10000000L) << (sizeof(void*) >= 8 && sizeof(streamoff) >= 8 ? 12 : 0))
+
+// Windows of at least two huge pages start at huge page boundary, so
+// that system may back them with huge pages.
+#define MMAP_HUGE_PAGE 0x200000L
+
 _Underflow< char, char_traits<char> >::int_type _STLP_CALL
 _Underflow< char, char_traits<char> >::_M_doit(basic_filebuf<char, char_traits<char> >* __this)
 {
   typedef char_traits<char> traits_type;
   typedef traits_type::int_type int_type;
+  typedef basic_filebuf<char, char_traits<char> > _Filebuf;
 
-  if ( (__this->int_flags_ & basic_filebuf<char, char_traits<char> >::_in_input_mode) == 0 ) {
+  if ( (__this->int_flags_ & _Filebuf::_in_input_mode) == 0 ) {
     if ( !__this->_M_switch_to_input_mode() ) {
       return traits_type::eof();
     }
-  } else if ( __this->int_flags_ & basic_filebuf<char, char_traits<char> >::_in_putback_mode ) {
+  } else if ( __this->int_flags_ & _Filebuf::_in_putback_mode ) {
     __this->_M_exit_putback_mode();
     if (__this->gptr() != __this->egptr()) {
       int_type __c = traits_type::to_int_type(*__this->gptr());
@@ -55,43 +72,299 @@ _Underflow< char, char_traits<char> >::_M_doit(basic_filebuf<char, char_traits<c
   // sequences are guaranteed to be identical, then try to use memory
   // mapped I/O.  Otherwise, revert to ordinary read.
   if (__this->_M_base.__regular_file()
-      && ((__this->int_flags_ & basic_filebuf<char, char_traits<char> >::_always_noconv) != 0)
-      && __this->_M_base._M_in_binary_mode()) {
+      && ((__this->int_flags_ & _Filebuf::_always_noconv) != 0)
+      && __this->_M_base._M_in_binary_mode()
+      && ((__this->_M_mmap_policy & (_Filebuf::mmap_window | _Filebuf::mmap_whole)) != 0)) {
     // If we've mmapped part of the file already, then unmap it.
-    if (__this->_M_mmap_base)
+    if (__this->_M_mmap_base) {
       __this->_M_base._M_unmap(__this->_M_mmap_base, __this->_M_mmap_len);
+      __this->_M_mmap_base = 0;
+      __this->_M_mmap_len = 0;
+    }
 
-    // Determine the position where we start mapping.  It has to be
-    // a multiple of the page size.
     streamoff __cur = __this->_M_base._M_seek(0, ios_base::cur);
     streamoff __size = __this->_M_base._M_file_size();
     if (__size > 0 && __cur >= 0 && __cur < __size) {
-      streamoff __offset = (__cur / __this->_M_base.__page_size()) * __this->_M_base.__page_size();
-      streamoff __remainder = __cur - __offset;
+      const streamoff __page = __this->_M_base.__page_size();
+      const streamoff __huge = (MMAP_HUGE_PAGE % __page) == 0 ? MMAP_HUGE_PAGE : __page;
+      streamoff __offset = 0;
+      streamoff __len = __size;
+      void* __base = 0;
 
-      __this->_M_mmap_len = __size - __offset;
+      if ((__this->_M_mmap_policy & _Filebuf::mmap_whole) && __size <= MMAP_WHOLE_MAX) {
+        __base = __this->_M_base._M_mmap(__offset, __len);
+      }
+
+      // Otherwise window: __window bytes starting at current position,
+      // mapping itself starts at page (or huge page) boundary.
+      if (__base == 0) {
+        streamoff __window = __this->_M_mmap_window > 0 ? __this->_M_mmap_window : MMAP_WINDOW;
+        streamoff __align = __window >= 2 * __huge ? __huge : __page;
+        __offset = (__cur / __align) * __align;
+        __len = (__cur - __offset) + __window;
+        if (__len > __size - __offset)
+          __len = __size - __offset;
+        __base = __this->_M_base._M_mmap(__offset, __len);
+      }
 
-      if (__this->_M_mmap_len > MMAP_CHUNK)
-        __this->_M_mmap_len = MMAP_CHUNK;
+      if (__base != 0) {
+        __this->_M_mmap_base = __base;
+        __this->_M_mmap_len = __len;
+        __this->_M_mmap_offset = __offset;
+        char* __b = __STATIC_CAST(char*, __base);
+        __this->setg(__b, __b + __STATIC_CAST(ptrdiff_t, __cur - __offset),
+                     __b + __STATIC_CAST(ptrdiff_t, __len));
 
-      if ((__this->_M_mmap_base = __this->_M_base._M_mmap(__offset, __this->_M_mmap_len)) != 0) {
-        __this->setg(__STATIC_CAST(char*, __this->_M_mmap_base),
-                     __STATIC_CAST(char*, __this->_M_mmap_base) + __STATIC_CAST(ptrdiff_t, __remainder),
-                     __STATIC_CAST(char*, __this->_M_mmap_base) + __STATIC_CAST(ptrdiff_t, __this->_M_mmap_len));
+        // Hints: read-ahead of window from current position on, unless
+        // access is random.
+        int __advice = (__this->_M_mmap_policy & _Filebuf::mmap_random) ?
+          _Filebuf_base::_S_adv_random : _Filebuf_base::_S_adv_sequential;
+        if (__huge != __page && __len >= 2 * __huge)
+          __advice |= _Filebuf_base::_S_adv_hugepage;
+        __this->_M_base._M_advise(__base, __len, __advice);
+        if ((__this->_M_mmap_policy & _Filebuf::mmap_random) == 0) {
+          streamoff __ahead = ((__cur - __offset) / __page) * __page;
+          streamoff __n = __len - __ahead;
+          if (__n > MMAP_WINDOW)
+            __n = MMAP_WINDOW;
+          __this->_M_base._M_advise(__b + __STATIC_CAST(ptrdiff_t, __ahead), __n,
+                                    _Filebuf_base::_S_adv_willneed);
+        }
         return traits_type::to_int_type(*__this->gptr());
       }
-      else
-        __this->_M_mmap_len = 0;
-    }
-    else {
-      __this->_M_mmap_base = 0;
-      __this->_M_mmap_len = 0;
     }
   }
 
   return __this->_M_underflow_aux();
 }
 
+//----------------------------------------------------------------------
+// Write-behind.
+//
+// Ring of buffers: writer thread takes buffers queued by filebuf, starting
+// from _M_head, and writes them with _Filebuf_base::_M_write; filebuf fills
+// buffer that follows queued ones.  Only one thread (filebuf's owner)
+// puts data.  When all buffers are queued, filebuf waits for free one.
+// Write error is sticky: later data are dropped, and error is reported
+// by next _M_queue_write or _M_drain_writer.
+
+#define WRITER_BUFSIZE 0x100000L
+
+#if defined (_STLP_THREADS)
+
+class _Filebuf_writer
+{
+  public:
+    _Filebuf_writer( _Filebuf_base& __f, size_t __nbufs, size_t __bufsize ) :
+        _M_file( __f ),
+        _M_nbufs( __nbufs ),
+        _M_bufsize( __bufsize ),
+        _M_mem( new char[__nbufs * __bufsize] ),
+        _M_len( 0 ),
+        _M_head( 0 ),
+        _M_queued( 0 ),
+        _M_cur( 0 ),
+        _M_fill( 0 ),
+        _M_error( false ),
+        _M_stop( false ),
+        _M_thread( 0 )
+      {
+        _STLP_TRY {
+          _M_len = new size_t[__nbufs];
+        }
+        _STLP_UNWIND( delete [] _M_mem )
+      }
+
+    // stop writer thread; everything queued is written before
+    ~_Filebuf_writer()
+      {
+        if ( _M_thread != 0 ) {
+          {
+            lock_guard<mutex> __lk( _M_lock );
+            _M_stop = true;
+            _M_work.notify_one();
+          }
+          _M_thread->join();
+          delete _M_thread;
+        }
+        delete [] _M_len;
+        delete [] _M_mem;
+      }
+
+    bool start();
+    bool put( const char* __s, size_t __n );
+    bool drain();
+
+  private:
+    static void _S_run( _Filebuf_writer* );
+    void _M_queue();
+
+    _Filebuf_base& _M_file;
+    const size_t _M_nbufs;
+    const size_t _M_bufsize;
+    char* _M_mem;
+    size_t* _M_len;     // bytes in queued buffers
+
+    size_t _M_head;     // oldest queued buffer
+    size_t _M_queued;   // queued buffers, including one that is written now
+    size_t _M_cur;      // buffer filled by filebuf (used by put only)
+    size_t _M_fill;     // bytes in _M_cur (used by put only)
+    bool _M_error;
+    bool _M_stop;
+
+    mutex _M_lock;
+    condition_variable _M_work; // writer waits for queued buffers
+    condition_variable _M_room; // filebuf waits for free buffer or drain
+    thread* _M_thread;
+};
+
+bool _Filebuf_writer::start()
+{
+  _STLP_TRY {
+    _M_thread = new thread( &_Filebuf_writer::_S_run, this );
+  }
+  _STLP_CATCH_ALL { // system_error: no resources for thread
+    _M_thread = 0;
+    return false;
+  }
+  if ( !_M_thread->joinable() ) { // thread wasn't created
+    delete _M_thread;
+    _M_thread = 0;
+    return false;
+  }
+  return true;
+}
+
+// pass current buffer to writer
+void _Filebuf_writer::_M_queue()
+{
+  lock_guard<mutex> __lk( _M_lock );
+  _M_len[_M_cur] = _M_fill;
+  ++_M_queued;
+  _M_fill = 0;
+  _M_work.notify_one();
+}
+
+bool _Filebuf_writer::put( const char* __s, size_t __n )
+{
+  while ( __n != 0 ) {
+    if ( _M_fill == 0 ) {
+      // take buffer that follows queued ones, when there is such
+      unique_lock<mutex> __lk( _M_lock );
+      while ( _M_queued == _M_nbufs && !_M_error ) {
+        _M_room.wait( __lk );
+      }
+      if ( _M_error ) {
+        return false;
+      }
+      _M_cur = (_M_head + _M_queued) % _M_nbufs;
+    }
+    size_t __k = _M_bufsize - _M_fill;
+    if ( __k > __n ) {
+      __k = __n;
+    }
+    memcpy( _M_mem + _M_cur * _M_bufsize + _M_fill, __s, __k );
+    _M_fill += __k;
+    __s += __k;
+    __n -= __k;
+    if ( _M_fill == _M_bufsize ) {
+      _M_queue();
+    }
+  }
+  return true;
+}
+
+bool _Filebuf_writer::drain()
+{
+  if ( _M_fill != 0 ) {
+    _M_queue();
+  }
+  unique_lock<mutex> __lk( _M_lock );
+  while ( _M_queued != 0 ) {
+    _M_room.wait( __lk );
+  }
+  return !_M_error;
+}
+
+void _Filebuf_writer::_S_run( _Filebuf_writer* __w )
+{
+  unique_lock<mutex> __lk( __w->_M_lock );
+  for ( ; ; ) {
+    while ( __w->_M_queued == 0 && !__w->_M_stop ) {
+      __w->_M_work.wait( __lk );
+    }
+    if ( __w->_M_queued == 0 ) { // stop, and nothing to write
+      break;
+    }
+    size_t __i = __w->_M_head;
+    bool __skip = __w->_M_error;
+    __lk.unlock();
+    bool __ok = __skip || __w->_M_file._M_write( __w->_M_mem + __i * __w->_M_bufsize,
+                                                 static_cast<ptrdiff_t>(__w->_M_len[__i]) );
+    __lk.lock();
+    if ( !__ok ) {
+      __w->_M_error = true;
+    }
+    __w->_M_head = (__i + 1) % __w->_M_nbufs;
+    --__w->_M_queued;
+    __w->_M_room.notify_one();
+  }
+}
+
+// Failure to start writer isn't an error: output stays synchronous,
+// so exceptions from here must not reach the caller.
+bool _Filebuf_base::_M_start_writer(size_t __nbufs, size_t __bufsize)
+{
+  _Filebuf_writer* __w = 0;
+  _STLP_TRY {
+    __w = new _Filebuf_writer(*this, __nbufs, __bufsize != 0 ? __bufsize : WRITER_BUFSIZE);
+  }
+  _STLP_CATCH_ALL { // bad_alloc for buffers
+    return false;
+  }
+  if (!__w->start()) {
+    delete __w;
+    return false;
+  }
+  _M_writer = __w;
+  return true;
+}
+
+bool _Filebuf_base::_M_queue_write(const char* __buf, ptrdiff_t __n)
+{
+  return _M_writer->put(__buf, static_cast<size_t>(__n));
+}
+
+bool _Filebuf_base::_M_drain_writer(bool __durable)
+{
+  bool __ok = _M_writer->drain();
+  return __durable ? _M_sync_file() && __ok : __ok;
+}
+
+bool _Filebuf_base::_M_stop_writer()
+{
+  bool __ok = _M_drain_writer(true);
+  delete _M_writer;
+  _M_writer = 0;
+  return __ok;
+}
+
+#else /* _STLP_THREADS */
+
+bool _Filebuf_base::_M_start_writer(size_t, size_t)
+{ return false; }
+
+bool _Filebuf_base::_M_queue_write(const char* __buf, ptrdiff_t __n)
+{ return _M_write(__CONST_CAST(char*, __buf), __n); }
+
+bool _Filebuf_base::_M_drain_writer(bool __durable)
+{ return __durable ? _M_sync_file() : true; }
+
+bool _Filebuf_base::_M_stop_writer()
+{ return true; }
+
+#endif /* _STLP_THREADS */
+
 //----------------------------------------------------------------------
 // Force instantiation of filebuf and fstream classes.
 #if !defined(_STLP_NO_FORCE_INSTANTIATE)
@@ -79,6 +79,33 @@ public:
       :"edi", "memory", "cc");
   }
 
+  /**
+   * Atomically pushes the chain of items [__first, __last] onto the freelist
+   * in one step; items in between are linked by _M_next already.
+   *
+   * @param __first [in] Item that becomes the front of the list
+   * @param __last  [in] Last item of the chain
+   */
+  void push_list(item* __first, item* __last) {
+    // Same as push, but ebx (new top) is __first and the old top goes
+    // to __last->_M_next; edi holds __last, so ebx is spilled to stack.
+    int __tmp1;
+    int __tmp2;
+    int __tmp3;
+    int __tmp4;
+    __asm__ __volatile__
+      ("       xchgl      %%ebx, %%ecx\n\t"
+       "       pushl      %%ecx\n\t"
+       "L1_%=: movl       %%eax, (%%edi)\n\t"     // __last._M_next = _M._M_data._M_top
+       "       leal       1(%%edx),%%ecx\n\t"     // new sequence = _M._M_data._M_sequence + 1
+       "lock;  cmpxchg8b  (%%esi)\n\t"
+       "       jne        L1_%=\n\t"              // Failed, retry! (edx:eax now contain most recent _M_sequence:_M_top)
+       "       popl       %%ebx"
+      :"=a" (__tmp1), "=d" (__tmp2), "=c" (__tmp3), "=D" (__tmp4)
+      :"a" (_M._M_data._M_top), "d" (_M._M_data._M_sequence), "c" (__first), "D" (__last), "S" (&_M._M_data)
+      :"memory", "cc");
+  }
+
   /**
    * Atomically removes the topmost item from the freelist and returns a
    * pointer to it.  Returns NULL if the list is empty.
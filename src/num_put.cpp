@@ -121,6 +121,20 @@ _STLP_DECLSPEC const char* _STLP_CALL __hex_char_table_lo()
 _STLP_DECLSPEC const char* _STLP_CALL __hex_char_table_hi()
 { return "0123456789ABCDEFX"; }
 
+_STLP_DECLSPEC const char* _STLP_CALL __two_digits_table()
+{
+  return "00010203040506070809"
+         "10111213141516171819"
+         "20212223242526272829"
+         "30313233343536373839"
+         "40414243444546474849"
+         "50515253545556575859"
+         "60616263646566676869"
+         "70717273747576777879"
+         "80818283848586878889"
+         "90919293949596979899";
+}
+
 char* _STLP_CALL
 __write_integer(char* buf, ios_base::fmtflags flags, long x) {
   char tmp[64];
@@ -82,6 +82,10 @@
 #endif
 
 #include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include "float_digits.h"
 
 #if defined (__DMC__)
 #  define snprintf _snprintf
@@ -457,6 +461,8 @@ static char* _Stl_fcvtR(long double x, int n, int* pt, int* sign, char* buf) {
 }
 #endif
 
+#endif // !USE_SPRINTF_INSTEAD
+
 //----------------------------------------------------------------------
 // num_put
 
@@ -566,7 +572,20 @@ static size_t __format_float_fixed( __iostring &buf, const char *bp,
   return __group_pos;
 }
 
-#if defined (_STLP_USE_SIGN_HELPER)
+static size_t __put_nan_or_inf(__iostring& buf, bool is_inf, bool is_neg, ios_base::fmtflags flags) {
+  static const char* inf[2] = { "inf", "Inf" };
+  static const char* nan[2] = { "nan", "NaN" };
+  if (is_neg)
+    buf += '-';
+  else if (flags & ios_base::showpos)
+    buf += '+';
+  size_t ret = buf.size();
+  buf += (is_inf ? inf : nan)[flags & ios_base::uppercase ? 1 : 0];
+  return ret;
+}
+
+#if !defined (USE_SPRINTF_INSTEAD)
+#  if defined (_STLP_USE_SIGN_HELPER)
 template<class _FloatT>
 struct float_sign_helper {
   float_sign_helper(_FloatT __x)
@@ -587,50 +606,28 @@ private:
   unsigned short get_word_lower() const _STLP_NOTHROW
   { return _M_number._Words[(sizeof(_FloatT) >= 12 ? 10 : sizeof(_FloatT)) / sizeof(unsigned short) - 1]; }
   unsigned short get_sign_word() const _STLP_NOTHROW
-#  if defined (_STLP_BIG_ENDIAN)
+#    if defined (_STLP_BIG_ENDIAN)
   { return get_word_higher(); }
-#  else /* _STLP_LITTLE_ENDIAN */
+#    else /* _STLP_LITTLE_ENDIAN */
   { return get_word_lower(); }
-#  endif
+#    endif
 };
-#endif
+#  endif
 
 template <class _FloatT>
 static size_t __format_nan_or_inf(__iostring& buf, _FloatT x, ios_base::fmtflags flags) {
-  static const char* inf[2] = { "inf", "Inf" };
-  static const char* nan[2] = { "nan", "NaN" };
-  const char** inf_or_nan;
-#if !defined (_STLP_USE_SIGN_HELPER)
-  if (_Stl_is_inf(x)) {            // Infinity
-    inf_or_nan = inf;
-    if (_Stl_is_neg_inf(x))
-      buf += '-';
-    else if (flags & ios_base::showpos)
-      buf += '+';
-  } else {                      // NaN
-    inf_or_nan = nan;
-    if (_Stl_is_neg_nan(x))
-      buf += '-';
-    else if (flags & ios_base::showpos)
-      buf += '+';
-  }
-#else
+#  if !defined (_STLP_USE_SIGN_HELPER)
+  if (_Stl_is_inf(x))              // Infinity
+    return __put_nan_or_inf(buf, true, _Stl_is_neg_inf(x), flags);
+  return __put_nan_or_inf(buf, false, _Stl_is_neg_nan(x), flags);
+#  else
   typedef numeric_limits<_FloatT> limits;
-  if (x == limits::infinity() || x == -limits::infinity()) {
-    inf_or_nan = inf;
-  } else {                    // NaN
-    inf_or_nan = nan;
-  }
   float_sign_helper<_FloatT> helper(x);
-  if (helper.is_negative())
-    buf += '-';
-  else if (flags & ios_base::showpos)
-    buf += '+';
-#endif
-  size_t ret = buf.size();
-  buf += inf_or_nan[flags & ios_base::uppercase ? 1 : 0];
-  return ret;
+  return __put_nan_or_inf(buf, x == limits::infinity() || x == -limits::infinity(),
+                          helper.is_negative(), flags);
+#  endif
 }
+#endif // !USE_SPRINTF_INSTEAD
 
 static inline size_t __format_float(__iostring &buf, const char * bp,
                                     int decpt, int sign, bool is_zero,
@@ -680,8 +677,6 @@ static inline size_t __format_float(__iostring &buf, const char * bp,
   return __group_pos;
 }
 
-#endif
-
 #if defined (USE_SPRINTF_INSTEAD) || defined (_STLP_EMULATE_LONG_DOUBLE_CVT)
 struct GroupPos {
   bool operator () (char __c) const {
@@ -803,9 +798,59 @@ static size_t  __write_floatT(__iostring &buf, ios_base::fmtflags flags, int pre
 #endif
 }
 
+static inline bool __is_negative(double x) {
+  unsigned char bytes[sizeof(double)];
+  memcpy(bytes, &x, sizeof(double));
+#if defined (_STLP_BIG_ENDIAN)
+  return (bytes[0] & 0x80) != 0;
+#else
+  return (bytes[sizeof(double) - 1] & 0x80) != 0;
+#endif
+}
+
+/* IEEE 754 double: digits come from __float_digits_* (float_digits.cpp),
+ * correctly rounded, reentrant and without platform conversion functions.
+ * Number of digits is limited as in __write_floatT; in scientific notation
+ * precision is number of digits after decimal point.
+ */
+static size_t __write_double(__iostring &buf, ios_base::fmtflags flags, int precision,
+                             double x) {
+  typedef numeric_limits<double> limits;
+  if (!(x == x) || x == limits::infinity() || x == -limits::infinity()) {
+    return __put_nan_or_inf(buf, x == x, __is_negative(x), flags);
+  }
+
+  char digits[_STLP_FLOAT_DIGITS_FIXED_MAX(-limits::min_exponent10 + limits::digits10 + 2) + 1];
+  int decpt;
+
+  switch (flags & ios_base::floatfield) {
+  case ios_base::fixed:
+    {
+      int digits10 = (x > -1.0 && x < 1.0 ? -limits::min_exponent10 + limits::digits10 + 2
+                                          : limits::digits10 + 2);
+      __float_digits_fixed(x, (max) (0, (min) (precision, digits10)), digits, &decpt);
+    }
+    break;
+  case ios_base::scientific:
+    __float_digits_precision(x, (max) (0, (min) (precision, limits::digits10 + 1)) + 1, digits, &decpt);
+    break;
+  default:
+    {
+      // default precision as established by __format_float
+      int digits10 = (flags & ios_base::showpoint || precision > 0) ? (max) (precision, 1) : 6;
+      __float_digits_precision(x, (min) (digits10, limits::digits10 + 2), digits, &decpt);
+    }
+    break;
+  }
+  return __format_float(buf, digits, decpt, __is_negative(x), x == 0.0, flags, precision);
+}
+
 size_t  _STLP_CALL
 __write_float(__iostring &buf, ios_base::fmtflags flags, int precision,
               double x) {
+  if (numeric_limits<double>::is_iec559 && numeric_limits<double>::digits == 53) {
+    return __write_double(buf, flags, precision, x);
+  }
   return __write_floatT(buf, flags, precision, x
 #if defined (USE_SPRINTF_INSTEAD)
                                                , 0
@@ -895,6 +940,450 @@ __adjust_float_buffer(__iostring &str, char dot) {
   }
 }
 
+//----------------------------------------------------------------------
+// to_chars (<charconv>)
+
+/*
+ * Digits are from the same engines as num_put use (__float_digits_* for
+ * IEEE 754 float and double, __write_float for other types), formatted
+ * here into caller's buffer as printf in "C" locale do: no locale, no
+ * allocation.
+ */
+
+class _Chars_buf {
+public:
+  _Chars_buf(char* first, char* last) :
+      _M_cur(first), _M_last(last), _M_ok(true)
+    { }
+
+  void put(char c) {
+    if (_M_cur != _M_last) {
+      *_M_cur++ = c;
+    } else {
+      _M_ok = false;
+    }
+  }
+  void put(const char* s, ptrdiff_t n) {
+    if (n <= 0) {
+      return;
+    }
+    if (_M_last - _M_cur >= n) {
+      memcpy(_M_cur, s, n);
+      _M_cur += n;
+    } else {
+      _M_ok = false;
+    }
+  }
+  void fill(char c, ptrdiff_t n) {
+    if (n <= 0) {
+      return;
+    }
+    if (_M_last - _M_cur >= n) {
+      memset(_M_cur, c, n);
+      _M_cur += n;
+    } else {
+      _M_ok = false;
+    }
+  }
+  char* finish(int& err) const {
+    if (!_M_ok) {
+      err = EOVERFLOW;
+      return _M_last;
+    }
+    err = 0;
+    return _M_cur;
+  }
+
+private:
+  char* _M_cur;
+  char* _M_last;
+  bool _M_ok;
+};
+
+// exponent with sign and at least __min_digits digits
+static void __put_exponent(_Chars_buf& buf, char c, int e, int min_digits) {
+  buf.put(c);
+  buf.put(e < 0 ? '-' : '+');
+  char tmp[16];
+  char* end = tmp + sizeof(tmp);
+  char* first = __write_decimal_digits32(end, e < 0 ? -e : e);
+  buf.fill('0', min_digits - (end - first));
+  buf.put(first, end - first);
+}
+
+/* Value is 0.d[0]...d[n-1] * 10^k (as from __float_digits_*); digits
+ * after n are zeros.
+ */
+static void __put_scientific(_Chars_buf& buf, const char* d, int n, int k, int precision) {
+  buf.put(d[0]);
+  if (precision > 0) {
+    buf.put('.');
+    const int m = (min) (n - 1, precision);
+    buf.put(d + 1, m);
+    buf.fill('0', precision - m);
+  }
+  __put_exponent(buf, 'e', k - 1, 2);
+}
+
+static void __put_fixed(_Chars_buf& buf, const char* d, int n, int k, int precision) {
+  if (k <= 0) {
+    buf.put('0');
+  } else {
+    const int m = (min) (n, k);
+    buf.put(d, m);
+    buf.fill('0', k - m);
+  }
+  if (precision > 0) {
+    buf.put('.');
+    const int z = (min) (precision, (max) (0, -k));
+    buf.fill('0', z);
+    const int i = (max) (k, 0);
+    const int m = (max) (0, (min) (n - i, precision - z));
+    buf.put(d + i, m);
+    buf.fill('0', precision - z - m);
+  }
+}
+
+/* Format of shortest digits. Without format: fixed or scientific, that
+ * is shorter (fixed if equal); general: %g rule with default precision.
+ * Fixed notation of big integers need exact digits, that are taken from
+ * __exact (may be 0: zeros instead).
+ */
+static void __put_shortest(_Chars_buf& buf, char* d, int n, int k, int fmt,
+                             int (*exact)(double, char*, int*), double x) {
+  const int e = k - 1;
+  bool sci;
+  switch (fmt) {
+    case __chars_scientific:
+      sci = true;
+      break;
+    case __chars_fixed:
+      sci = false;
+      break;
+    case __chars_general:
+      sci = e < -4 || e >= 6;
+      break;
+    default:
+      {
+        const int sci_len = n + (n > 1 ? 1 : 0) + (e <= -100 || e >= 100 ? 5 : 4);
+        const int fixed_len = k <= 0 ? 2 - k + n : (k < n ? n + 1 : k);
+        sci = sci_len < fixed_len;
+      }
+      break;
+  }
+  if (sci) {
+    __put_scientific(buf, d, n, k, n - 1);
+    return;
+  }
+  if (k > n && exact != 0) {
+    n = exact(x, d, &k);
+  }
+  __put_fixed(buf, d, n, k, (max) (0, n - k));
+}
+
+static int __exact_integer_digits(double x, char* d, int* k)
+{ return __float_digits_fixed(x, 0, d, k); }
+
+// fixed: digits after point; scientific: after first digit; general: %g
+static void __put_precision(_Chars_buf& buf, double x, int fmt, int precision) {
+  char d[_STLP_FLOAT_DIGITS_FIXED_MAX(1075) + 1];
+  int k;
+  int n;
+  switch (fmt) {
+    case __chars_fixed:
+      // digits beyond 10^-1074 are zeros
+      n = __float_digits_fixed(x, (min) (precision, 1074), d, &k);
+      __put_fixed(buf, d, n, k, precision);
+      break;
+    case __chars_scientific:
+      // exact decimal value of double has at most 767 significant digits
+      n = __float_digits_precision(x, (min) (precision, 767) + 1, d, &k);
+      __put_scientific(buf, d, n, k, precision);
+      break;
+    default:
+      {
+        const int p = precision == 0 ? 1 : precision;
+        n = __float_digits_precision(x, (min) (p, 767), d, &k);
+        while (n > 1 && d[n - 1] == '0') {
+          --n;
+        }
+        const int e = k - 1;
+        if (p > e && e >= -4) {
+          __put_fixed(buf, d, n, k, (max) (0, n - k));
+        } else {
+          __put_scientific(buf, d, n, k, n - 1);
+        }
+      }
+      break;
+  }
+}
+
+/* Hex: leading digit h[0] and nd digits h[1..nd] after point (values
+ * 0..15); value is h[0].h[1]...h[nd] * 2^exp.
+ */
+static void __put_hex(_Chars_buf& buf, unsigned char* h, int nd, int exp, int precision) {
+  static const char hex[] = "0123456789abcdef";
+  if (precision < 0) {
+    while (nd > 0 && h[nd] == 0) {
+      --nd;
+    }
+  } else if (precision < nd) {
+    // round half to even at digit h[precision]
+    bool above = false;
+    for (int i = precision + 2; i <= nd; ++i) {
+      above |= (h[i] != 0);
+    }
+    const int r = h[precision + 1];
+    if (r > 8 || (r == 8 && (above || (h[precision] & 1) != 0))) {
+      int i = precision;
+      for ( ; i > 0 && h[i] == 15; --i) {
+        h[i] = 0;
+      }
+      ++h[i];
+      if (h[0] == 16) { // 0xf.f -> 0x1p+4 (2 for IEEE types: 0x1.f -> 0x2)
+        h[0] = 1;
+        exp += 4;
+      }
+    }
+    nd = precision;
+  }
+  buf.put(hex[h[0]]);
+  const int zeros = precision > nd ? precision - nd : 0;
+  if (nd + zeros > 0) {
+    buf.put('.');
+    for (int i = 1; i <= nd; ++i) {
+      buf.put(hex[h[i]]);
+    }
+    buf.fill('0', zeros);
+  }
+  __put_exponent(buf, 'p', exp, 1);
+}
+
+// IEEE 754, sign bit clear: 1.xxx (0.xxx for denormals), 0p+0 for zero
+static int __hex_digits(double x, unsigned char* h, int& exp) {
+  uint64_t b;
+  memcpy(&b, &x, sizeof(b));
+  const uint64_t f = b & ((uint64_t(1) << 52) - 1);
+  const int e = (int)(b >> 52) & 0x7ff;
+  uint64_t m = e != 0 ? f | (uint64_t(1) << 52) : f;
+  exp = e != 0 ? e - 1023 : (f != 0 ? -1022 : 0);
+  for (int i = 13; i >= 0; --i, m >>= 4) {
+    h[i] = (unsigned char)(m & 0xf);
+  }
+  return 13;
+}
+
+static int __hex_digits(float x, unsigned char* h, int& exp) {
+  uint32_t b;
+  memcpy(&b, &x, sizeof(b));
+  const uint32_t f = b & ((uint32_t(1) << 23) - 1);
+  const int e = (int)(b >> 23) & 0xff;
+  // 23 bits of fraction are 6 hex digits with one bit of padding
+  uint32_t m = (e != 0 ? f | (uint32_t(1) << 23) : f) << 1;
+  exp = e != 0 ? e - 127 : (f != 0 ? -126 : 0);
+  for (int i = 6; i >= 0; --i, m >>= 4) {
+    h[i] = (unsigned char)(m & 0xf);
+  }
+  return 6;
+}
+
+static bool __put_sign_nan_or_inf(_Chars_buf& buf, bool neg, bool nan, bool inf) {
+  if (neg) {
+    buf.put('-');
+  }
+  if (nan || inf) {
+    buf.put(nan ? "nan" : "inf", 3);
+    return true;
+  }
+  return false;
+}
+
+template <class _FloatT>
+static char* __to_chars_ieee(char* first, char* last, _FloatT x, int fmt, int precision, int& err) {
+  _Chars_buf buf(first, last);
+  const bool neg = __is_negative(double(x));
+  if (neg) {
+    x = -x;
+  }
+  if (!__put_sign_nan_or_inf(buf, neg, !(x == x), x == numeric_limits<_FloatT>::infinity())) {
+    if (fmt == __chars_hex) {
+      unsigned char h[16];
+      int exp;
+      const int nd = __hex_digits(x, h, exp);
+      __put_hex(buf, h, nd, exp, precision);
+    } else if (precision < 0) {
+      char d[_STLP_FLOAT_DIGITS_FIXED_MAX(0) + 1];
+      int k;
+      const int n = __float_digits_shortest(x, d, &k);
+      __put_shortest(buf, d, n, k, fmt, __exact_integer_digits, double(x));
+    } else {
+      __put_precision(buf, double(x), fmt, precision);
+    }
+  }
+  return buf.finish(err);
+}
+
+/* Other types: digits from __write_float, %g with given number of
+ * significant digits; shortest is least number of digits that read back
+ * (by from_chars) to the same value, up to max_digits10. Fixed notation
+ * of long integers padded with zeros.
+ */
+template <class _FloatT>
+static int __float_digits_via_stream(_FloatT x, int ndigits, char* d, int* k) {
+  __iostring s;
+  __write_float(s, ios_base::fmtflags(0), ndigits, x);
+  const char* p = s.c_str();
+  int n = 0;
+  int decpt = 0;
+  bool point = false;
+  for (; *p != 0 && *p != 'e' && *p != 'E'; ++p) {
+    if (*p == '.') {
+      point = true;
+    } else if (n == 0 && *p == '0') {
+      decpt -= point ? 1 : 0;
+    } else {
+      d[n++] = *p;
+      decpt += point ? 0 : 1;
+    }
+  }
+  if (*p != 0) {
+    decpt += atoi(p + 1);
+  }
+  if (n == 0) {
+    d[n++] = '0';
+    decpt = 1;
+  }
+  d[n] = 0;
+  *k = decpt;
+  return n;
+}
+
+template <class _FloatT>
+static bool __float_digits_read_back(_FloatT x, const char* d, int n, int k) {
+  char s[64];
+  memcpy(s, d, n);
+  s[n] = 'e';
+  char* end = s + sizeof(s);
+  const int e = k - n;
+  char* first = __write_decimal_digits32(end, e < 0 ? -e : e);
+  char* p = s + n + 1;
+  if (e < 0) {
+    *p++ = '-';
+  }
+  memmove(p, first, end - first);
+  p += end - first;
+  _FloatT y;
+  int err;
+  __from_chars_float(s, p, y, __chars_general, err);
+  return err == 0 && y == x;
+}
+
+template <class _FloatT>
+static char* __to_chars_via_stream(char* first, char* last, _FloatT x, int fmt, int precision, int& err) {
+  typedef numeric_limits<_FloatT> limits;
+  _Chars_buf buf(first, last);
+  const bool is_nan = !(x == x);
+  const bool neg = (is_nan || x == 0) ? __is_negative(double(x)) : x < 0;
+  if (neg) {
+    x = -x;
+  }
+  if (__put_sign_nan_or_inf(buf, neg, is_nan, x == limits::infinity())) {
+    return buf.finish(err);
+  }
+
+  const int max_digits = 2 + limits::digits * 30103 / 100000; // max_digits10
+  if (fmt == __chars_hex) {
+    // leading digit is first 4 bits of significand, as glibc's %La
+    unsigned char h[32];
+    int nd = 0;
+    int exp = 0;
+    h[0] = 0;
+    if (x != 0) {
+      int e;
+      _FloatT f = frexp(x, &e); // [0.5, 1)
+      exp = e - 4;
+      nd = (min) ((limits::digits + 3) / 4, 32) - 1;
+      for (int i = 0; i <= nd; ++i) {
+        f *= 16;
+        const int digit = int(f);
+        f -= digit;
+        h[i] = (unsigned char)digit;
+      }
+    }
+    __put_hex(buf, h, nd, exp, precision);
+  } else if (precision < 0) {
+    char d[64];
+    int k;
+    int n;
+    if (x == 0) {
+      d[0] = '0';
+      n = 1;
+      k = 1;
+    } else {
+      // round trip is monotonic in number of digits
+      int lo = 1;
+      int hi = max_digits;
+      while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        n = __float_digits_via_stream(x, mid, d, &k);
+        if (__float_digits_read_back(x, d, n, k)) {
+          hi = mid;
+        } else {
+          lo = mid + 1;
+        }
+      }
+      n = __float_digits_via_stream(x, lo, d, &k);
+    }
+    __put_shortest(buf, d, n, k, fmt, 0, 0.0);
+  } else {
+    char d[64];
+    int k;
+    const int p = fmt == __chars_scientific ? precision + 1 : (precision == 0 ? 1 : precision);
+    if (fmt == __chars_fixed) {
+      __iostring s;
+      __write_float(s, ios_base::fixed, precision, x);
+      buf.put(s.data(), s.size());
+    } else {
+      const int n = __float_digits_via_stream(x, (min) (p, max_digits), d, &k);
+      if (fmt == __chars_scientific) {
+        __put_scientific(buf, d, n, k, precision);
+      } else if (p > k - 1 && k - 1 >= -4) {
+        __put_fixed(buf, d, n, k, (max) (0, n - k));
+      } else {
+        __put_scientific(buf, d, n, k, n - 1);
+      }
+    }
+  }
+  return buf.finish(err);
+}
+
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* first, char* last, float x, int fmt, int precision, int& err) {
+  if (numeric_limits<float>::is_iec559 && numeric_limits<double>::is_iec559 &&
+      numeric_limits<double>::digits == 53) {
+    return __to_chars_ieee(first, last, x, fmt, precision, err);
+  }
+  return __to_chars_via_stream(first, last, double(x), fmt, precision, err);
+}
+
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* first, char* last, double x, int fmt, int precision, int& err) {
+  if (numeric_limits<double>::is_iec559 && numeric_limits<double>::digits == 53) {
+    return __to_chars_ieee(first, last, x, fmt, precision, err);
+  }
+  return __to_chars_via_stream(first, last, x, fmt, precision, err);
+}
+
+#if !defined (_STLP_NO_LONG_DOUBLE)
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* first, char* last, long double x, int fmt, int precision, int& err) {
+  if (numeric_limits<long double>::digits == numeric_limits<double>::digits) {
+    return __to_chars_float(first, last, double(x), fmt, precision, err);
+  }
+  return __to_chars_via_stream(first, last, x, fmt, precision, err);
+}
+#endif
+
 _STLP_MOVE_TO_STD_NAMESPACE
 _STLP_END_NAMESPACE
 
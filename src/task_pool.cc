@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "stlport_prefix.h"
+
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <exception>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <stl/_task_pool.h>
+
+#ifdef _STLP_PTHREADS
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+struct _Task
+{
+    _Task_group::task_type _M_fn;
+    void* _M_arg;
+    _Task_group* _M_group;
+};
+
+// Threads admitted to tasks of top-level group and its nested groups
+class _Task_arena
+{
+  public:
+    // __self: worker index + 1 of owner thread, 0 if owner isn't worker
+    _Task_arena( size_t __limit, size_t __workers, size_t __self ) :
+        _M_limit( __limit ),
+        _M_count( 1 ),
+        _M_admitted( new unsigned char[__workers + 1] )
+      {
+        for ( size_t __i = 0; __i <= __workers; ++__i ) {
+          _M_admitted[__i] = 0;
+        }
+        _M_admitted[__self] = 1;
+      }
+
+    ~_Task_arena()
+      { delete [] _M_admitted; }
+
+    size_t concurrency() const
+      { return _M_limit; }
+
+    // Only worker __self itself check (and set) own flag
+    bool admit( size_t __self )
+      {
+        if ( _M_admitted[__self] != 0 ) {
+          return true;
+        }
+        size_t __c = _M_count.load();
+        while ( __c < _M_limit ) {
+          if ( _M_count.compare_exchange_weak( __c, __c + 1 ) ) {
+            _M_admitted[__self] = 1;
+            return true;
+          }
+        }
+        return false;
+      }
+
+  private:
+    const size_t _M_limit;
+    atomic<size_t> _M_count;
+    unsigned char* _M_admitted;
+};
+
+class _Task_pool
+{
+  public:
+    static _Task_pool& instance()
+      {
+        pthread_once( &_S_once, _S_init );
+        return *_S_pool;
+      }
+
+    // worker index + 1 for workers of the pool, 0 for other threads
+    static size_t self()
+      { return reinterpret_cast<size_t>( pthread_getspecific( _S_key ) ); }
+
+    size_t workers() const
+      { return _M_workers; }
+
+    void push( const _Task& );
+    void wait( _Task_group& );
+
+  private:
+    struct _Queue
+    {
+        mutex _M_lock;
+        deque<_Task> _M_tasks;
+    };
+
+    explicit _Task_pool( size_t __workers );
+
+    static void _S_init();
+    static void _S_worker( size_t __i );
+
+    bool run_one( size_t __self, _Task_arena* __arena );
+    bool steal( size_t __victim, size_t __self, _Task_arena* __arena, _Task& __t );
+    void execute( const _Task& __t );
+    void signal();
+    void sleep( unsigned long __epoch );
+
+    const size_t _M_workers;
+    _Queue* _M_queues; // one per worker, last is for foreign threads
+    thread** _M_threads;
+
+    // changed on every push and on group completion
+    atomic<unsigned long> _M_epoch;
+    atomic<size_t> _M_sleepers;
+    mutex _M_lock;
+    condition_variable _M_cond;
+
+    static pthread_once_t _S_once;
+    static pthread_key_t _S_key;
+    static _Task_pool* _S_pool;
+};
+
+pthread_once_t _Task_pool::_S_once = PTHREAD_ONCE_INIT;
+pthread_key_t _Task_pool::_S_key;
+_Task_pool* _Task_pool::_S_pool = 0;
+
+_Task_pool::_Task_pool( size_t __workers ) :
+    _M_workers( __workers ),
+    _M_queues( new _Queue[__workers + 1] ),
+    _M_threads( new thread*[__workers] ),
+    _M_epoch( 0 ),
+    _M_sleepers( 0 )
+{
+}
+
+// Pool live up to the end of process: workers may be in use by static
+// objects destructors, and they are parked in condition wait anyway.
+void _Task_pool::_S_init()
+{
+  pthread_key_create( &_S_key, 0 );
+
+  long __n = ::sysconf( _SC_NPROCESSORS_ONLN );
+  _S_pool = new _Task_pool( __n > 1 ? static_cast<size_t>(__n - 1) : 0 );
+
+  for ( size_t __i = 0; __i < _S_pool->_M_workers; ++__i ) {
+    _S_pool->_M_threads[__i] = new thread( &_Task_pool::_S_worker, __i );
+  }
+}
+
+void _Task_pool::_S_worker( size_t __i )
+{
+  pthread_setspecific( _S_key, reinterpret_cast<void*>( __i + 1 ) );
+
+  _Task_pool& __pool = *_S_pool;
+  for ( ; ; ) {
+    unsigned long __epoch = __pool._M_epoch.load();
+    if ( !__pool.run_one( __i + 1, 0 ) ) {
+      __pool.sleep( __epoch );
+    }
+  }
+}
+
+void _Task_pool::push( const _Task& __t )
+{
+  size_t __self = self();
+  _Queue& __q = _M_queues[__self != 0 ? __self - 1 : _M_workers];
+  {
+    lock_guard<mutex> __lk( __q._M_lock );
+    __q._M_tasks.push_back( __t );
+  }
+  signal();
+}
+
+// Execute tasks of __g's arena until all tasks of __g are done
+void _Task_pool::wait( _Task_group& __g )
+{
+  size_t __self = self();
+  while ( __g._M_pending.load() != 0 ) {
+    unsigned long __epoch = _M_epoch.load();
+    if ( __g._M_pending.load() == 0 ) {
+      break;
+    }
+    if ( !run_one( __self, __g._M_arena ) ) {
+      sleep( __epoch );
+    }
+  }
+}
+
+// Run one task: newest one from own deque, or steal oldest from others.
+// __arena == 0: any task of admitted arena (idle worker),
+// otherwise only tasks of __arena (thread that wait for group).
+bool _Task_pool::run_one( size_t __self, _Task_arena* __arena )
+{
+  _Task __t;
+
+  if ( __self != 0 ) {
+    _Queue& __q = _M_queues[__self - 1];
+    bool __found = false;
+    {
+      lock_guard<mutex> __lk( __q._M_lock );
+      if ( !__q._M_tasks.empty() && (__arena == 0 || __q._M_tasks.back()._M_group->_M_arena == __arena) ) {
+        __t = __q._M_tasks.back();
+        __q._M_tasks.pop_back();
+        __found = true;
+      }
+    }
+    if ( __found ) {
+      execute( __t );
+      return true;
+    }
+  }
+
+  // start from own neighbour, so thieves don't contend for the same victim;
+  // foreign thread look at shared queue first
+  size_t __n = _M_workers + 1;
+  size_t __start = __self != 0 ? __self : _M_workers;
+  for ( size_t __k = 0; __k < __n; ++__k ) {
+    size_t __v = (__start + __k) % __n;
+    if ( __v + 1 != __self && steal( __v, __self, __arena, __t ) ) {
+      execute( __t );
+      return true;
+    }
+  }
+  return false;
+}
+
+bool _Task_pool::steal( size_t __victim, size_t __self, _Task_arena* __arena, _Task& __t )
+{
+  _Queue& __q = _M_queues[__victim];
+  lock_guard<mutex> __lk( __q._M_lock );
+
+  deque<_Task>::iterator __i = __q._M_tasks.begin();
+  // worker's deque: only oldest task; shared queue: first suitable one
+  deque<_Task>::iterator __end = __victim == _M_workers || __i == __q._M_tasks.end() ? __q._M_tasks.end() : __i + 1;
+  for ( ; __i != __end; ++__i ) {
+    _Task_arena* __a = __i->_M_group->_M_arena;
+    if ( (__arena == 0 || __a == __arena) && (__self == 0 || __a->admit( __self )) ) {
+      __t = *__i;
+      __q._M_tasks.erase( __i );
+      return true;
+    }
+  }
+  return false;
+}
+
+void _Task_pool::execute( const _Task& __t )
+{
+  _STLP_TRY {
+    (*__t._M_fn)( __t._M_arg );
+  }
+  _STLP_CATCH_ALL {
+    _STLP_STD::terminate();
+  }
+  // group may be destroyed by waiting thread just after decrement
+  if ( __t._M_group->_M_pending.fetch_sub( 1 ) == 1 ) {
+    signal();
+  }
+}
+
+void _Task_pool::signal()
+{
+  _M_epoch.fetch_add( 1 );
+  if ( _M_sleepers.load() != 0 ) {
+    lock_guard<mutex> __lk( _M_lock );
+    _M_cond.notify_all();
+  }
+}
+
+void _Task_pool::sleep( unsigned long __epoch )
+{
+  for ( int __i = 0; __i < 64; ++__i ) {
+    if ( _M_epoch.load() != __epoch ) {
+      return;
+    }
+    sched_yield();
+  }
+
+  unique_lock<mutex> __lk( _M_lock );
+  _M_sleepers.fetch_add( 1 );
+  while ( _M_epoch.load() == __epoch ) {
+    _M_cond.wait( __lk );
+  }
+  _M_sleepers.fetch_sub( 1 );
+}
+
+_STLP_DECLSPEC _Task_group::_Task_group( size_t __concurrency ) :
+    _M_own_arena( true ),
+    _M_pending( 0 )
+{
+  _Task_pool& __pool = _Task_pool::instance();
+  size_t __n = __pool.workers() + 1;
+  if ( __concurrency == 0 || __concurrency > __n ) {
+    __concurrency = __n;
+  }
+  _M_arena = new _Task_arena( __concurrency, __pool.workers(), _Task_pool::self() );
+}
+
+_STLP_DECLSPEC _Task_group::_Task_group( _Task_group& __parent ) :
+    _M_arena( __parent._M_arena ),
+    _M_own_arena( false ),
+    _M_pending( 0 )
+{
+}
+
+_STLP_DECLSPEC _Task_group::~_Task_group()
+{
+  wait();
+  if ( _M_own_arena ) {
+    delete _M_arena;
+  }
+}
+
+_STLP_DECLSPEC void _Task_group::run( task_type __task, void* __arg )
+{
+  _M_pending.fetch_add( 1 );
+  _Task __t = { __task, __arg, this };
+  _Task_pool::instance().push( __t );
+}
+
+_STLP_DECLSPEC void _Task_group::wait()
+{
+  if ( _M_pending.load() != 0 ) {
+    _Task_pool::instance().wait( *this );
+  }
+}
+
+_STLP_DECLSPEC size_t _Task_group::concurrency() const
+{
+  return _M_arena->concurrency();
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif // _STLP_PTHREADS
@@ -30,6 +30,10 @@
 #  include <stl/_tempbuf.h>
 #endif
 
+#ifndef _STLP_INTERNAL_RADIX_SORT_H
+#  include <stl/_radix_sort.h>
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
@@ -852,8 +856,25 @@ _RandomAccessIter __unguarded_partition(_RandomAccessIter __first,
   }
 }
 
-// sort() and its auxiliary functions.
-#define __stl_threshold  16
+/*
+ * sort() and its auxiliary functions: pattern-defeating quicksort
+ * (O. Peters, "Pattern-defeating Quicksort"). This is introsort with
+ * pseudomedian of nine pivots for big ranges; partition that find no
+ * misplaced element let sort check whether both parts are already sorted
+ * (cheap insertion sort, given up after few moves); highly unbalanced
+ * partition shuffle a few elements and count against limit, then
+ * heapsort take over. Elements equal to pivot of the left neighbour are
+ * put aside in one pass, so many duplicates cost linear time.
+ *
+ * For cheap comparisons (less and greater of arithmetic and pointer
+ * types) partition is branchless, as in "BlockQuicksort" (S. Edelkamp,
+ * A. Weiss): offsets of misplaced elements are collected in blocks
+ * and then swapped.
+ */
+#define __stl_threshold  24 // insertion sort below this size
+#define __stl_ninther_threshold  128
+#define __stl_partial_insertion_limit  8
+#define __stl_partition_block  64
 
 template <class _RandomAccessIter, class _Compare>
 void __unguarded_linear_insert(_RandomAccessIter __last,
@@ -911,40 +932,391 @@ inline void __unguarded_insertion_sort(_RandomAccessIter __first,
                                        _Compare __comp)
 { __unguarded_insertion_sort_aux(__first, __last, __comp); }
 
+// Insertion sort that give up when more than __stl_partial_insertion_limit
+// elements were moved; true if range is sorted
+template <class _RandomAccessIter, class _Compare>
+bool __partial_insertion_sort(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  if (__first == __last) return true;
+  size_t __moved = 0;
+  for (_RandomAccessIter __cur = __first + 1; __cur != __last; ++__cur) {
+    _RandomAccessIter __sift = __cur;
+    _RandomAccessIter __sift_1 = __cur - 1;
+    if (__comp(*__sift, *__sift_1)) {
+      _Tp __tmp = *__sift;
+      do {
+        *__sift-- = *__sift_1;
+      } while (__sift != __first && __comp(__tmp, *--__sift_1));
+      *__sift = __tmp;
+      __moved += __cur - __sift;
+    }
+    if (__moved > __stl_partial_insertion_limit)
+      return false;
+  }
+  return true;
+}
+
+template <class _RandomAccessIter, class _Compare>
+inline void __sort2(_RandomAccessIter __a, _RandomAccessIter __b, _Compare __comp)
+{
+  if (__comp(*__b, *__a))
+    iter_swap(__a, __b);
+}
+
+template <class _RandomAccessIter, class _Compare>
+inline void __sort3(_RandomAccessIter __a, _RandomAccessIter __b, _RandomAccessIter __c, _Compare __comp)
+{
+  __sort2(__a, __b, __comp);
+  __sort2(__b, __c, __comp);
+  __sort2(__a, __b, __comp);
+}
+
+// Put pivot to *__first: median of three, or pseudomedian of nine
+// for big ranges. Elements around are left ordered relative to pivot,
+// so partition scans are guarded.
 template <class _RandomAccessIter, class _Compare>
-void __final_insertion_sort(_RandomAccessIter __first,
-                            _RandomAccessIter __last, _Compare __comp) {
-  if (__last - __first > __stl_threshold) {
-    __insertion_sort(__first, __first + __stl_threshold, __comp);
-    __unguarded_insertion_sort(__first + __stl_threshold, __last, __comp);
+void __pdq_choose_pivot(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
+{
+  typename iterator_traits<_RandomAccessIter>::difference_type __len = __last - __first;
+  _RandomAccessIter __mid = __first + __len / 2;
+  if (__len > __stl_ninther_threshold) {
+    __sort3(__first, __mid, __last - 1, __comp);
+    __sort3(__first + 1, __mid - 1, __last - 2, __comp);
+    __sort3(__first + 2, __mid + 1, __last - 3, __comp);
+    __sort3(__mid - 1, __mid, __mid + 1, __comp);
+    iter_swap(__first, __mid);
   }
   else
-    __insertion_sort(__first, __last, __comp);
+    __sort3(__mid, __first, __last - 1, __comp);
 }
 
+// Partition around pivot *__first, elements equal to pivot go to the right.
+// Return final pivot position; __partitioned is set if no element was
+// misplaced.
 template <class _RandomAccessIter, class _Compare>
-void __introsort_loop(_RandomAccessIter __first,
-                      _RandomAccessIter __last,
-                      typename iterator_traits<_RandomAccessIter>::difference_type __depth_limit,
-                      _Compare __comp)
+_RandomAccessIter __pdq_partition_right(_RandomAccessIter __first, _RandomAccessIter __last,
+                                        _Compare __comp, bool& __partitioned,
+                                        const false_type& /* _Branchless */)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  _Tp __pivot = *__first;
+  _RandomAccessIter __f = __first;
+  _RandomAccessIter __l = __last;
+
+  // there is element not less than pivot: the pivot choice guarantee it
+  while (__comp(*++__f, __pivot)) {
+    _STLP_VERBOSE_ASSERT(!__comp(__pivot, *__f), _StlMsg_INVALID_STRICT_WEAK_PREDICATE)
+  }
+  // element less than pivot may be absent if __f didn't move
+  if (__f - 1 == __first) {
+    while (__f < __l && !__comp(*--__l, __pivot)) {}
+  }
+  else {
+    while (!__comp(*--__l, __pivot)) {}
+  }
+
+  __partitioned = !(__f < __l);
+  while (__f < __l) {
+    iter_swap(__f, __l);
+    while (__comp(*++__f, __pivot)) {
+      _STLP_VERBOSE_ASSERT(!__comp(__pivot, *__f), _StlMsg_INVALID_STRICT_WEAK_PREDICATE)
+    }
+    while (!__comp(*--__l, __pivot)) {}
+  }
+
+  _RandomAccessIter __pivot_pos = __f - 1;
+  *__first = *__pivot_pos;
+  *__pivot_pos = __pivot;
+  return __pivot_pos;
+}
+
+// Swap __n pairs of misplaced elements, given by offsets from __first
+// and back from __last; without pairwise swaps it is one cycle of moves
+template <class _RandomAccessIter>
+void __pdq_swap_offsets(_RandomAccessIter __first, _RandomAccessIter __last,
+                        const unsigned char* __offsets_l, const unsigned char* __offsets_r,
+                        size_t __n, bool __use_swaps)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  if (__use_swaps) {
+    // cycle would break order of descending input, and pdqsort
+    // rely on it being partitioned in one pass
+    for (size_t __i = 0; __i < __n; ++__i)
+      iter_swap(__first + __offsets_l[__i], __last - __offsets_r[__i]);
+  }
+  else if (__n > 0) {
+    _RandomAccessIter __l = __first + __offsets_l[0];
+    _RandomAccessIter __r = __last - __offsets_r[0];
+    _Tp __tmp = *__l;
+    *__l = *__r;
+    for (size_t __i = 1; __i < __n; ++__i) {
+      __l = __first + __offsets_l[__i];
+      *__r = *__l;
+      __r = __last - __offsets_r[__i];
+      *__l = *__r;
+    }
+    *__r = __tmp;
+  }
+}
+
+template <class _RandomAccessIter, class _Compare>
+_RandomAccessIter __pdq_partition_right(_RandomAccessIter __first, _RandomAccessIter __last,
+                                        _Compare __comp, bool& __partitioned,
+                                        const true_type& /* _Branchless */)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  _Tp __pivot = *__first;
+  _RandomAccessIter __f = __first;
+  _RandomAccessIter __l = __last;
+
+  while (__comp(*++__f, __pivot)) {}
+  if (__f - 1 == __first) {
+    while (__f < __l && !__comp(*--__l, __pivot)) {}
+  }
+  else {
+    while (!__comp(*--__l, __pivot)) {}
+  }
+
+  __partitioned = !(__f < __l);
+  if (!__partitioned) {
+    iter_swap(__f, __l);
+    ++__f;
+
+    // offsets of elements not less than pivot from __base_l, and of
+    // elements less than pivot back from __base_r; comparison result
+    // is added to count instead of branch
+    unsigned char __offsets_l[__stl_partition_block];
+    unsigned char __offsets_r[__stl_partition_block];
+    _RandomAccessIter __base_l = __f;
+    _RandomAccessIter __base_r = __l;
+    size_t __num_l = 0, __num_r = 0, __start_l = 0, __start_r = 0;
+
+    while (__f < __l) {
+      size_t __unknown = __l - __f;
+      size_t __split_l = __num_l == 0 ? (__num_r == 0 ? __unknown / 2 : __unknown) : 0;
+      size_t __split_r = __num_r == 0 ? __unknown - __split_l : 0;
+      if (__split_l > __stl_partition_block)
+        __split_l = __stl_partition_block;
+      if (__split_r > __stl_partition_block)
+        __split_r = __stl_partition_block;
+
+      for (size_t __i = 0; __i < __split_l; ) {
+        __offsets_l[__num_l] = static_cast<unsigned char>(__i++);
+        __num_l += !__comp(*__f, __pivot);
+        ++__f;
+      }
+      for (size_t __i = 0; __i < __split_r; ) {
+        __offsets_r[__num_r] = static_cast<unsigned char>(++__i);
+        __num_r += __comp(*--__l, __pivot);
+      }
+
+      size_t __n = (min)(__num_l, __num_r);
+      __pdq_swap_offsets(__base_l, __base_r, __offsets_l + __start_l, __offsets_r + __start_r,
+                         __n, __num_l == __num_r);
+      __num_l -= __n;
+      __num_r -= __n;
+      __start_l += __n;
+      __start_r += __n;
+      if (__num_l == 0) {
+        __start_l = 0;
+        __base_l = __f;
+      }
+      if (__num_r == 0) {
+        __start_r = 0;
+        __base_r = __l;
+      }
+    }
+
+    // elements left in one block: move them to the middle
+    if (__num_l != 0) {
+      while (__num_l--)
+        iter_swap(__base_l + __offsets_l[__start_l + __num_l], --__l);
+      __f = __l;
+    }
+    if (__num_r != 0) {
+      while (__num_r--) {
+        iter_swap(__base_r - __offsets_r[__start_r + __num_r], __f);
+        ++__f;
+      }
+    }
+  }
+
+  _RandomAccessIter __pivot_pos = __f - 1;
+  *__first = *__pivot_pos;
+  *__pivot_pos = __pivot;
+  return __pivot_pos;
+}
+
+// Partition around pivot *__first, elements equal to pivot go to the left;
+// used when pivot is equal to element before range, so nothing
+// in range is less than pivot. Return final pivot position.
+template <class _RandomAccessIter, class _Compare>
+_RandomAccessIter __pdq_partition_left(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  _Tp __pivot = *__first;
+  _RandomAccessIter __f = __first;
+  _RandomAccessIter __l = __last;
+
+  while (__comp(__pivot, *--__l)) {
+    _STLP_VERBOSE_ASSERT(!__comp(*__l, __pivot), _StlMsg_INVALID_STRICT_WEAK_PREDICATE)
+  }
+  if (__l + 1 == __last) {
+    while (__f < __l && !__comp(__pivot, *++__f)) {}
+  }
+  else {
+    while (!__comp(__pivot, *++__f)) {}
+  }
+
+  while (__f < __l) {
+    iter_swap(__f, __l);
+    while (__comp(__pivot, *--__l)) {
+      _STLP_VERBOSE_ASSERT(!__comp(*__l, __pivot), _StlMsg_INVALID_STRICT_WEAK_PREDICATE)
+    }
+    while (!__comp(__pivot, *++__f)) {}
+  }
+
+  *__first = *__l;
+  *__l = __pivot;
+  return __l;
+}
+
+// __leftmost is false when element before __first is not greater
+// than any element of range (guard for unguarded insertion sort)
+template <class _RandomAccessIter, class _Compare, class _Branchless>
+void __pdqsort_loop(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp,
+                    int __bad_allowed, bool __leftmost, const _Branchless& __branchless)
 {
-  while (__last - __first > __stl_threshold) {
-    if (__depth_limit == 0) {
-      partial_sort(__first, __last, __last, __comp);
+  typedef typename iterator_traits<_RandomAccessIter>::difference_type _Distance;
+
+  for (;;) {
+    _Distance __len = __last - __first;
+    if (__len < __stl_threshold) {
+      if (__leftmost)
+        __insertion_sort(__first, __last, __comp);
+      else
+        __unguarded_insertion_sort(__first, __last, __comp);
       return;
     }
-    --__depth_limit;
-    _RandomAccessIter __cut =
-      __unguarded_partition(__first, __last,
-                            __median(*__first,
-                                     *(__first + (__last - __first)/2),
-                                     *(__last - 1), __comp),
-                            __comp);
-    __introsort_loop(__cut, __last, __depth_limit, __comp);
-    __last = __cut;
+
+    __pdq_choose_pivot(__first, __last, __comp);
+
+    // pivot is equal to guard: skip all elements equal to it
+    if (!__leftmost && !__comp(*(__first - 1), *__first)) {
+      __first = __pdq_partition_left(__first, __last, __comp) + 1;
+      continue;
+    }
+
+    bool __partitioned;
+    _RandomAccessIter __pivot_pos = __pdq_partition_right(__first, __last, __comp, __partitioned, __branchless);
+
+    _Distance __l_len = __pivot_pos - __first;
+    _Distance __r_len = __last - (__pivot_pos + 1);
+    if (__l_len < __len / 8 || __r_len < __len / 8) {
+      if (--__bad_allowed == 0) {
+        make_heap(__first, __last, __comp);
+        sort_heap(__first, __last, __comp);
+        return;
+      }
+      // break patterns that may lead to bad pivots
+      if (__l_len >= __stl_threshold) {
+        iter_swap(__first, __first + __l_len / 4);
+        iter_swap(__pivot_pos - 1, __pivot_pos - __l_len / 4);
+        if (__l_len > __stl_ninther_threshold) {
+          iter_swap(__first + 1, __first + (__l_len / 4 + 1));
+          iter_swap(__first + 2, __first + (__l_len / 4 + 2));
+          iter_swap(__pivot_pos - 2, __pivot_pos - (__l_len / 4 + 1));
+          iter_swap(__pivot_pos - 3, __pivot_pos - (__l_len / 4 + 2));
+        }
+      }
+      if (__r_len >= __stl_threshold) {
+        iter_swap(__pivot_pos + 1, __pivot_pos + (1 + __r_len / 4));
+        iter_swap(__last - 1, __last - __r_len / 4);
+        if (__r_len > __stl_ninther_threshold) {
+          iter_swap(__pivot_pos + 2, __pivot_pos + (2 + __r_len / 4));
+          iter_swap(__pivot_pos + 3, __pivot_pos + (3 + __r_len / 4));
+          iter_swap(__last - 2, __last - (1 + __r_len / 4));
+          iter_swap(__last - 3, __last - (2 + __r_len / 4));
+        }
+      }
+    }
+    else if (__partitioned &&
+             __partial_insertion_sort(__first, __pivot_pos, __comp) &&
+             __partial_insertion_sort(__pivot_pos + 1, __last, __comp)) {
+      // input looks sorted
+      return;
+    }
+
+    __pdqsort_loop(__first, __pivot_pos, __comp, __bad_allowed, __leftmost, __branchless);
+    __first = __pivot_pos + 1;
+    __leftmost = false;
   }
 }
 
+// Comparison of values that is cheap and has no side effects,
+// so it may be done without branch on its result
+template <class _Tp, class _Compare>
+struct __is_cheap_compare
+{
+  typedef false_type _Ret;
+};
+
+template <class _Tp>
+struct __is_cheap_compare<_Tp, less<_Tp> >
+{
+  typedef integral_constant<bool, is_arithmetic<_Tp>::value || is_pointer<_Tp>::value> _Ret;
+};
+
+template <class _Tp>
+struct __is_cheap_compare<_Tp, less<void> >
+{
+  typedef integral_constant<bool, is_arithmetic<_Tp>::value || is_pointer<_Tp>::value> _Ret;
+};
+
+template <class _Tp>
+struct __is_cheap_compare<_Tp, greater<_Tp> >
+{
+  typedef integral_constant<bool, is_arithmetic<_Tp>::value || is_pointer<_Tp>::value> _Ret;
+};
+
+template <class _Tp>
+struct __is_cheap_compare<_Tp, greater<void> >
+{
+  typedef integral_constant<bool, is_arithmetic<_Tp>::value || is_pointer<_Tp>::value> _Ret;
+};
+
+template <class _RandomAccessIter, class _Compare>
+void __pdqsort(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  typedef typename __is_cheap_compare<_Tp, _Compare>::_Ret _Branchless;
+  __pdqsort_loop(__first, __last, __comp, static_cast<int>(__lg(__last - __first)) + 1,
+                 true, _Branchless());
+}
+
+template <class _RandomAccessIter, class _Compare>
+inline void __sort(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
+{ __pdqsort(__first, __last, __comp); }
+
+template <class _Tp, class _Compare>
+inline void __sort_ptr(_Tp* __first, _Tp* __last, _Compare __comp, const false_type& /* _Is_default */)
+{ __pdqsort(__first, __last, __comp); }
+
+template <class _Tp, class _Compare>
+inline void __sort_ptr(_Tp* __first, _Tp* __last, _Compare __comp, const true_type& /* _Is_default */)
+{
+  if (!__radix_sort_values(__first, __last, __radix_order<_Tp, _Compare>::_Descending != 0)) {
+    __pdqsort(__first, __last, __comp);
+  }
+}
+
+// Arithmetic values in contiguous storage (pointers, vector iterators),
+// ordered by less or greater, are sorted by radix sort
+template <class _Tp, class _Compare>
+inline void __sort(_Tp* __first, _Tp* __last, _Compare __comp)
+{ __sort_ptr(__first, __last, __comp, typename __radix_order<_Tp, _Compare>::_Is_default()); }
+
 _STLP_MOVE_TO_STD_NAMESPACE
 
 template <class _RandomAccessIter>
@@ -952,11 +1324,8 @@ void sort(_RandomAccessIter __first, _RandomAccessIter __last)
 {
   _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
   if (__first != __last) {
-    _STLP_PRIV __introsort_loop(__first, __last,
-                                _STLP_PRIV __lg(__last - __first) * 2,
-                                less<typename iterator_traits<_RandomAccessIter>::value_type>());
-    _STLP_PRIV __final_insertion_sort(__first, __last,
-                                      less<typename iterator_traits<_RandomAccessIter>::value_type>());
+    _STLP_PRIV __sort(__first, __last,
+                      less<typename iterator_traits<_RandomAccessIter>::value_type>());
   }
 }
 
@@ -965,9 +1334,7 @@ void sort(_RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp)
 {
   _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
   if (__first != __last) {
-    _STLP_PRIV __introsort_loop(__first, __last,
-                                _STLP_PRIV __lg(__last - __first) * 2, __comp);
-    _STLP_PRIV __final_insertion_sort(__first, __last, __comp);
+    _STLP_PRIV __sort(__first, __last, __comp);
   }
 }
 
@@ -1289,7 +1656,7 @@ void nth_element(_RandomAccessIter __first, _RandomAccessIter __nth, _RandomAcce
   _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __nth))
   _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__nth, __last))
   _STLP_PRIV __nth_element(__first, __nth, __last,
-                           less<typename iterator_traits<_RandomAccessIter>::difference_type>());
+                           less<typename iterator_traits<_RandomAccessIter>::value_type>());
 }
 
 template <class _RandomAccessIter, class _Compare>
@@ -1982,6 +2349,9 @@ _STLP_MOVE_TO_STD_NAMESPACE
 _STLP_END_NAMESPACE
 
 #undef __stl_threshold
+#undef __stl_ninther_threshold
+#undef __stl_partial_insertion_limit
+#undef __stl_partition_block
 
 #endif /* _STLP_ALGO_C */
 // Local Variables:
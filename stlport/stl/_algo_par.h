@@ -0,0 +1,611 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_ALGO_PAR_H
+#define _STLP_INTERNAL_ALGO_PAR_H
+
+#ifndef _STLP_INTERNAL_TEMPBUF_H
+#  include <stl/_tempbuf.h>
+#endif
+
+#include <exception>
+
+#if defined (_STLP_PTHREADS)
+#  ifndef _STLP_INTERNAL_TASK_POOL_H
+#    include <stl/_task_pool.h>
+#  endif
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+#if defined (_STLP_PTHREADS)
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Parallel sort, stable_sort and nth_element, tasks are executed by
+ * work-stealing pool (_Task_group).
+ *
+ * Ranges up to __stl_par_threshold elements are processed by serial
+ * algorithms; range is also split no finer than that.
+ */
+const int __stl_par_threshold = 16384;
+const int __stl_par_max_chunks = 64;
+
+template <class _Tp, class _Compare>
+struct __less_than_pivot
+{
+    __less_than_pivot( const _Tp& __pivot, _Compare __comp ) :
+        _M_pivot( __pivot ),
+        _M_comp( __comp )
+      { }
+
+    bool operator()( const _Tp& __x ) const
+      { return _M_comp( __x, _M_pivot ); }
+
+    const _Tp& _M_pivot;
+    _Compare _M_comp;
+};
+
+template <class _Tp, class _Compare>
+struct __not_greater_than_pivot
+{
+    __not_greater_than_pivot( const _Tp& __pivot, _Compare __comp ) :
+        _M_pivot( __pivot ),
+        _M_comp( __comp )
+      { }
+
+    bool operator()( const _Tp& __x ) const
+      { return !_M_comp( _M_pivot, __x ); }
+
+    const _Tp& _M_pivot;
+    _Compare _M_comp;
+};
+
+// Pseudomedian of nine, for big ranges
+template <class _RandomAccessIter, class _Compare>
+typename iterator_traits<_RandomAccessIter>::value_type
+__par_pivot( _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp )
+{
+  typename iterator_traits<_RandomAccessIter>::difference_type __s = (__last - __first) / 8;
+  _RandomAccessIter __mid = __first + (__last - __first) / 2;
+  return __median( __median( *__first, *(__first + __s), *(__first + 2 * __s), __comp ),
+                   __median( *(__mid - __s), *__mid, *(__mid + __s), __comp ),
+                   __median( *(__last - 1 - 2 * __s), *(__last - 1 - __s), *(__last - 1), __comp ),
+                   __comp );
+}
+
+template <class _RandomAccessIter, class _Predicate>
+struct __par_partition_chunk
+{
+    void operator()()
+      { _M_mid = _STLP_STD::partition( _M_first, _M_last, *_M_pred ); }
+
+    _RandomAccessIter _M_first;
+    _RandomAccessIter _M_last;
+    _RandomAccessIter _M_mid;
+    _Predicate* _M_pred;
+};
+
+// Misplaced elements are given as lists of intervals (offsets from _M_base)
+// on both sides of partition point; swap [_M_from, _M_to) elements of them.
+template <class _RandomAccessIter, class _Distance>
+struct __par_swap_misplaced
+{
+    static void _S_locate( const _Distance* __b, const _Distance* __e, _Distance __k,
+                           size_t& __i, _Distance& __pos )
+      {
+        for ( __i = 0; __k >= __e[__i] - __b[__i]; ++__i ) {
+          __k -= __e[__i] - __b[__i];
+        }
+        __pos = __b[__i] + __k;
+      }
+
+    void operator()()
+      {
+        size_t __i, __j;
+        _Distance __p, __q;
+        _S_locate( _M_lb, _M_le, _M_from, __i, __p );
+        _S_locate( _M_rb, _M_re, _M_from, __j, __q );
+        for ( _Distance __n = _M_to - _M_from; __n > 0; ) {
+          _Distance __step = (min)( __n, (min)( _M_le[__i] - __p, _M_re[__j] - __q ) );
+          _STLP_STD::swap_ranges( _M_base + __p, _M_base + __p + __step, _M_base + __q );
+          __n -= __step;
+          __p += __step;
+          __q += __step;
+          if ( __p == _M_le[__i] && __n > 0 ) {
+            __p = _M_lb[++__i];
+          }
+          if ( __q == _M_re[__j] && __n > 0 ) {
+            __q = _M_rb[++__j];
+          }
+        }
+      }
+
+    _RandomAccessIter _M_base;
+    const _Distance* _M_lb;
+    const _Distance* _M_le;
+    const _Distance* _M_rb;
+    const _Distance* _M_re;
+    _Distance _M_from;
+    _Distance _M_to;
+};
+
+/*
+ * Partition by __chunks threads: every chunk is partitioned independently,
+ * then elements that are on wrong side of common partition point
+ * are swapped, again in parallel. Return partition point.
+ */
+template <class _RandomAccessIter, class _Predicate>
+_RandomAccessIter __par_partition( _RandomAccessIter __first, _RandomAccessIter __last,
+                                   _Predicate __pred, size_t __chunks, _Task_group& __g )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::difference_type _Distance;
+
+  __par_partition_chunk<_RandomAccessIter, _Predicate> __c[__stl_par_max_chunks];
+  _Distance __n = __last - __first;
+
+  {
+    _Task_group __sub( __g );
+    for ( size_t __i = 0; __i < __chunks; ++__i ) {
+      __c[__i]._M_first = __first + __n * __i / __chunks;
+      __c[__i]._M_last = __first + __n * (__i + 1) / __chunks;
+      __c[__i]._M_pred = &__pred;
+      if ( __i + 1 < __chunks ) {
+        __sub.run( __c[__i] );
+      }
+    }
+    __c[__chunks - 1]();
+    __sub.wait();
+  }
+
+  _Distance __split = 0;
+  for ( size_t __i = 0; __i < __chunks; ++__i ) {
+    __split += __c[__i]._M_mid - __c[__i]._M_first;
+  }
+
+  // not satisfying __pred before __split, and satisfying after it
+  _Distance __lb[__stl_par_max_chunks], __le[__stl_par_max_chunks];
+  _Distance __rb[__stl_par_max_chunks], __re[__stl_par_max_chunks];
+  size_t __nl = 0, __nr = 0;
+  _Distance __m = 0;
+  for ( size_t __i = 0; __i < __chunks; ++__i ) {
+    _Distance __b = __c[__i]._M_first - __first;
+    _Distance __mid = __c[__i]._M_mid - __first;
+    _Distance __e = __c[__i]._M_last - __first;
+    if ( __mid < __split && __mid < __e ) {
+      __lb[__nl] = __mid;
+      __le[__nl] = (min)( __e, __split );
+      __m += __le[__nl++] - __mid;
+    }
+    if ( __split < __mid && __b < __mid ) {
+      __rb[__nr] = (max)( __b, __split );
+      __re[__nr++] = __mid;
+    }
+  }
+
+  if ( __m != 0 ) {
+    __par_swap_misplaced<_RandomAccessIter, _Distance> __s[__stl_par_max_chunks];
+    size_t __k = (min)( __chunks, static_cast<size_t>(__m / __stl_par_threshold) + 1 );
+    _Task_group __sub( __g );
+    for ( size_t __i = 0; __i < __k; ++__i ) {
+      __s[__i]._M_base = __first;
+      __s[__i]._M_lb = __lb;
+      __s[__i]._M_le = __le;
+      __s[__i]._M_rb = __rb;
+      __s[__i]._M_re = __re;
+      __s[__i]._M_from = __m * __i / __k;
+      __s[__i]._M_to = __m * (__i + 1) / __k;
+      if ( __i + 1 < __k ) {
+        __sub.run( __s[__i] );
+      }
+    }
+    __s[__k - 1]();
+    __sub.wait();
+  }
+
+  return __first + __split;
+}
+
+template <class _RandomAccessIter, class _Compare, class _Distance>
+void __par_introsort( _RandomAccessIter __first, _RandomAccessIter __last,
+                      _Distance __depth_limit, _Distance __grain, _Distance __total,
+                      _Compare __comp, _Task_group& __g );
+
+template <class _RandomAccessIter, class _Compare, class _Distance>
+struct __par_introsort_job
+{
+    void operator()()
+      { __par_introsort( _M_first, _M_last, _M_depth_limit, _M_grain, _M_total, _M_comp, *_M_group ); }
+
+    _RandomAccessIter _M_first;
+    _RandomAccessIter _M_last;
+    _Distance _M_depth_limit;
+    _Distance _M_grain;
+    _Distance _M_total;
+    _Compare _M_comp;
+    _Task_group* _M_group;
+};
+
+/*
+ * Quicksort, halves are sorted in parallel. Ranges that are bigger
+ * than share of one thread (so other threads may be idle) are
+ * partitioned in parallel too. Ranges up to __grain and ranges
+ * that exhaust __depth_limit are left to serial sort.
+ */
+template <class _RandomAccessIter, class _Compare, class _Distance>
+void __par_introsort( _RandomAccessIter __first, _RandomAccessIter __last,
+                      _Distance __depth_limit, _Distance __grain, _Distance __total,
+                      _Compare __comp, _Task_group& __g )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+
+  _Distance __len = __last - __first;
+  if ( __len <= __grain || __depth_limit == 0 ) {
+    _STLP_STD::sort( __first, __last, __comp );
+    return;
+  }
+  --__depth_limit;
+
+  size_t __chunks = (min)( static_cast<size_t>(__len / __stl_par_threshold),
+                           static_cast<size_t>(__g.concurrency() * __len / __total) );
+  _RandomAccessIter __cut;
+  if ( __chunks > 1 ) {
+    _Tp __pivot = __par_pivot( __first, __last, __comp );
+    __chunks = (min)( __chunks, static_cast<size_t>(__stl_par_max_chunks) );
+    __cut = __par_partition( __first, __last, __less_than_pivot<_Tp, _Compare>( __pivot, __comp ), __chunks, __g );
+    if ( __cut == __first ) {
+      // nothing less than pivot: skip elements equal to pivot
+      __cut = __par_partition( __first, __last, __not_greater_than_pivot<_Tp, _Compare>( __pivot, __comp ), __chunks, __g );
+      __par_introsort( __cut, __last, __depth_limit, __grain, __total, __comp, __g );
+      return;
+    }
+  } else {
+    __cut = __unguarded_partition( __first, __last,
+                                   _Tp( __median( *__first, *(__first + __len / 2), *(__last - 1), __comp ) ),
+                                   __comp );
+  }
+
+  _Task_group __sub( __g );
+  __par_introsort_job<_RandomAccessIter, _Compare, _Distance> __right =
+    { __cut, __last, __depth_limit, __grain, __total, __comp, &__g };
+  __sub.run( __right );
+  __par_introsort( __first, __cut, __depth_limit, __grain, __total, __comp, __g );
+  __sub.wait();
+}
+
+template <class _RandomAccessIter, class _Compare>
+void __par_sort( _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp, size_t __concurrency )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::difference_type _Distance;
+
+  _Distance __n = __last - __first;
+  if ( __n > __stl_par_threshold && __concurrency != 1 ) {
+    _Task_group __g( __concurrency );
+    _Distance __conc = static_cast<_Distance>(__g.concurrency());
+    if ( __conc > 1 ) {
+      _Distance __grain = (max)( static_cast<_Distance>(__stl_par_threshold), __n / (__conc * 8) );
+      __par_introsort( __first, __last, _Distance( __lg( __n ) * 2 ), __grain, __n, __comp, __g );
+      return;
+    }
+  }
+  _STLP_STD::sort( __first, __last, __comp );
+}
+
+template <class _InputIter, class _OutputIter, class _Compare, class _Distance>
+void __par_merge( _InputIter __first1, _InputIter __last1,
+                  _InputIter __first2, _InputIter __last2,
+                  _OutputIter __result, _Distance __grain,
+                  _Compare __comp, _Task_group& __g );
+
+template <class _InputIter, class _OutputIter, class _Compare, class _Distance>
+struct __par_merge_job
+{
+    void operator()()
+      { __par_merge( _M_first1, _M_last1, _M_first2, _M_last2, _M_result, _M_grain, _M_comp, *_M_group ); }
+
+    _InputIter _M_first1;
+    _InputIter _M_last1;
+    _InputIter _M_first2;
+    _InputIter _M_last2;
+    _OutputIter _M_result;
+    _Distance _M_grain;
+    _Compare _M_comp;
+    _Task_group* _M_group;
+};
+
+/*
+ * Stable merge: split bigger sequence in the middle, and other one
+ * at position of middle element (before equal elements if middle element
+ * is from first sequence, after them otherwise); merge both parts
+ * in parallel.
+ */
+template <class _InputIter, class _OutputIter, class _Compare, class _Distance>
+void __par_merge( _InputIter __first1, _InputIter __last1,
+                  _InputIter __first2, _InputIter __last2,
+                  _OutputIter __result, _Distance __grain,
+                  _Compare __comp, _Task_group& __g )
+{
+  _Distance __len1 = __last1 - __first1;
+  _Distance __len2 = __last2 - __first2;
+  if ( __len1 + __len2 <= __grain ) {
+    _STLP_STD::merge( __first1, __last1, __first2, __last2, __result, __comp );
+    return;
+  }
+
+  _InputIter __cut1 = __first1;
+  _InputIter __cut2 = __first2;
+  if ( __len1 >= __len2 ) {
+    __cut1 += __len1 / 2;
+    __cut2 = _STLP_STD::lower_bound( __first2, __last2, *__cut1, __comp );
+  } else {
+    __cut2 += __len2 / 2;
+    __cut1 = _STLP_STD::upper_bound( __first1, __last1, *__cut2, __comp );
+  }
+
+  _Task_group __sub( __g );
+  __par_merge_job<_InputIter, _OutputIter, _Compare, _Distance> __left =
+    { __first1, __cut1, __first2, __cut2, __result, __grain, __comp, &__g };
+  __sub.run( __left );
+  __par_merge( __cut1, __last1, __cut2, __last2, __result + ((__cut1 - __first1) + (__cut2 - __first2)),
+               __grain, __comp, __g );
+  __sub.wait();
+}
+
+template <class _RandomAccessIter, class _Pointer, class _Compare, class _Distance>
+void __par_merge_sort( _RandomAccessIter __first, _RandomAccessIter __last,
+                       _Pointer __buffer, bool __to_buffer, _Distance __grain,
+                       _Compare __comp, _Task_group& __g );
+
+template <class _RandomAccessIter, class _Pointer, class _Compare, class _Distance>
+struct __par_merge_sort_job
+{
+    void operator()()
+      { __par_merge_sort( _M_first, _M_last, _M_buffer, _M_to_buffer, _M_grain, _M_comp, *_M_group ); }
+
+    _RandomAccessIter _M_first;
+    _RandomAccessIter _M_last;
+    _Pointer _M_buffer;
+    bool _M_to_buffer;
+    _Distance _M_grain;
+    _Compare _M_comp;
+    _Task_group* _M_group;
+};
+
+/*
+ * Merge sort of [__first, __last), result is placed in buffer of the same
+ * size if __to_buffer, in place otherwise. Halves are sorted in parallel
+ * into other place, so every level of merge only move elements between
+ * range and buffer.
+ */
+template <class _RandomAccessIter, class _Pointer, class _Compare, class _Distance>
+void __par_merge_sort( _RandomAccessIter __first, _RandomAccessIter __last,
+                       _Pointer __buffer, bool __to_buffer, _Distance __grain,
+                       _Compare __comp, _Task_group& __g )
+{
+  _Distance __len = __last - __first;
+  if ( __len <= __grain ) {
+    __merge_sort_with_buffer( __first, __last, __buffer, __comp );
+    if ( __to_buffer ) {
+      _STLP_STD::copy( __first, __last, __buffer );
+    }
+    return;
+  }
+
+  _RandomAccessIter __middle = __first + __len / 2;
+  _Pointer __buffer_middle = __buffer + __len / 2;
+  {
+    _Task_group __sub( __g );
+    __par_merge_sort_job<_RandomAccessIter, _Pointer, _Compare, _Distance> __left =
+      { __first, __middle, __buffer, !__to_buffer, __grain, __comp, &__g };
+    __sub.run( __left );
+    __par_merge_sort( __middle, __last, __buffer_middle, !__to_buffer, __grain, __comp, __g );
+    __sub.wait();
+  }
+
+  if ( __to_buffer ) {
+    __par_merge( __first, __middle, __middle, __last, __buffer, __grain, __comp, __g );
+  } else {
+    __par_merge( __buffer, __buffer_middle, __buffer_middle, __buffer + __len, __first, __grain, __comp, __g );
+  }
+}
+
+template <class _RandomAccessIter, class _Compare>
+void __par_stable_sort( _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp, size_t __concurrency )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::difference_type _Distance;
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+
+  _Distance __n = __last - __first;
+  if ( __n > __stl_par_threshold && __concurrency != 1 ) {
+    _Task_group __g( __concurrency );
+    _Distance __conc = static_cast<_Distance>(__g.concurrency());
+    if ( __conc > 1 ) {
+      _Temporary_buffer<_RandomAccessIter, _Tp> __buf( __first, __last );
+      if ( __buf.size() == __n ) {
+        _Distance __grain = (max)( static_cast<_Distance>(__stl_par_threshold), __n / (__conc * 4) );
+        __par_merge_sort( __first, __last, __buf.begin(), false, __grain, __comp, __g );
+      } else if ( __buf.begin() == 0 ) {
+        __inplace_stable_sort( __first, __last, __comp );
+      } else {
+        __stable_sort_adaptive( __first, __last, __buf.begin(), _Distance( __buf.size() ), __comp );
+      }
+      return;
+    }
+  }
+  _STLP_STD::stable_sort( __first, __last, __comp );
+}
+
+/*
+ * Quickselect with parallel partition, down to range that is small
+ * for parallel partition; the rest is done by serial nth_element.
+ */
+template <class _RandomAccessIter, class _Compare>
+void __par_nth_element( _RandomAccessIter __first, _RandomAccessIter __nth,
+                        _RandomAccessIter __last, _Compare __comp, size_t __concurrency )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::difference_type _Distance;
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+
+  if ( __nth == __last ) {
+    return;
+  }
+  _Distance __n = __last - __first;
+  if ( __n > __stl_par_threshold && __concurrency != 1 ) {
+    _Task_group __g( __concurrency );
+    size_t __conc = (min)( __g.concurrency(), static_cast<size_t>(__stl_par_max_chunks) );
+    for ( _Distance __depth_limit = __lg( __n ) * 2; __depth_limit > 0; --__depth_limit ) {
+      size_t __chunks = (min)( __conc, static_cast<size_t>((__last - __first) / __stl_par_threshold) );
+      if ( __chunks < 2 ) {
+        break;
+      }
+      _Tp __pivot = __par_pivot( __first, __last, __comp );
+      _RandomAccessIter __cut = __par_partition( __first, __last, __less_than_pivot<_Tp, _Compare>( __pivot, __comp ), __chunks, __g );
+      if ( __cut == __first ) {
+        // nothing less than pivot: elements equal to pivot are in place
+        __cut = __par_partition( __first, __last, __not_greater_than_pivot<_Tp, _Compare>( __pivot, __comp ), __chunks, __g );
+        if ( __nth < __cut ) {
+          return;
+        }
+        __first = __cut;
+      } else if ( __nth < __cut ) {
+        __last = __cut;
+      } else {
+        __first = __cut;
+      }
+    }
+  }
+  __nth_element( __first, __nth, __last, __comp );
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+#endif /* _STLP_PTHREADS */
+
+/*
+ * Overloads with execution policy. Parallel ones fall back to serial code
+ * for short ranges, for parallel_policy( 1 ) and if threads
+ * aren't available. Exception from element access function (comparison,
+ * copy, etc.) in parallel algorithm call terminate().
+ */
+
+template <class _RandomAccessIter>
+inline void sort( const execution::sequenced_policy&, _RandomAccessIter __first, _RandomAccessIter __last )
+{ _STLP_STD::sort( __first, __last ); }
+
+template <class _RandomAccessIter, class _Compare>
+inline void sort( const execution::sequenced_policy&, _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp )
+{ _STLP_STD::sort( __first, __last, __comp ); }
+
+template <class _RandomAccessIter, class _Compare>
+void sort( const execution::parallel_policy& __exec, _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp )
+{
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
+#if defined (_STLP_PTHREADS)
+  _STLP_TRY {
+    _STLP_PRIV __par_sort( __first, __last, __comp, __exec.concurrency() );
+  }
+  _STLP_CATCH_ALL {
+    _STLP_STD::terminate();
+  }
+#else
+  _STLP_STD::sort( __first, __last, __comp );
+#endif
+}
+
+template <class _RandomAccessIter>
+inline void sort( const execution::parallel_policy& __exec, _RandomAccessIter __first, _RandomAccessIter __last )
+{
+  _STLP_STD::sort( __exec, __first, __last,
+                   less<typename iterator_traits<_RandomAccessIter>::value_type>() );
+}
+
+template <class _RandomAccessIter>
+inline void stable_sort( const execution::sequenced_policy&, _RandomAccessIter __first, _RandomAccessIter __last )
+{ _STLP_STD::stable_sort( __first, __last ); }
+
+template <class _RandomAccessIter, class _Compare>
+inline void stable_sort( const execution::sequenced_policy&, _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp )
+{ _STLP_STD::stable_sort( __first, __last, __comp ); }
+
+template <class _RandomAccessIter, class _Compare>
+void stable_sort( const execution::parallel_policy& __exec, _RandomAccessIter __first, _RandomAccessIter __last, _Compare __comp )
+{
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
+#if defined (_STLP_PTHREADS)
+  _STLP_TRY {
+    _STLP_PRIV __par_stable_sort( __first, __last, __comp, __exec.concurrency() );
+  }
+  _STLP_CATCH_ALL {
+    _STLP_STD::terminate();
+  }
+#else
+  _STLP_STD::stable_sort( __first, __last, __comp );
+#endif
+}
+
+template <class _RandomAccessIter>
+inline void stable_sort( const execution::parallel_policy& __exec, _RandomAccessIter __first, _RandomAccessIter __last )
+{
+  _STLP_STD::stable_sort( __exec, __first, __last,
+                          less<typename iterator_traits<_RandomAccessIter>::value_type>() );
+}
+
+template <class _RandomAccessIter>
+inline void nth_element( const execution::sequenced_policy&, _RandomAccessIter __first,
+                         _RandomAccessIter __nth, _RandomAccessIter __last )
+{ _STLP_STD::nth_element( __first, __nth, __last ); }
+
+template <class _RandomAccessIter, class _Compare>
+inline void nth_element( const execution::sequenced_policy&, _RandomAccessIter __first,
+                         _RandomAccessIter __nth, _RandomAccessIter __last, _Compare __comp )
+{ _STLP_STD::nth_element( __first, __nth, __last, __comp ); }
+
+template <class _RandomAccessIter, class _Compare>
+void nth_element( const execution::parallel_policy& __exec, _RandomAccessIter __first,
+                  _RandomAccessIter __nth, _RandomAccessIter __last, _Compare __comp )
+{
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __nth))
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__nth, __last))
+#if defined (_STLP_PTHREADS)
+  _STLP_TRY {
+    _STLP_PRIV __par_nth_element( __first, __nth, __last, __comp, __exec.concurrency() );
+  }
+  _STLP_CATCH_ALL {
+    _STLP_STD::terminate();
+  }
+#else
+  _STLP_STD::nth_element( __first, __nth, __last, __comp );
+#endif
+}
+
+template <class _RandomAccessIter>
+inline void nth_element( const execution::parallel_policy& __exec, _RandomAccessIter __first,
+                         _RandomAccessIter __nth, _RandomAccessIter __last )
+{
+  _STLP_STD::nth_element( __exec, __first, __nth, __last,
+                          less<typename iterator_traits<_RandomAccessIter>::value_type>() );
+}
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_ALGO_PAR_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_BIT_OPS_H
+#define _STLP_INTERNAL_BIT_OPS_H
+
+/*
+ * Word-level primitives for bit containers (bitset, vector<bool>):
+ * population count and index of lowest/highest set bit, by compiler
+ * builtins where available. Counting over long buffer is done in
+ * library (_Bs_G::_S_count), by popcnt or AVX2 kernel chosen at runtime.
+ * Also bitwise operations over word arrays, shared by bitset and
+ * dynamic_bitset.
+ */
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// structure to aid in counting bits
+class _STLP_CLASS_DECLSPEC _Bs_G
+{
+  public:
+    //returns the number of bit set within the buffer between __beg and __end.
+    static size_t _S_count(const unsigned char *__beg, const unsigned char *__end)
+#if defined (_STLP_USE_NO_IOSTREAMS)
+    {
+      size_t __result = 0;
+      for (; __beg != __end; ++__beg) {
+        for (size_t i = 0; i < (sizeof(unsigned char) * 8); ++i) {
+          if ((*__beg & (1 << i)) != 0) { ++__result; }
+        }
+      }
+      return __result;
+    }
+#else
+      ;
+#endif
+    // number of bits set in both [__beg1, __end1) and buffer at __beg2
+    static size_t _S_count_and(const unsigned char *__beg1, const unsigned char *__end1,
+                               const unsigned char *__beg2)
+#if defined (_STLP_USE_NO_IOSTREAMS)
+    {
+      size_t __result = 0;
+      for (; __beg1 != __end1; ++__beg1, ++__beg2) {
+        for (unsigned char __c = *__beg1 & *__beg2; __c != 0; __c &= __c - 1) { ++__result; }
+      }
+      return __result;
+    }
+#else
+      ;
+#endif
+    // Mapping from 8 bit unsigned integers to the index of the first one bit set:
+    static unsigned char _S_first_one(unsigned char __x)
+#if defined (_STLP_USE_NO_IOSTREAMS)
+    {
+      for (unsigned char i = 0; i < (sizeof(unsigned char) * 8); ++i) {
+        if ((__x & (1 << i)) != 0) { return i; }
+      }
+      return 0;
+    }
+#else
+      ;
+#endif
+};
+
+#if !defined (__GNUC__)
+template <class _Word>
+inline size_t __bit_popcount_aux(_Word __x)
+{
+  size_t __n = 0;
+  for ( ; __x != 0; __x &= __x - 1) {
+    ++__n;
+  }
+  return __n;
+}
+
+// __x != 0
+template <class _Word>
+inline size_t __bit_ctz_aux(_Word __x)
+{
+  size_t __n = 0;
+  for ( ; (__x & 1) == 0; __x >>= 1) {
+    ++__n;
+  }
+  return __n;
+}
+
+// __x != 0
+template <class _Word>
+inline size_t __bit_clz_aux(_Word __x)
+{
+  size_t __n = sizeof(_Word) * CHAR_BIT - 1;
+  for ( ; (__x >>= 1) != 0; ) {
+    --__n;
+  }
+  return __n;
+}
+#endif
+
+// number of set bits
+inline size_t __bit_popcount(unsigned int __x)
+#if defined (__GNUC__)
+{ return __builtin_popcount(__x); }
+#else
+{ return __bit_popcount_aux(__x); }
+#endif
+
+inline size_t __bit_popcount(unsigned long __x)
+#if defined (__GNUC__)
+{ return __builtin_popcountl(__x); }
+#else
+{ return __bit_popcount_aux(__x); }
+#endif
+
+// index of lowest set bit; __x != 0
+inline size_t __bit_ctz(unsigned int __x)
+#if defined (__GNUC__)
+{ return __builtin_ctz(__x); }
+#else
+{ return __bit_ctz_aux(__x); }
+#endif
+
+inline size_t __bit_ctz(unsigned long __x)
+#if defined (__GNUC__)
+{ return __builtin_ctzl(__x); }
+#else
+{ return __bit_ctz_aux(__x); }
+#endif
+
+// number of zero bits above highest set bit; __x != 0
+inline size_t __bit_clz(unsigned int __x)
+#if defined (__GNUC__)
+{ return __builtin_clz(__x); }
+#else
+{ return __bit_clz_aux(__x); }
+#endif
+
+inline size_t __bit_clz(unsigned long __x)
+#if defined (__GNUC__)
+{ return __builtin_clzl(__x); }
+#else
+{ return __bit_clz_aux(__x); }
+#endif
+
+inline size_t __bit_popcount(unsigned char __x)
+{ return __bit_popcount(static_cast<unsigned int>(__x)); }
+inline size_t __bit_popcount(unsigned short __x)
+{ return __bit_popcount(static_cast<unsigned int>(__x)); }
+inline size_t __bit_ctz(unsigned char __x)
+{ return __bit_ctz(static_cast<unsigned int>(__x)); }
+inline size_t __bit_ctz(unsigned short __x)
+{ return __bit_ctz(static_cast<unsigned int>(__x)); }
+inline size_t __bit_clz(unsigned char __x)
+{ return __bit_clz(static_cast<unsigned int>(__x)) - (sizeof(unsigned int) - sizeof(unsigned char)) * CHAR_BIT; }
+inline size_t __bit_clz(unsigned short __x)
+{ return __bit_clz(static_cast<unsigned int>(__x)) - (sizeof(unsigned int) - sizeof(unsigned short)) * CHAR_BIT; }
+
+#if defined (_STLP_LONG_LONG)
+inline size_t __bit_popcount(unsigned _STLP_LONG_LONG __x)
+#  if defined (__GNUC__)
+{ return __builtin_popcountll(__x); }
+#  else
+{ return __bit_popcount_aux(__x); }
+#  endif
+
+inline size_t __bit_ctz(unsigned _STLP_LONG_LONG __x)
+#  if defined (__GNUC__)
+{ return __builtin_ctzll(__x); }
+#  else
+{ return __bit_ctz_aux(__x); }
+#  endif
+
+inline size_t __bit_clz(unsigned _STLP_LONG_LONG __x)
+#  if defined (__GNUC__)
+{ return __builtin_clzll(__x); }
+#  else
+{ return __bit_clz_aux(__x); }
+#  endif
+#endif
+
+// Buffers at least this long (in bytes) are counted by library kernels;
+// shorter are counted inline, call and dispatch would cost more.
+#define _STLP_BIT_COUNT_THRESHOLD 64
+
+template <class _Word>
+inline size_t __bit_count(const _Word* __first, const _Word* __last)
+{
+  if ( static_cast<size_t>(__last - __first) * sizeof(_Word) >= _STLP_BIT_COUNT_THRESHOLD ) {
+    return _Bs_G::_S_count(__REINTERPRET_CAST(const unsigned char*, __first),
+                           __REINTERPRET_CAST(const unsigned char*, __last));
+  }
+  size_t __n = 0;
+  for ( ; __first != __last; ++__first ) {
+    __n += __bit_popcount(*__first);
+  }
+  return __n;
+}
+
+// Index of first set bit in [__first, __last) starting from bit __pos,
+// or __not_found; __pos < (__last - __first) * bits in _Word.
+template <class _Word>
+inline size_t __bit_find_next(const _Word* __first, const _Word* __last, size_t __pos, size_t __not_found)
+{
+  const size_t __bits = sizeof(_Word) * CHAR_BIT;
+  const _Word* __p = __first + __pos / __bits;
+  _Word __w = __STATIC_CAST(_Word, *__p & (__STATIC_CAST(_Word, ~__STATIC_CAST(_Word, 0)) << (__pos % __bits)));
+
+  for ( ; ; ) {
+    if ( __w != 0 ) {
+      return (__p - __first) * __bits + __bit_ctz(__w);
+    }
+    if ( ++__p == __last ) {
+      return __not_found;
+    }
+    __w = *__p;
+  }
+}
+
+template <class _Word>
+inline size_t __bit_count_and(const _Word* __first1, const _Word* __last1, const _Word* __first2)
+{
+  if ( static_cast<size_t>(__last1 - __first1) * sizeof(_Word) >= _STLP_BIT_COUNT_THRESHOLD ) {
+    return _Bs_G::_S_count_and(__REINTERPRET_CAST(const unsigned char*, __first1),
+                               __REINTERPRET_CAST(const unsigned char*, __last1),
+                               __REINTERPRET_CAST(const unsigned char*, __first2));
+  }
+  size_t __n = 0;
+  for ( ; __first1 != __last1; ++__first1, ++__first2 ) {
+    __n += __bit_popcount(static_cast<_Word>(*__first1 & *__first2));
+  }
+  return __n;
+}
+
+/*
+ * Bitwise operations over word arrays go by SIMD packets of GCC vector
+ * extensions, 16 bytes or 32 bytes when compiled with AVX2, with scalar
+ * loop for tail; operation functors work on words and packets alike.
+ */
+#if defined (__GNUC__) && ((__GNUC__ >= 5) || defined (__clang__)) && !defined (_STLP_NO_SSE2)
+#  define _STLP_BIT_OPS_SIMD
+#  if defined (__AVX2__)
+#    define _STLP_BIT_OPS_SIMD_BYTES 32
+#  else
+#    define _STLP_BIT_OPS_SIMD_BYTES 16
+#  endif
+#endif
+
+struct _Bit_and
+{
+    template <class _Tp>
+    _Tp operator()(_Tp __x, _Tp __y) const
+      { return __x & __y; }
+};
+
+struct _Bit_or
+{
+    template <class _Tp>
+    _Tp operator()(_Tp __x, _Tp __y) const
+      { return __x | __y; }
+};
+
+struct _Bit_xor
+{
+    template <class _Tp>
+    _Tp operator()(_Tp __x, _Tp __y) const
+      { return __x ^ __y; }
+};
+
+// bits of __x that aren't in __y
+struct _Bit_and_not
+{
+    template <class _Tp>
+    _Tp operator()(_Tp __x, _Tp __y) const
+      { return __x & ~__y; }
+};
+
+// __p[i] = __op(__p[i], __q[i]) for i in [0, __n)
+template <class _Word, class _Op>
+inline void __bit_transform(_Word* __p, const _Word* __q, size_t __n, _Op __op)
+{
+#if defined (_STLP_BIT_OPS_SIMD)
+  typedef _Word _Packet __attribute__((__vector_size__(_STLP_BIT_OPS_SIMD_BYTES)));
+  const size_t __w = sizeof(_Packet) / sizeof(_Word);
+  for ( ; __n >= __w; __n -= __w, __p += __w, __q += __w ) {
+    _Packet __x, __y;
+    __builtin_memcpy(&__x, __p, sizeof(_Packet));
+    __builtin_memcpy(&__y, __q, sizeof(_Packet));
+    __x = __op(__x, __y);
+    __builtin_memcpy(__p, &__x, sizeof(_Packet));
+  }
+#endif
+  for ( ; __n != 0; --__n, ++__p, ++__q ) {
+    *__p = __op(*__p, *__q);
+  }
+}
+
+// true if __op(__p[i], __q[i]) is zero for every i in [0, __n)
+template <class _Word, class _Op>
+inline bool __bit_none_of(const _Word* __p, const _Word* __q, size_t __n, _Op __op)
+{
+#if defined (_STLP_BIT_OPS_SIMD)
+  typedef _Word _Packet __attribute__((__vector_size__(_STLP_BIT_OPS_SIMD_BYTES)));
+  const size_t __w = sizeof(_Packet) / sizeof(_Word);
+  // check for early exit once per four packets
+  for ( ; __n >= 4 * __w; __n -= 4 * __w ) {
+    _Packet __acc = _Packet();
+    for ( int __k = 0; __k < 4; ++__k, __p += __w, __q += __w ) {
+      _Packet __x, __y;
+      __builtin_memcpy(&__x, __p, sizeof(_Packet));
+      __builtin_memcpy(&__y, __q, sizeof(_Packet));
+      __acc |= __op(__x, __y);
+    }
+    _Word __r = 0;
+    for ( size_t __i = 0; __i < __w; ++__i ) {
+      __r |= __acc[__i];
+    }
+    if ( __r != 0 ) {
+      return false;
+    }
+  }
+#endif
+  for ( ; __n != 0; --__n, ++__p, ++__q ) {
+    if ( __op(*__p, *__q) != 0 ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_BIT_OPS_H */
+
+// Local Variables:
+// mode:C++
+// End:
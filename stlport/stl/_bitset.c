@@ -86,23 +86,7 @@ unsigned long _Base_bitset<_Nw>::_M_do_to_ulong() const {
 
 template<size_t _Nw>
 size_t _Base_bitset<_Nw>::_M_do_find_first(size_t __not_found) const {
-  for ( size_t __i = 0; __i < _Nw; __i++ ) {
-    _WordT __thisword = _M_w[__i];
-    if ( __thisword != __STATIC_CAST(_WordT,0) ) {
-      // find byte within word
-      for ( size_t __j = 0; __j < sizeof(_WordT); __j++ ) {
-        unsigned char __this_byte
-          = __STATIC_CAST(unsigned char,(__thisword & (~(unsigned char)0)));
-        if ( __this_byte )
-          return __i*__BITS_PER_WORD + __j*CHAR_BIT +
-            _Bs_G::_S_first_one(__this_byte);
-
-        __thisword >>= CHAR_BIT;
-      }
-    }
-  }
-  // not found, so return an indication of failure.
-  return __not_found;
+  return __bit_find_next(_M_w + 0, _M_w + _Nw, 0, __not_found);
 }
 
 template<size_t _Nw>
@@ -116,48 +100,7 @@ _Base_bitset<_Nw>::_M_do_find_next(size_t __prev,
   if ( __prev >= _Nw * __BITS_PER_WORD )
     return __not_found;
 
-    // search first word
-  size_t __i = _S_whichword(__prev);
-  _WordT __thisword = _M_w[__i];
-
-    // mask off bits below bound
-  __thisword &= (~__STATIC_CAST(_WordT,0)) << _S_whichbit(__prev);
-
-  if ( __thisword != __STATIC_CAST(_WordT,0) ) {
-    // find byte within word
-    // get first byte into place
-    __thisword >>= _S_whichbyte(__prev) * CHAR_BIT;
-    for ( size_t __j = _S_whichbyte(__prev); __j < sizeof(_WordT); ++__j ) {
-      unsigned char __this_byte
-        = __STATIC_CAST(unsigned char,(__thisword & (~(unsigned char)0)));
-      if ( __this_byte )
-        return __i*__BITS_PER_WORD + __j*CHAR_BIT +
-          _Bs_G::_S_first_one(__this_byte);
-
-      __thisword >>= CHAR_BIT;
-    }
-  }
-
-  // check subsequent words
-  ++__i;
-  for ( ; __i < _Nw; ++__i ) {
-    /* _WordT */ __thisword = _M_w[__i];
-    if ( __thisword != __STATIC_CAST(_WordT,0) ) {
-      // find byte within word
-      for ( size_t __j = 0; __j < sizeof(_WordT); ++__j ) {
-        unsigned char __this_byte
-          = __STATIC_CAST(unsigned char,(__thisword & (~(unsigned char)0)));
-        if ( __this_byte )
-          return __i*__BITS_PER_WORD + __j*CHAR_BIT +
-            _Bs_G::_S_first_one(__this_byte);
-
-        __thisword >>= CHAR_BIT;
-      }
-    }
-  }
-
-  // not found, so return an indication of failure.
-  return __not_found;
+  return __bit_find_next(_M_w + 0, _M_w + _Nw, __prev, __not_found);
 } // end _M_do_find_next
 
 _STLP_MOVE_TO_STD_NAMESPACE
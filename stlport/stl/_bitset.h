@@ -59,6 +59,10 @@
 #  include <stl/_string.h>
 #endif
 
+#ifndef _STLP_INTERNAL_BIT_OPS_H
+#  include <stl/_bit_ops.h>
+#endif
+
 #define __BITS_PER_WORD (CHAR_BIT*sizeof(unsigned long))
 #define __BITSET_WORDS(__n) ((__n + __BITS_PER_WORD - 1)/__BITS_PER_WORD)
 
@@ -66,39 +70,6 @@ _STLP_BEGIN_NAMESPACE
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
 
-// structure to aid in counting bits
-class _STLP_CLASS_DECLSPEC _Bs_G
-{
-  public:
-    //returns the number of bit set within the buffer between __beg and __end.
-    static size_t _S_count(const unsigned char *__beg, const unsigned char *__end)
-#if defined (_STLP_USE_NO_IOSTREAMS)
-    {
-      size_t __result = 0;
-      for (; __beg != __end; ++__beg) {
-        for (size_t i = 0; i < (sizeof(unsigned char) * 8); ++i) {
-          if ((*__beg & (1 << i)) != 0) { ++__result; }
-        }
-      }
-      return __result;
-    }
-#else
-      ;
-#endif
-    // Mapping from 8 bit unsigned integers to the index of the first one bit set:
-    static unsigned char _S_first_one(unsigned char __x)
-#if defined (_STLP_USE_NO_IOSTREAMS)
-    {
-      for (unsigned char i = 0; i < (sizeof(unsigned char) * 8); ++i) {
-        if ((__x & (1 << i)) != 0) { return i; }
-      }
-      return 0;
-    }
-#else
-      ;
-#endif
-};
-
 //
 // Base class: general case.
 //
@@ -136,21 +107,15 @@ struct _Base_bitset {
   _WordT  _M_hiword() const { return _M_w[_Nw - 1]; }
 
   void _M_do_and(const _Base_bitset<_Nw>& __x) {
-    for ( size_t __i = 0; __i < _Nw; __i++ ) {
-      _M_w[__i] &= __x._M_w[__i];
-    }
+    __bit_transform(_M_w + 0, __x._M_w + 0, _Nw, _Bit_and());
   }
 
   void _M_do_or(const _Base_bitset<_Nw>& __x) {
-    for ( size_t __i = 0; __i < _Nw; __i++ ) {
-      _M_w[__i] |= __x._M_w[__i];
-    }
+    __bit_transform(_M_w + 0, __x._M_w + 0, _Nw, _Bit_or());
   }
 
   void _M_do_xor(const _Base_bitset<_Nw>& __x) {
-    for ( size_t __i = 0; __i < _Nw; __i++ ) {
-      _M_w[__i] ^= __x._M_w[__i];
-    }
+    __bit_transform(_M_w + 0, __x._M_w + 0, _Nw, _Bit_xor());
   }
 
   void _M_do_left_shift(size_t __shift);
@@ -188,10 +153,7 @@ struct _Base_bitset {
   }
 
   size_t _M_do_count() const {
-    const unsigned char* __byte_ptr = (const unsigned char*)_M_w;
-    const unsigned char* __end_ptr = (const unsigned char*)(_M_w+_Nw);
-
-    return _Bs_G::_S_count(__byte_ptr, __end_ptr);
+    return __bit_count(_M_w, _M_w + _Nw);
   }
 
   unsigned long _M_do_to_ulong() const;
@@ -252,9 +214,7 @@ struct _Base_bitset<1UL> {
   }
 
   size_t _M_do_count() const {
-    const unsigned char* __byte_ptr = (const unsigned char*)&_M_w;
-    const unsigned char* __end_ptr = ((const unsigned char*)&_M_w)+sizeof(_M_w);
-    return _Bs_G::_S_count(__byte_ptr, __end_ptr);
+    return __bit_popcount(_M_w);
   }
 
   unsigned long _M_do_to_ulong() const { return _M_w; }
@@ -273,22 +233,7 @@ struct _Base_bitset<1UL> {
 //
 inline size_t
 _Base_bitset<1UL>::_M_do_find_first(size_t __not_found) const {
-  //  typedef unsigned long _WordT;
-  _WordT __thisword = _M_w;
-
-  if ( __thisword != __STATIC_CAST(_WordT,0) ) {
-    // find byte within word
-    for ( size_t __j = 0; __j < sizeof(_WordT); __j++ ) {
-      unsigned char __this_byte
-        = __STATIC_CAST(unsigned char,(__thisword & (~(unsigned char)0)));
-      if ( __this_byte )
-        return __j*CHAR_BIT + _Bs_G::_S_first_one(__this_byte);
-
-      __thisword >>= CHAR_BIT;
-    }
-  }
-  // not found, so return a value that indicates failure.
-  return __not_found;
+  return _M_w != 0 ? __bit_ctz(_M_w) : __not_found;
 }
 
 inline size_t
@@ -301,28 +246,10 @@ _Base_bitset<1UL>::_M_do_find_next(size_t __prev,
   if ( __prev >= __BITS_PER_WORD )
     return __not_found;
 
-    // search first (and only) word
-  _WordT __thisword = _M_w;
-
   // mask off bits below bound
-  __thisword &= (~__STATIC_CAST(_WordT,0)) << _S_whichbit(__prev);
-
-  if ( __thisword != __STATIC_CAST(_WordT,0) ) {
-    // find byte within word
-    // get first byte into place
-    __thisword >>= _S_whichbyte(__prev) * CHAR_BIT;
-    for ( size_t __j = _S_whichbyte(__prev); __j < sizeof(_WordT); __j++ ) {
-      unsigned char __this_byte
-        = __STATIC_CAST(unsigned char,(__thisword & (~(unsigned char)0)));
-      if ( __this_byte )
-        return __j*CHAR_BIT + _Bs_G::_S_first_one(__this_byte);
-
-      __thisword >>= CHAR_BIT;
-    }
-  }
+  _WordT __thisword = _M_w & ((~__STATIC_CAST(_WordT,0)) << _S_whichbit(__prev));
 
-  // not found, so return a value that indicates failure.
-  return __not_found;
+  return __thisword != 0 ? __bit_ctz(__thisword) : __not_found;
 } // end _M_do_find_next
 
 
@@ -32,6 +32,10 @@
 
 #  include <vector>
 
+#ifndef _STLP_INTERNAL_BIT_OPS_H
+#  include <stl/_bit_ops.h>
+#endif
+
 #define _STLP_WORD_BIT (int(CHAR_BIT * sizeof(unsigned int)))
 
 _STLP_BEGIN_NAMESPACE
@@ -686,6 +690,63 @@ public:
       *__p = ~*__p;
   }
 
+  // Extensions: word at a time operations. Bits of last chunk that are
+  // beyond end() aren't kept zero, so they are masked off here.
+
+  // number of true elements
+  size_type count() const {
+    size_type __n = _STLP_PRIV __bit_count(__STATIC_CAST(const __chunk_type*, this->_M_start._M_p),
+                                           __STATIC_CAST(const __chunk_type*, this->_M_finish._M_p));
+    if (this->_M_finish._M_offset != 0)
+      __n += _STLP_PRIV __bit_popcount(*this->_M_finish._M_p & _M_tail_mask());
+    return __n;
+  }
+  bool any() const { return find_first() != size(); }
+  bool none() const { return find_first() == size(); }
+
+  // position of first true element, size() if there is no one
+  size_type find_first() const
+  { return empty() ? 0 : _M_find_from(0); }
+  // position of first true element after __prev, size() if there is no one
+  size_type find_next(size_type __prev) const
+  { return ++__prev < size() ? _M_find_from(__prev) : size(); }
+
+  // element-wise operations; __x must be of the same size
+  _Self& operator&=(const _Self& __x) {
+    __chunk_type* __p = this->_M_start._M_p;
+    for (const __chunk_type* __q = __x._M_start._M_p; __q != __x._M_chunks_end(); ++__p, ++__q)
+      *__p &= *__q;
+    return *this;
+  }
+  _Self& operator|=(const _Self& __x) {
+    __chunk_type* __p = this->_M_start._M_p;
+    for (const __chunk_type* __q = __x._M_start._M_p; __q != __x._M_chunks_end(); ++__p, ++__q)
+      *__p |= *__q;
+    return *this;
+  }
+  _Self& operator^=(const _Self& __x) {
+    __chunk_type* __p = this->_M_start._M_p;
+    for (const __chunk_type* __q = __x._M_start._M_p; __q != __x._M_chunks_end(); ++__p, ++__q)
+      *__p ^= *__q;
+    return *this;
+  }
+
+private:
+  // mask of bits of last (partial) chunk that are before end()
+  __chunk_type _M_tail_mask() const
+  { return ~__STATIC_CAST(__chunk_type, 0) >> (_STLP_WORD_BIT - this->_M_finish._M_offset); }
+  const __chunk_type* _M_chunks_end() const
+  { return this->_M_finish._M_p + (this->_M_finish._M_offset != 0 ? 1 : 0); }
+  // __pos < size()
+  size_type _M_find_from(size_type __pos) const {
+    size_type __r = _STLP_PRIV __bit_find_next(__STATIC_CAST(const __chunk_type*, this->_M_start._M_p),
+                                               _M_chunks_end(), __pos, size());
+    // garbage bits beyond end() may be found too
+    return __r < size() ? __r : size();
+  }
+
+public:
+
   void clear() { erase(begin(), end()); }
 };
 
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_CHARCONV_H
+#define _STLP_INTERNAL_CHARCONV_H
+
+#include <type_traits>
+#include <limits>
+#include <system_error>
+
+#ifndef _STLP_INTERNAL_NUM_DIGITS_H
+#  include <stl/_num_digits.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+/*
+ * to_chars/from_chars: conversions in caller's buffer, without locale,
+ * allocation or exceptions. Integers are converted inline; floating
+ * point goes to library, to the same digit engines as num_put/num_get.
+ */
+
+enum class chars_format
+{
+  scientific = _STLP_PRIV __chars_scientific,
+  fixed = _STLP_PRIV __chars_fixed,
+  hex = _STLP_PRIV __chars_hex,
+  general = _STLP_PRIV __chars_general
+};
+
+constexpr chars_format operator &(chars_format __l, chars_format __r)
+{ return static_cast<chars_format>(static_cast<int>(__l) & static_cast<int>(__r)); }
+constexpr chars_format operator |(chars_format __l, chars_format __r)
+{ return static_cast<chars_format>(static_cast<int>(__l) | static_cast<int>(__r)); }
+constexpr chars_format operator ^(chars_format __l, chars_format __r)
+{ return static_cast<chars_format>(static_cast<int>(__l) ^ static_cast<int>(__r)); }
+constexpr chars_format operator ~(chars_format __f)
+{ return static_cast<chars_format>(~static_cast<int>(__f) & (_STLP_PRIV __chars_general | _STLP_PRIV __chars_hex)); }
+inline chars_format& operator &=(chars_format& __l, chars_format __r)
+{ return __l = __l & __r; }
+inline chars_format& operator |=(chars_format& __l, chars_format __r)
+{ return __l = __l | __r; }
+inline chars_format& operator ^=(chars_format& __l, chars_format __r)
+{ return __l = __l ^ __r; }
+
+struct to_chars_result
+{
+    char* ptr;
+    errc ec;
+};
+
+struct from_chars_result
+{
+    const char* ptr;
+    errc ec;
+};
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+inline to_chars_result _STLP_CALL
+__to_chars_unsigned(char* __first, char* __last, uint64_t __u, int __base)
+{
+  static const char __digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  if (__base == 10) {
+    const int __n = __decimal_length(__u);
+    if (__last - __first < __n) {
+      to_chars_result __r = { __last, errc::value_too_large };
+      return __r;
+    }
+    __write_decimal_digits(__first + __n, __u);
+    to_chars_result __r = { __first + __n, errc() };
+    return __r;
+  }
+
+  if ((__base & (__base - 1)) == 0) { // 2, 4, 8, 16, 32: shifts only
+    int __shift = 0;
+    while ((1 << __shift) != __base) {
+      ++__shift;
+    }
+    int __n = 1;
+    for (uint64_t __t = __u >> __shift; __t != 0; __t >>= __shift) {
+      ++__n;
+    }
+    if (__last - __first < __n) {
+      to_chars_result __r = { __last, errc::value_too_large };
+      return __r;
+    }
+    for (char* __p = __first + __n; __p != __first; __u >>= __shift) {
+      *--__p = __digits[__u & (__base - 1)];
+    }
+    to_chars_result __r = { __first + __n, errc() };
+    return __r;
+  }
+
+  char __buf[64];
+  char* __p = __buf + sizeof(__buf);
+  do {
+    *--__p = __digits[__u % __base];
+    __u /= __base;
+  } while (__u != 0);
+  const ptrdiff_t __n = __buf + sizeof(__buf) - __p;
+  if (__last - __first < __n) {
+    to_chars_result __r = { __last, errc::value_too_large };
+    return __r;
+  }
+  memcpy(__first, __p, __n);
+  to_chars_result __r = { __first + __n, errc() };
+  return __r;
+}
+
+template <class _Int>
+inline to_chars_result _STLP_CALL
+__to_chars_int(char* __first, char* __last, _Int __x, int __base, const true_type& /* signed */)
+{
+  uint64_t __u = static_cast<uint64_t>(__x);
+  if (__x < 0) {
+    if (__first == __last) {
+      to_chars_result __r = { __last, errc::value_too_large };
+      return __r;
+    }
+    *__first++ = '-';
+    __u = 0 - __u;
+  }
+  return __to_chars_unsigned(__first, __last, __u, __base);
+}
+
+template <class _Int>
+inline to_chars_result _STLP_CALL
+__to_chars_int(char* __first, char* __last, _Int __x, int __base, const false_type& /* signed */)
+{ return __to_chars_unsigned(__first, __last, static_cast<uint64_t>(__x), __base); }
+
+inline to_chars_result _STLP_CALL
+__to_chars_float_result(char* __first, char* __last, int __err)
+{
+  to_chars_result __r = { __err == 0 ? __first : __last, static_cast<errc>(__err) };
+  return __r;
+}
+
+inline from_chars_result _STLP_CALL
+__from_chars_float_result(const char* __p, int __err)
+{
+  from_chars_result __r = { __p, static_cast<errc>(__err) };
+  return __r;
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+// integers; __base is 2..36
+
+template <class _Int>
+inline typename enable_if<is_integral<_Int>::value, to_chars_result>::type
+to_chars(char* __first, char* __last, _Int __x, int __base = 10)
+{
+  return _STLP_PRIV __to_chars_int(__first, __last, __x, __base,
+                                   integral_constant<bool, numeric_limits<_Int>::is_signed>());
+}
+
+to_chars_result to_chars(char*, char*, bool, int = 10) = delete;
+
+template <class _Int>
+typename enable_if<is_integral<_Int>::value, from_chars_result>::type
+from_chars(const char* __first, const char* __last, _Int& __x, int __base = 10)
+{
+  const char* __p = __first;
+  bool __neg = false;
+  if (numeric_limits<_Int>::is_signed && __p != __last && *__p == '-') {
+    __neg = true;
+    ++__p;
+  }
+  uint64_t __v;
+  bool __overflow = false;
+  const char* __e = __base == 10 ?
+    _STLP_PRIV __parse_decimal(__p, __last, __v, __overflow) :
+    _STLP_PRIV __parse_digits(__p, __last, __base, __v, __overflow);
+  if (__e == __p) {
+    from_chars_result __r = { __first, errc::invalid_argument };
+    return __r;
+  }
+  // magnitude of min() is 0 - min() in two's complement
+  const uint64_t __max = __neg ?
+    uint64_t(0) - static_cast<uint64_t>(numeric_limits<_Int>::min()) :
+    static_cast<uint64_t>(numeric_limits<_Int>::max());
+  if (__overflow || __v > __max) {
+    from_chars_result __r = { __e, errc::result_out_of_range };
+    return __r;
+  }
+  __x = static_cast<_Int>(__neg ? uint64_t(0) - __v : __v);
+  from_chars_result __r = { __e, errc() };
+  return __r;
+}
+
+from_chars_result from_chars(const char*, const char*, bool&, int = 10) = delete;
+
+/*
+ * Floating point. Without format: shortest of fixed and scientific
+ * that read back exactly; with format only: shortest in that format;
+ * with precision: as printf with %f, %e, %g or %a.
+ */
+
+#define _STLP_TO_CHARS_FLOAT(_Tp)                                                  \
+inline to_chars_result to_chars(char* __first, char* __last, _Tp __x)              \
+{                                                                                  \
+  int __err = 0;                                                                   \
+  char* __p = _STLP_PRIV __to_chars_float(__first, __last, __x,                    \
+                                          _STLP_PRIV __chars_plain, -1, __err);    \
+  return _STLP_PRIV __to_chars_float_result(__p, __last, __err);                   \
+}                                                                                  \
+inline to_chars_result to_chars(char* __first, char* __last, _Tp __x,              \
+                                chars_format __fmt)                                \
+{                                                                                  \
+  int __err = 0;                                                                   \
+  char* __p = _STLP_PRIV __to_chars_float(__first, __last, __x,                    \
+                                          static_cast<int>(__fmt), -1, __err);     \
+  return _STLP_PRIV __to_chars_float_result(__p, __last, __err);                   \
+}                                                                                  \
+inline to_chars_result to_chars(char* __first, char* __last, _Tp __x,              \
+                                chars_format __fmt, int __precision)               \
+{                                                                                  \
+  int __err = 0;                                                                   \
+  char* __p = _STLP_PRIV __to_chars_float(__first, __last, __x,                    \
+                                          static_cast<int>(__fmt),                 \
+                                          __precision < 0 ? 6 : __precision,       \
+                                          __err);                                  \
+  return _STLP_PRIV __to_chars_float_result(__p, __last, __err);                   \
+}                                                                                  \
+inline from_chars_result from_chars(const char* __first, const char* __last,       \
+                                    _Tp& __x,                                      \
+                                    chars_format __fmt = chars_format::general)    \
+{                                                                                  \
+  int __err = 0;                                                                   \
+  const char* __p = _STLP_PRIV __from_chars_float(__first, __last, __x,            \
+                                                  static_cast<int>(__fmt), __err); \
+  return _STLP_PRIV __from_chars_float_result(__p, __err);                         \
+}
+
+_STLP_TO_CHARS_FLOAT(float)
+_STLP_TO_CHARS_FLOAT(double)
+#if !defined (_STLP_NO_LONG_DOUBLE)
+_STLP_TO_CHARS_FLOAT(long double)
+#endif
+
+#undef _STLP_TO_CHARS_FLOAT
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_CHARCONV_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -79,7 +79,7 @@ void deque<_Tp,_Alloc>::_M_create_nodes(_Tp** __nstart, _Tp** __nfinish )
   _Tp** __cur = __nstart;
   _STLP_TRY {
     for ( ; __cur < __nfinish; ++__cur ) {
-      *__cur = _M_map_size.allocate(this->buffer_size());
+      *__cur = _M_allocate_node();
     }
   }
   _STLP_UNWIND(_M_destroy_nodes(__nstart, __cur))
@@ -89,7 +89,7 @@ template <class _Tp, class _Alloc >
 void deque<_Tp,_Alloc>::_M_destroy_nodes( _Tp** __nstart, _Tp** __nfinish )
 {
   for ( _Tp** __n = __nstart; __n < __nfinish; ++__n ) {
-    _M_map_size.deallocate(*__n, this->buffer_size());
+    _M_deallocate_node(*__n);
   }
 }
 
@@ -140,11 +140,11 @@ __iterator__ deque<_Tp,_Alloc>::_M_erase( iterator __pos, const false_type& /* t
     //starting from the rightmost element to move.
     iterator __src = __pos, __dst = __pos;
     _Self::get_allocator().destroy( &(*__dst) );
-    if (__src != this->_M_start) {
-      for (--__src; __dst != this->_M_start; --__src, --__dst) {
-        _Self::get_allocator().construct( &(*__dst), _STLP_STD::move(*__src) );
-        _Self::get_allocator().destroy( &(*__src) );
-      }
+    while (__dst != this->_M_start) {
+      --__src; // don't step before _M_start: node before it may be out of map
+      _Self::get_allocator().construct( &(*__dst), _STLP_STD::move(*__src) );
+      _Self::get_allocator().destroy( &(*__src) );
+      __dst = __src;
     }
     _M_pop_front_aux();
   } else {
@@ -186,26 +186,16 @@ __iterator__ deque<_Tp,_Alloc>::_M_erase(iterator __first, iterator __last, cons
   difference_type __n = __last - __first;
   difference_type __elems_before = __first - this->_M_start;
   if (__elems_before <= difference_type(this->size() - __n) / 2) {
+    //Every destination is alive: either erased element or moved-from one;
+    //never step before _M_start: node before it may be out of map
     iterator __src = __first, __dst = __last;
-    if (__src != this->_M_start) {
-      for (--__src, --__dst; (__src >= this->_M_start) && (__dst >= __first); --__src, --__dst) {
-        _Self::get_allocator().destroy( &(*__dst) );
-        _Self::get_allocator().construct( &(*__dst), _STLP_STD::move(*__src) );
-      }
-      if (__dst >= __first) {
-        //There are more elements to erase than elements to move
-        _STLP_STD::detail::_Destroy_Range( this->_M_start, ++__dst );
-      } else {
-        //There are more elements to move than elements to erase
-        for (; __src >= this->_M_start; --__src, --__dst) {
-          _Self::get_allocator().destroy( &(*__dst) );
-          _Self::get_allocator().construct( &(*__dst), _STLP_STD::move(*__src) );
-        }
-        _STLP_STD::detail::_Destroy_Range( this->_M_start, ++__dst );
-      }
-    } else {
-      _STLP_STD::detail::_Destroy_Range(this->_M_start, __last);
+    while (__src != this->_M_start) {
+      --__src;
+      --__dst;
+      _Self::get_allocator().destroy( &(*__dst) );
+      _Self::get_allocator().construct( &(*__dst), _STLP_STD::move(*__src) );
     }
+    _STLP_STD::detail::_Destroy_Range( this->_M_start, __dst );
     iterator __new_start = this->_M_start + __n;
     this->_M_destroy_nodes(this->_M_start._M_node, __new_start._M_node);
     this->_M_start = __new_start;
@@ -263,13 +253,13 @@ void deque<_Tp,_Alloc>::clear()
 {
   for ( _Map_pointer __node = this->_M_start._M_node + 1; __node < this->_M_finish._M_node; ++__node) {
     _STLP_STD::detail::_Destroy_Range( *__node, *__node + this->buffer_size() );
-    this->_M_map_size.deallocate(*__node, this->buffer_size());
+    this->_M_deallocate_node(*__node);
   }
 
   if (this->_M_start._M_node != this->_M_finish._M_node) {
     _STLP_STD::detail::_Destroy_Range( this->_M_start._M_cur, this->_M_start._M_last );
     _STLP_STD::detail::_Destroy_Range( this->_M_finish._M_first, this->_M_finish._M_cur );
-    this->_M_map_size.deallocate(this->_M_finish._M_first, this->buffer_size());
+    this->_M_deallocate_node(this->_M_finish._M_first);
   } else {
     _STLP_STD::detail::_Destroy_Range( this->_M_start._M_cur, this->_M_finish._M_cur );
   }
@@ -298,14 +288,13 @@ template <class _Tp, class _Alloc >
 void deque<_Tp,_Alloc>::_M_push_back_aux_v(const value_type& __t)
 {
   _M_reserve_map_at_back();
-  *(this->_M_finish._M_node + 1) = this->_M_map_size.allocate(this->buffer_size());
+  *(this->_M_finish._M_node + 1) = this->_M_allocate_node();
   _STLP_TRY {
     _Self::get_allocator().construct( this->_M_finish._M_cur, __t );
     this->_M_finish._M_set_node(this->_M_finish._M_node + 1);
     this->_M_finish._M_cur = this->_M_finish._M_first;
   }
-  _STLP_UNWIND(this->_M_map_size.deallocate(*(this->_M_finish._M_node + 1),
-                                            this->buffer_size()))
+  _STLP_UNWIND(this->_M_deallocate_node(*(this->_M_finish._M_node + 1)))
 }
 
 // Called only if this->_M_start._M_cur == this->_M_start._M_first.
@@ -313,21 +302,21 @@ template <class _Tp, class _Alloc >
 void deque<_Tp,_Alloc>::_M_push_front_aux_v(const value_type& __t)
 {
   _M_reserve_map_at_front();
-  *(this->_M_start._M_node - 1) = this->_M_map_size.allocate(this->buffer_size());
+  *(this->_M_start._M_node - 1) = this->_M_allocate_node();
   _STLP_TRY {
     this->_M_start._M_set_node(this->_M_start._M_node - 1);
     this->_M_start._M_cur = this->_M_start._M_last - 1;
     _Self::get_allocator().construct( this->_M_start._M_cur, __t );
   }
   _STLP_UNWIND((++this->_M_start,
-                this->_M_map_size.deallocate(*(this->_M_start._M_node - 1), this->buffer_size())))
+                this->_M_deallocate_node(*(this->_M_start._M_node - 1))))
 }
 
 // Called only if this->_M_finish._M_cur == this->_M_finish._M_first.
 template <class _Tp, class _Alloc >
 void deque<_Tp,_Alloc>::_M_pop_back_aux()
 {
-  this->_M_map_size.deallocate(this->_M_finish._M_first, this->buffer_size());
+  this->_M_deallocate_node(this->_M_finish._M_first);
   this->_M_finish._M_set_node(this->_M_finish._M_node - 1);
   this->_M_finish._M_cur = this->_M_finish._M_last - 1;
 }
@@ -341,7 +330,7 @@ void deque<_Tp,_Alloc>::_M_pop_front_aux()
   if (this->_M_start._M_cur != this->_M_start._M_last - 1) {
     ++this->_M_start._M_cur;
   } else {
-    this->_M_map_size.deallocate(this->_M_start._M_first, this->buffer_size());
+    this->_M_deallocate_node(this->_M_start._M_first);
     this->_M_start._M_set_node(this->_M_start._M_node + 1);
     this->_M_start._M_cur = this->_M_start._M_first;
   }
@@ -450,11 +439,11 @@ void deque<_Tp,_Alloc>::_M_new_elements_at_front(size_type __new_elems)
   size_type __i = 1;
   _STLP_TRY {
     for ( ; __i <= __new_nodes; ++__i ) {
-      *(this->_M_start._M_node - __i) = this->_M_map_size.allocate(this->buffer_size());
+      *(this->_M_start._M_node - __i) = this->_M_allocate_node();
     }
   }
   _STLP_UNWIND(for (size_type __j = 1; __j < __i; ++__j)
-                 this->_M_map_size.deallocate(*(this->_M_start._M_node - __j), this->buffer_size()))
+                 this->_M_deallocate_node(*(this->_M_start._M_node - __j)))
 }
 
 template <class _Tp, class _Alloc >
@@ -465,11 +454,11 @@ void deque<_Tp,_Alloc>::_M_new_elements_at_back( size_type __new_elems )
   size_type __i = 1;
   _STLP_TRY {
     for ( ; __i <= __new_nodes; ++__i ) {
-      *(this->_M_finish._M_node + __i) = this->_M_map_size.allocate(this->buffer_size());
+      *(this->_M_finish._M_node + __i) = this->_M_allocate_node();
     }
   }
   _STLP_UNWIND(for (size_type __j = 1; __j < __i; ++__j)
-                 this->_M_map_size.deallocate(*(this->_M_finish._M_node + __j), this->buffer_size()))
+                 this->_M_deallocate_node(*(this->_M_finish._M_node + __j)))
 }
 
 template <class _Tp, class _Alloc >
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_DYNAMIC_BITSET_H
+#define _STLP_INTERNAL_DYNAMIC_BITSET_H
+
+#  include <vector>
+
+#ifndef _STLP_RANGE_ERRORS_H
+#  include <stl/_range_errors.h>
+#endif
+
+#ifndef _STLP_INTERNAL_BIT_OPS_H
+#  include <stl/_bit_ops.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+/*
+ * Bitset with size chosen at runtime. Bits are kept in vector of blocks,
+ * bit i is bit i % bits_per_block of block i / bits_per_block; unused
+ * high-order bits of last block are always zero (as for bitset<>), so
+ * count, find and comparison work on whole blocks.
+ *
+ * Set operations (&=, |=, ^=, -=, is_subset_of, intersects,
+ * intersection_count, ==) require operands of the same size; they go
+ * through the same word-level code as bitset<> (stl/_bit_ops.h).
+ */
+template <_STLP_DFL_TMPL_PARAM(_Block, unsigned long),
+          _STLP_DFL_TMPL_PARAM(_Alloc, allocator<_Block>) >
+class dynamic_bitset
+{
+  typedef dynamic_bitset<_Block, _Alloc> _Self;
+  typedef vector<_Block, _Alloc> _Buffer;
+public:
+  typedef _Block block_type;
+  typedef _Alloc allocator_type;
+  typedef size_t size_type;
+
+  _STLP_STATIC_CONSTANT(size_type, bits_per_block = sizeof(_Block) * CHAR_BIT);
+#include <stl/_string_npos.h>
+
+  // bit reference:
+  class reference
+  {
+    friend class dynamic_bitset<_Block, _Alloc>;
+
+    reference(_Block* __p, size_type __pos)
+      : _M_p(__p), _M_mask(_S_bit(__pos)) {}
+
+  public:
+    operator bool() const { return (*_M_p & _M_mask) != 0; }
+    bool operator~() const { return (*_M_p & _M_mask) == 0; }
+
+    reference& operator=(bool __x) {
+      if (__x)
+        *_M_p |= _M_mask;
+      else
+        *_M_p &= ~_M_mask;
+      return *this;
+    }
+    reference& operator=(const reference& __x) { return *this = bool(__x); }
+    reference& operator|=(bool __x) { if (__x) *_M_p |= _M_mask; return *this; }
+    reference& operator&=(bool __x) { if (!__x) *_M_p &= ~_M_mask; return *this; }
+    reference& operator^=(bool __x) { if (__x) *_M_p ^= _M_mask; return *this; }
+    reference& flip() { *_M_p ^= _M_mask; return *this; }
+
+  private:
+    _Block* _M_p;
+    _Block _M_mask;
+  };
+  typedef bool const_reference;
+
+  // forward iterator over positions of set bits, in increasing order
+  class ones_iterator
+  {
+    friend class dynamic_bitset<_Block, _Alloc>;
+
+    ones_iterator(const _Self* __s, size_type __pos)
+      : _M_s(__s), _M_pos(__pos) {}
+
+  public:
+    typedef forward_iterator_tag iterator_category;
+    typedef size_type value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const size_type* pointer;
+    typedef const size_type& reference;
+
+    ones_iterator() : _M_s(0), _M_pos(npos) {}
+
+    reference operator*() const { return _M_pos; }
+    ones_iterator& operator++() {
+      _M_pos = _M_s->find_next(_M_pos);
+      return *this;
+    }
+    ones_iterator operator++(int) {
+      ones_iterator __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+    bool operator==(const ones_iterator& __x) const { return _M_pos == __x._M_pos; }
+    bool operator!=(const ones_iterator& __x) const { return _M_pos != __x._M_pos; }
+
+  private:
+    const _Self* _M_s;
+    size_type _M_pos;
+  };
+
+  explicit dynamic_bitset(const allocator_type& __a = allocator_type())
+    : _M_bits(__a), _M_size(0) {}
+
+  // first __n bits, low-order bits are taken from __val
+  explicit dynamic_bitset(size_type __n, unsigned long __val = 0,
+                          const allocator_type& __a = allocator_type())
+    : _M_bits(_S_blocks(__n), _Block(0), __a), _M_size(__n) {
+    const size_type __val_bits = sizeof(unsigned long) * CHAR_BIT;
+    for (size_type __i = 0; __i < _M_bits.size() && __val != 0; ++__i) {
+      _M_bits[__i] = __STATIC_CAST(_Block, __val);
+      // no shift by full width of __val: it is undefined
+      __val = bits_per_block < __val_bits ? __val >> (bits_per_block % __val_bits) : 0;
+    }
+    _M_sanitize();
+  }
+
+  dynamic_bitset(const _Self& __x) : _M_bits(__x._M_bits), _M_size(__x._M_size) {}
+  dynamic_bitset(_Self&& __x) : _M_bits(__x.get_allocator()), _M_size(__x._M_size) {
+    _M_bits.swap(__x._M_bits);
+    __x._M_size = 0;
+  }
+
+  _Self& operator=(const _Self& __x) {
+    _M_bits = __x._M_bits;
+    _M_size = __x._M_size;
+    return *this;
+  }
+  _Self& operator=(_Self&& __x) {
+    swap(__x);
+    return *this;
+  }
+
+  allocator_type get_allocator() const { return _M_bits.get_allocator(); }
+
+  size_type size() const { return _M_size; }
+  size_type num_blocks() const { return _M_bits.size(); }
+  size_type max_size() const { return _M_bits.max_size(); }
+  size_type capacity() const { return _M_bits.capacity() * bits_per_block; }
+  bool empty() const { return _M_size == 0; }
+  void reserve(size_type __n) { _M_bits.reserve(_S_blocks(__n)); }
+
+  // new bits (if any) get value __x
+  void resize(size_type __n, bool __x = false) {
+    if (__x && __n > _M_size && _M_size % bits_per_block != 0) {
+      _M_bits.back() |= __STATIC_CAST(_Block, _S_ones() << (_M_size % bits_per_block));
+    }
+    _M_bits.resize(_S_blocks(__n), __x ? _S_ones() : _Block(0));
+    _M_size = __n;
+    _M_sanitize();
+  }
+  void clear() {
+    _M_bits.clear();
+    _M_size = 0;
+  }
+  void push_back(bool __x) {
+    if (_M_size % bits_per_block == 0) {
+      _M_bits.push_back(_Block(0));
+    }
+    if (__x) {
+      _M_bits.back() |= _S_bit(_M_size);
+    }
+    ++_M_size;
+  }
+  // append bits_per_block bits of __b, low-order bit first
+  void append(block_type __b) {
+    const size_type __r = _M_size % bits_per_block;
+    if (__r == 0) {
+      _M_bits.push_back(__b);
+    } else {
+      _M_bits.back() |= __STATIC_CAST(_Block, __b << __r);
+      _M_bits.push_back(__STATIC_CAST(_Block, __b >> (bits_per_block - __r)));
+    }
+    _M_size += bits_per_block;
+  }
+  void swap(_Self& __x) {
+    _M_bits.swap(__x._M_bits);
+    _STLP_STD::swap(_M_size, __x._M_size);
+  }
+
+  // element access:
+  reference operator[](size_type __pos) { return reference(_M_data() + __pos / bits_per_block, __pos); }
+  bool operator[](size_type __pos) const { return _M_test(__pos); }
+  bool test(size_type __pos) const {
+    if (__pos >= _M_size)
+      __stl_throw_out_of_range("dynamic_bitset");
+    return _M_test(__pos);
+  }
+
+  // modification:
+  _Self& set() {
+    _STLP_STD::fill(_M_bits.begin(), _M_bits.end(), _S_ones());
+    _M_sanitize();
+    return *this;
+  }
+  _Self& set(size_type __pos, bool __val = true) {
+    if (__pos >= _M_size)
+      __stl_throw_out_of_range("dynamic_bitset");
+    (*this)[__pos] = __val;
+    return *this;
+  }
+  _Self& reset() {
+    _STLP_STD::fill(_M_bits.begin(), _M_bits.end(), _Block(0));
+    return *this;
+  }
+  _Self& reset(size_type __pos) { return set(__pos, false); }
+  _Self& flip() {
+    for (size_type __i = 0; __i < _M_bits.size(); ++__i) {
+      _M_bits[__i] = __STATIC_CAST(_Block, ~_M_bits[__i]);
+    }
+    _M_sanitize();
+    return *this;
+  }
+  _Self& flip(size_type __pos) {
+    if (__pos >= _M_size)
+      __stl_throw_out_of_range("dynamic_bitset");
+    (*this)[__pos].flip();
+    return *this;
+  }
+  _Self operator~() const { return _Self(*this).flip(); }
+
+  // set operations; __x must be of the same size
+  _Self& operator&=(const _Self& __x) { return _M_transform(__x, _STLP_PRIV _Bit_and()); }
+  _Self& operator|=(const _Self& __x) { return _M_transform(__x, _STLP_PRIV _Bit_or()); }
+  _Self& operator^=(const _Self& __x) { return _M_transform(__x, _STLP_PRIV _Bit_xor()); }
+  // difference: bits of *this that aren't in __x
+  _Self& operator-=(const _Self& __x) { return _M_transform(__x, _STLP_PRIV _Bit_and_not()); }
+
+  bool is_subset_of(const _Self& __x) const {
+    _STLP_ASSERT(_M_size == __x._M_size)
+    return _STLP_PRIV __bit_none_of(_M_data(), __x._M_data(), _M_bits.size(), _STLP_PRIV _Bit_and_not());
+  }
+  bool is_proper_subset_of(const _Self& __x) const
+  { return is_subset_of(__x) && !(*this == __x); }
+  bool intersects(const _Self& __x) const {
+    _STLP_ASSERT(_M_size == __x._M_size)
+    return !_STLP_PRIV __bit_none_of(_M_data(), __x._M_data(), _M_bits.size(), _STLP_PRIV _Bit_and());
+  }
+  // number of bits set in both *this and __x, without temporary
+  size_type intersection_count(const _Self& __x) const {
+    _STLP_ASSERT(_M_size == __x._M_size)
+    return _STLP_PRIV __bit_count_and(_M_data(), _M_data() + _M_bits.size(), __x._M_data());
+  }
+
+  bool operator==(const _Self& __x) const
+  { return _M_size == __x._M_size && _STLP_STD::equal(_M_bits.begin(), _M_bits.end(), __x._M_bits.begin()); }
+  bool operator!=(const _Self& __x) const
+  { return !(*this == __x); }
+
+  // observers:
+  size_type count() const
+  { return _STLP_PRIV __bit_count(_M_data(), _M_data() + _M_bits.size()); }
+  bool any() const { return find_first() != npos; }
+  bool none() const { return find_first() == npos; }
+  bool all() const { return count() == _M_size; }
+
+  // position of first set bit, npos if there is no one
+  size_type find_first() const
+  { return _M_size == 0 ? npos : _STLP_PRIV __bit_find_next(_M_data(), _M_data() + _M_bits.size(), 0, npos); }
+  // position of first set bit after __prev, npos if there is no one
+  size_type find_next(size_type __prev) const {
+    return __prev + 1 >= _M_size || __prev == npos ? npos :
+      _STLP_PRIV __bit_find_next(_M_data(), _M_data() + _M_bits.size(), __prev + 1, npos);
+  }
+
+  ones_iterator ones_begin() const { return ones_iterator(this, find_first()); }
+  ones_iterator ones_end() const { return ones_iterator(this, npos); }
+
+private:
+  static _Block _S_ones() { return __STATIC_CAST(_Block, ~__STATIC_CAST(_Block, 0)); }
+  static _Block _S_bit(size_type __pos)
+  { return __STATIC_CAST(_Block, __STATIC_CAST(_Block, 1) << (__pos % bits_per_block)); }
+  static size_type _S_blocks(size_type __n)
+  { return (__n + bits_per_block - 1) / bits_per_block; }
+
+  _Block* _M_data() { return _M_bits.empty() ? 0 : &_M_bits[0]; }
+  const _Block* _M_data() const { return _M_bits.empty() ? 0 : &_M_bits[0]; }
+
+  bool _M_test(size_type __pos) const
+  { return (_M_bits[__pos / bits_per_block] & _S_bit(__pos)) != 0; }
+
+  // zero out unused high-order bits of last block
+  void _M_sanitize() {
+    if (_M_size % bits_per_block != 0) {
+      _M_bits.back() &= __STATIC_CAST(_Block, ~(_S_ones() << (_M_size % bits_per_block)));
+    }
+  }
+
+  template <class _Op>
+  _Self& _M_transform(const _Self& __x, _Op __op) {
+    _STLP_ASSERT(_M_size == __x._M_size)
+    _STLP_PRIV __bit_transform(_M_data(), __x._M_data(), _M_bits.size(), __op);
+    return *this;
+  }
+
+  _Buffer _M_bits;
+  size_type _M_size;
+};
+
+#if !defined (_STLP_STATIC_CONST_INIT_BUG) && !defined (_STLP_NO_STATIC_CONST_DEFINITION)
+template <class _Block, class _Alloc>
+const size_t dynamic_bitset<_Block, _Alloc>::npos;
+#endif
+
+template <class _Block, class _Alloc>
+inline dynamic_bitset<_Block, _Alloc> _STLP_CALL
+operator&(const dynamic_bitset<_Block, _Alloc>& __x, const dynamic_bitset<_Block, _Alloc>& __y) {
+  dynamic_bitset<_Block, _Alloc> __result(__x);
+  __result &= __y;
+  return __result;
+}
+
+template <class _Block, class _Alloc>
+inline dynamic_bitset<_Block, _Alloc> _STLP_CALL
+operator|(const dynamic_bitset<_Block, _Alloc>& __x, const dynamic_bitset<_Block, _Alloc>& __y) {
+  dynamic_bitset<_Block, _Alloc> __result(__x);
+  __result |= __y;
+  return __result;
+}
+
+template <class _Block, class _Alloc>
+inline dynamic_bitset<_Block, _Alloc> _STLP_CALL
+operator^(const dynamic_bitset<_Block, _Alloc>& __x, const dynamic_bitset<_Block, _Alloc>& __y) {
+  dynamic_bitset<_Block, _Alloc> __result(__x);
+  __result ^= __y;
+  return __result;
+}
+
+template <class _Block, class _Alloc>
+inline dynamic_bitset<_Block, _Alloc> _STLP_CALL
+operator-(const dynamic_bitset<_Block, _Alloc>& __x, const dynamic_bitset<_Block, _Alloc>& __y) {
+  dynamic_bitset<_Block, _Alloc> __result(__x);
+  __result -= __y;
+  return __result;
+}
+
+template <class _Block, class _Alloc>
+inline void _STLP_CALL
+swap(dynamic_bitset<_Block, _Alloc>& __x, dynamic_bitset<_Block, _Alloc>& __y)
+{ __x.swap(__y); }
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_DYNAMIC_BITSET_H */
+
+// Local Variables:
+// mode:C++
+// End:
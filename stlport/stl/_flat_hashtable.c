@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef _STLP_FLAT_HASHTABLE_C
+#define _STLP_FLAT_HASHTABLE_C
+
+#ifndef _STLP_INTERNAL_FLAT_HASHTABLE_H
+#  include <stl/_flat_hashtable.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+typename _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::size_type
+_Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_capacity_for(size_type __n) const
+{
+  if (__n == 0) {
+    return 0;
+  }
+  size_type __c = _Flat_ctrl::_S_group_width;
+  while (_M_max_growth(__c) < __n) {
+    __c <<= 1;
+  }
+  return __c;
+}
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_erase(size_type __i)
+{
+  allocator_traits<_SlotAlloc>::destroy(_M_alloc, _M_slots + __i);
+  --_M_num_elements;
+
+  /* If group of this slot has an empty slot, lookup never pass over this
+   * group, so slot may become empty again. Otherwise lookup of elements
+   * placed after this group has to continue here: leave tombstone.
+   */
+  const size_type __base = __i & ~size_type(_Flat_ctrl::_S_group_width - 1);
+  if (_Flat_group(_M_ctrl + __base).match_empty() != 0) {
+    _M_ctrl[__i] = _Flat_ctrl::_S_empty;
+    ++_M_growth_left;
+  } else {
+    _M_ctrl[__i] = _Flat_ctrl::_S_deleted;
+  }
+}
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_grow()
+{
+  if (_M_capacity == 0) {
+    _M_rehash(_Flat_ctrl::_S_group_width);
+  } else if (size() * 2 <= _M_max_growth(_M_capacity)) {
+    // mostly tombstones: clean them up without growing
+    _M_rehash(_M_capacity);
+  } else {
+    _M_rehash(_M_capacity * 2);
+  }
+}
+
+/*
+ * Elements are moved to new slots; element's move constructor is expected
+ * not to throw (if it throws, table lose elements not moved yet).
+ */
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_rehash(size_type __capacity)
+{
+  if (__capacity == 0) {
+    _M_deallocate();
+    _M_ctrl = 0;
+    _M_slots = 0;
+    _M_capacity = 0;
+    _M_num_elements = 0;
+    _M_growth_left = 0;
+    return;
+  }
+
+  _CtrlAlloc __ctrl_alloc(_M_alloc);
+  _Flat_ctrl_type* __ctrl = __ctrl_alloc.allocate(__capacity + _Flat_ctrl::_S_group_width);
+  value_type* __slots = 0;
+  _STLP_TRY {
+    __slots = _M_alloc.allocate(__capacity);
+  }
+  _STLP_UNWIND(__ctrl_alloc.deallocate(__ctrl, __capacity + _Flat_ctrl::_S_group_width))
+
+  fill(__ctrl, __ctrl + __capacity, _Flat_ctrl_type(_Flat_ctrl::_S_empty));
+  fill(__ctrl + __capacity, __ctrl + __capacity + _Flat_ctrl::_S_group_width, _Flat_ctrl_type(_Flat_ctrl::_S_end));
+
+  _Flat_ctrl_type* __old_ctrl = _M_ctrl;
+  value_type* __old_slots = _M_slots;
+  const size_type __old_capacity = _M_capacity;
+
+  _M_ctrl = __ctrl;
+  _M_slots = __slots;
+  _M_capacity = __capacity;
+  _M_num_elements = 0;
+  _M_growth_left = _M_max_growth(__capacity);
+
+  for (size_type __i = 0; __i < __old_capacity; ++__i) {
+    if (__old_ctrl[__i] >= 0) {
+      const size_t __h = _M_hash_of(_M_get_key(__old_slots[__i]));
+      const size_type __j = _M_find_free(__h);
+      allocator_traits<_SlotAlloc>::construct(_M_alloc, _M_slots + __j, _STLP_STD::move(__old_slots[__i]));
+      allocator_traits<_SlotAlloc>::destroy(_M_alloc, __old_slots + __i);
+      _M_set_full(__j, __h);
+    }
+  }
+
+  if (__old_ctrl != 0) {
+    __ctrl_alloc.deallocate(__old_ctrl, __old_capacity + _Flat_ctrl::_S_group_width);
+    _M_alloc.deallocate(__old_slots, __old_capacity);
+  }
+}
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_deallocate()
+{
+  if (_M_ctrl == 0) {
+    return;
+  }
+  for (size_type __i = 0; __i < _M_capacity; ++__i) {
+    if (_M_ctrl[__i] >= 0) {
+      allocator_traits<_SlotAlloc>::destroy(_M_alloc, _M_slots + __i);
+    }
+  }
+  _CtrlAlloc(_M_alloc).deallocate(_M_ctrl, _M_capacity + _Flat_ctrl::_S_group_width);
+  _M_alloc.deallocate(_M_slots, _M_capacity);
+}
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::clear()
+{
+  for (size_type __i = 0; __i < _M_capacity; ++__i) {
+    if (_M_ctrl[__i] >= 0) {
+      allocator_traits<_SlotAlloc>::destroy(_M_alloc, _M_slots + __i);
+    }
+    _M_ctrl[__i] = _Flat_ctrl::_S_empty;
+  }
+  _M_num_elements = 0;
+  _M_growth_left = _M_capacity == 0 ? 0 : _M_max_growth(_M_capacity);
+}
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+void _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_copy_from(const _Self& __ht)
+{
+  if (__ht.empty()) {
+    return;
+  }
+  _M_rehash(_M_capacity_for(__ht.size()));
+  _STLP_TRY {
+    for (size_type __i = 0; __i < __ht._M_capacity; ++__i) {
+      if (__ht._M_ctrl[__i] >= 0) {
+        const size_t __h = _M_hash_of(_M_get_key(__ht._M_slots[__i]));
+        const size_type __j = _M_find_free(__h);
+        allocator_traits<_SlotAlloc>::construct(_M_alloc, _M_slots + __j, __ht._M_slots[__i]);
+        _M_set_full(__j, __h);
+      }
+    }
+  }
+  _STLP_UNWIND(_M_rehash(0))
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_FLAT_HASHTABLE_C */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_FLAT_HASHTABLE_H
+#define _STLP_INTERNAL_FLAT_HASHTABLE_H
+
+#include <utility>
+
+#ifndef _STLP_INTERNAL_ALLOC_H
+#  include <stl/_alloc.h>
+#endif
+
+#ifndef _STLP_INTERNAL_ITERATOR_H
+#  include <stl/_iterator.h>
+#endif
+
+#ifndef _STLP_INTERNAL_FUNCTION_BASE_H
+#  include <stl/_function_base.h>
+#endif
+
+#ifndef _STLP_INTERNAL_ALGOBASE_H
+#  include <stl/_algobase.h>
+#endif
+
+#ifndef _STLP_HASH_FUN_H
+#  include <stl/_hash_fun.h>
+#endif
+
+#if !defined (_STLP_NO_SSE2) && \
+    (defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#  define _STLP_FLAT_HASH_SSE2 1
+#  include <emmintrin.h>
+#endif
+
+/*
+ * Open addressing hashtable, used to implement flat_hash_set and
+ * flat_hash_map.
+ *
+ * Elements are stored inline in array of slots; each slot has a control
+ * byte: empty, deleted (tombstone) or 7 low bits of hash code if slot is
+ * occupied. Control bytes are grouped by 16 (one SSE2 register), and lookup
+ * check all slots of a group at once: only slots with same 7 bits of hash
+ * are compared with key. Lookup ends at first group that has an empty slot.
+ *
+ * Number of slots is 0 or power of 2 not less than group size; groups are
+ * visited in triangular order (1, 2, 3, ... groups step), that visit all
+ * groups. Table grows when slots occupied by elements and tombstones exceed
+ * max_load_factor(), that never exceed 7/8.
+ *
+ * Unlike unordered_* containers, rehash (so insert) invalidates iterators,
+ * pointers and references to elements; erase invalidates only erased ones.
+ */
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+typedef signed char _Flat_ctrl_type;
+
+struct _Flat_ctrl
+{
+    enum {
+      _S_empty = -128,
+      _S_deleted = -2,
+      // after last slot; iteration stop here
+      _S_end = -1,
+      _S_group_width = 16
+    };
+};
+
+inline unsigned __flat_ctz(unsigned __m)
+{
+#if defined (__GNUC__)
+  return __builtin_ctz(__m);
+#else
+  unsigned __n = 0;
+  for ( ; (__m & 1) == 0; __m >>= 1, ++__n);
+  return __n;
+#endif
+}
+
+// Group of 16 control bytes; match* return bitmask, bit i for byte i.
+class _Flat_group
+{
+  public:
+    explicit _Flat_group(const _Flat_ctrl_type* __p)
+#if defined (_STLP_FLAT_HASH_SSE2)
+      : _M_ctrl(_mm_loadu_si128(__REINTERPRET_CAST(const __m128i*, __p)))
+      { }
+#else
+      : _M_ctrl(__p)
+      { }
+#endif
+
+    unsigned match(_Flat_ctrl_type __h2) const
+      {
+#if defined (_STLP_FLAT_HASH_SSE2)
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(__h2), _M_ctrl));
+#else
+        unsigned __m = 0;
+        for (size_t __i = 0; __i < _Flat_ctrl::_S_group_width; ++__i) {
+          __m |= unsigned(_M_ctrl[__i] == __h2) << __i;
+        }
+        return __m;
+#endif
+      }
+
+    unsigned match_empty() const
+      { return match(_Flat_ctrl::_S_empty); }
+
+    // empty or deleted, but not end
+    unsigned match_free() const
+      {
+#if defined (_STLP_FLAT_HASH_SSE2)
+        return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_Flat_ctrl::_S_end), _M_ctrl));
+#else
+        unsigned __m = 0;
+        for (size_t __i = 0; __i < _Flat_ctrl::_S_group_width; ++__i) {
+          __m |= unsigned(_M_ctrl[__i] < _Flat_ctrl::_S_end) << __i;
+        }
+        return __m;
+#endif
+      }
+
+  private:
+#if defined (_STLP_FLAT_HASH_SSE2)
+    __m128i _M_ctrl;
+#else
+    const _Flat_ctrl_type* _M_ctrl;
+#endif
+};
+
+template <class _Val, class _Ptr, class _Ref>
+struct _Flat_hash_iterator
+{
+    typedef forward_iterator_tag iterator_category;
+    typedef _Val value_type;
+    typedef ptrdiff_t difference_type;
+    typedef _Ptr pointer;
+    typedef _Ref reference;
+
+    typedef _Flat_hash_iterator<_Val, _Val*, _Val&> iterator;
+    typedef _Flat_hash_iterator<_Val, const _Val*, const _Val&> const_iterator;
+    typedef _Flat_hash_iterator<_Val, _Ptr, _Ref> _Self;
+
+    _Flat_hash_iterator() :
+        _M_ctrl(0),
+        _M_slot(0)
+      { }
+
+    _Flat_hash_iterator(const _Flat_ctrl_type* __ctrl, _Val* __slot) :
+        _M_ctrl(__ctrl),
+        _M_slot(__slot)
+      { }
+
+    _Flat_hash_iterator(const iterator& __it) :
+        _M_ctrl(__it._M_ctrl),
+        _M_slot(__it._M_slot)
+      { }
+
+    reference operator*() const
+      { return *_M_slot; }
+    pointer operator->() const
+      { return _M_slot; }
+
+    _Self& operator++()
+      {
+        ++_M_ctrl;
+        ++_M_slot;
+        _M_skip_free();
+        return *this;
+      }
+
+    _Self operator++(int)
+      {
+        _Self __tmp = *this;
+        ++*this;
+        return __tmp;
+      }
+
+    bool operator==(const const_iterator& __y) const
+      { return _M_slot == __y._M_slot; }
+    bool operator!=(const const_iterator& __y) const
+      { return _M_slot != __y._M_slot; }
+
+    void _M_skip_free()
+      {
+        // stop on occupied slot or on _S_end after last slot
+        for ( ; *_M_ctrl < _Flat_ctrl::_S_end; ++_M_ctrl, ++_M_slot);
+      }
+
+    const _Flat_ctrl_type* _M_ctrl;
+    _Val* _M_slot;
+};
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+class _Flat_hashtable
+{
+  private:
+    typedef _Flat_hashtable<_Val, _Key, _HF, _ExK, _EqK, _All> _Self;
+    typedef typename _All::template rebind<_Val>::other _SlotAlloc;
+    typedef typename _All::template rebind<_Flat_ctrl_type>::other _CtrlAlloc;
+
+  public:
+    typedef _Key key_type;
+    typedef _Val value_type;
+    typedef _HF hasher;
+    typedef _EqK key_equal;
+
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+
+    typedef _Flat_hash_iterator<_Val, _Val*, _Val&> iterator;
+    typedef _Flat_hash_iterator<_Val, const _Val*, const _Val&> const_iterator;
+
+    typedef _All allocator_type;
+
+  private:
+    hasher                _M_hash;
+    key_equal             _M_equals;
+    _SlotAlloc            _M_alloc;
+    _Flat_ctrl_type*      _M_ctrl;
+    value_type*           _M_slots;
+    size_type             _M_capacity;
+    size_type             _M_num_elements;
+    size_type             _M_growth_left; // free slots before rehash
+    float                 _M_max_load_factor;
+    _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+    static const key_type& _M_get_key(const value_type& __val)
+      {
+        _ExK k;
+        return k(__val);
+      }
+
+  public:
+    hasher hash_funct() const { return _M_hash; }
+    key_equal key_eq() const { return _M_equals; }
+    allocator_type get_allocator() const { return allocator_type(_M_alloc); }
+
+    _Flat_hashtable(size_type __n, const _HF& __hf, const _EqK& __eql, const allocator_type& __a = allocator_type()) :
+        _M_hash(__hf),
+        _M_equals(__eql),
+        _M_alloc(__a),
+        _M_ctrl(0),
+        _M_slots(0),
+        _M_capacity(0),
+        _M_num_elements(0),
+        _M_growth_left(0),
+        _M_max_load_factor(0.875f)
+      {
+        if (__n != 0) {
+          _M_rehash(_M_capacity_for_buckets(__n));
+        }
+      }
+
+    _Flat_hashtable(const _Self& __ht) :
+        _M_hash(__ht._M_hash),
+        _M_equals(__ht._M_equals),
+        _M_alloc(__ht._M_alloc),
+        _M_ctrl(0),
+        _M_slots(0),
+        _M_capacity(0),
+        _M_num_elements(0),
+        _M_growth_left(0),
+        _M_max_load_factor(__ht._M_max_load_factor)
+      { _M_copy_from(__ht); }
+
+    _Flat_hashtable(_Self&& __ht) :
+        _M_hash(__ht._M_hash),
+        _M_equals(__ht._M_equals),
+        _M_alloc(__ht._M_alloc),
+        _M_ctrl(__ht._M_ctrl),
+        _M_slots(__ht._M_slots),
+        _M_capacity(__ht._M_capacity),
+        _M_num_elements(__ht._M_num_elements),
+        _M_growth_left(__ht._M_growth_left),
+        _M_max_load_factor(__ht._M_max_load_factor)
+      {
+        __ht._M_ctrl = 0;
+        __ht._M_slots = 0;
+        __ht._M_capacity = 0;
+        __ht._M_num_elements = 0;
+        __ht._M_growth_left = 0;
+      }
+
+    _Self& operator =(const _Self& __ht)
+      {
+        if (&__ht != this) {
+          _Self __tmp(__ht);
+          swap(__tmp);
+        }
+        return *this;
+      }
+
+    _Self& operator =(_Self&& __ht)
+      {
+        swap(__ht);
+        return *this;
+      }
+
+    ~_Flat_hashtable()
+      { _M_deallocate(); }
+
+    size_type size() const
+      { return _M_num_elements; }
+    size_type max_size() const
+      { return size_type(-1) / sizeof(value_type); }
+    bool empty() const
+      { return _M_num_elements == 0; }
+
+    void swap(_Self& __ht)
+      {
+        _STLP_PRIV __swap(_M_hash, __ht._M_hash);
+        _STLP_PRIV __swap(_M_equals, __ht._M_equals);
+        _STLP_PRIV __swap(_M_alloc, __ht._M_alloc);
+        _STLP_PRIV __swap(_M_ctrl, __ht._M_ctrl);
+        _STLP_PRIV __swap(_M_slots, __ht._M_slots);
+        _STLP_PRIV __swap(_M_capacity, __ht._M_capacity);
+        _STLP_PRIV __swap(_M_num_elements, __ht._M_num_elements);
+        _STLP_PRIV __swap(_M_growth_left, __ht._M_growth_left);
+        _STLP_PRIV __swap(_M_max_load_factor, __ht._M_max_load_factor);
+      }
+
+    iterator begin()
+      {
+        iterator __it(_M_ctrl, _M_slots);
+        if (_M_ctrl != 0) {
+          __it._M_skip_free();
+        }
+        return __it;
+      }
+    iterator end()
+      { return iterator(_M_ctrl + _M_capacity, _M_slots + _M_capacity); }
+    const_iterator begin() const
+      { return __CONST_CAST(_Self*, this)->begin(); }
+    const_iterator end() const
+      { return __CONST_CAST(_Self*, this)->end(); }
+
+    // number of slots
+    size_type bucket_count() const
+      { return _M_capacity; }
+    size_type max_bucket_count() const
+      { return max_size(); }
+
+    float load_factor() const
+      { return _M_capacity == 0 ? 0.0f : (float)size() / (float)_M_capacity; }
+    float max_load_factor() const
+      { return _M_max_load_factor; }
+    void max_load_factor(float __z)
+      {
+        // open addressing need free slots to stop lookup
+        _M_max_load_factor = (__z > 0.875f) ? 0.875f : ((__z < 0.125f) ? 0.125f : __z);
+        _M_rehash(_M_capacity_for_buckets(_M_capacity));
+      }
+
+    void rehash(size_type __num_buckets_hint)
+      { _M_rehash(_M_capacity_for_buckets(__num_buckets_hint)); }
+    void reserve(size_type __n)
+      {
+        if (__n > size() + _M_growth_left) {
+          _M_rehash(_M_capacity_for(__n));
+        }
+      }
+
+  private:
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    size_type _M_find(const _KT& __key) const
+      { return _M_capacity == 0 ? _M_capacity : _M_find(__key, _M_hash_of(__key)); }
+
+    // as above, with hash code __h of __key; table must have slots
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    size_type _M_find(const _KT& __key, size_t __h) const
+      {
+        const _Flat_ctrl_type __h2 = _S_h2(__h);
+        const size_type __mask = _M_capacity / _Flat_ctrl::_S_group_width - 1;
+        size_type __g = _S_h1(__h) & __mask;
+        for (size_type __step = 1; ; ++__step) {
+          const size_type __base = __g * _Flat_ctrl::_S_group_width;
+          _Flat_group __grp(_M_ctrl + __base);
+          for (unsigned __m = __grp.match(__h2); __m != 0; __m &= __m - 1) {
+            const size_type __i = __base + __flat_ctz(__m);
+            if (_M_equals(_M_get_key(_M_slots[__i]), __key)) {
+              return __i;
+            }
+          }
+          if (__grp.match_empty() != 0) {
+            return _M_capacity;
+          }
+          __g = (__g + __step) & __mask;
+        }
+      }
+
+    // first free slot in probe sequence of hash code __h; table must have free slots
+    size_type _M_find_free(size_t __h) const
+      {
+        const size_type __mask = _M_capacity / _Flat_ctrl::_S_group_width - 1;
+        size_type __g = _S_h1(__h) & __mask;
+        for (size_type __step = 1; ; ++__step) {
+          const size_type __base = __g * _Flat_ctrl::_S_group_width;
+          unsigned __m = _Flat_group(_M_ctrl + __base).match_free();
+          if (__m != 0) {
+            return __base + __flat_ctz(__m);
+          }
+          __g = (__g + __step) & __mask;
+        }
+      }
+
+    // mark slot __i, where element was just constructed, as occupied
+    void _M_set_full(size_type __i, size_t __h)
+      {
+        if (_M_ctrl[__i] == _Flat_ctrl::_S_empty) {
+          --_M_growth_left;
+        }
+        _M_ctrl[__i] = _S_h2(__h);
+        ++_M_num_elements;
+      }
+
+  public:
+    /*
+     * Insert element constructed from __args if no element with __key
+     * present. __key is used only before element construction, so it may
+     * refer to one of __args.
+     */
+    template <class _KT2, class... _Args>
+    pair<iterator, bool> _M_insert_key(const _KT2& __key, _Args&&... __args)
+      {
+        const size_t __h = _M_hash_of(__key);
+        size_type __i = _M_capacity == 0 ? _M_capacity : _M_find(__key, __h);
+        if (__i != _M_capacity) {
+          return pair<iterator, bool>(iterator(_M_ctrl + __i, _M_slots + __i), false);
+        }
+        if (_M_growth_left == 0) {
+          _M_grow();
+        }
+        __i = _M_find_free(__h);
+        allocator_traits<_SlotAlloc>::construct(_M_alloc, _M_slots + __i, _STLP_STD::forward<_Args>(__args)...);
+        _M_set_full(__i, __h);
+        return pair<iterator, bool>(iterator(_M_ctrl + __i, _M_slots + __i), true);
+      }
+
+    pair<iterator, bool> insert_unique(const value_type& __obj)
+      { return _M_insert_key(_M_get_key(__obj), __obj); }
+
+    pair<iterator, bool> insert_unique(value_type&& __obj)
+      { return _M_insert_key(_M_get_key(__obj), _STLP_STD::move(__obj)); }
+
+    template <class... _Args>
+    pair<iterator, bool> emplace_unique(_Args&&... __args)
+      {
+        value_type __tmp(_STLP_STD::forward<_Args>(__args)...);
+        return _M_insert_key(_M_get_key(__tmp), _STLP_STD::move(__tmp));
+      }
+
+    template <class _InputIterator>
+    void insert_unique(_InputIterator __f, _InputIterator __l)
+      { for ( ; __f != __l; ++__f) insert_unique(*__f); }
+
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    iterator find(const _KT& __key)
+      {
+        const size_type __i = _M_find(__key);
+        return iterator(_M_ctrl + __i, _M_slots + __i);
+      }
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    const_iterator find(const _KT& __key) const
+      { return __CONST_CAST(_Self*, this)->find(__key); }
+
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    size_type count(const _KT& __key) const
+      { return _M_find(__key) != _M_capacity ? 1 : 0; }
+
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    pair<iterator, iterator> equal_range(const _KT& __key)
+      {
+        iterator __it = find(__key);
+        iterator __last = __it;
+        return pair<iterator, iterator>(__it, __it == end() ? __last : ++__last);
+      }
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    pair<const_iterator, const_iterator> equal_range(const _KT& __key) const
+      {
+        const_iterator __it = find(__key);
+        const_iterator __last = __it;
+        return pair<const_iterator, const_iterator>(__it, __it == end() ? __last : ++__last);
+      }
+
+    size_type erase(const key_type& __key)
+      {
+        const size_type __i = _M_find(__key);
+        if (__i == _M_capacity) {
+          return 0;
+        }
+        _M_erase(__i);
+        return 1;
+      }
+    void erase(const_iterator __it)
+      { _M_erase(__it._M_slot - _M_slots); }
+    void erase(const_iterator __first, const_iterator __last)
+      {
+        while (__first != __last) {
+          erase(__first++);
+        }
+      }
+
+    void clear();
+
+  private:
+    static size_t _S_h1(size_t __h)
+      { return __h >> 7; }
+    static _Flat_ctrl_type _S_h2(size_t __h)
+      { return __STATIC_CAST(_Flat_ctrl_type, __h & 0x7f); }
+
+    // post-mixed, because masked: hash<> of integers is identity
+    _STLP_TEMPLATE_FOR_CONT_EXT
+    size_t _M_hash_of(const _KT& __key) const
+      { return __stl_hash_mix(_M_hash(__key)); }
+
+    size_type _M_max_growth(size_type __capacity) const
+      {
+        size_type __n = (size_type)((float)__capacity * _M_max_load_factor);
+        return __n < __capacity ? __n : __capacity - 1;
+      }
+
+    size_type _M_capacity_for(size_type __n) const;
+    size_type _M_capacity_for_buckets(size_type __n) const
+      {
+        size_type __c = _M_capacity_for(size());
+        if (__c == 0 && __n != 0) {
+          __c = _Flat_ctrl::_S_group_width;
+        }
+        while (__c < __n) {
+          __c <<= 1;
+        }
+        return __c;
+      }
+
+    void _M_erase(size_type __i);
+    void _M_grow();
+    void _M_rehash(size_type __capacity);
+    void _M_deallocate();
+    void _M_copy_from(const _Self& __ht);
+};
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#include <stl/_flat_hashtable.c>
+
+_STLP_BEGIN_NAMESPACE
+
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+inline
+void _STLP_CALL
+swap( _STLP_PRIV _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>& __ht1, _STLP_PRIV _Flat_hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>& __ht2)
+{ __ht1.swap(__ht2); }
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_FLAT_HASHTABLE_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,629 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_FLAT_MAP_H
+#define _STLP_INTERNAL_FLAT_MAP_H
+
+#ifndef _STLP_INTERNAL_FLAT_TREE_H
+#  include <stl/_flat_tree.h>
+#endif
+
+#ifndef _STLP_INTERNAL_RANGE_ERRORS_H
+#  include <stl/_range_errors.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// operator-> of iterator over parallel vectors: reference is built on the fly
+template <class _Ref>
+struct _Flat_map_arrow
+{
+    explicit _Flat_map_arrow(const _Ref& __r) :
+        _M_ref(__r)
+      { }
+
+    const _Ref* operator->() const
+      { return &_M_ref; }
+
+    _Ref _M_ref;
+};
+
+/*
+ * Keys and mapped values of flat_map are in separate vectors (keys are
+ * scanned by lookup without mapped values in cache), so element is
+ * accessed via pair of references: pair<const key_type&, mapped_type&>.
+ */
+template <class _Key, class _Tp, class _Ref>
+struct _Flat_map_iterator
+{
+    typedef random_access_iterator_tag iterator_category;
+    typedef pair<_Key, _Tp> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef _Ref reference;
+    typedef _Flat_map_arrow<_Ref> pointer;
+
+    typedef _Flat_map_iterator<_Key, _Tp, pair<const _Key&, _Tp&> > iterator;
+    typedef _Flat_map_iterator<_Key, _Tp, pair<const _Key&, const _Tp&> > const_iterator;
+    typedef _Flat_map_iterator<_Key, _Tp, _Ref> _Self;
+
+    _Flat_map_iterator() :
+        _M_key(0),
+        _M_value(0)
+      { }
+
+    _Flat_map_iterator(const _Key* __k, _Tp* __v) :
+        _M_key(__k),
+        _M_value(__v)
+      { }
+
+    _Flat_map_iterator(const iterator& __it) :
+        _M_key(__it._M_key),
+        _M_value(__it._M_value)
+      { }
+
+    reference operator*() const
+      { return reference(*_M_key, *_M_value); }
+    pointer operator->() const
+      { return pointer(**this); }
+    reference operator[](difference_type __n) const
+      { return reference(_M_key[__n], _M_value[__n]); }
+
+    _Self& operator++()
+      {
+        ++_M_key;
+        ++_M_value;
+        return *this;
+      }
+    _Self operator++(int)
+      {
+        _Self __tmp = *this;
+        ++*this;
+        return __tmp;
+      }
+    _Self& operator--()
+      {
+        --_M_key;
+        --_M_value;
+        return *this;
+      }
+    _Self operator--(int)
+      {
+        _Self __tmp = *this;
+        --*this;
+        return __tmp;
+      }
+
+    _Self& operator+=(difference_type __n)
+      {
+        _M_key += __n;
+        _M_value += __n;
+        return *this;
+      }
+    _Self& operator-=(difference_type __n)
+      { return *this += -__n; }
+    _Self operator+(difference_type __n) const
+      { return _Self(_M_key + __n, _M_value + __n); }
+    _Self operator-(difference_type __n) const
+      { return _Self(_M_key - __n, _M_value - __n); }
+    difference_type operator-(const const_iterator& __y) const
+      { return _M_key - __y._M_key; }
+
+    bool operator==(const const_iterator& __y) const
+      { return _M_key == __y._M_key; }
+    bool operator!=(const const_iterator& __y) const
+      { return _M_key != __y._M_key; }
+    bool operator<(const const_iterator& __y) const
+      { return _M_key < __y._M_key; }
+    bool operator>(const const_iterator& __y) const
+      { return _M_key > __y._M_key; }
+    bool operator<=(const const_iterator& __y) const
+      { return _M_key <= __y._M_key; }
+    bool operator>=(const const_iterator& __y) const
+      { return _M_key >= __y._M_key; }
+
+    const _Key* _M_key;
+    _Tp* _M_value;
+};
+
+template <class _Key, class _Tp, class _Ref>
+inline _Flat_map_iterator<_Key, _Tp, _Ref> _STLP_CALL
+operator+(ptrdiff_t __n, const _Flat_map_iterator<_Key, _Tp, _Ref>& __it)
+{ return __it + __n; }
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+/*
+ * Map over sorted vectors (see stl/_flat_tree.h): keys in one vector,
+ * mapped values in another one. Interface of map, plus reserve(),
+ * capacity() and access to underlying vectors; value_type is
+ * pair<key_type, mapped_type>, and iterator give
+ * pair<const key_type&, mapped_type&> on dereference. Insert and
+ * erase invalidate iterators.
+ */
+template <class _Key, class _Tp, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key> ),
+          _STLP_DEFAULT_PAIR_ALLOCATOR_SELECT(_Key, _Tp) >
+class flat_map
+{
+  typedef flat_map<_Key, _Tp, _Compare, _Alloc> _Self;
+public:
+  typedef _Key                  key_type;
+  typedef _Tp                   mapped_type;
+  typedef pair<_Key, _Tp>       value_type;
+  typedef _Compare              key_compare;
+
+  class value_compare
+    : public binary_function<value_type, value_type, bool> {
+  friend class flat_map<_Key,_Tp,_Compare,_Alloc>;
+  protected :
+    //c is a Standard name (23.3.1), do no make it STLport naming convention compliant.
+    _Compare comp;
+    value_compare(_Compare __c) : comp(__c) {}
+  public:
+    bool operator()(const value_type& __x, const value_type& __y) const
+    { return comp(__x.first, __y.first); }
+  };
+
+  typedef vector<_Key, typename _Alloc::template rebind<_Key>::other> key_container_type;
+  typedef vector<_Tp, typename _Alloc::template rebind<_Tp>::other> mapped_container_type;
+
+  typedef pair<const _Key&, _Tp&> reference;
+  typedef pair<const _Key&, const _Tp&> const_reference;
+  typedef _STLP_PRIV _Flat_map_iterator<_Key, _Tp, reference> iterator;
+  typedef _STLP_PRIV _Flat_map_iterator<_Key, _Tp, const_reference> const_iterator;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Alloc allocator_type;
+  _STLP_DECLARE_RANDOM_ACCESS_REVERSE_ITERATORS;
+
+private:
+  key_container_type _M_keys;
+  mapped_container_type _M_values;
+  _Compare _M_comp;
+  _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+  const _Key* _M_kdata() const
+  { return _M_keys.empty() ? 0 : &_M_keys[0]; }
+  _Tp* _M_vdata() const
+  { return _M_values.empty() ? 0 : __CONST_CAST(_Tp*, &_M_values[0]); }
+  iterator _M_iter(size_type __i) const
+  { return iterator(_M_kdata() + __i, _M_vdata() + __i); }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_lower(const _KT& __k) const
+  { return _STLP_PRIV __flat_lower_bound(_M_kdata(), size(), __k, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_upper(const _KT& __k) const
+  { return _STLP_PRIV __flat_upper_bound(_M_kdata(), size(), __k, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_find(const _KT& __k) const {
+    size_type __i = _M_lower(__k);
+    return __i == size() || _M_comp(__k, _M_keys[__i]) ? size() : __i;
+  }
+
+  iterator _M_insert_at(size_type __i, const _Key& __k, const _Tp& __v) {
+    _M_keys.insert(_M_keys.begin() + __i, __k);
+    _STLP_TRY {
+      _M_values.insert(_M_values.begin() + __i, __v);
+    }
+    _STLP_UNWIND(_M_keys.erase(_M_keys.begin() + __i))
+    return _M_iter(__i);
+  }
+  iterator _M_erase(size_type __f, size_type __l) {
+    _M_keys.erase(_M_keys.begin() + __f, _M_keys.begin() + __l);
+    _M_values.erase(_M_values.begin() + __f, _M_values.begin() + __l);
+    return _M_iter(__f);
+  }
+
+public:
+  explicit flat_map(const _Compare& __comp = _Compare(),
+                    const allocator_type& __a = allocator_type())
+    : _M_keys(__a), _M_values(__a), _M_comp(__comp) {}
+
+  template <class _InputIterator>
+  flat_map(_InputIterator __first, _InputIterator __last,
+           const _Compare& __comp = _Compare(),
+           const allocator_type& __a = allocator_type())
+    : _M_keys(__a), _M_values(__a), _M_comp(__comp)
+    { insert(__first, __last); }
+
+  flat_map(const _Self& __x)
+    : _M_keys(__x._M_keys), _M_values(__x._M_values), _M_comp(__x._M_comp) {}
+  flat_map(_Self&& __x)
+    : _M_keys(__x._M_keys.get_allocator()), _M_values(__x._M_values.get_allocator()), _M_comp(__x._M_comp) {
+    _M_keys.swap(__x._M_keys);
+    _M_values.swap(__x._M_values);
+  }
+
+  _Self& operator=(const _Self& __x) {
+    if (&__x != this) {
+      _Self __tmp(__x);
+      swap(__tmp);
+    }
+    return *this;
+  }
+  _Self& operator=(_Self&& __x) {
+    swap(__x);
+    return *this;
+  }
+
+  // accessors:
+  key_compare key_comp() const { return _M_comp; }
+  value_compare value_comp() const { return value_compare(_M_comp); }
+  allocator_type get_allocator() const { return allocator_type(_M_keys.get_allocator()); }
+
+  iterator begin() { return _M_iter(0); }
+  iterator end() { return _M_iter(size()); }
+  const_iterator begin() const { return _M_iter(0); }
+  const_iterator end() const { return _M_iter(size()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+  bool empty() const { return _M_keys.empty(); }
+  size_type size() const { return _M_keys.size(); }
+  size_type max_size() const { return _M_keys.max_size(); }
+  size_type capacity() const { return _M_keys.capacity(); }
+  void reserve(size_type __n) {
+    _M_keys.reserve(__n);
+    _M_values.reserve(__n);
+  }
+  void swap(_Self& __x) {
+    _M_keys.swap(__x._M_keys);
+    _M_values.swap(__x._M_values);
+    _STLP_PRIV __swap(_M_comp, __x._M_comp);
+  }
+
+  // sorted keys and corresponding mapped values
+  const key_container_type& keys() const { return _M_keys; }
+  const mapped_container_type& values() const { return _M_values; }
+  // take elements without copy; __k should be sorted, without equivalent keys,
+  // __v of the same size
+  void replace(key_container_type&& __k, mapped_container_type&& __v) {
+    _M_keys.clear();
+    _M_values.clear();
+    _M_keys.swap(__k);
+    _M_values.swap(__v);
+  }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  _Tp& operator[](const _KT& __k) {
+    size_type __i = _M_lower(__k);
+    if (__i == size() || _M_comp(__k, _M_keys[__i])) {
+      _M_insert_at(__i, __k, _STLP_DEFAULT_CONSTRUCTED(_Tp));
+    }
+    return _M_values[__i];
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  _Tp& at(const _KT& __k) {
+    size_type __i = _M_find(__k);
+    if (__i == size()) {
+      __stl_throw_out_of_range("flat_map");
+    }
+    return _M_values[__i];
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const _Tp& at(const _KT& __k) const {
+    size_type __i = _M_find(__k);
+    if (__i == size()) {
+      __stl_throw_out_of_range("flat_map");
+    }
+    return _M_values[__i];
+  }
+
+  // insert/erase
+  pair<iterator,bool> insert(const value_type& __x) {
+    size_type __i = _M_lower(__x.first);
+    if (__i != size() && !_M_comp(__x.first, _M_keys[__i])) {
+      return pair<iterator,bool>(_M_iter(__i), false);
+    }
+    return pair<iterator,bool>(_M_insert_at(__i, __x.first, __x.second), true);
+  }
+  iterator insert(const_iterator __pos, const value_type& __x) {
+    // right hint: element before __pos < __x < element at __pos
+    size_type __i = __pos - begin();
+    if ((__i == size() || _M_comp(__x.first, _M_keys[__i])) &&
+        (__i == 0 || _M_comp(_M_keys[__i - 1], __x.first))) {
+      return _M_insert_at(__i, __x.first, __x.second);
+    }
+    return insert(__x).first;
+  }
+  template <class _InputIterator>
+  void insert(_InputIterator __first, _InputIterator __last) {
+    vector<value_type, typename _Alloc::template rebind<value_type>::other> __buf(__first, __last);
+    _STLP_PRIV __flat_merge_pairs(_M_keys, _M_values, __buf, _M_comp, true);
+  }
+  template <class... _Args>
+  pair<iterator,bool> emplace(_Args&&... __args)
+  { return insert(value_type(_STLP_STD::forward<_Args>(__args)...)); }
+
+  iterator erase(const_iterator __pos) {
+    size_type __i = __pos - begin();
+    return _M_erase(__i, __i + 1);
+  }
+  size_type erase(const key_type& __k) {
+    size_type __i = _M_find(__k);
+    if (__i == size()) {
+      return 0;
+    }
+    _M_erase(__i, __i + 1);
+    return 1;
+  }
+  iterator erase(const_iterator __first, const_iterator __last)
+  { return _M_erase(__first - begin(), __last - begin()); }
+  void clear() {
+    _M_keys.clear();
+    _M_values.clear();
+  }
+
+  // flat_map operations:
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator find(const _KT& __k) { return _M_iter(_M_find(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator find(const _KT& __k) const { return _M_iter(_M_find(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type count(const _KT& __k) const
+  { return _M_find(__k) == size() ? 0 : 1; }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator lower_bound(const _KT& __k) { return _M_iter(_M_lower(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator lower_bound(const _KT& __k) const { return _M_iter(_M_lower(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator upper_bound(const _KT& __k) { return _M_iter(_M_upper(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator upper_bound(const _KT& __k) const { return _M_iter(_M_upper(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<iterator,iterator> equal_range(const _KT& __k) {
+    size_type __i = _M_find(__k);
+    return pair<iterator,iterator>(_M_iter(__i), _M_iter(__i == size() ? __i : __i + 1));
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<const_iterator,const_iterator> equal_range(const _KT& __k) const {
+    size_type __i = _M_find(__k);
+    return pair<const_iterator,const_iterator>(_M_iter(__i), _M_iter(__i == size() ? __i : __i + 1));
+  }
+};
+
+template <class _Key, class _Tp, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key> ),
+          _STLP_DEFAULT_PAIR_ALLOCATOR_SELECT(_Key, _Tp) >
+class flat_multimap
+{
+  typedef flat_multimap<_Key, _Tp, _Compare, _Alloc> _Self;
+public:
+  typedef _Key                  key_type;
+  typedef _Tp                   mapped_type;
+  typedef pair<_Key, _Tp>       value_type;
+  typedef _Compare              key_compare;
+
+  class value_compare
+    : public binary_function<value_type, value_type, bool> {
+  friend class flat_multimap<_Key,_Tp,_Compare,_Alloc>;
+  protected :
+    //c is a Standard name (23.3.1), do no make it STLport naming convention compliant.
+    _Compare comp;
+    value_compare(_Compare __c) : comp(__c) {}
+  public:
+    bool operator()(const value_type& __x, const value_type& __y) const
+    { return comp(__x.first, __y.first); }
+  };
+
+  typedef vector<_Key, typename _Alloc::template rebind<_Key>::other> key_container_type;
+  typedef vector<_Tp, typename _Alloc::template rebind<_Tp>::other> mapped_container_type;
+
+  typedef pair<const _Key&, _Tp&> reference;
+  typedef pair<const _Key&, const _Tp&> const_reference;
+  typedef _STLP_PRIV _Flat_map_iterator<_Key, _Tp, reference> iterator;
+  typedef _STLP_PRIV _Flat_map_iterator<_Key, _Tp, const_reference> const_iterator;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Alloc allocator_type;
+  _STLP_DECLARE_RANDOM_ACCESS_REVERSE_ITERATORS;
+
+private:
+  key_container_type _M_keys;
+  mapped_container_type _M_values;
+  _Compare _M_comp;
+  _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+  const _Key* _M_kdata() const
+  { return _M_keys.empty() ? 0 : &_M_keys[0]; }
+  _Tp* _M_vdata() const
+  { return _M_values.empty() ? 0 : __CONST_CAST(_Tp*, &_M_values[0]); }
+  iterator _M_iter(size_type __i) const
+  { return iterator(_M_kdata() + __i, _M_vdata() + __i); }
+
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_lower(const _KT& __k) const
+  { return _STLP_PRIV __flat_lower_bound(_M_kdata(), size(), __k, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_upper(const _KT& __k) const
+  { return _STLP_PRIV __flat_upper_bound(_M_kdata(), size(), __k, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type _M_find(const _KT& __k) const {
+    size_type __i = _M_lower(__k);
+    return __i == size() || _M_comp(__k, _M_keys[__i]) ? size() : __i;
+  }
+
+  iterator _M_insert_at(size_type __i, const _Key& __k, const _Tp& __v) {
+    _M_keys.insert(_M_keys.begin() + __i, __k);
+    _STLP_TRY {
+      _M_values.insert(_M_values.begin() + __i, __v);
+    }
+    _STLP_UNWIND(_M_keys.erase(_M_keys.begin() + __i))
+    return _M_iter(__i);
+  }
+  iterator _M_erase(size_type __f, size_type __l) {
+    _M_keys.erase(_M_keys.begin() + __f, _M_keys.begin() + __l);
+    _M_values.erase(_M_values.begin() + __f, _M_values.begin() + __l);
+    return _M_iter(__f);
+  }
+
+public:
+  explicit flat_multimap(const _Compare& __comp = _Compare(),
+                         const allocator_type& __a = allocator_type())
+    : _M_keys(__a), _M_values(__a), _M_comp(__comp) {}
+
+  template <class _InputIterator>
+  flat_multimap(_InputIterator __first, _InputIterator __last,
+                const _Compare& __comp = _Compare(),
+                const allocator_type& __a = allocator_type())
+    : _M_keys(__a), _M_values(__a), _M_comp(__comp)
+    { insert(__first, __last); }
+
+  flat_multimap(const _Self& __x)
+    : _M_keys(__x._M_keys), _M_values(__x._M_values), _M_comp(__x._M_comp) {}
+  flat_multimap(_Self&& __x)
+    : _M_keys(__x._M_keys.get_allocator()), _M_values(__x._M_values.get_allocator()), _M_comp(__x._M_comp) {
+    _M_keys.swap(__x._M_keys);
+    _M_values.swap(__x._M_values);
+  }
+
+  _Self& operator=(const _Self& __x) {
+    if (&__x != this) {
+      _Self __tmp(__x);
+      swap(__tmp);
+    }
+    return *this;
+  }
+  _Self& operator=(_Self&& __x) {
+    swap(__x);
+    return *this;
+  }
+
+  // accessors:
+  key_compare key_comp() const { return _M_comp; }
+  value_compare value_comp() const { return value_compare(_M_comp); }
+  allocator_type get_allocator() const { return allocator_type(_M_keys.get_allocator()); }
+
+  iterator begin() { return _M_iter(0); }
+  iterator end() { return _M_iter(size()); }
+  const_iterator begin() const { return _M_iter(0); }
+  const_iterator end() const { return _M_iter(size()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+  bool empty() const { return _M_keys.empty(); }
+  size_type size() const { return _M_keys.size(); }
+  size_type max_size() const { return _M_keys.max_size(); }
+  size_type capacity() const { return _M_keys.capacity(); }
+  void reserve(size_type __n) {
+    _M_keys.reserve(__n);
+    _M_values.reserve(__n);
+  }
+  void swap(_Self& __x) {
+    _M_keys.swap(__x._M_keys);
+    _M_values.swap(__x._M_values);
+    _STLP_PRIV __swap(_M_comp, __x._M_comp);
+  }
+
+  // sorted keys and corresponding mapped values
+  const key_container_type& keys() const { return _M_keys; }
+  const mapped_container_type& values() const { return _M_values; }
+  // take elements without copy; __k should be sorted,
+  // __v of the same size
+  void replace(key_container_type&& __k, mapped_container_type&& __v) {
+    _M_keys.clear();
+    _M_values.clear();
+    _M_keys.swap(__k);
+    _M_values.swap(__v);
+  }
+
+  // insert/erase
+  iterator insert(const value_type& __x)
+  { return _M_insert_at(_M_upper(__x.first), __x.first, __x.second); }
+  iterator insert(const_iterator __pos, const value_type& __x) {
+    // right hint: element before __pos <= __x <= element at __pos
+    size_type __i = __pos - begin();
+    if ((__i == size() || !_M_comp(_M_keys[__i], __x.first)) &&
+        (__i == 0 || !_M_comp(__x.first, _M_keys[__i - 1]))) {
+      return _M_insert_at(__i, __x.first, __x.second);
+    }
+    return insert(__x);
+  }
+  template <class _InputIterator>
+  void insert(_InputIterator __first, _InputIterator __last) {
+    vector<value_type, typename _Alloc::template rebind<value_type>::other> __buf(__first, __last);
+    _STLP_PRIV __flat_merge_pairs(_M_keys, _M_values, __buf, _M_comp, false);
+  }
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return insert(value_type(_STLP_STD::forward<_Args>(__args)...)); }
+
+  iterator erase(const_iterator __pos) {
+    size_type __i = __pos - begin();
+    return _M_erase(__i, __i + 1);
+  }
+  size_type erase(const key_type& __k) {
+    size_type __f = _M_lower(__k);
+    size_type __l = _M_upper(__k);
+    _M_erase(__f, __l);
+    return __l - __f;
+  }
+  iterator erase(const_iterator __first, const_iterator __last)
+  { return _M_erase(__first - begin(), __last - begin()); }
+  void clear() {
+    _M_keys.clear();
+    _M_values.clear();
+  }
+
+  // flat_multimap operations:
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator find(const _KT& __k) { return _M_iter(_M_find(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator find(const _KT& __k) const { return _M_iter(_M_find(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type count(const _KT& __k) const
+  { return _M_upper(__k) - _M_lower(__k); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator lower_bound(const _KT& __k) { return _M_iter(_M_lower(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator lower_bound(const _KT& __k) const { return _M_iter(_M_lower(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator upper_bound(const _KT& __k) { return _M_iter(_M_upper(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  const_iterator upper_bound(const _KT& __k) const { return _M_iter(_M_upper(__k)); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<iterator,iterator> equal_range(const _KT& __k)
+  { return pair<iterator,iterator>(_M_iter(_M_lower(__k)), _M_iter(_M_upper(__k))); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<const_iterator,const_iterator> equal_range(const _KT& __k) const
+  { return pair<const_iterator,const_iterator>(_M_iter(_M_lower(__k)), _M_iter(_M_upper(__k))); }
+};
+
+#define _STLP_TEMPLATE_HEADER template <class _Key, class _Tp, class _Compare, class _Alloc>
+#define _STLP_TEMPLATE_CONTAINER flat_map<_Key,_Tp,_Compare,_Alloc>
+#include <stl/_relops_cont.h>
+#undef  _STLP_TEMPLATE_CONTAINER
+#define _STLP_TEMPLATE_CONTAINER flat_multimap<_Key,_Tp,_Compare,_Alloc>
+#include <stl/_relops_cont.h>
+#undef  _STLP_TEMPLATE_CONTAINER
+#undef  _STLP_TEMPLATE_HEADER
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_FLAT_MAP_H */
+
+// Local Variables:
+// mode:C++
+// End:
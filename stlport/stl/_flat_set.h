@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_FLAT_SET_H
+#define _STLP_INTERNAL_FLAT_SET_H
+
+#ifndef _STLP_INTERNAL_FLAT_TREE_H
+#  include <stl/_flat_tree.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+/*
+ * Set over sorted vector (see stl/_flat_tree.h): interface of set,
+ * plus reserve(), capacity() and access to underlying vector;
+ * insert and erase invalidate iterators.
+ */
+template <class _Key, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key>),
+                      _STLP_DFL_TMPL_PARAM(_Alloc, allocator<_Key>) >
+class flat_set
+{
+  typedef flat_set<_Key, _Compare, _Alloc> _Self;
+public:
+  typedef _Key     key_type;
+  typedef _Key     value_type;
+  typedef _Compare key_compare;
+  typedef _Compare value_compare;
+  typedef vector<_Key, _Alloc> container_type;
+
+  typedef typename container_type::pointer pointer;
+  typedef typename container_type::const_pointer const_pointer;
+  typedef typename container_type::reference reference;
+  typedef typename container_type::const_reference const_reference;
+  // elements of set are immutable
+  typedef typename container_type::const_iterator iterator;
+  typedef typename container_type::const_iterator const_iterator;
+  typedef typename container_type::const_reverse_iterator reverse_iterator;
+  typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+  typedef typename container_type::size_type size_type;
+  typedef typename container_type::difference_type difference_type;
+  typedef typename container_type::allocator_type allocator_type;
+
+private:
+  container_type _M_c;
+  _Compare _M_comp;
+  _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+  const_pointer _M_data() const
+  { return _M_c.empty() ? 0 : &_M_c[0]; }
+  typename container_type::iterator _M_mutable(const_iterator __pos)
+  { return _M_c.begin() + (__pos - _M_c.begin()); }
+
+public:
+  explicit flat_set(const _Compare& __comp = _Compare(),
+                    const allocator_type& __a = allocator_type())
+    : _M_c(__a), _M_comp(__comp) {}
+
+  template <class _InputIterator>
+  flat_set(_InputIterator __first, _InputIterator __last,
+           const _Compare& __comp = _Compare(),
+           const allocator_type& __a = allocator_type())
+    : _M_c(__a), _M_comp(__comp) { insert(__first, __last); }
+
+  flat_set(const _Self& __x) : _M_c(__x._M_c), _M_comp(__x._M_comp) {}
+  flat_set(_Self&& __x) : _M_c(__x.get_allocator()), _M_comp(__x._M_comp)
+  { _M_c.swap(__x._M_c); }
+
+  _Self& operator=(const _Self& __x) {
+    _M_c = __x._M_c;
+    _M_comp = __x._M_comp;
+    return *this;
+  }
+  _Self& operator=(_Self&& __x) {
+    swap(__x);
+    return *this;
+  }
+
+  // accessors:
+  key_compare key_comp() const { return _M_comp; }
+  value_compare value_comp() const { return _M_comp; }
+  allocator_type get_allocator() const { return _M_c.get_allocator(); }
+
+  iterator begin() const { return _M_c.begin(); }
+  iterator end() const { return _M_c.end(); }
+  reverse_iterator rbegin() const { return _M_c.rbegin(); }
+  reverse_iterator rend() const { return _M_c.rend(); }
+  bool empty() const { return _M_c.empty(); }
+  size_type size() const { return _M_c.size(); }
+  size_type max_size() const { return _M_c.max_size(); }
+  size_type capacity() const { return _M_c.capacity(); }
+  void reserve(size_type __n) { _M_c.reserve(__n); }
+  void swap(_Self& __x) {
+    _M_c.swap(__x._M_c);
+    _STLP_PRIV __swap(_M_comp, __x._M_comp);
+  }
+
+  // give sorted vector of elements away without copy; set become empty
+  container_type extract() {
+    container_type __c(_M_c.get_allocator());
+    __c.swap(_M_c);
+    return __c;
+  }
+  // take elements without copy; __c should be sorted, without equivalent elements
+  void replace(container_type&& __c) {
+    _M_c.clear();
+    _M_c.swap(__c);
+  }
+
+  // insert/erase
+  pair<iterator,bool> insert(const value_type& __x) {
+    size_type __i = _STLP_PRIV __flat_lower_bound(_M_data(), size(), __x, _M_comp);
+    if (__i != size() && !_M_comp(__x, _M_c[__i])) {
+      return pair<iterator,bool>(begin() + __i, false);
+    }
+    return pair<iterator,bool>(_M_c.insert(_M_c.begin() + __i, __x), true);
+  }
+  iterator insert(const_iterator __pos, const value_type& __x) {
+    // right hint: element before __pos < __x < element at __pos
+    if ((__pos == end() || _M_comp(__x, *__pos)) &&
+        (__pos == begin() || _M_comp(*(__pos - 1), __x))) {
+      return _M_c.insert(_M_mutable(__pos), __x);
+    }
+    return insert(__x).first;
+  }
+  template <class _InputIterator>
+  void insert(_InputIterator __first, _InputIterator __last) {
+    size_type __n = size();
+    _M_c.insert(_M_c.end(), __first, __last);
+    _STLP_PRIV __flat_merge_tail(_M_c, __n, _M_comp, true);
+  }
+  template <class... _Args>
+  pair<iterator,bool> emplace(_Args&&... __args)
+  { return insert(value_type(_STLP_STD::forward<_Args>(__args)...)); }
+
+  iterator erase(const_iterator __pos) { return _M_c.erase(_M_mutable(__pos)); }
+  size_type erase(const key_type& __x) {
+    size_type __i = _STLP_PRIV __flat_lower_bound(_M_data(), size(), __x, _M_comp);
+    if (__i == size() || _M_comp(__x, _M_c[__i])) {
+      return 0;
+    }
+    _M_c.erase(_M_c.begin() + __i);
+    return 1;
+  }
+  iterator erase(const_iterator __first, const_iterator __last)
+  { return _M_c.erase(_M_mutable(__first), _M_mutable(__last)); }
+  void clear() { _M_c.clear(); }
+
+  // set operations:
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator find(const _KT& __x) const {
+    iterator __i = lower_bound(__x);
+    return __i == end() || _M_comp(__x, *__i) ? end() : __i;
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type count(const _KT& __x) const
+  { return find(__x) == end() ? 0 : 1; }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator lower_bound(const _KT& __x) const
+  { return begin() + _STLP_PRIV __flat_lower_bound(_M_data(), size(), __x, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator upper_bound(const _KT& __x) const
+  { return begin() + _STLP_PRIV __flat_upper_bound(_M_data(), size(), __x, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<iterator, iterator> equal_range(const _KT& __x) const {
+    iterator __i = find(__x);
+    return pair<iterator, iterator>(__i, __i == end() ? __i : __i + 1);
+  }
+};
+
+template <class _Key, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key>),
+                      _STLP_DFL_TMPL_PARAM(_Alloc, allocator<_Key>) >
+class flat_multiset
+{
+  typedef flat_multiset<_Key, _Compare, _Alloc> _Self;
+public:
+  typedef _Key     key_type;
+  typedef _Key     value_type;
+  typedef _Compare key_compare;
+  typedef _Compare value_compare;
+  typedef vector<_Key, _Alloc> container_type;
+
+  typedef typename container_type::pointer pointer;
+  typedef typename container_type::const_pointer const_pointer;
+  typedef typename container_type::reference reference;
+  typedef typename container_type::const_reference const_reference;
+  typedef typename container_type::const_iterator iterator;
+  typedef typename container_type::const_iterator const_iterator;
+  typedef typename container_type::const_reverse_iterator reverse_iterator;
+  typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+  typedef typename container_type::size_type size_type;
+  typedef typename container_type::difference_type difference_type;
+  typedef typename container_type::allocator_type allocator_type;
+
+private:
+  container_type _M_c;
+  _Compare _M_comp;
+  _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
+
+  const_pointer _M_data() const
+  { return _M_c.empty() ? 0 : &_M_c[0]; }
+  typename container_type::iterator _M_mutable(const_iterator __pos)
+  { return _M_c.begin() + (__pos - _M_c.begin()); }
+
+public:
+  explicit flat_multiset(const _Compare& __comp = _Compare(),
+                         const allocator_type& __a = allocator_type())
+    : _M_c(__a), _M_comp(__comp) {}
+
+  template <class _InputIterator>
+  flat_multiset(_InputIterator __first, _InputIterator __last,
+                const _Compare& __comp = _Compare(),
+                const allocator_type& __a = allocator_type())
+    : _M_c(__a), _M_comp(__comp) { insert(__first, __last); }
+
+  flat_multiset(const _Self& __x) : _M_c(__x._M_c), _M_comp(__x._M_comp) {}
+  flat_multiset(_Self&& __x) : _M_c(__x.get_allocator()), _M_comp(__x._M_comp)
+  { _M_c.swap(__x._M_c); }
+
+  _Self& operator=(const _Self& __x) {
+    _M_c = __x._M_c;
+    _M_comp = __x._M_comp;
+    return *this;
+  }
+  _Self& operator=(_Self&& __x) {
+    swap(__x);
+    return *this;
+  }
+
+  // accessors:
+  key_compare key_comp() const { return _M_comp; }
+  value_compare value_comp() const { return _M_comp; }
+  allocator_type get_allocator() const { return _M_c.get_allocator(); }
+
+  iterator begin() const { return _M_c.begin(); }
+  iterator end() const { return _M_c.end(); }
+  reverse_iterator rbegin() const { return _M_c.rbegin(); }
+  reverse_iterator rend() const { return _M_c.rend(); }
+  bool empty() const { return _M_c.empty(); }
+  size_type size() const { return _M_c.size(); }
+  size_type max_size() const { return _M_c.max_size(); }
+  size_type capacity() const { return _M_c.capacity(); }
+  void reserve(size_type __n) { _M_c.reserve(__n); }
+  void swap(_Self& __x) {
+    _M_c.swap(__x._M_c);
+    _STLP_PRIV __swap(_M_comp, __x._M_comp);
+  }
+
+  // give sorted vector of elements away without copy; multiset become empty
+  container_type extract() {
+    container_type __c(_M_c.get_allocator());
+    __c.swap(_M_c);
+    return __c;
+  }
+  // take elements without copy; __c should be sorted
+  void replace(container_type&& __c) {
+    _M_c.clear();
+    _M_c.swap(__c);
+  }
+
+  // insert/erase
+  iterator insert(const value_type& __x)
+  { return _M_c.insert(_M_c.begin() + _STLP_PRIV __flat_upper_bound(_M_data(), size(), __x, _M_comp), __x); }
+  iterator insert(const_iterator __pos, const value_type& __x) {
+    // right hint: element before __pos <= __x <= element at __pos
+    if ((__pos == end() || !_M_comp(*__pos, __x)) &&
+        (__pos == begin() || !_M_comp(__x, *(__pos - 1)))) {
+      return _M_c.insert(_M_mutable(__pos), __x);
+    }
+    return insert(__x);
+  }
+  template <class _InputIterator>
+  void insert(_InputIterator __first, _InputIterator __last) {
+    size_type __n = size();
+    _M_c.insert(_M_c.end(), __first, __last);
+    _STLP_PRIV __flat_merge_tail(_M_c, __n, _M_comp, false);
+  }
+  template <class... _Args>
+  iterator emplace(_Args&&... __args)
+  { return insert(value_type(_STLP_STD::forward<_Args>(__args)...)); }
+
+  iterator erase(const_iterator __pos) { return _M_c.erase(_M_mutable(__pos)); }
+  size_type erase(const key_type& __x) {
+    pair<iterator, iterator> __r = equal_range(__x);
+    size_type __n = __r.second - __r.first;
+    _M_c.erase(_M_mutable(__r.first), _M_mutable(__r.second));
+    return __n;
+  }
+  iterator erase(const_iterator __first, const_iterator __last)
+  { return _M_c.erase(_M_mutable(__first), _M_mutable(__last)); }
+  void clear() { _M_c.clear(); }
+
+  // multiset operations:
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator find(const _KT& __x) const {
+    iterator __i = lower_bound(__x);
+    return __i == end() || _M_comp(__x, *__i) ? end() : __i;
+  }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  size_type count(const _KT& __x) const
+  { return upper_bound(__x) - lower_bound(__x); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator lower_bound(const _KT& __x) const
+  { return begin() + _STLP_PRIV __flat_lower_bound(_M_data(), size(), __x, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  iterator upper_bound(const _KT& __x) const
+  { return begin() + _STLP_PRIV __flat_upper_bound(_M_data(), size(), __x, _M_comp); }
+  _STLP_TEMPLATE_FOR_CONT_EXT
+  pair<iterator, iterator> equal_range(const _KT& __x) const
+  { return pair<iterator, iterator>(lower_bound(__x), upper_bound(__x)); }
+};
+
+#define _STLP_TEMPLATE_HEADER template <class _Key, class _Compare, class _Alloc>
+#define _STLP_TEMPLATE_CONTAINER flat_set<_Key,_Compare,_Alloc>
+#include <stl/_relops_cont.h>
+#undef  _STLP_TEMPLATE_CONTAINER
+#define _STLP_TEMPLATE_CONTAINER flat_multiset<_Key,_Compare,_Alloc>
+#include <stl/_relops_cont.h>
+#undef  _STLP_TEMPLATE_CONTAINER
+#undef  _STLP_TEMPLATE_HEADER
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_FLAT_SET_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_FLAT_TREE_H
+#define _STLP_INTERNAL_FLAT_TREE_H
+
+#  include <vector>
+#  include <algorithm>
+
+#ifndef _STLP_INTERNAL_FUNCTION_BASE_H
+#  include <stl/_function_base.h>
+#endif
+
+/*
+ * Common part of flat_set, flat_multiset, flat_map and flat_multimap:
+ * elements are kept sorted in vector (keys and mapped values of flat_map
+ * in two parallel vectors), so there is no per-element allocation, and
+ * lookup is binary search over contiguous memory.
+ *
+ * Single insert and erase move elements behind position (O(n)); range
+ * insert append new elements, sort them and merge with old ones, so it
+ * cost O(n + m log m) for m new elements. Insert and erase invalidate
+ * iterators and references.
+ */
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Binary search without unpredictable branches: number of iterations
+ * depend only on __n, and choice of half is conditional move, so loop
+ * doesn't stall on mispredictions when keys are random. Return index
+ * of first element not less than __k.
+ */
+template <class _Tp, class _KT, class _Compare>
+size_t __flat_lower_bound(const _Tp* __a, size_t __n, const _KT& __k, const _Compare& __comp)
+{
+  if (__n == 0) {
+    return 0;
+  }
+  const _Tp* __base = __a;
+  while (__n > 1) {
+    const size_t __half = __n / 2;
+    __base = __comp(__base[__half], __k) ? __base + __half : __base;
+    __n -= __half;
+  }
+  return (__base - __a) + (__comp(*__base, __k) ? 1 : 0);
+}
+
+// index of first element greater than __k
+template <class _Tp, class _KT, class _Compare>
+size_t __flat_upper_bound(const _Tp* __a, size_t __n, const _KT& __k, const _Compare& __comp)
+{
+  if (__n == 0) {
+    return 0;
+  }
+  const _Tp* __base = __a;
+  while (__n > 1) {
+    const size_t __half = __n / 2;
+    __base = __comp(__k, __base[__half]) ? __base : __base + __half;
+    __n -= __half;
+  }
+  return (__base - __a) + (__comp(__k, *__base) ? 0 : 1);
+}
+
+// neighbours in sorted sequence are equivalent
+template <class _Compare>
+struct __flat_equivalent
+{
+    explicit __flat_equivalent(const _Compare& __comp) :
+        _M_comp(__comp)
+      { }
+
+    template <class _Tp>
+    bool operator()(const _Tp& __x, const _Tp& __y) const
+      { return !_M_comp(__x, __y); }
+
+    _Compare _M_comp;
+};
+
+// compare (key, value) pairs by key
+template <class _Compare>
+struct __flat_first_compare
+{
+    explicit __flat_first_compare(const _Compare& __comp) :
+        _M_comp(__comp)
+      { }
+
+    template <class _Pair>
+    bool operator()(const _Pair& __x, const _Pair& __y) const
+      { return _M_comp(__x.first, __y.first); }
+
+    _Compare _M_comp;
+};
+
+template <class _RandomAccessIter, class _Compare>
+bool __flat_is_sorted(_RandomAccessIter __first, _RandomAccessIter __last, const _Compare& __comp)
+{
+  if (__first != __last) {
+    for (_RandomAccessIter __next = __first + 1; __next != __last; __first = __next++) {
+      if (__comp(*__next, *__first)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*
+ * Elements of __v before __mid are sorted, ones after __mid are new:
+ * sort new ones (input is often sorted already, that is checked first)
+ * and merge with old. Merge and sort are stable, so for unique containers
+ * first of equivalent elements, i.e. old one, is kept.
+ */
+template <class _Tp, class _Alloc, class _Compare>
+void __flat_merge_tail(vector<_Tp, _Alloc>& __v, size_t __mid, const _Compare& __comp, bool __unique)
+{
+  typedef typename vector<_Tp, _Alloc>::iterator _Iter;
+  _Iter __m = __v.begin() + __mid;
+  if (__m == __v.end()) {
+    return;
+  }
+  if (!__flat_is_sorted(__m, __v.end(), __comp)) {
+    _STLP_STD::stable_sort(__m, __v.end(), __comp);
+  }
+  // elements before __first are less than any new one, so stay in place
+  _Iter __first = _STLP_STD::upper_bound(__v.begin(), __m, *__m, __comp);
+  if (__first != __m) {
+    _STLP_STD::inplace_merge(__first, __m, __v.end(), __comp);
+  }
+  if (__unique) {
+    if (__first != __v.begin() && !__comp(*(__first - 1), *__first)) {
+      --__first;
+    }
+    __v.erase(_STLP_STD::unique(__first, __v.end(), __flat_equivalent<_Compare>(__comp)), __v.end());
+  }
+}
+
+/*
+ * Merge sorted parallel vectors __keys and __values with (key, value)
+ * pairs of __buf (in any order). Result is built in new vectors, so
+ * containers are unchanged if exception is thrown.
+ */
+template <class _Key, class _KAlloc, class _Tp, class _TAlloc, class _Pair, class _PAlloc, class _Compare>
+void __flat_merge_pairs(vector<_Key, _KAlloc>& __keys, vector<_Tp, _TAlloc>& __values,
+                        vector<_Pair, _PAlloc>& __buf, const _Compare& __comp, bool __unique)
+{
+  __flat_first_compare<_Compare> __pcomp(__comp);
+  if (!__flat_is_sorted(__buf.begin(), __buf.end(), __pcomp)) {
+    _STLP_STD::stable_sort(__buf.begin(), __buf.end(), __pcomp);
+  }
+  if (__unique) {
+    __buf.erase(_STLP_STD::unique(__buf.begin(), __buf.end(), __flat_equivalent<__flat_first_compare<_Compare> >(__pcomp)),
+                __buf.end());
+  }
+
+  vector<_Key, _KAlloc> __k(__keys.get_allocator());
+  vector<_Tp, _TAlloc> __v(__values.get_allocator());
+  __k.reserve(__keys.size() + __buf.size());
+  __v.reserve(__keys.size() + __buf.size());
+  size_t __i = 0;
+  size_t __j = 0;
+  while (__i < __keys.size() && __j < __buf.size()) {
+    if (__comp(__buf[__j].first, __keys[__i])) {
+      __k.push_back(__buf[__j].first);
+      __v.push_back(__buf[__j].second);
+      ++__j;
+    } else {
+      // old element go first; new equivalent one is dropped from unique container
+      if (__unique && !__comp(__keys[__i], __buf[__j].first)) {
+        ++__j;
+      }
+      __k.push_back(__keys[__i]);
+      __v.push_back(__values[__i]);
+      ++__i;
+    }
+  }
+  for ( ; __i < __keys.size(); ++__i) {
+    __k.push_back(__keys[__i]);
+    __v.push_back(__values[__i]);
+  }
+  for ( ; __j < __buf.size(); ++__j) {
+    __k.push_back(__buf[__j].first);
+    __v.push_back(__buf[__j].second);
+  }
+  __keys.swap(__k);
+  __values.swap(__v);
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_FLAT_TREE_H */
+
+// Local Variables:
+// mode:C++
+// End:
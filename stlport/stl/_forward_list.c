@@ -23,10 +23,6 @@
 #  include <forward_list>
 #endif
 
-#ifndef _STLP_CARRAY_H
-#  include <stl/_carray.h>
-#endif
-
 #ifndef _STLP_RANGE_ERRORS_H
 #  include <stl/_range_errors.h>
 #endif
@@ -56,7 +52,7 @@ forward_list<_Tp,_Alloc>::_M_erase_after(_STLP_PRIV _Slist_node_base* __before_f
     _Node* __tmp = __STATIC_CAST(_Node*, __cur);
     __cur = __cur->_M_next;
     this->get_allocator().destroy( &__tmp->_M_data );
-    _M_head.deallocate(__tmp,1);
+    _M_put_node(__tmp);
   }
   __before_first->_M_next = __last_node;
   return __last_node;
@@ -149,34 +145,12 @@ template <class _Tp, class _Alloc>
 template <class _StrictWeakOrdering>
 void forward_list<_Tp,_Alloc>::sort(_StrictWeakOrdering __comp)
 {
-  if (!this->begin()._M_node || !this->begin()._M_node->_M_next)
-    return;
-
-  forward_list<_Tp, _Alloc> __carry(this->get_allocator());
-  const int NB = 64;
-  _STLP_PRIV _CArray<forward_list<_Tp, _Alloc>, NB> __counter(__carry);
-  int __fill = 0;
-  while (!this->empty()) {
-    __carry.splice_after(__carry.before_begin(), *this, this->before_begin());
-    int __i = 0;
-    while (__i < __fill && !__counter[__i].empty()) {
-      __counter[__i].merge(__carry, __comp);
-      __carry.swap(__counter[__i]);
-      ++__i;
-    }
-    __carry.swap(__counter[__i]);
-    if (__i == __fill) {
-      ++__fill;
-      if (__fill >= NB) {
-        //Looks like the forward_list has too many elements to be sorted with this algorithm:
-        __stl_throw_overflow_error("forward_list::sort");
-      }
-    }
+  _Node_base* __first = this->_M_head._M_data._M_next;
+  _STLP_TRY {
+    _STLP_PRIV __chain_sort<_Node>(__first, __comp);
   }
-
-  for (int __i = 1; __i < __fill; ++__i)
-     __counter[__i].merge(__counter[__i - 1], __comp);
-  this->swap(__counter[__fill-1]);
+  _STLP_UNWIND(this->_M_head._M_data._M_next = __first)
+  this->_M_head._M_data._M_next = __first;
 }
 
 #if defined (forward_list)
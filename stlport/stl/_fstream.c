@@ -52,6 +52,11 @@ basic_filebuf<_CharT, _Traits>::basic_filebuf() :
     _M_end_state(_STLP_DEFAULT_CONSTRUCTED(_State_type)),
     _M_mmap_base(0),
     _M_mmap_len(0),
+    _M_mmap_offset(0),
+    _M_mmap_policy(mmap_window),
+    _M_mmap_window(0),
+    _M_wb_nbufs(0),
+    _M_wb_bufsize(0),
     _M_saved_eback(0),
     _M_saved_gptr(0),
     _M_saved_egptr(0),
@@ -89,6 +94,11 @@ basic_filebuf<_CharT, _Traits>::close()
     this->_M_exit_input_mode();
   }
 
+  // Write-behind: wait until everything is on disk.
+  if (_M_base.__has_writer()) {
+    __ok = _M_base._M_stop_writer() && __ok;
+  }
+
   // Note order of arguments.  We close the file even if __ok is false.
   __ok = _M_base._M_close() && __ok;
 
@@ -265,6 +275,113 @@ basic_filebuf<_CharT, _Traits>::overflow(int_type __c)
   return traits_type::not_eof(__c);
 }
 
+// Block transfers.  When no conversion is needed, a block that doesn't fit
+// into the buffer is passed between the file and the caller's memory
+// directly (see _M_do_noconv_xsgetn and _M_do_noconv_xsputn); otherwise
+// characters go through the buffer, as in basic_streambuf.
+template <class _CharT, class _Traits>
+streamsize
+basic_filebuf<_CharT, _Traits>::xsgetn(_CharT* __s, streamsize __n)
+{
+  if ( ((int_flags_ & _always_noconv) != 0) && (__n > this->egptr() - this->gptr()) ) {
+    streamsize __result = _Noconv_input<_Traits>::_M_xsgetn(this, __s, __n);
+    if (__result >= 0) {
+      return __result;
+    }
+  }
+  return _Base::xsgetn(__s, __n);
+}
+
+template <class _CharT, class _Traits>
+streamsize
+basic_filebuf<_CharT, _Traits>::xsputn(const _CharT* __s, streamsize __n)
+{
+  if ( ((int_flags_ & _always_noconv) != 0) && (__n > this->epptr() - this->pptr()) ) {
+    streamsize __result = _Noconv_output<_Traits>::_M_xsputn(this, __s, __n);
+    if (__result >= 0) {
+      return __result;
+    }
+  }
+  return _Base::xsputn(__s, __n);
+}
+
+// Write block that is at least as large as internal buffer: pending
+// characters of put area and the block go to file together, without
+// copying block into buffer.  Returns -1 if block should be written
+// via buffer.  Called only when internal and external characters are
+// the same (see _Noconv_output).
+template <class _CharT, class _Traits>
+streamsize
+basic_filebuf<_CharT, _Traits>::_M_do_noconv_xsputn(const char* __s, streamsize __n)
+{
+  if ( (int_flags_ & _in_input_mode) != 0 ) {
+    return -1;
+  }
+  if ( (int_flags_ & _in_output_mode) == 0 ) {
+    if ( !_M_switch_to_output_mode() ) {
+      return 0;
+    }
+  }
+  if (__n < _M_int_buf_EOS - _M_int_buf) {
+    return -1;
+  }
+
+  char* __pending = (char*)this->pbase();
+  ptrdiff_t __npending = (char*)this->pptr() - __pending;
+  this->setp(_M_int_buf, _M_int_buf_EOS - 1);
+
+  if (_M_base.__has_writer() ?
+      !(_M_base._M_queue_write(__pending, __npending) && _M_base._M_queue_write(__s, __STATIC_CAST(ptrdiff_t, __n))) :
+      !_M_base._M_write(__pending, __npending, __CONST_CAST(char*, __s), __STATIC_CAST(ptrdiff_t, __n))) {
+    _M_output_error();
+    return 0;
+  }
+  return __n;
+}
+
+// Read block that is at least as large as external buffer (after
+// characters already in get area): get area is drained, the rest is read
+// from file straight into __s.  Get area is left empty, so position
+// and seeks are computed as after underflow that read nothing.  Returns
+// -1 if block should be read via buffer.
+template <class _CharT, class _Traits>
+streamsize
+basic_filebuf<_CharT, _Traits>::_M_do_noconv_xsgetn(char* __s, streamsize __n)
+{
+  if ( (int_flags_ & (_in_output_mode | _in_putback_mode)) != 0 ) {
+    return -1;
+  }
+  if ( (int_flags_ & _in_input_mode) == 0 ) {
+    if ( !_M_switch_to_input_mode() ) {
+      return 0;
+    }
+  }
+
+  streamsize __result = (char*)this->egptr() - (char*)this->gptr();
+  if (__n - __result < _M_ext_buf_EOS - _M_ext_buf) {
+    return -1;
+  }
+
+  _STLP_STD::copy((char*)this->gptr(), (char*)this->egptr(), __s);
+  if (_M_mmap_base != 0) {
+    _M_base._M_unmap(_M_mmap_base, _M_mmap_len);
+    _M_mmap_base = 0;
+    _M_mmap_len = 0;
+  }
+  _M_ext_buf_converted = _M_ext_buf;
+  _M_ext_buf_end = _M_ext_buf;
+  this->setg((_CharT*)_M_ext_buf, (_CharT*)_M_ext_buf, (_CharT*)_M_ext_buf);
+
+  while (__result < __n) {
+    ptrdiff_t __got = _M_base._M_read(__s + __result, __STATIC_CAST(ptrdiff_t, __n - __result));
+    if (__got <= 0) {
+      break;
+    }
+    __result += __got;
+  }
+  return __result;
+}
+
 // This member function must be called before any I/O has been
 // performed on the stream, otherwise it has no effect.
 //
@@ -313,6 +430,13 @@ basic_filebuf<_CharT, _Traits>::seekoff(off_type __off,
   if (!_M_seek_init(__off != 0 || __whence != ios_base::cur))
     return pos_type(-1);
 
+  if (_M_mmap_base != 0 && __whence != ios_base::end) {
+    streamoff __pos = __whence == ios_base::beg ? streamoff(__off) :
+      _M_mmap_offset + (this->gptr() - (_CharT*)_M_mmap_base) + __off;
+    if (_M_seek_in_mmap(__pos))
+      return pos_type(__pos);
+  }
+
   // Seek to beginning or end, regardless of whether we're in input mode.
   if (__whence == ios_base::beg || __whence == ios_base::end)
     return _M_seek_return(_M_base._M_seek(_M_width * __off, __whence),
@@ -400,6 +524,8 @@ basic_filebuf<_CharT, _Traits>::seekpos(pos_type __pos,
       return pos_type(-1);
 
     streamoff __off = off_type(__pos);
+    if (__off != -1 && _M_seek_in_mmap(__off))
+      return __pos;
     if (__off != -1 && _M_base._M_seek(__off, ios_base::beg) != -1) {
       _M_state = __pos.state();
       return _M_seek_return(__off, __pos.state());
@@ -414,13 +540,48 @@ template <class _CharT, class _Traits>
 int basic_filebuf<_CharT, _Traits>::sync()
 {
   if ( int_flags_ & _in_output_mode ) {
-    return traits_type::eq_int_type(this->overflow(traits_type::eof()),
-                                    traits_type::eof()) ? -1 : 0;
+    if (traits_type::eq_int_type(this->overflow(traits_type::eof()),
+                                 traits_type::eof()))
+      return -1;
+    // Write-behind: sync means data are on disk.
+    if (_M_base.__has_writer() && !_M_base._M_drain_writer(true))
+      return -1;
   }
   return 0;
 }
 
 
+// Target of seek is inside memory-mapped input: move gptr() only, keep
+// the mapping and file position (at the end of mapping).  Not for files
+// open for output, where next write must go to the new position.
+template <class _CharT, class _Traits>
+bool basic_filebuf<_CharT, _Traits>::_M_seek_in_mmap(streamoff __pos)
+{
+  if (_M_mmap_base != 0 &&
+      (int_flags_ & (_in_input_mode | _in_putback_mode)) == _in_input_mode &&
+      (_M_base.__o_mode() & ios_base::out) == 0 &&
+      __pos >= _M_mmap_offset && __pos < _M_mmap_offset + _M_mmap_len) {
+    _CharT* __base = (_CharT*)_M_mmap_base;
+    this->setg(__base, __base + __STATIC_CAST(ptrdiff_t, __pos - _M_mmap_offset),
+               __base + __STATIC_CAST(ptrdiff_t, _M_mmap_len));
+    return true;
+  }
+  return false;
+}
+
+// Mapped input from current position on; maps next part of file when
+// get area is empty.  Putback characters aren't part of file, so there
+// is no view in putback mode.
+template <class _CharT, class _Traits>
+const _CharT* basic_filebuf<_CharT, _Traits>::data()
+{
+  if ( ((int_flags_ & (_in_output_mode | _in_putback_mode)) == 0) &&
+       (this->gptr() == this->egptr()) ) {
+    this->underflow();
+  }
+  return (_M_mmap_base != 0 && (int_flags_ & _in_putback_mode) == 0) ? this->gptr() : 0;
+}
+
 // Change the filebuf's locale.  This member function has no effect
 // unless it is called before any I/O is performed on the stream.
 template <class _CharT, class _Traits>
@@ -485,6 +646,12 @@ bool basic_filebuf<_CharT, _Traits>::_M_switch_to_output_mode()
     this->setp(_M_int_buf, _M_int_buf_EOS - 1);
     int_flags_ |= _in_output_mode;
 
+    // Writer thread is started once per open file; if it can't be
+    // started, output is synchronous.
+    if (_M_wb_nbufs != 0 && !_M_base.__has_writer()) {
+      _M_base._M_start_writer(_M_wb_nbufs, _M_wb_bufsize);
+    }
+
     return true;
   }
 
@@ -737,6 +904,10 @@ bool basic_filebuf<_CharT, _Traits>::_M_seek_init(bool __do_unshift)
     if (__do_unshift) {
       __ok = __ok && this->_M_unshift();
     }
+    // File position is right only when writer is idle.
+    if (_M_base.__has_writer()) {
+      __ok = _M_base._M_drain_writer(false) && __ok;
+    }
     if (!__ok) {
       int_flags_ &= ~_in_output_mode;
       int_flags_ |= _in_error_mode;
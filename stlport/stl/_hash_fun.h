@@ -35,6 +35,10 @@
 #  include <cstddef>
 #endif
 
+#ifndef _STLP_CSTRING
+#  include <cstring>
+#endif
+
 #include <stdint.h>
 
 _STLP_BEGIN_NAMESPACE
@@ -43,15 +47,137 @@ template <class _Key> struct hash { };
 
 _STLP_MOVE_TO_PRIV_NAMESPACE
 
+/*
+ * Hash of bytes sequence and final mix of integer, for 32-bit and
+ * 64-bit size_t.
+ *
+ * Bytes are processed by words (MurmurHash2 / MurmurHash64A), not
+ * char by char: much faster for long keys, and every input bit affects
+ * all bits of result, so bucket index is good for any bucket count.
+ *
+ * mix() is finalizer of MurmurHash3: it spread keys like pointers
+ * (low bits are zero due to alignment) or sequential ids over all bits.
+ */
+template <int _Size>
+struct __stl_hash_traits;
+
+_STLP_TEMPLATE_NULL
+struct __stl_hash_traits<4>
+{
+    static uint32_t mix( uint32_t __h )
+      {
+        __h ^= __h >> 16;
+        __h *= 0x85ebca6bU;
+        __h ^= __h >> 13;
+        __h *= 0xc2b2ae35U;
+        __h ^= __h >> 16;
+        return __h;
+      }
+
+    static uint32_t bytes( const void* __p, size_t __len )
+      {
+        const uint32_t __m = 0x5bd1e995U;
+        const unsigned char* __data = static_cast<const unsigned char*>(__p);
+        uint32_t __h = 0x9747b28cU ^ static_cast<uint32_t>(__len);
+
+        for ( ; __len >= 4; __len -= 4, __data += 4 ) {
+          uint32_t __k;
+          memcpy( &__k, __data, 4 ); // unaligned load
+          __k *= __m;
+          __k ^= __k >> 24;
+          __k *= __m;
+          __h *= __m;
+          __h ^= __k;
+        }
+
+        if ( __len != 0 ) { // tail, 1..3 bytes
+          for ( size_t __i = 0; __i < __len; ++__i ) {
+            __h ^= uint32_t(__data[__i]) << (8 * __i);
+          }
+          __h *= __m;
+        }
+
+        __h ^= __h >> 13;
+        __h *= __m;
+        __h ^= __h >> 15;
+
+        return __h;
+      }
+};
+
+_STLP_TEMPLATE_NULL
+struct __stl_hash_traits<8>
+{
+    static uint64_t mix( uint64_t __h )
+      {
+        __h ^= __h >> 33;
+        __h *= 0xff51afd7ed558ccdULL;
+        __h ^= __h >> 33;
+        __h *= 0xc4ceb9fe1a85ec53ULL;
+        __h ^= __h >> 33;
+        return __h;
+      }
+
+    static uint64_t bytes( const void* __p, size_t __len )
+      {
+        const uint64_t __m = 0xc6a4a7935bd1e995ULL;
+        const unsigned char* __data = static_cast<const unsigned char*>(__p);
+        uint64_t __h = 0x9747b28cULL ^ (__len * __m);
+
+        for ( ; __len >= 8; __len -= 8, __data += 8 ) {
+          uint64_t __k;
+          memcpy( &__k, __data, 8 ); // unaligned load
+          __k *= __m;
+          __k ^= __k >> 47;
+          __k *= __m;
+          __h ^= __k;
+          __h *= __m;
+        }
+
+        if ( __len != 0 ) { // tail, 1..7 bytes
+          for ( size_t __i = 0; __i < __len; ++__i ) {
+            __h ^= uint64_t(__data[__i]) << (8 * __i);
+          }
+          __h *= __m;
+        }
+
+        __h ^= __h >> 47;
+        __h *= __m;
+        __h ^= __h >> 47;
+
+        return __h;
+      }
+};
+
+inline size_t __stl_hash_mix(size_t __x)
+{ return size_t(__stl_hash_traits<sizeof(size_t)>::mix(__x)); }
+
+inline size_t __stl_hash_bytes(const void* __p, size_t __len)
+{ return size_t(__stl_hash_traits<sizeof(size_t)>::bytes(__p, __len)); }
+
+// hash of integral types: identity, or mixed (see _STLP_USE_INTEGER_HASH_MIX)
+inline size_t __stl_hash_int(size_t __x)
+{
+#if defined (_STLP_USE_INTEGER_HASH_MIX)
+  return __stl_hash_mix(__x);
+#else
+  return __x;
+#endif
+}
+
 inline size_t __stl_hash_string(const char* __s)
 {
   // _STLP_FIX_LITERAL_BUG(__s)
+#if !defined (_STLP_USE_LEGACY_STRING_HASH)
+  return __stl_hash_bytes(__s, strlen(__s));
+#else
   uint32_t __h = 0;
   while ( *__s ) {
     __h += (__h << 5) + *(__s++); // __h = 33 * __h + __s[i]
   }
 
   return size_t(__h);
+#endif
 }
 
 _STLP_MOVE_TO_STD_NAMESPACE
@@ -73,29 +199,29 @@ struct hash<const char*> {
 };
 
 _STLP_TEMPLATE_NULL struct hash<char> {
-  size_t operator()(char __x) const { return __x; }
+  size_t operator()(char __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 _STLP_TEMPLATE_NULL struct hash<unsigned char> {
-  size_t operator()(unsigned char __x) const { return __x; }
+  size_t operator()(unsigned char __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 #if !defined (_STLP_NO_SIGNED_BUILTINS)
 _STLP_TEMPLATE_NULL struct hash<signed char> {
-  size_t operator()(unsigned char __x) const { return __x; }
+  size_t operator()(unsigned char __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 #endif
 _STLP_TEMPLATE_NULL struct hash<short> {
-  size_t operator()(short __x) const { return __x; }
+  size_t operator()(short __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 _STLP_TEMPLATE_NULL struct hash<unsigned short> {
-  size_t operator()(unsigned short __x) const { return __x; }
+  size_t operator()(unsigned short __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 _STLP_TEMPLATE_NULL struct hash<int> {
-  size_t operator()(int __x) const { return __x; }
+  size_t operator()(int __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 
 #if !defined (_STLP_MSVC) || (_STLP_MSVC < 1300) || defined (_WIN64)
 _STLP_TEMPLATE_NULL struct hash<unsigned int> {
-  size_t operator()(unsigned int __x) const { return __x; }
+  size_t operator()(unsigned int __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 #else
 /* MSVC .Net since 2002 has a 64 bits portability warning feature. typedef
@@ -105,72 +231,33 @@ _STLP_TEMPLATE_NULL struct hash<unsigned int> {
  * unsigned int one.
  */
 _STLP_TEMPLATE_NULL struct hash<size_t> {
-  size_t operator()(size_t __x) const { return __x; }
+  size_t operator()(size_t __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 #endif
 
 _STLP_TEMPLATE_NULL struct hash<long> {
-  size_t operator()(long __x) const { return __x; }
+  size_t operator()(long __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 _STLP_TEMPLATE_NULL struct hash<unsigned long> {
-  size_t operator()(unsigned long __x) const { return __x; }
+  size_t operator()(unsigned long __x) const { return _STLP_PRIV __stl_hash_int(__x); }
 };
 
 #if defined (_STLP_LONG_LONG)
 _STLP_TEMPLATE_NULL struct hash<_STLP_LONG_LONG> {
-  size_t operator()(_STLP_LONG_LONG x) const { return (size_t)x; }
+  size_t operator()(_STLP_LONG_LONG x) const { return _STLP_PRIV __stl_hash_int((size_t)x); }
 };
 _STLP_TEMPLATE_NULL struct hash<unsigned _STLP_LONG_LONG> {
-  size_t operator()(unsigned _STLP_LONG_LONG x) const { return (size_t)x; }
+  size_t operator()(unsigned _STLP_LONG_LONG x) const { return _STLP_PRIV __stl_hash_int((size_t)x); }
 };
 #endif
 
-template <int L>
-inline size_t __stl_pointer_hash(const void* __s)
-{
-  size_t __h = 0;
-  size_t __len = L;
-  const unsigned char* __data = reinterpret_cast<const unsigned char*>(&__s);
-  while ( __len-- > 0 ) {
-    __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  }
-
-  return __h;
-}
-
-template <>
-inline size_t __stl_pointer_hash<4>(const void* __s)
-{
-  const unsigned char* __data = reinterpret_cast<const unsigned char*>(&__s);
-  size_t __h = *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *__data; // __h = 33 * __h + __s[i]
-
-  return __h;
-}
-
-template <>
-inline size_t __stl_pointer_hash<8>(const void* __s)
-{
-  const unsigned char* __data = reinterpret_cast<const unsigned char*>(&__s);
-  size_t __h = *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *(__data++); // __h = 33 * __h + __s[i]
-  __h += (__h << 5) + *__data; // __h = 33 * __h + __s[i]
-
-  return __h;
-}
-
 _STLP_TEMPLATE_NULL
 struct hash<void *>
 {
     size_t operator()(const void* __x) const
-      { return __stl_pointer_hash<sizeof(const void*)>(__x); }
+      { // pointers are aligned, so low bits are almost always zero: mix
+        return _STLP_PRIV __stl_hash_mix(reinterpret_cast<size_t>(__x));
+      }
 };
 
 _STLP_END_NAMESPACE
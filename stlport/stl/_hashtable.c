@@ -88,6 +88,57 @@ void _STLP_CALL _Stl_prime<_Dummy>::_S_prev_sizes(size_t __n, size_t const*&__be
 
 #  undef __PRIME_LIST_BODY
 
+template <class _Dummy>
+const size_t* _STLP_CALL _Stl_pow2<_Dummy>::_S_sizes(size_t &__size)
+{
+  static const size_t _list[] = {
+    8ul,          16ul,         32ul,         64ul,
+    128ul,        256ul,        512ul,        1024ul,
+    2048ul,       4096ul,       8192ul,       16384ul,
+    32768ul,      65536ul,      131072ul,     262144ul,
+    524288ul,     1048576ul,    2097152ul,    4194304ul,
+    8388608ul,    16777216ul,   33554432ul,   67108864ul,
+    134217728ul,  268435456ul,  536870912ul,  1073741824ul,
+    2147483648ul
+  };
+  __size =  sizeof(_list) / sizeof(_list[0]);
+  return _list;
+}
+
+template <class _Dummy>
+size_t _STLP_CALL _Stl_pow2<_Dummy>::_S_max_nb_buckets()
+{
+  size_t __size;
+  const size_t* __first = _S_sizes(__size);
+  return *(__first + __size - 1);
+}
+
+template <class _Dummy>
+size_t _STLP_CALL _Stl_pow2<_Dummy>::_S_next_size(size_t __n)
+{
+  size_t __size;
+  const size_t* __first = _S_sizes(__size);
+  const size_t* __last =  __first + __size;
+  const size_t* pos = __lower_bound(__first, __last, __n, __less((size_t*)0), __less((size_t*)0));
+  return (pos == __last ? *(__last - 1) : *pos);
+}
+
+template <class _Dummy>
+void _STLP_CALL _Stl_pow2<_Dummy>::_S_prev_sizes(size_t __n, size_t const*&__begin, size_t const*&__pos)
+{
+  size_t __size;
+  __begin = _S_sizes(__size);
+  const size_t* __last =  __begin + __size;
+  __pos = __lower_bound(__begin, __last, __n, __less((size_t*)0), __less((size_t*)0));
+
+  if (__pos== __last)
+    --__pos;
+  else if (*__pos == __n) {
+    if (__pos != __begin)
+      --__pos;
+  }
+}
+
 // _STLP_MOVE_TO_STD_NAMESPACE
 
 #endif
@@ -114,14 +165,14 @@ bool hashtable<_Val,_Key,_HF,_Traits,_ExK,_EqK,_All>::_M_equal(
  * __n to the first previous bucket having the same first iterator as bucket
  * __n.
  */
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::iterator
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All> ::_M_before_begin(size_type &__n) const
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::iterator
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt> ::_M_before_begin(size_type &__n) const
 { return _S_before_begin(_M_elems, _M_buckets, __n); }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::iterator
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_S_before_begin(const _ElemsCont& __elems, const _BucketVector& __buckets, size_type &__n)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::iterator
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_S_before_begin(const _ElemsCont& __elems, const _BucketVector& __buckets, size_type &__n)
 {
   _ElemsCont &__mutable_elems = __CONST_CAST(_ElemsCont&, __elems);
   typename _BucketVector::const_iterator __bpos(__buckets.begin() + __n);
@@ -144,9 +195,9 @@ hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_S_before_begin(const _ElemsCont& __ele
 }
 
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::iterator
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_insert_noresize(size_type __n, const value_type& __obj)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::iterator
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_insert_noresize(size_type __n, const value_type& __obj)
 {
   //We always insert this element as 1st in the bucket to not break
   //the elements order as equal elements must be kept next to each other.
@@ -158,9 +209,9 @@ hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_insert_noresize(size_type __n, const
   return iterator(_ElemsIte(_M_buckets[__n]));
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-pair<typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::iterator, bool>
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::insert_unique_noresize(const value_type& __obj)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+pair<typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::iterator, bool>
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::insert_unique_noresize(const value_type& __obj)
 {
   const size_type __n = _M_bkt_num(__obj);
   _ElemsIte __cur(_M_buckets[__n]);
@@ -188,9 +239,9 @@ hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::insert_unique_noresize(const value_type
   return pair<iterator, bool>(_M_insert_noresize(__n, __obj), true);
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::iterator
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::insert_equal_noresize(const value_type& __obj)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::iterator
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::insert_equal_noresize(const value_type& __obj)
 {
   const size_type __n = _M_bkt_num(__obj);
   {
@@ -211,16 +262,16 @@ hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::insert_equal_noresize(const value_type&
   return _M_insert_noresize(__n, __obj);
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::reference hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_insert(const value_type& __obj)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::reference hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_insert(const value_type& __obj)
 {
   _M_enlarge(_M_num_elements + 1);
   return *insert_unique_noresize(__obj).first;
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::size_type
-hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const key_type& __key)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+typename hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::size_type
+hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::erase(const key_type& __key)
 {
   const size_type __n = _M_bkt_num_key(__key);
 
@@ -257,8 +308,8 @@ hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const key_type& __key)
   return __erased;
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const_iterator __it)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::erase(const_iterator __it)
 {
   const size_type __n = _M_bkt_num(*__it);
   _ElemsConstIte __cur(_M_buckets[__n]);
@@ -285,8 +336,8 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const_iterator __it)
   _M_num_elements -= __erased;
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const_iterator __first, const_iterator __last)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::erase(const_iterator __first, const_iterator __last)
 {
   if (__first == __last)
     return;
@@ -313,18 +364,19 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::erase(const_iterator __first, cons
   _M_num_elements -= __erased;
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::rehash(size_type __num_buckets_hint)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::rehash(size_type __num_buckets_hint)
 {
   if ( bucket_count() <  __num_buckets_hint ) {
-    _M_rehash(__num_buckets_hint);
+    // Bucket policy may only handle some numbers of buckets (powers of 2):
+    _M_rehash(_Bkt::_S_next_size(__num_buckets_hint));
   } else {
     _M_reduce();
   }
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_enlarge( size_type __to_size )
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_enlarge( size_type __to_size )
 {
   size_type __num_buckets = bucket_count();
   size_type __num_buckets_hint = (size_type)((float)__to_size / max_load_factor());
@@ -332,13 +384,13 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_enlarge( size_type __to_size )
     return;
   }
 
-  __num_buckets = _STLP_PRIV _Stl_prime_type::_S_next_size(__num_buckets_hint);
+  __num_buckets = _Bkt::_S_next_size(__num_buckets_hint);
 
   _M_rehash(__num_buckets);
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_reduce()
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_reduce()
 {
   size_type __num_buckets = bucket_count();
   // We only try to reduce the hashtable if the theorical load factor
@@ -351,7 +403,7 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_reduce()
 
   const size_type *__first;
   const size_type *__prev;
-  _STLP_PRIV _Stl_prime_type::_S_prev_sizes(__num_buckets, __first, __prev);
+  _Bkt::_S_prev_sizes(__num_buckets, __first, __prev);
 
   /* We are only going to reduce number of buckets if moving to yet the previous number
    * of buckets in the prime numbers would respect the load rule. Otherwise algorithm
@@ -379,8 +431,8 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_reduce()
   _M_rehash(*__prev);
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_rehash(size_type __num_buckets)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_rehash(size_type __num_buckets)
 {
 #if defined (_STLP_DEBUG)
   _M_check();
@@ -405,8 +457,8 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_rehash(size_type __num_buckets)
 }
 
 #if defined (_STLP_DEBUG)
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_check() const
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_check() const
 {
   //We check that hash code of stored keys haven't change and also that equivalent
   //relation hasn't been modified
@@ -426,16 +478,16 @@ void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_check() const
 }
 #endif
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::clear()
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::clear()
 {
   _M_elems.clear();
   _M_buckets.assign(_M_buckets.size(), __STATIC_CAST(_BucketType*, 0));
   _M_num_elements = 0;
 }
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
-void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>::_M_copy_from(const hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>& __ht)
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
+void hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>::_M_copy_from(const hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>& __ht)
 {
   _M_elems.clear();
   _M_elems.insert_after(_M_elems.before_begin(), __ht._M_elems.begin(), __ht._M_elems.end());
@@ -104,13 +104,48 @@ public:
 
   // Returns the bucket range containing sorted list of prime numbers <= __hint.
   static void _STLP_CALL _S_prev_sizes(size_t __hint, const size_t *&__begin, const size_t *&__end);
+
+  //Returns the bucket of a hash code in a table of __n buckets
+  static size_t _S_bucket(size_t __h, size_t __n)
+  { return __h % __n; }
+};
+
+/*
+ * Power of 2 number of buckets: bucket is found by a mask rather than by
+ * a modulo, hash code is post-mixed so that its high bits also take part
+ * in bucket selection (identity hash<int> would otherwise only use the
+ * lowest bits).
+ */
+template <class _Dummy>
+class _Stl_pow2 {
+  // Returns begining of powers of 2 list and size by reference.
+  static const size_t* _S_sizes(size_t&);
+public:
+  static size_t _STLP_CALL _S_max_nb_buckets();
+  static size_t _STLP_CALL _S_next_size(size_t);
+  static void _STLP_CALL _S_prev_sizes(size_t __hint, const size_t *&__begin, const size_t *&__end);
+
+  static size_t _S_bucket(size_t __h, size_t __n)
+  { return __stl_hash_mix(__h) & (__n - 1); }
 };
 
 #if defined (_STLP_USE_TEMPLATE_EXPORT)
 _STLP_EXPORT_TEMPLATE_CLASS _Stl_prime<bool>;
+_STLP_EXPORT_TEMPLATE_CLASS _Stl_pow2<bool>;
 #endif
 
 typedef _Stl_prime<bool> _Stl_prime_type;
+typedef _Stl_pow2<bool> _Stl_pow2_type;
+
+/*
+ * Bucket policy used by hashtable when not given explicitly, so by
+ * unordered_set/unordered_map/unordered_multiset/unordered_multimap.
+ */
+#if defined (_STLP_USE_POW2_HASH_BUCKETS)
+typedef _Stl_pow2_type _Stl_bucket_policy_type;
+#else
+typedef _Stl_prime_type _Stl_bucket_policy_type;
+#endif
 
 // #if !defined (_STLP_DEBUG)
 // _STLP_MOVE_TO_STD_NAMESPACE
@@ -124,12 +159,16 @@ typedef _Stl_prime<bool> _Stl_prime_type;
  * This is because, for hashtables, this extra storage is negligible.
  * Additionally, a base class wouldn't serve any other purposes; it
  * wouldn't, for example, simplify the exception-handling code.
+ *
+ * _Bkt is the bucket policy: number of buckets and bucket of a hash code
+ * (_Stl_prime_type or _Stl_pow2_type).
  */
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All,
+          class _Bkt = _Stl_bucket_policy_type>
 class hashtable
 {
   private:
-    typedef hashtable<_Val, _Key, _HF, _ExK, _EqK, _All> _Self;
+    typedef hashtable<_Val, _Key, _HF, _ExK, _EqK, _All, _Bkt> _Self;
 
   public:
     typedef _Key key_type;
@@ -283,7 +322,7 @@ class hashtable
     size_type bucket_count() const
       { return _M_buckets.size() - 1; }
     size_type max_bucket_count() const
-      { return _STLP_PRIV _Stl_prime_type::_S_max_nb_buckets(); }
+      { return _Bkt::_S_max_nb_buckets(); }
     size_type elems_in_bucket(size_type __bucket) const
       { return _STLP_STD::distance(_ElemsIte(_M_buckets[__bucket]), _ElemsIte(_M_buckets[__bucket + 1])); }
 
@@ -478,7 +517,7 @@ class hashtable
 
     void _M_initialize_buckets(size_type __n)
       {
-        const size_type __n_buckets = _STLP_PRIV _Stl_prime_type::_S_next_size(__n) + 1;
+        const size_type __n_buckets = _Bkt::_S_next_size(__n) + 1;
         _M_buckets.reserve(__n_buckets);
         _M_buckets.assign(__n_buckets, __STATIC_CAST(_BucketType*, 0));
       }
@@ -492,7 +531,7 @@ class hashtable
 
     _STLP_TEMPLATE_FOR_CONT_EXT
     size_type _M_bkt_num_key(const _KT& __key, size_type __n) const
-      { return _M_hash(__key) % __n; }
+      { return _Bkt::_S_bucket(_M_hash(__key), __n); }
 
     size_type _M_bkt_num(const value_type& __obj, size_t __n) const
       { return _M_bkt_num_key(_M_get_key(__obj), __n); }
@@ -517,10 +556,10 @@ _STLP_END_NAMESPACE
 
 _STLP_BEGIN_NAMESPACE
 
-template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All>
+template <class _Val, class _Key, class _HF, class _ExK, class _EqK, class _All, class _Bkt>
 inline
 void _STLP_CALL
-swap( _STLP_PRIV hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>& __hm1, _STLP_PRIV hashtable<_Val,_Key,_HF,_ExK,_EqK,_All>& __hm2)
+swap( _STLP_PRIV hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>& __hm1, _STLP_PRIV hashtable<_Val,_Key,_HF,_ExK,_EqK,_All,_Bkt>& __hm2)
 { __hm1.swap(__hm2); }
 
 _STLP_END_NAMESPACE
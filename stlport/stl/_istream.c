@@ -786,18 +786,20 @@ basic_istream<_CharT, _Traits>::read(char_type* __s, streamsize __n) {
   this->_M_gcount = 0;
 
   if (__sentry && !this->eof()) {
-    basic_streambuf<_CharT, _Traits>*__buf = this->rdbuf();
-    if (__buf->gptr() != __buf->egptr())
-      _M_gcount
-        = _STLP_PRIV __read_buffered(this,  __buf, __n, __s,
-                                     _STLP_PRIV _Constant_unary_fun<bool, int_type>(false),
-                                     _STLP_PRIV _Project2nd<const _CharT*, const _CharT*>(),
-                                     false, false, false);
-    else
-      _M_gcount
-        = _STLP_PRIV __read_unbuffered(this,  __buf, __n, __s,
-                                       _STLP_PRIV _Constant_unary_fun<bool, int_type>(false),
-                                       false, false, false);
+    // No delimiter to look for: whole block is streambuf's job, so
+    // that buffer may pass it to device directly (see filebuf::xsgetn).
+    // Short read is reported after the try block: exception thrown
+    // by setstate must not be taken for streambuf's one (badbit).
+    bool __short = false;
+    _STLP_TRY {
+      _M_gcount = this->rdbuf()->sgetn(__s, __n);
+      __short = _M_gcount != __n;
+    }
+    _STLP_CATCH_ALL {
+      this->_M_handle_exception(ios_base::badbit);
+    }
+    if (__short)
+      this->setstate(ios_base::eofbit);
   }
   else
     this->setstate(ios_base::failbit);
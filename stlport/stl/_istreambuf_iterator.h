@@ -79,6 +79,9 @@ public:
     return this->_M_eof == __i._M_eof;
   }
 
+  // for num_get fast path, that read directly from get area
+  streambuf_type* _M_streambuf() const { return _M_buf; }
+
 private:
   void _M_init(streambuf_type* __p) {
     _M_buf = __p;
@@ -32,10 +32,6 @@
 #  include <stl/_list.h>
 #endif
 
-#ifndef _STLP_CARRAY_H
-#  include <stl/_carray.h>
-#endif
-
 #ifndef _STLP_RANGE_ERRORS_H
 #  include <stl/_range_errors.h>
 #endif
@@ -89,7 +85,7 @@ void list<_Tp,_Alloc>::clear()
     _Node* __tmp = __cur;
     __cur = __STATIC_CAST(_Node*, __cur->_M_next);
     this->get_allocator().destroy( &__tmp->_M_data );
-    this->_M_head.deallocate(__tmp, 1);
+    this->_M_put_node(__tmp);
   }
   _M_empty_initialize();
   // _M_head._M_data._M_next = &_M_head._M_data;
@@ -140,6 +136,20 @@ void list<_Tp, _Alloc>::_M_fill_assign(size_type __n, const value_type& __val)
 }
 
 
+// restore _M_prev links and circle of null-terminated chain
+template <class _Tp, class _Alloc>
+void list<_Tp, _Alloc>::_M_relink(_Node_base* __first)
+{
+  _Node_base* __prev = &_M_head._M_data;
+  for ( ; __first != 0; __first = __first->_M_next) {
+    __prev->_M_next = __first;
+    __first->_M_prev = __prev;
+    __prev = __first;
+  }
+  __prev->_M_next = &_M_head._M_data;
+  _M_head._M_data._M_prev = __prev;
+}
+
 template <class _Tp, class _Alloc>
 template <class _StrictWeakOrdering>
 void list<_Tp, _Alloc>::sort(_StrictWeakOrdering __comp)
@@ -149,30 +159,14 @@ void list<_Tp, _Alloc>::sort(_StrictWeakOrdering __comp)
       _M_head._M_data._M_next->_M_next == &_M_head._M_data)
     return;
 
-  list<_Tp, _Alloc> __carry(get_allocator());
-  const int NB = 64;
-  _STLP_PRIV _CArray<list<_Tp, _Alloc>, NB> __counter(__carry);
-  int __fill = 0;
-  while (!empty()) {
-    __carry.splice(__carry.begin(), *this, begin());
-    int __i = 0;
-    while (__i < __fill && !__counter[__i].empty()) {
-      __counter[__i].merge(__carry, __comp);
-      __carry.swap(__counter[__i++]);
-    }
-    __carry.swap(__counter[__i]);
-    if (__i == __fill) {
-      ++__fill;
-      if (__fill >= NB) {
-        //Looks like the list has too many elements to be sorted with this algorithm:
-        __stl_throw_overflow_error("list::sort");
-      }
-    }
+  // sort nodes as null-terminated chain linked via _M_next only
+  _Node_base* __first = _M_head._M_data._M_next;
+  _M_head._M_data._M_prev->_M_next = 0;
+  _STLP_TRY {
+    _STLP_PRIV __chain_sort<_Node>(__first, __comp);
   }
-
-  for (int __i = 1; __i < __fill; ++__i)
-    __counter[__i].merge(__counter[__i - 1], __comp);
-  this->swap(__counter[__fill - 1]);
+  _STLP_UNWIND(_M_relink(__first))
+  _M_relink(__first);
 }
 
 template <class _Tp, class _Alloc>
@@ -49,6 +49,10 @@
 #  include <stl/_function_base.h>
 #endif
 
+#ifndef _STLP_INTERNAL_NODE_CHAIN_H
+#  include <stl/_node_chain.h>
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 template <class _Tp, class _Alloc> class list;
@@ -290,23 +294,29 @@ class list
     typedef _STLP_STD::reverse_iterator<iterator> reverse_iterator;
 
   protected:
+    _Node* _M_get_node()
+      { return _M_pool.template _M_get<_Node>(static_cast<_M_node_allocator_type&>(_M_head)); }
+
+    void _M_put_node(_Node* __p)
+      { _M_pool._M_put(static_cast<_M_node_allocator_type&>(_M_head), __p); }
+
     _Node* _M_create_node(const value_type& __x)
       {
-        _Node* __p = _M_head.allocate(1);
+        _Node* __p = _M_get_node();
         _STLP_TRY {
           _Self::get_allocator().construct( &__p->_M_data, __x );
         }
-        _STLP_UNWIND(_M_head.deallocate(__p, 1))
+        _STLP_UNWIND(_M_put_node(__p))
           return __p;
       }
 
     _Node* _M_create_node(value_type&& __x)
       {
-        _Node* __p = _M_head.allocate(1);
+        _Node* __p = _M_get_node();
         _STLP_TRY {
           _Self::get_allocator().construct( &__p->_M_data, _STLP_STD::move(__x) );
         }
-        _STLP_UNWIND(_M_head.deallocate(__p, 1))
+        _STLP_UNWIND(_M_put_node(__p))
           return __p;
       }
 
@@ -415,7 +425,10 @@ class list
     _Self& operator =(const _Self& __x);
 
     ~list()
-      { clear(); }
+      {
+        clear();
+        shrink_node_pool();
+      }
 
     void clear();
     bool empty() const
@@ -469,6 +482,7 @@ class list
           _STLP_PRIV __swap(static_cast<_M_node_allocator_type&>(_M_head),
                             static_cast<_M_node_allocator_type&>(__x._M_head));
         }
+        _M_pool._M_swap(__x._M_pool);
         _Node_base& xnode = __x._M_head._M_data;
         _Node_base& node = _M_head._M_data;
         if (xnode._M_next == &xnode) { // __x.empty()
@@ -577,7 +591,7 @@ class list
         __prev_node->_M_next = __next_node;
         __next_node->_M_prev = __prev_node;
         get_allocator().destroy( &__n->_M_data );
-        _M_head.deallocate(__n, 1);
+        _M_put_node(__n);
         return iterator(__next_node);
       }
 
@@ -715,8 +729,19 @@ class list
     template <class _StrictWeakOrdering>
     void sort(_StrictWeakOrdering __comp);
 
+    // Node pool: after reserve_nodes(__n) next __n insertions don't call
+    // allocator, and nodes of erased elements are kept for reuse, until
+    // shrink_node_pool() return them to allocator.
+    void reserve_nodes(size_type __n)
+      { _M_pool._M_reserve(static_cast<_M_node_allocator_type&>(_M_head), __n); }
+    void shrink_node_pool()
+      { _M_pool.template _M_release<_Node>(static_cast<_M_node_allocator_type&>(_M_head)); }
+
   private:
+    void _M_relink(_Node_base* __first);
+
     _AllocProxy _M_head;
+    _STLP_PRIV _Node_pool<_Node_base> _M_pool;
 };
 
 #if defined (list)
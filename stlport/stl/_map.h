@@ -36,6 +36,8 @@
 
 _STLP_BEGIN_NAMESPACE
 
+template <class _Key, class _Tp, class _Compare, class _Alloc> class multimap;
+
 template <class _Key, class _Tp, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key> ),
           _STLP_DEFAULT_PAIR_ALLOCATOR_SELECT(_STLP_CONST _Key, _Tp) >
 class map
@@ -80,11 +82,16 @@ public:
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
   typedef typename _Rep_type::allocator_type allocator_type;
+  typedef _STLP_PRIV _Rb_tree_map_node_handle<_Key, _Tp, allocator_type> node_type;
+  typedef _STLP_PRIV _Rb_tree_insert_return<iterator, node_type> insert_return_type;
 
 private:
   _Rep_type _M_t;  // red-black tree representing map
   _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
 
+  template <class _Key2, class _Tp2, class _Compare2, class _Alloc2> friend class map;
+  template <class _Key2, class _Tp2, class _Compare2, class _Alloc2> friend class multimap;
+
 public:
   // allocation/deallocation
   map() : _M_t(_Compare(), allocator_type()) {}
@@ -157,6 +164,53 @@ public:
   void erase(iterator __first, iterator __last) { _M_t.erase(__first, __last); }
   void clear() { _M_t.clear(); }
 
+  // node transfer: no copy or move of values, no allocation
+  node_type extract(iterator __pos)
+  { return node_type(_M_t._M_extract(__pos), _M_t.get_allocator()); }
+  node_type extract(const key_type& __x)
+  {
+    iterator __i = _M_t.find(__x);
+    return __i == _M_t.end() ? node_type() : extract(__i);
+  }
+  insert_return_type insert(node_type&& __nh)
+  {
+    insert_return_type __r;
+    if (__nh.empty()) {
+      __r.position = end();
+      __r.inserted = false;
+      return __r;
+    }
+    pair<iterator,bool> __p = _M_t._M_insert_node_unique(__nh._M_get());
+    __r.position = __p.first;
+    __r.inserted = __p.second;
+    if (__p.second)
+      __nh._M_release();
+    else
+      __r.node = _STLP_STD::move(__nh);
+    return __r;
+  }
+  iterator insert(iterator __pos, node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    pair<iterator,bool> __p = _M_t._M_insert_node_unique(__pos, __nh._M_get());
+    if (__p.second)
+      __nh._M_release();
+    return __p.first;
+  }
+  template <class _Compare2>
+  void merge(map<_Key, _Tp, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(map<_Key, _Tp, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(multimap<_Key, _Tp, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(multimap<_Key, _Tp, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+
   // map operations:
   _STLP_TEMPLATE_FOR_CONT_EXT
   iterator find(const _KT& __x) { return _M_t.find(__x); }
@@ -224,11 +278,15 @@ public:
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
   typedef typename _Rep_type::allocator_type allocator_type;
+  typedef _STLP_PRIV _Rb_tree_map_node_handle<_Key, _Tp, allocator_type> node_type;
 
 private:
   _Rep_type _M_t;  // red-black tree representing multimap
   _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
 
+  template <class _Key2, class _Tp2, class _Compare2, class _Alloc2> friend class map;
+  template <class _Key2, class _Tp2, class _Compare2, class _Alloc2> friend class multimap;
+
 public:
   // allocation/deallocation
   multimap() : _M_t(_Compare(), allocator_type()) { }
@@ -291,6 +349,43 @@ public:
   void erase(iterator __first, iterator __last) { _M_t.erase(__first, __last); }
   void clear() { _M_t.clear(); }
 
+  // node transfer: no copy or move of values, no allocation
+  node_type extract(iterator __pos)
+  { return node_type(_M_t._M_extract(__pos), _M_t.get_allocator()); }
+  node_type extract(const key_type& __x)
+  {
+    iterator __i = _M_t.find(__x);
+    return __i == _M_t.end() ? node_type() : extract(__i);
+  }
+  iterator insert(node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    iterator __i = _M_t._M_insert_node_equal(__nh._M_get());
+    __nh._M_release();
+    return __i;
+  }
+  iterator insert(iterator __pos, node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    iterator __i = _M_t._M_insert_node_equal(__pos, __nh._M_get());
+    __nh._M_release();
+    return __i;
+  }
+  template <class _Compare2>
+  void merge(multimap<_Key, _Tp, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(multimap<_Key, _Tp, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(map<_Key, _Tp, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(map<_Key, _Tp, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+
   // multimap operations:
 
   _STLP_TEMPLATE_FOR_CONT_EXT
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_NODE_CHAIN_H
+#define _STLP_INTERNAL_NODE_CHAIN_H
+
+#ifndef _STLP_CSTDDEF
+#  include <cstddef>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Helpers shared by list and forward_list. Both work with node base
+ * (_List_node_base or _Slist_node_base) via its _M_next link only.
+ */
+
+/*
+ * Per-container cache of free nodes. Pool is off by default: nodes are
+ * returned to allocator as soon as element is erased. reserve_nodes(n)
+ * allocate nodes in advance and turn pool on; since then nodes of erased
+ * elements are kept in pool for reuse, so container that is filled and
+ * drained repeatedly stop calling allocator. shrink_node_pool() return
+ * cached nodes to allocator and turn pool off.
+ *
+ * Free nodes are linked via _M_next of node base, i.e. pool cost no
+ * memory besides the nodes themselves.
+ */
+template <class _NodeBase>
+struct _Node_pool
+{
+    _Node_pool() :
+        _M_free( 0 ),
+        _M_on( false )
+      { }
+
+    template <class _Node, class _Alloc>
+    _Node* _M_get( _Alloc& __a )
+      {
+        if ( _M_free != 0 ) {
+          _NodeBase* __p = _M_free;
+          _M_free = __p->_M_next;
+          return static_cast<_Node*>(__p);
+        }
+        return __a.allocate( 1 );
+      }
+
+    template <class _Alloc, class _Node>
+    void _M_put( _Alloc& __a, _Node* __p )
+      {
+        if ( _M_on ) {
+          __p->_M_next = _M_free;
+          _M_free = __p;
+        } else {
+          __a.deallocate( __p, 1 );
+        }
+      }
+
+    // make at least __n nodes available without allocator call
+    template <class _Alloc>
+    void _M_reserve( _Alloc& __a, size_t __n )
+      {
+        _M_on = true;
+        for ( _NodeBase* __p = _M_free; __p != 0 && __n > 0; __p = __p->_M_next ) {
+          --__n;
+        }
+        for ( ; __n > 0; --__n ) {
+          _NodeBase* __p = __a.allocate( 1 );
+          __p->_M_next = _M_free;
+          _M_free = __p;
+        }
+      }
+
+    template <class _Node, class _Alloc>
+    void _M_release( _Alloc& __a )
+      {
+        while ( _M_free != 0 ) {
+          _NodeBase* __p = _M_free;
+          _M_free = __p->_M_next;
+          __a.deallocate( static_cast<_Node*>(__p), 1 );
+        }
+        _M_on = false;
+      }
+
+    void _M_swap( _Node_pool& __x )
+      {
+        _NodeBase* __f = _M_free;
+        _M_free = __x._M_free;
+        __x._M_free = __f;
+        bool __on = _M_on;
+        _M_on = __x._M_on;
+        __x._M_on = __on;
+      }
+
+    _NodeBase* _M_free;
+    bool _M_on;
+};
+
+/*
+ * Stable merge sort of null-terminated chain of nodes.
+ *
+ * Input is cut into natural runs (non-descending ones, and strictly
+ * descending ones that are reversed), runs go into binary counter of
+ * sorted chains: bin i hold about 2^i runs, new run is merged with
+ * bins 0, 1, ... while they are occupied. So merges are done in
+ * depth-first order, mostly on nodes that were touched recently and
+ * are still in cache, unlike merge passes of growing width over the
+ * whole chain. Only _M_next links are rewritten; there are no temporary
+ * containers and no splicing between them.
+ *
+ * If comparison throw, all nodes are left in __first, in unspecified
+ * order.
+ */
+
+// link chain __y after the last node of chain __x
+template <class _NodeBase>
+_NodeBase* __chain_append( _NodeBase* __x, _NodeBase* __y )
+{
+  if ( __x == 0 ) {
+    return __y;
+  }
+  _NodeBase* __p = __x;
+  while ( __p->_M_next != 0 ) {
+    __p = __p->_M_next;
+  }
+  __p->_M_next = __y;
+  return __x;
+}
+
+// merge __y into __x; __x contain elements that precede ones of __y
+// in original order, so equivalent elements are taken from __x first
+template <class _Node, class _NodeBase, class _Compare>
+void __chain_merge( _NodeBase*& __x, _NodeBase*& __y, _Compare& __comp )
+{
+  _NodeBase __head;
+  _NodeBase* __tail = &__head;
+
+  _STLP_TRY {
+    while ( __x != 0 && __y != 0 ) {
+      if ( __comp( static_cast<_Node*>(__y)->_M_data, static_cast<_Node*>(__x)->_M_data ) ) {
+        __tail->_M_next = __y;
+        __tail = __y;
+        __y = __y->_M_next;
+      } else {
+        __tail->_M_next = __x;
+        __tail = __x;
+        __x = __x->_M_next;
+      }
+    }
+  }
+  _STLP_UNWIND( (__tail->_M_next = __x, __x = __chain_append( __head._M_next, __y ), __y = 0) )
+
+  __tail->_M_next = __x != 0 ? __x : __y;
+  __x = __head._M_next;
+  __y = 0;
+}
+
+// cut natural run from the front of __rest
+template <class _Node, class _NodeBase, class _Compare>
+_NodeBase* __chain_run( _NodeBase*& __rest, _Compare& __comp )
+{
+  _NodeBase* __run = __rest;
+  _NodeBase* __last = __run;
+  _NodeBase* __next = __last->_M_next;
+
+  if ( __next != 0 && __comp( static_cast<_Node*>(__next)->_M_data, static_cast<_Node*>(__last)->_M_data ) ) {
+    // strictly descending: reverse it, order of equivalent elements is kept
+    do {
+      __last = __next;
+      __next = __next->_M_next;
+    } while ( __next != 0 && __comp( static_cast<_Node*>(__next)->_M_data, static_cast<_Node*>(__last)->_M_data ) );
+    __rest = __next;
+    _NodeBase* __prev = 0;
+    for ( _NodeBase* __p = __run; __p != __next; ) {
+      _NodeBase* __n = __p->_M_next;
+      __p->_M_next = __prev;
+      __prev = __p;
+      __p = __n;
+    }
+    return __prev;
+  }
+
+  while ( __next != 0 && !__comp( static_cast<_Node*>(__next)->_M_data, static_cast<_Node*>(__last)->_M_data ) ) {
+    __last = __next;
+    __next = __next->_M_next;
+  }
+  __last->_M_next = 0;
+  __rest = __next;
+  return __run;
+}
+
+// collect all nodes into one chain after exception
+template <class _NodeBase>
+_NodeBase* __chain_unwind( _NodeBase** __bin, int __n, _NodeBase* __carry, _NodeBase* __rest )
+{
+  _NodeBase* __first = __chain_append( __carry, __rest );
+  for ( int __i = 0; __i < __n; ++__i ) {
+    __first = __chain_append( __bin[__i], __first );
+  }
+  return __first;
+}
+
+template <class _Node, class _NodeBase, class _Compare>
+void __chain_sort( _NodeBase*& __first, _Compare& __comp )
+{
+  if ( __first == 0 || __first->_M_next == 0 ) {
+    return;
+  }
+
+  const int _NB = 64;
+  _NodeBase* __bin[_NB];
+  int __fill = 0;
+  _NodeBase* __rest = __first;
+  _NodeBase* __carry = 0;
+
+  _STLP_TRY {
+    while ( __rest != 0 ) {
+      __carry = __chain_run<_Node>( __rest, __comp );
+      int __i = 0;
+      for ( ; __i < __fill && __bin[__i] != 0; ++__i ) {
+        __chain_merge<_Node>( __bin[__i], __carry, __comp );
+        __carry = __bin[__i];
+        __bin[__i] = 0;
+      }
+      // bin i hold at least 2^i runs, so it never overflow
+      __bin[__i] = __carry;
+      __carry = 0;
+      if ( __i == __fill ) {
+        ++__fill;
+      }
+    }
+
+    for ( int __i = 1; __i < __fill; ++__i ) {
+      if ( __bin[__i] == 0 ) {
+        __bin[__i] = __bin[__i - 1];
+      } else {
+        __chain_merge<_Node>( __bin[__i], __bin[__i - 1], __comp );
+      }
+      __bin[__i - 1] = 0;
+    }
+  }
+  _STLP_UNWIND( __first = __chain_unwind( __bin, __fill, __carry, __rest ) )
+
+  __first = __bin[__fill - 1];
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_NODE_CHAIN_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_NUM_DIGITS_H
+#define _STLP_INTERNAL_NUM_DIGITS_H
+
+#ifndef _STLP_CSTRING
+#  include <cstring>
+#endif
+
+#include <stdint.h>
+
+/*
+ * Locale-free conversion between numbers and chars, shared by
+ * to_chars/from_chars (<charconv>) and num_put/num_get facets:
+ *
+ *  - decimal output two digits per division, from "00".."99" table;
+ *  - decimal input eight digits at once (SWAR: digits check and value
+ *    of 8 chars loaded as one 64-bit word), on little-endian targets;
+ *  - floating point conversions in library, on the same engines as
+ *    num_put (float_digits.cpp) and num_get (num_get_float.cpp).
+ *
+ * Functions here write and read plain char buffers: no locale, no
+ * allocation, no exceptions.
+ */
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+#if defined (_STLP_LITTLE_ENDIAN)
+#  define _STLP_SWAR_DIGITS
+#endif
+
+// values of chars_format; plain (0) is to_chars without format
+enum {
+  __chars_plain = 0,
+  __chars_scientific = 1,
+  __chars_fixed = 2,
+  __chars_hex = 4,
+  __chars_general = __chars_fixed | __chars_scientific
+};
+
+// "00" "01" ... "99"
+_STLP_DECLSPEC const char* _STLP_CALL __two_digits_table();
+
+inline int _STLP_CALL __decimal_length(uint64_t __x) {
+  int __n = 1;
+  for (;;) {
+    if (__x < 10) return __n;
+    if (__x < 100) return __n + 1;
+    if (__x < 1000) return __n + 2;
+    if (__x < 10000) return __n + 3;
+    __x /= 10000;
+    __n += 4;
+  }
+}
+
+// Writes decimal digits of __x (at least one) just before __end,
+// returns pointer to first digit.
+inline char* _STLP_CALL __write_decimal_digits32(char* __end, uint32_t __x) {
+  const char* __t = __two_digits_table();
+  while (__x >= 100) {
+    const uint32_t __r = __x % 100;
+    __x /= 100;
+    __end -= 2;
+    __end[0] = __t[2 * __r];
+    __end[1] = __t[2 * __r + 1];
+  }
+  if (__x >= 10) {
+    __end -= 2;
+    __end[0] = __t[2 * __x];
+    __end[1] = __t[2 * __x + 1];
+  } else {
+    *--__end = __STATIC_CAST(char, '0' + __x);
+  }
+  return __end;
+}
+
+inline char* _STLP_CALL __write_decimal_digits(char* __end, uint64_t __x) {
+  // 64-bit division only to split off eight low digits
+  while (__x > 0xffffffffU) {
+    const uint64_t __q = __x / 100000000U;
+    uint32_t __r = __STATIC_CAST(uint32_t, __x - __q * 100000000U);
+    __x = __q;
+    const char* __t = __two_digits_table();
+    for (int __i = 0; __i < 4; ++__i) {
+      const uint32_t __d = __r % 100;
+      __r /= 100;
+      __end -= 2;
+      __end[0] = __t[2 * __d];
+      __end[1] = __t[2 * __d + 1];
+    }
+  }
+  return __write_decimal_digits32(__end, __STATIC_CAST(uint32_t, __x));
+}
+
+// value of digit in bases up to 36, 36 or more for anything else
+inline unsigned _STLP_CALL __char_digit_value(char __c) {
+  const unsigned __u = __STATIC_CAST(unsigned char, __c);
+  if (__u - '0' < 10) {
+    return __u - '0';
+  }
+  const unsigned __l = (__u | 0x20) - 'a';
+  return __l < 26 ? __l + 10 : 36;
+}
+
+#if defined (_STLP_SWAR_DIGITS)
+// all eight bytes of __w are '0'..'9'
+inline bool _STLP_CALL __is_eight_digits(uint64_t __w) {
+  return ((__w & 0xf0f0f0f0f0f0f0f0ULL) |
+          (((__w + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// value of eight digits, first char in lowest byte
+inline uint32_t _STLP_CALL __eight_digits_value(uint64_t __w) {
+  __w -= 0x3030303030303030ULL;
+  __w = (__w * 10) + (__w >> 8);
+  __w = (((__w & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) +
+         (((__w >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >> 32;
+  return __STATIC_CAST(uint32_t, __w);
+}
+#endif
+
+/*
+ * Reads decimal digits from [__first, __last), returns pointer after the
+ * last one. __overflow is set if value doesn't fit into 64 bits; all
+ * digits are consumed anyway.
+ */
+inline const char* _STLP_CALL
+__parse_decimal(const char* __first, const char* __last, uint64_t& __val, bool& __overflow) {
+  uint64_t __v = 0;
+  int __nd = 0; // significant digits in __v; 19 always fit
+  while (__first != __last && *__first == '0') {
+    ++__first;
+  }
+#if defined (_STLP_SWAR_DIGITS)
+  while (__last - __first >= 8 && __nd <= 11) {
+    uint64_t __w;
+    memcpy(&__w, __first, 8); // unaligned load
+    if (!__is_eight_digits(__w)) {
+      break;
+    }
+    __v = __v * 100000000U + __eight_digits_value(__w);
+    __first += 8;
+    __nd += 8;
+  }
+#endif
+  for ( ; __first != __last; ++__first) {
+    const unsigned __d = __STATIC_CAST(unsigned char, *__first) - '0';
+    if (__d >= 10) {
+      break;
+    }
+    if (__nd < 19 || (__nd == 19 && __v <= (~uint64_t(0) - __d) / 10)) {
+      __v = __v * 10 + __d;
+    } else {
+      __overflow = true;
+    }
+    ++__nd;
+  }
+  __val = __v;
+  return __first;
+}
+
+// As above, for digits in base 2..36
+inline const char* _STLP_CALL
+__parse_digits(const char* __first, const char* __last, int __base, uint64_t& __val, bool& __overflow) {
+  const uint64_t __b = __STATIC_CAST(uint64_t, __base);
+  const uint64_t __max = ~uint64_t(0);
+  uint64_t __v = 0;
+  for ( ; __first != __last; ++__first) {
+    const unsigned __d = __char_digit_value(*__first);
+    if (__d >= __STATIC_CAST(unsigned, __base)) {
+      break;
+    }
+    if (__v > (__max - __d) / __b) {
+      __overflow = true;
+    } else {
+      __v = __v * __b + __d;
+    }
+  }
+  __val = __v;
+  return __first;
+}
+
+/*
+ * Floating point to chars (library). __fmt is one of __chars_* above,
+ * __precision < 0 means shortest representation that read back exactly.
+ * Returns end of output; __err is 0, or EOVERFLOW if output doesn't fit.
+ */
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* __first, char* __last, float __x, int __fmt, int __precision, int& __err);
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* __first, char* __last, double __x, int __fmt, int __precision, int& __err);
+#if !defined (_STLP_NO_LONG_DOUBLE)
+_STLP_DECLSPEC char* _STLP_CALL
+__to_chars_float(char* __first, char* __last, long double __x, int __fmt, int __precision, int& __err);
+#endif
+
+/*
+ * Chars to floating point (library), pattern as for strtod in "C" locale
+ * but without leading '+' and "0x", restricted by __fmt. Returns end of
+ * pattern; __err is 0, EINVAL if nothing matched (returns __first) or
+ * ERANGE if value is out of range (__x isn't changed then).
+ */
+_STLP_DECLSPEC const char* _STLP_CALL
+__from_chars_float(const char* __first, const char* __last, float& __x, int __fmt, int& __err);
+_STLP_DECLSPEC const char* _STLP_CALL
+__from_chars_float(const char* __first, const char* __last, double& __x, int __fmt, int& __err);
+#if !defined (_STLP_NO_LONG_DOUBLE)
+_STLP_DECLSPEC const char* _STLP_CALL
+__from_chars_float(const char* __first, const char* __last, long double& __x, int __fmt, int& __err);
+#endif
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_NUM_DIGITS_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -240,6 +240,61 @@ __get_decimal_integer(_InputIter& __first, _InputIter& __last, _Integer& __val,
   return __get_integer(__first, __last, 10, __val, 0, false, _CharT() /*separator*/, __grp, false_type());
 }
 
+/*
+ * Fast paths for char streams: number that lies in the get area of stream
+ * buffer (and doesn't end at its end) is parsed in place by locale-free
+ * code of _num_digits.h (shared with from_chars); otherwise, or if locale
+ * has grouping, number is read char by char as below.
+ */
+template <class _InputIter, class _Integer>
+inline bool _STLP_CALL
+__get_integer_buffered(_InputIter&, _InputIter&, ios_base&, ios_base::iostate&, _Integer&)
+{ return false; }
+
+template <class _Integer>
+bool _STLP_CALL
+__get_integer_buffered(istreambuf_iterator<char, char_traits<char> >& __in_ite,
+                       istreambuf_iterator<char, char_traits<char> >& __end,
+                       ios_base& __str, ios_base::iostate& __err, _Integer& __val) {
+  typedef istreambuf_iterator<char, char_traits<char> > _Iter;
+  typename _Iter::streambuf_type* __buf = __in_ite._M_streambuf();
+  if (__buf == 0 || __end._M_streambuf() != 0 ||
+      (__str.flags() & ios_base::basefield) != ios_base::dec) {
+    return false;
+  }
+  const char* __first = __buf->_M_gptr();
+  const char* __last = __buf->_M_egptr();
+  if (__first == __last) {
+    return false;
+  }
+  const char* __p = __first;
+  const bool __negative = (*__p == '-');
+  if (__negative || *__p == '+') {
+    ++__p;
+  }
+  uint64_t __v;
+  bool __overflow = false;
+  const char* __e = __parse_decimal(__p, __last, __v, __overflow);
+  if (__e == __p || __e == __last || __overflow) {
+    return false;
+  }
+  // out of range (and negative unsigned, that wrap around) go slow way
+  if (__negative ?
+      (!numeric_limits<_Integer>::is_signed ||
+       __v > uint64_t(0) - __STATIC_CAST(uint64_t, (numeric_limits<_Integer>::min)())) :
+      __v > __STATIC_CAST(uint64_t, (numeric_limits<_Integer>::max)())) {
+    return false;
+  }
+  if (!use_facet<numpunct<char> >(__str.getloc()).grouping().empty()) {
+    return false;
+  }
+  __val = __STATIC_CAST(_Integer, __negative ? uint64_t(0) - __v : __v);
+  __buf->_M_gbump(__STATIC_CAST(int, __e - __first));
+  __in_ite = _Iter(__buf);
+  __err = ios_base::goodbit;
+  return true;
+}
+
 template <class _InputIter, class _Integer, class _CharT>
 _InputIter _STLP_CALL
 __do_get_integer(_InputIter& __in_ite, _InputIter& __end, ios_base& __str,
@@ -253,6 +308,10 @@ __do_get_integer(_InputIter& __in_ite, _InputIter& __end, ios_base& __str,
   typedef typename is_signed<_Integer>::type::type _IsSigned;
 #endif
 
+  if (__get_integer_buffered(__in_ite, __end, __str, __err, __val)) {
+    return __in_ite;
+  }
+
   const int __base_or_zero = __get_base_or_zero(__in_ite, __end, __str.flags(), __ctype);
   int  __got = __base_or_zero & 1;
 
@@ -420,10 +479,60 @@ __read_float(__iostring& __buf, _InputIter& __in_ite, _InputIter& __end,
   return __ok;
 }
 
+// Fast path, as for integers; uses from_chars engine
+template <class _InputIter, class _Float>
+inline bool _STLP_CALL
+__get_float_buffered(_InputIter&, _InputIter&, ios_base&, ios_base::iostate&, _Float&)
+{ return false; }
+
+template <class _Float>
+bool _STLP_CALL
+__get_float_buffered(istreambuf_iterator<char, char_traits<char> >& __in_ite,
+                     istreambuf_iterator<char, char_traits<char> >& __end,
+                     ios_base& __str, ios_base::iostate& __err, _Float& __val) {
+  typedef istreambuf_iterator<char, char_traits<char> > _Iter;
+  typename _Iter::streambuf_type* __buf = __in_ite._M_streambuf();
+  if (__buf == 0 || __end._M_streambuf() != 0) {
+    return false;
+  }
+  const char* __first = __buf->_M_gptr();
+  const char* __last = __buf->_M_egptr();
+  const char* __p = __first; // from_chars accept '-', but not '+'
+  const char* __q = __first; // first digit or '.'
+  if (__q != __last && (*__q == '+' || *__q == '-')) {
+    __p += (*__q == '+') ? 1 : 0;
+    ++__q;
+  }
+  // not inf or nan, that num_get doesn't read
+  if (__q == __last || !(*__q == '.' || (*__q >= '0' && *__q <= '9'))) {
+    return false;
+  }
+  _Float __v;
+  int __ec;
+  const char* __e = __from_chars_float(__p, __last, __v, __chars_general, __ec);
+  // incomplete exponent ("1e+") is an error for num_get
+  if (__ec != 0 || __e == __last || *__e == 'e' || *__e == 'E') {
+    return false;
+  }
+  const numpunct<char>& __np = use_facet<numpunct<char> >(__str.getloc());
+  if (__np.decimal_point() != '.' || !__np.grouping().empty()) {
+    return false;
+  }
+  __val = __v;
+  __buf->_M_gbump(__STATIC_CAST(int, __e - __first));
+  __in_ite = _Iter(__buf);
+  __err = ios_base::goodbit;
+  return true;
+}
+
 template <class _InputIter, class _Float, class _CharT>
 _InputIter _STLP_CALL
 __do_get_float(_InputIter& __in_ite, _InputIter& __end, ios_base& __str,
                ios_base::iostate& __err, _Float& __val, _CharT* /*__pc*/) {
+  if (__get_float_buffered(__in_ite, __end, __str, __err, __val)) {
+    return __in_ite;
+  }
+
   locale __loc = __str.getloc();
   const ctype<_CharT> &__ctype = use_facet<ctype<_CharT> >(__loc);
   const numpunct<_CharT> &__numpunct = use_facet<numpunct<_CharT> >(__loc);
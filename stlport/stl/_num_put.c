@@ -276,8 +276,7 @@ __write_decimal_backward(char* __ptr, _Integer __x, ios_base::fmtflags __flags,
   __max_int_t __temp = __x;
   __umax_int_t __utemp = __negative?-__temp:__temp;
 
-  for (; __utemp != 0; __utemp /= 10)
-    *--__ptr = (char)((int)(__utemp % 10) + '0');
+  __ptr = __write_decimal_digits(__ptr, __utemp);
   // put sign if needed or requested
   if (__negative)
     *--__ptr = '-';
@@ -289,8 +288,7 @@ __write_decimal_backward(char* __ptr, _Integer __x, ios_base::fmtflags __flags,
 template <class _Integer>
 inline char* _STLP_CALL
 __write_decimal_backward(char* __ptr, _Integer __x, ios_base::fmtflags __flags, const false_type& /* is_signed */) {
-  for (; __x != 0; __x /= 10)
-    *--__ptr = (char)((int)(__x % 10) + '0');
+  __ptr = __write_decimal_digits(__ptr, __x);
   // put sign if requested
   if (__flags & ios_base::showpos)
     *--__ptr = '+';
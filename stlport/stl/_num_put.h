@@ -43,6 +43,10 @@
 #  include <stl/_facets_fwd.h>
 #endif
 
+#ifndef _STLP_INTERNAL_NUM_DIGITS_H
+#  include <stl/_num_digits.h>
+#endif
+
 _STLP_BEGIN_NAMESPACE
 
 //----------------------------------------------------------------------
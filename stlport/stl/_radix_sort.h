@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_RADIX_SORT_H
+#define _STLP_INTERNAL_RADIX_SORT_H
+
+#ifndef _STLP_CLIMITS
+#  include <climits>
+#endif
+
+#ifndef _STLP_INTERNAL_CSTDLIB
+#  include <stl/_cstdlib.h>
+#endif
+
+#ifndef _STLP_INTERNAL_UNINITIALIZED_H
+#  include <stl/_uninitialized.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+template <class _Tp> struct greater;
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * LSD radix sort, one byte of key per pass; keys are arithmetic values
+ * mapped to unsigned integers of the same order. Passes over byte that is
+ * the same for all keys are skipped. Elements move between range and
+ * buffer of the same size; sort is stable.
+ */
+
+// sort() of fewer values is left to introsort
+#define __stl_radix_threshold  256
+
+template <class _Tp>
+struct __radix_traits
+{
+    typedef false_type _Is_key;
+};
+
+template <class _Tp, class _Key, bool _Signed>
+struct __radix_int_traits
+{
+    typedef true_type _Is_key;
+    typedef _Key _Key_type;
+
+    // signed: flip sign bit, so negative values go first
+    static _Key _S_key( _Tp __x )
+      { return _Signed ? static_cast<_Key>(static_cast<_Key>(__x) ^ (_Key(1) << (sizeof(_Key) * CHAR_BIT - 1))) : static_cast<_Key>(__x); }
+};
+
+template <class _Tp, class _Key>
+struct __radix_float_traits
+{
+    typedef true_type _Is_key;
+    typedef _Key _Key_type;
+
+    // IEEE 754: flip all bits of negative values and sign bit of others
+    static _Key _S_key( _Tp __x )
+      {
+        _Key __b;
+        memcpy( &__b, &__x, sizeof(_Key) );
+        const _Key __sign = _Key(1) << (sizeof(_Key) * CHAR_BIT - 1);
+        return __b ^ ((__b & __sign) != 0 ? static_cast<_Key>(~_Key(0)) : __sign);
+      }
+};
+
+template <> struct __radix_traits<bool> : public __radix_int_traits<bool, unsigned char, false> {};
+template <> struct __radix_traits<char> : public __radix_int_traits<char, unsigned char, (CHAR_MIN < 0)> {};
+template <> struct __radix_traits<signed char> : public __radix_int_traits<signed char, unsigned char, true> {};
+template <> struct __radix_traits<unsigned char> : public __radix_int_traits<unsigned char, unsigned char, false> {};
+template <> struct __radix_traits<short> : public __radix_int_traits<short, unsigned short, true> {};
+template <> struct __radix_traits<unsigned short> : public __radix_int_traits<unsigned short, unsigned short, false> {};
+template <> struct __radix_traits<int> : public __radix_int_traits<int, unsigned int, true> {};
+template <> struct __radix_traits<unsigned int> : public __radix_int_traits<unsigned int, unsigned int, false> {};
+template <> struct __radix_traits<long> : public __radix_int_traits<long, unsigned long, true> {};
+template <> struct __radix_traits<unsigned long> : public __radix_int_traits<unsigned long, unsigned long, false> {};
+#if defined (_STLP_LONG_LONG)
+template <> struct __radix_traits<_STLP_LONG_LONG> : public __radix_int_traits<_STLP_LONG_LONG, unsigned _STLP_LONG_LONG, true> {};
+template <> struct __radix_traits<unsigned _STLP_LONG_LONG> : public __radix_int_traits<unsigned _STLP_LONG_LONG, unsigned _STLP_LONG_LONG, false> {};
+template <> struct __radix_traits<double> : public __radix_float_traits<double, unsigned _STLP_LONG_LONG> {};
+#endif
+template <> struct __radix_traits<float> : public __radix_float_traits<float, unsigned int> {};
+
+// Order given by comparator: _Is_default is true_type for less and greater
+// of radix key type
+template <class _Tp, class _Compare>
+struct __radix_order
+{
+    typedef false_type _Is_default;
+};
+
+template <class _Tp>
+struct __radix_order<_Tp, less<_Tp> >
+{
+    typedef typename __radix_traits<_Tp>::_Is_key _Is_default;
+    enum { _Descending = 0 };
+};
+
+template <class _Tp>
+struct __radix_order<_Tp, less<void> >
+{
+    typedef typename __radix_traits<_Tp>::_Is_key _Is_default;
+    enum { _Descending = 0 };
+};
+
+template <class _Tp>
+struct __radix_order<_Tp, greater<_Tp> >
+{
+    typedef typename __radix_traits<_Tp>::_Is_key _Is_default;
+    enum { _Descending = 1 };
+};
+
+template <class _Tp>
+struct __radix_order<_Tp, greater<void> >
+{
+    typedef typename __radix_traits<_Tp>::_Is_key _Is_default;
+    enum { _Descending = 1 };
+};
+
+// Key functions: element to unsigned key
+template <class _Tp>
+struct __radix_key_ascending
+{
+    typedef typename __radix_traits<_Tp>::_Key_type _Key_type;
+
+    _Key_type operator()( const _Tp& __x ) const
+      { return __radix_traits<_Tp>::_S_key( __x ); }
+};
+
+template <class _Tp>
+struct __radix_key_descending
+{
+    typedef typename __radix_traits<_Tp>::_Key_type _Key_type;
+
+    _Key_type operator()( const _Tp& __x ) const
+      { return static_cast<_Key_type>(~__radix_traits<_Tp>::_S_key( __x )); }
+};
+
+template <class _Tp, class _Kt, class _KeyExtractor>
+struct __radix_key_extract
+{
+    typedef typename __radix_traits<_Kt>::_Key_type _Key_type;
+
+    explicit __radix_key_extract( _KeyExtractor __key ) :
+        _M_key( __key )
+      { }
+
+    _Key_type operator()( const _Tp& __x ) const
+      { return __radix_traits<_Kt>::_S_key( _M_key( __x ) ); }
+
+    _KeyExtractor _M_key;
+};
+
+template <class _KeyFn>
+struct __radix_key_compare
+{
+    explicit __radix_key_compare( _KeyFn __key ) :
+        _M_key( __key )
+      { }
+
+    template <class _Tp>
+    bool operator()( const _Tp& __x, const _Tp& __y ) const
+      { return _M_key( __x ) < _M_key( __y ); }
+
+    _KeyFn _M_key;
+};
+
+// Put elements to places given by __pos (per value of key byte)
+template <class _InputIter, class _OutputIter, class _KeyFn>
+void __radix_scatter( _InputIter __first, _InputIter __last, _OutputIter __result,
+                      size_t* __pos, int __shift, _KeyFn __key )
+{
+  for ( ; __first != __last; ++__first ) {
+    __result[__pos[(__key( *__first ) >> __shift) & 0xff]++] = *__first;
+  }
+}
+
+template <class _RandomAccessIter, class _Tp, class _KeyFn>
+void __radix_sort_lsd( _RandomAccessIter __first, _RandomAccessIter __last, _Tp* __buffer, _KeyFn __key )
+{
+  typedef typename _KeyFn::_Key_type _Key;
+  const int __bytes = sizeof(_Key);
+
+  size_t __n = __last - __first;
+  size_t __count[__bytes][256];
+  memset( __count, 0, sizeof(__count) );
+  for ( _RandomAccessIter __i = __first; __i != __last; ++__i ) {
+    _Key __k = __key( *__i );
+    for ( int __d = 0; __d < __bytes; ++__d ) {
+      ++__count[__d][(__k >> (__d * CHAR_BIT)) & 0xff];
+    }
+  }
+
+  const _Key __first_key = __key( *__first );
+  bool __in_buffer = false;
+  for ( int __d = 0; __d < __bytes; ++__d ) {
+    size_t* __pos = __count[__d];
+    if ( __pos[(__first_key >> (__d * CHAR_BIT)) & 0xff] == __n ) {
+      continue;
+    }
+    size_t __sum = 0;
+    for ( int __b = 0; __b < 256; ++__b ) {
+      size_t __c = __pos[__b];
+      __pos[__b] = __sum;
+      __sum += __c;
+    }
+    if ( __in_buffer ) {
+      __radix_scatter( __buffer, __buffer + __n, __first, __pos, __d * CHAR_BIT, __key );
+    } else {
+      __radix_scatter( __first, __last, __buffer, __pos, __d * CHAR_BIT, __key );
+    }
+    __in_buffer = !__in_buffer;
+  }
+  if ( __in_buffer ) {
+    _STLP_STD::copy( __buffer, __buffer + __n, __first );
+  }
+}
+
+template <class _Tp>
+_Tp* __radix_buffer( size_t __n )
+{ return __n <= size_t(-1) / sizeof(_Tp) ? static_cast<_Tp*>(malloc( __n * sizeof(_Tp) )) : 0; }
+
+// sort() of arithmetic values; false if there are too few of them
+// or memory for buffer isn't available
+template <class _Tp>
+bool __radix_sort_values( _Tp* __first, _Tp* __last, bool __descending )
+{
+  size_t __n = __last - __first;
+  if ( __n < __stl_radix_threshold ) {
+    return false;
+  }
+  _Tp* __buffer = __radix_buffer<_Tp>( __n );
+  if ( __buffer == 0 ) {
+    return false;
+  }
+  if ( __descending ) {
+    __radix_sort_lsd( __first, __last, __buffer, __radix_key_descending<_Tp>() );
+  } else {
+    __radix_sort_lsd( __first, __last, __buffer, __radix_key_ascending<_Tp>() );
+  }
+  free( __buffer );
+  return true;
+}
+
+template <class _RandomAccessIter, class _Tp, class _KeyFn>
+void __radix_sort_aux( _RandomAccessIter __first, _RandomAccessIter __last, _Tp*, _KeyFn __key )
+{
+  size_t __n = __last - __first;
+  _Tp* __buffer = __n < 2 ? 0 : __radix_buffer<_Tp>( __n );
+  if ( __buffer == 0 ) {
+    _STLP_STD::stable_sort( __first, __last, __radix_key_compare<_KeyFn>( __key ) );
+    return;
+  }
+  _STLP_TRY {
+    _STLP_STD::uninitialized_copy( __first, __last, __buffer );
+  }
+  _STLP_UNWIND( free( __buffer ) )
+  _STLP_TRY {
+    __radix_sort_lsd( __first, __last, __buffer, __key );
+  }
+  _STLP_UNWIND( (_STLP_STD::detail::_Destroy_Range( __buffer, __buffer + __n ), free( __buffer )) )
+  _STLP_STD::detail::_Destroy_Range( __buffer, __buffer + __n );
+  free( __buffer );
+}
+
+template <class _RandomAccessIter, class _KeyExtractor, class _Kt>
+inline void __radix_sort_by_key( _RandomAccessIter __first, _RandomAccessIter __last,
+                                 _KeyExtractor __key, const _Kt& )
+{
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  __radix_sort_aux( __first, __last, static_cast<_Tp*>(0),
+                    __radix_key_extract<_Tp, _Kt, _KeyExtractor>( __key ) );
+}
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+#if !defined (_STLP_NO_EXTENSIONS)
+template <class _RandomAccessIter>
+void radix_sort( _RandomAccessIter __first, _RandomAccessIter __last )
+{
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
+  typedef typename iterator_traits<_RandomAccessIter>::value_type _Tp;
+  _STLP_PRIV __radix_sort_aux( __first, __last, static_cast<_Tp*>(0), _STLP_PRIV __radix_key_ascending<_Tp>() );
+}
+
+template <class _RandomAccessIter, class _KeyExtractor>
+void radix_sort( _RandomAccessIter __first, _RandomAccessIter __last, _KeyExtractor __key )
+{
+  _STLP_DEBUG_CHECK(_STLP_PRIV __check_range(__first, __last))
+  if ( __first != __last ) {
+    _STLP_PRIV __radix_sort_by_key( __first, __last, __key, __key( *__first ) );
+  }
+}
+#endif /* _STLP_NO_EXTENSIONS */
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_RADIX_SORT_H */
+
+// Local Variables:
+// mode:C++
+// End:
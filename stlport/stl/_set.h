@@ -38,6 +38,8 @@
 
 _STLP_BEGIN_NAMESPACE
 
+template <class _Key, class _Compare, class _Alloc> class multiset;
+
 template <class _Key, _STLP_DFL_TMPL_PARAM(_Compare, less<_Key>),
                       _STLP_DFL_TMPL_PARAM(_Alloc, allocator<_Key>) >
 class set
@@ -66,11 +68,16 @@ public:
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
   typedef typename _Rep_type::allocator_type allocator_type;
+  typedef _STLP_PRIV _Rb_tree_set_node_handle<value_type, allocator_type> node_type;
+  typedef _STLP_PRIV _Rb_tree_insert_return<iterator, node_type> insert_return_type;
 
 private:
   _Rep_type _M_t;  // red-black tree representing set
   _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
 
+  template <class _Key2, class _Compare2, class _Alloc2> friend class set;
+  template <class _Key2, class _Compare2, class _Alloc2> friend class multiset;
+
 public:
 
   // allocation/deallocation
@@ -135,6 +142,53 @@ public:
   void erase(iterator __first, iterator __last) { _M_t.erase(__first, __last ); }
   void clear() { _M_t.clear(); }
 
+  // node transfer: no copy or move of values, no allocation
+  node_type extract(iterator __pos)
+  { return node_type(_M_t._M_extract(__pos), _M_t.get_allocator()); }
+  node_type extract(const key_type& __x)
+  {
+    iterator __i = _M_t.find(__x);
+    return __i == _M_t.end() ? node_type() : extract(__i);
+  }
+  insert_return_type insert(node_type&& __nh)
+  {
+    insert_return_type __r;
+    if (__nh.empty()) {
+      __r.position = end();
+      __r.inserted = false;
+      return __r;
+    }
+    pair<iterator,bool> __p = _M_t._M_insert_node_unique(__nh._M_get());
+    __r.position = __p.first;
+    __r.inserted = __p.second;
+    if (__p.second)
+      __nh._M_release();
+    else
+      __r.node = _STLP_STD::move(__nh);
+    return __r;
+  }
+  iterator insert(iterator __pos, node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    pair<iterator,bool> __p = _M_t._M_insert_node_unique(__pos, __nh._M_get());
+    if (__p.second)
+      __nh._M_release();
+    return __p.first;
+  }
+  template <class _Compare2>
+  void merge(set<_Key, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(set<_Key, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(multiset<_Key, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+  template <class _Compare2>
+  void merge(multiset<_Key, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_unique(__src._M_t); }
+
   // set operations:
   _STLP_TEMPLATE_FOR_CONT_EXT
   const_iterator find(const _KT& __x) const { return _M_t.find(__x); }
@@ -188,11 +242,15 @@ public:
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
   typedef typename _Rep_type::allocator_type allocator_type;
+  typedef _STLP_PRIV _Rb_tree_set_node_handle<value_type, allocator_type> node_type;
 
 private:
   _Rep_type _M_t;  // red-black tree representing multiset
   _STLP_KEY_TYPE_FOR_CONT_EXT(key_type)
 
+  template <class _Key2, class _Compare2, class _Alloc2> friend class set;
+  template <class _Key2, class _Compare2, class _Alloc2> friend class multiset;
+
 public:
   explicit multiset(const _Compare& __comp = _Compare(),
                     const allocator_type& __a = allocator_type())
@@ -256,6 +314,43 @@ public:
   void erase(iterator __first, iterator __last) { _M_t.erase( __first, __last ); }
   void clear() { _M_t.clear(); }
 
+  // node transfer: no copy or move of values, no allocation
+  node_type extract(iterator __pos)
+  { return node_type(_M_t._M_extract(__pos), _M_t.get_allocator()); }
+  node_type extract(const key_type& __x)
+  {
+    iterator __i = _M_t.find(__x);
+    return __i == _M_t.end() ? node_type() : extract(__i);
+  }
+  iterator insert(node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    iterator __i = _M_t._M_insert_node_equal(__nh._M_get());
+    __nh._M_release();
+    return __i;
+  }
+  iterator insert(iterator __pos, node_type&& __nh)
+  {
+    if (__nh.empty())
+      return end();
+    iterator __i = _M_t._M_insert_node_equal(__pos, __nh._M_get());
+    __nh._M_release();
+    return __i;
+  }
+  template <class _Compare2>
+  void merge(multiset<_Key, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(multiset<_Key, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(set<_Key, _Compare2, _Alloc>& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+  template <class _Compare2>
+  void merge(set<_Key, _Compare2, _Alloc>&& __src)
+  { _M_t._M_merge_equal(__src._M_t); }
+
   // multiset operations:
   _STLP_TEMPLATE_FOR_CONT_EXT
   iterator find(const _KT& __x) { return _M_t.find(__x); }
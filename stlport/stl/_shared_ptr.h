@@ -58,127 +58,153 @@ D* get_deleter( const shared_ptr<T>& ) _STLP_NOEXCEPT;
 
 namespace detail {
 
-struct __shared_ref_base
+/*
+ * Strong and weak counters of shared_ptr's control block are shared
+ * between threads: increment may be relaxed (new owner is created from
+ * existing one, so object is alive anyway), but decrement should be
+ * acquire/release, to make all modifications of the object visible
+ * to the thread that will destroy it.
+ */
+#if defined (__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7)))
+inline void __shared_count_incr( long* c )
+{ __atomic_fetch_add( c, 1L, __ATOMIC_RELAXED ); }
+
+inline long __shared_count_decr( long* c )
+{ return __atomic_sub_fetch( c, 1L, __ATOMIC_ACQ_REL ); }
+
+inline long __shared_count_load( const long* c )
+{ return __atomic_load_n( c, __ATOMIC_RELAXED ); }
+
+inline bool __shared_count_cas( long* c, long& expected, long v )
+{ return __atomic_compare_exchange_n( c, &expected, v, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED ); }
+#elif defined (__GNUC__)
+inline void __shared_count_incr( long* c )
+{ __sync_fetch_and_add( c, 1L ); }
+
+inline long __shared_count_decr( long* c )
+{ return __sync_sub_and_fetch( c, 1L ); }
+
+inline long __shared_count_load( const long* c )
+{ return *static_cast<const volatile long*>(c); }
+
+inline bool __shared_count_cas( long* c, long& expected, long v )
 {
-    virtual void unlink() = 0;
-    virtual void link() = 0;
-    virtual long count() = 0;
+  long prev = __sync_val_compare_and_swap( c, expected, v );
+  if ( prev == expected ) {
+    return true;
+  }
+  expected = prev;
+  return false;
+}
+#else // no atomic operations known, not thread safe
+inline void __shared_count_incr( long* c )
+{ ++*c; }
 
-    virtual void weak_unlink() = 0;
-    virtual void weak_link() = 0;
+inline long __shared_count_decr( long* c )
+{ return --*c; }
 
-    virtual __shared_ref_base* ref() = 0;
+inline long __shared_count_load( const long* c )
+{ return *c; }
 
-    virtual void* get_deleter()
-      { return NULL; }
-};
+inline bool __shared_count_cas( long* c, long& expected, long v )
+{
+  if ( *c == expected ) {
+    *c = v;
+    return true;
+  }
+  expected = *c;
+  return false;
+}
+#endif
 
-template <class T>
-class __shared_ref :
-    public __shared_ref_base
+/*
+ * Control block. Counters manipulation isn't virtual; only release
+ * of owned object (dispose) and of control block itself (destroy)
+ * depends upon the way object was created.
+ *
+ * _w is number of weak references plus one while _n > 0: strong
+ * owners together keep single weak reference, so control block
+ * is alive during dispose() even if the last weak_ptr is removed
+ * in other thread (or by destructor of owned object).
+ */
+class __shared_ref_base
 {
   public:
-    __shared_ref( T* p ) :
-        _p( p ),
+    __shared_ref_base() :
         _n( 1 ),
-        _w( 0 )
+        _w( 1 )
       { }
 
-    virtual void unlink()
+    void link()
+      { __shared_count_incr( &_n ); }
+
+    // add strong reference, if object still alive (for weak_ptr::lock)
+    bool link_nz()
       {
-        if ( --_n == 0 ) {
-          // don't refer to members after 'delete _p;', due to
-          // 'this' may be destroyed during 'delete _p;'.
-          if ( _w > 0 ) {
-            delete _p;
-          } else {
-            delete _p;
-            delete this;
+        long n = __shared_count_load( &_n );
+        while ( n != 0 ) {
+          if ( __shared_count_cas( &_n, n, n + 1 ) ) {
+            return true;
           }
         }
+        return false;
       }
 
-    virtual void link()
-      { ++_n; }
-
-    virtual long count()
-      { return _n; }
-
-    virtual void weak_unlink()
+    void unlink()
       {
-        if ( (--_w == 0) && (_n == 0) ) {
-          delete this;
+        if ( __shared_count_decr( &_n ) == 0 ) {
+          dispose();
+          weak_unlink();
         }
       }
 
-    virtual void weak_link()
-      { ++_w; }
+    long count() const
+      { return __shared_count_load( &_n ); }
 
-    virtual __shared_ref_base* ref()
-      { return this; }
+    void weak_link()
+      { __shared_count_incr( &_w ); }
 
-  protected:
-    T* _p;
-    long _n;
-    long _w;
-};
-
-template <class Y>
-class __alias_shared_ref :
-        public __shared_ref_base
-{
-  public:
-    __alias_shared_ref( __shared_ref_base* r ) :
-        _parent( r == NULL ? NULL : r->ref() )
-      {
-        if ( _parent != NULL ) {
-          _parent->link();
-        }
-      }
-
-    virtual void unlink()
+    void weak_unlink()
       {
-        if ( _parent != NULL ) {
-          _parent->unlink();
+        if ( __shared_count_decr( &_w ) == 0 ) {
+          destroy();
         }
-
-        delete this;
       }
 
-    virtual void link()
-      {
-        if ( _parent != NULL ) {
-          _parent->link();
-        }
-      }
+    virtual void* get_deleter()
+      { return NULL; }
 
-    virtual long count()
-      { return _parent == NULL ? 0L : _parent->count(); }
+  protected:
+    virtual ~__shared_ref_base()
+      { }
 
-    virtual void weak_unlink()
-      {
-        if ( _parent != NULL ) {
-          _parent->weak_unlink();
-        }
+    // release owned object
+    virtual void dispose() = 0;
+    // release control block
+    virtual void destroy() = 0;
 
-        delete this;
-      }
+  private:
+    long _n;
+    long _w;
+};
 
-    virtual void weak_link()
-      {
-        if ( _parent != NULL ) {
-          _parent->weak_link();
-        }
-      }
+template <class T>
+class __shared_ref :
+    public __shared_ref_base
+{
+  public:
+    __shared_ref( T* p ) :
+        _p( p )
+      { }
 
-    virtual __shared_ref_base* ref()
-      { return _parent == NULL ? NULL : _parent->ref(); }
+  protected:
+    virtual void dispose()
+      { delete _p; }
 
-    // virtual void* get_deleter()
-    //   { return _parent == NULL ? NULL : _parent->get_deleter(); }
+    virtual void destroy()
+      { delete this; }
 
-  protected:
-    __shared_ref_base* _parent;
+    T* _p;
 };
 
 template <class T, class D>
@@ -191,25 +217,6 @@ class __shared_ref_deleter :
         _d( d )
       { }
 
-    virtual void unlink()
-      {
-        if ( --__shared_ref<T>::_n == 0 ) {
-          if ( __shared_ref<T>::_w > 0 ) {
-          __shared_ref_deleter<T,D>::_d( __shared_ref<T>::_p );
-          } else {
-            __shared_ref_deleter<T,D>::_d( __shared_ref<T>::_p );
-            delete this;
-          }
-        }
-      }
-
-    virtual void weak_unlink()
-      {
-        if ( (--__shared_ref<T>::_w == 0) && (__shared_ref<T>::_n == 0) ) {
-          delete this;
-        }
-      }
-
     virtual void* get_deleter()
       { return reinterpret_cast<void*>(this); }
 
@@ -217,6 +224,10 @@ class __shared_ref_deleter :
     // bool check_deleter() const
     //   { return is_convertible<DD*,D*>::value; }
 
+  protected:
+    virtual void dispose()
+      { _d( __shared_ref<T>::_p ); }
+
   private:
     template <class DD, class TT> friend DD* _STLP_STD::get_deleter( const _STLP_STD::shared_ptr<TT>& ) _STLP_NOEXCEPT;
     D _d;
@@ -240,35 +251,32 @@ template <class T, class D, class A>
 class __shared_ref_alloc :
     public __shared_ref_deleter<T,D>
 {
+  private:
+    typedef typename A::template rebind<__shared_ref_alloc>::other allocator_type;
+
   public:
     __shared_ref_alloc( T* p, D d, A a ) :
         __shared_ref_deleter<T,D>( p, d ),
         _a( a )
       { }
 
-    virtual void unlink()
-      {
-        if ( --__shared_ref<T>::_n == 0 ) {
-          if ( __shared_ref<T>::_w > 0 ) {
-            __shared_ref_deleter<T,D>::_d( __shared_ref<T>::_p );
-          } else {
-            __shared_ref_deleter<T,D>::_d( __shared_ref<T>::_p );
-            _a.deallocate( this, 1 );
-          }
-        }
-      }
-
-    virtual void weak_unlink()
+  protected:
+    virtual void destroy()
       {
-        if ( (--__shared_ref<T>::_w == 0) && (__shared_ref<T>::_n == 0) ) {
-          _a.deallocate( this, 1 );
-        }
+        allocator_type a( _STLP_STD::move(_a) );
+        this->~__shared_ref_alloc();
+        a.deallocate( this, 1 );
       }
 
   private:
-    A _a;
+    allocator_type _a;
 };
 
+/*
+ * Control block and object in single memory block (make_shared,
+ * allocate_shared): one allocation instead of two, and object
+ * is near counters in memory.
+ */
 template <class T, class A>
 class __shared_ref_intrusive :
     public __shared_ref_base
@@ -278,50 +286,27 @@ class __shared_ref_intrusive :
 
   public:
     template <class... Args >
-    __shared_ref_intrusive( A a, Args ... args ) :
-        _p( args... ),
-        _n( 1 ),
-        _w( 0 ),
-        _a( _STLP_STD::move( a ) )
+    __shared_ref_intrusive( const A& a, Args&&... args ) :
+        _p( _STLP_STD::forward<Args>(args)... ),
+        _a( a )
       { }
 
-    virtual void unlink()
-      {
-        if ( --_n == 0 ) {
-          if ( _w > 0 ) {
-            _p.~T();
-          } else {
-            _p.~T();
-            _a.deallocate( this, 1 );
-          }
-        }
-      }
-
-    virtual void link()
-      { ++_n; }
-
-    virtual long count()
-      { return _n; }
+  protected:
+    virtual void dispose()
+      { _p.~T(); }
 
-    virtual void weak_unlink()
+    virtual void destroy()
       {
-        if ( (--_w == 0) && (_n == 0) ) {
-          _a.deallocate( this, 1 );
-        }
+        // _p already destroyed in dispose(), so don't call destructor
+        // of control block, only allocator's one
+        allocator_type a( _STLP_STD::move(_a) );
+        _a.~allocator_type();
+        a.deallocate( this, 1 );
       }
 
-    virtual void weak_link()
-      { ++_w; }
-
-    virtual __shared_ref_base* ref()
-      { return this; }
-
-  protected:
     friend class shared_ptr<T>;
 
     T _p;
-    long _n;
-    long _w;
     allocator_type _a;
 };
 
@@ -803,19 +788,18 @@ class shared_ptr
       }
 
     template <class Y>
-    shared_ptr( const shared_ptr<Y>& r, T* p ) _STLP_NOEXCEPT
+    shared_ptr( const shared_ptr<Y>& r, T* p ) _STLP_NOEXCEPT :
+        _p( p ),
+        _ref( r._ref )
       {
-        try {
-          _p = p;
-          _ref = new detail::__alias_shared_ref<Y>( r._ref );
-        }
-        catch ( ... ) {
-          _ref = NULL;
+        // aliasing: share control block of r, no allocation
+        if ( _ref != NULL ) {
+          _ref->link();
         }
       }
 
     shared_ptr( const shared_ptr& r ) _STLP_NOEXCEPT :
-        _ref( r._ref == NULL ? NULL : r._ref->ref() )
+        _ref( r._ref )
       {
         if ( _ref != NULL ) {
           _p = r.get();
@@ -827,7 +811,7 @@ class shared_ptr
 
     template <class Y, class = typename enable_if<is_convertible<Y*,T*>::value>::type >
     shared_ptr( const shared_ptr<Y>& r ) _STLP_NOEXCEPT :
-        _ref( r._ref == NULL ? NULL : r._ref->ref() )
+        _ref( r._ref )
       {
         // static_assert( is_convertible<Y*,T*>::value, "pointers not convertible" );
 
@@ -870,12 +854,13 @@ class shared_ptr
       {
         static_assert( is_convertible<Y*,T*>::value, "pointers not convertible" );
 
-        if ( r.expired() ) {
+        // object may be removed by other thread between check and
+        // link, so check and link in one atomic operation
+        if ( (r._ref == NULL) || !r._ref->link_nz() ) {
           throw bad_weak_ptr();
         }
-        _ref = r._ref->ref(); // r._ref not NULL here
+        _ref = r._ref;
         _p = r._p;
-        _ref->link();
       }
 
     template <class Y>
@@ -1188,19 +1173,18 @@ class shared_ptr<void>
       }
 
     template <class Y>
-    shared_ptr( const shared_ptr<Y>& r, void* p ) _STLP_NOEXCEPT
+    shared_ptr( const shared_ptr<Y>& r, void* p ) _STLP_NOEXCEPT :
+        _p( p ),
+        _ref( r._ref )
       {
-        try {
-          _p = p;
-          _ref = new detail::__alias_shared_ref<Y>( r._ref );
-        }
-        catch ( ... ) {
-          _ref = NULL;
+        // aliasing: share control block of r, no allocation
+        if ( _ref != NULL ) {
+          _ref->link();
         }
       }
 
     shared_ptr( const shared_ptr& r ) _STLP_NOEXCEPT :
-        _ref( r._ref == NULL ? NULL : r._ref->ref() )
+        _ref( r._ref )
       {
         if ( _ref != NULL ) {
           _p = r.get();
@@ -1212,7 +1196,7 @@ class shared_ptr<void>
 
     template <class Y>
     shared_ptr( const shared_ptr<Y>& r ) _STLP_NOEXCEPT :
-        _ref( r._ref == NULL ? NULL : r._ref->ref() )
+        _ref( r._ref )
       {
         // static_assert( is_convertible<Y*,T*>::value, "pointers not convertible" );
 
@@ -1253,12 +1237,13 @@ class shared_ptr<void>
     template <class Y>
     explicit shared_ptr( const weak_ptr<Y>& r )
       {
-        if ( r.expired() ) {
+        // object may be removed by other thread between check and
+        // link, so check and link in one atomic operation
+        if ( (r._ref == NULL) || !r._ref->link_nz() ) {
           throw bad_weak_ptr();
         }
-        _ref = r._ref->ref(); // r._ref not NULL here
+        _ref = r._ref;
         _p = r._p;
-        _ref->link();
       }
 
     template <class Y>
@@ -1612,7 +1597,7 @@ shared_ptr<T> static_pointer_cast( const shared_ptr<U>& r ) _STLP_NOEXCEPT
 
   if ( r._ref != NULL ) {
     p._p = static_cast<T*>(r.get());
-    p._ref = r._ref->ref();
+    p._ref = r._ref;
     p._ref->link();
   }
 
@@ -1626,7 +1611,7 @@ shared_ptr<T> dynamic_pointer_cast( const shared_ptr<U>& r ) _STLP_NOEXCEPT
 
   if ( r._ref != NULL ) {
     p._p = dynamic_cast<T*>(r.get());
-    p._ref = r._ref->ref();
+    p._ref = r._ref;
     p._ref->link();
   }
 
@@ -1640,7 +1625,7 @@ shared_ptr<T> const_pointer_cast( const shared_ptr<U>& r ) _STLP_NOEXCEPT
 
   if ( r._ref != NULL ) {
     p._p = const_cast<T*>(r.get());
-    p._ref = r._ref->ref();
+    p._ref = r._ref;
     p._ref->link();
   }
 
@@ -1690,7 +1675,7 @@ class weak_ptr
 
     template <class Y, class = typename enable_if<is_convertible<Y*,T*>::value>::type>
     weak_ptr( const shared_ptr<Y>& r ) _STLP_NOEXCEPT :
-        _ref( r._ref == NULL ? NULL : r._ref->ref() )
+        _ref( r._ref )
       {
         if ( _ref != NULL ) {
           _p = r._p;
@@ -1701,7 +1686,7 @@ class weak_ptr
       }
 
     weak_ptr( const weak_ptr& r ) _STLP_NOEXCEPT :
-        _ref( /* r._ref == NULL ? NULL : */ r.expired() ? NULL : r._ref->ref() )
+        _ref( /* r._ref == NULL ? NULL : */ r.expired() ? NULL : r._ref )
       {
         if ( _ref != NULL ) {
           _p = r._p;
@@ -1713,7 +1698,7 @@ class weak_ptr
 
     template <class Y, class = typename enable_if<is_convertible<Y*,T*>::value>::type>
     weak_ptr( const weak_ptr<Y>& r ) _STLP_NOEXCEPT :
-        _ref( /* r._ref == NULL ? NULL : */ r.expired() ? NULL : r._ref->ref() )
+        _ref( /* r._ref == NULL ? NULL : */ r.expired() ? NULL : r._ref )
       {
         if ( _ref != NULL ) {
           _p = r._p;
@@ -1806,10 +1791,14 @@ class weak_ptr
 
     shared_ptr<T> lock() const _STLP_NOEXCEPT
       {
-        if ( expired() ) {
-          return shared_ptr<T>();
+        shared_ptr<T> p;
+
+        if ( (_ref != NULL) && _ref->link_nz() ) {
+          p._p = _p;
+          p._ref = _ref;
         }
-        return shared_ptr<T>(*this);
+
+        return p;
       }
 
     template <class U>
@@ -43,13 +43,13 @@ _STLP_BEGIN_NAMESPACE
 template <class _CharT, class _Traits, class _Alloc>
 basic_stringbuf<_CharT, _Traits, _Alloc>
   ::basic_stringbuf(ios_base::openmode __mode)
-    : basic_streambuf<_CharT, _Traits>(), _M_mode(__mode), _M_str()
+    : basic_streambuf<_CharT, _Traits>(), _M_mode(__mode), _M_str(), _M_size(0)
 {}
 
 template <class _CharT, class _Traits, class _Alloc>
 basic_stringbuf<_CharT, _Traits, _Alloc>
   ::basic_stringbuf(const basic_string<_CharT, _Traits, _Alloc>& __s, ios_base::openmode __mode)
-    : basic_streambuf<_CharT, _Traits>(), _M_mode(__mode), _M_str(__s)
+    : basic_streambuf<_CharT, _Traits>(), _M_mode(__mode), _M_str(__s), _M_size(0)
 {
   _M_set_ptrs();
 }
@@ -67,35 +67,106 @@ basic_stringbuf<_CharT, _Traits, _Alloc>::str(const basic_string<_CharT, _Traits
   _M_set_ptrs();
 }
 
+// Move contents out; string is trimmed to contents, but keeps capacity.
+template <class _CharT, class _Traits, class _Alloc>
+basic_string<_CharT, _Traits, _Alloc>
+basic_stringbuf<_CharT, _Traits, _Alloc>::str() &&
+{
+  _M_str.resize(_M_length());
+  _String __s(_M_str.get_allocator());
+  __s.swap(_M_str);
+  _M_set_ptrs();
+  return __s;
+}
+
 template <class _CharT, class _Traits, class _Alloc>
 void
 basic_stringbuf<_CharT, _Traits, _Alloc>::_M_set_ptrs()
 {
+  _M_size = _M_str.size();
+  if (_M_mode & ios_base::out) {
+    _M_str.resize(_M_str.capacity()); // whole capacity is put area
+  }
+
   _CharT* __data_ptr = _S_start(_M_str);
-  _CharT* __data_end = _S_finish(_M_str);
+  _CharT* __data_end = __data_ptr + _M_size;
   // The initial read position is the beginning of the string.
   if (_M_mode & ios_base::in) {
     this->setg(__data_ptr, (_M_mode & ios_base::ate) ? __data_end : __data_ptr, __data_end);
   }
 
-  // The initial write position is the beginning of the string.
+  // The initial write position is the beginning of the string, or its
+  // end in app/ate mode, or if we initialized read-write stringbuf with string.
   if (_M_mode & ios_base::out) {
-    if ( _M_mode & (ios_base::app | ios_base::ate) ) {
-      this->setp( __data_end, __data_end );
-    } else {
-      this->setp( __data_ptr, __data_end );
-      if ( _M_mode & ios_base::in ) {
-        this->pbump((int)_M_str.size()); // initial write position, if we initialized with string
-      }
+    this->setp( __data_ptr, _S_finish(_M_str) );
+    if ( _M_mode & (ios_base::app | ios_base::ate | ios_base::in) ) {
+      this->pbump((int)_M_size);
     }
-    // this->setp((_M_mode & (ios_base::app | ios_base::ate))? __data_end : __data_ptr, __data_end);
   }
 }
 
+// Make put area at least __n characters long.  String grows at least
+// twice, and is resized to its capacity; contents and get and put
+// positions are kept.
+template <class _CharT, class _Traits, class _Alloc>
+void
+basic_stringbuf<_CharT, _Traits, _Alloc>::_M_grow(size_t __n)
+{
+  const ptrdiff_t __offg = this->gptr() - this->eback();
+  const ptrdiff_t __offp = this->pptr() - this->pbase();
+  _M_size = _M_length();
+
+  if (__n > _M_str.size()) {
+    const size_t __max = _M_str.max_size();
+    _M_str.reserve((max)(__n, _M_str.size() < __max / 2 ? 2 * _M_str.size() : __max));
+  }
+  _M_str.resize(_M_str.capacity());
+
+  _CharT* __data_ptr = _S_start(_M_str);
+  if (_M_mode & ios_base::in) {
+    this->setg(__data_ptr, __data_ptr + __offg, __data_ptr + _M_size);
+  }
+  this->setp(__data_ptr, _S_finish(_M_str));
+  this->pbump((int)__offp);
+}
+
+// In app mode output always goes to end of contents: seek of put position
+// back leaves put area ending there, so next output comes here.
+template <class _CharT, class _Traits, class _Alloc>
+void
+basic_stringbuf<_CharT, _Traits, _Alloc>::_M_append_pos()
+{
+  _M_size = _M_length();
+  this->setp(this->pbase(), _S_finish(_M_str));
+  this->pbump((int)_M_size);
+}
+
+template <class _CharT, class _Traits, class _Alloc>
+void
+basic_stringbuf<_CharT, _Traits, _Alloc>::reserve(size_t __n)
+{
+  if ((_M_mode & ios_base::out) && __n > _M_str.size()) {
+    _M_grow(__n);
+  }
+}
+
+// Characters that can be read without underflow, output included.
+template <class _CharT, class _Traits, class _Alloc>
+streamsize
+basic_stringbuf<_CharT, _Traits, _Alloc>::showmanyc() {
+  if (!(_M_mode & ios_base::in)) {
+    return -1;
+  }
+  _M_update_egptr();
+  return this->egptr() - this->gptr();
+}
+
 // Precondition: gptr() >= egptr().  Returns a character, if one is available.
+// Output since get area was set may have extended contents.
 template <class _CharT, class _Traits, class _Alloc>
 __BSB_int_type__
 basic_stringbuf<_CharT, _Traits, _Alloc>::underflow() {
+  _M_update_egptr();
   return this->gptr() != this->egptr()
     ? _Traits::to_int_type(*this->gptr())
     : _Traits::eof();
@@ -105,6 +176,7 @@ basic_stringbuf<_CharT, _Traits, _Alloc>::underflow() {
 template <class _CharT, class _Traits, class _Alloc>
 __BSB_int_type__
 basic_stringbuf<_CharT, _Traits, _Alloc>::uflow() {
+  _M_update_egptr();
   if (this->gptr() != this->egptr()) {
     int_type __c = _Traits::to_int_type(*this->gptr());
     this->gbump(1);
@@ -140,26 +212,20 @@ basic_stringbuf<_CharT, _Traits, _Alloc>::pbackfail(int_type __c) {
     return _Traits::eof();
 }
 
+// Put area is full: string grows.
 template <class _CharT, class _Traits, class _Alloc>
 __BSB_int_type__ basic_stringbuf<_CharT, _Traits, _Alloc>::overflow(int_type __c)
 {
   if (!_Traits::eq_int_type(__c, _Traits::eof())) {
     if (_M_mode & ios_base::out) {
-      if ( this->pptr() < this->epptr() ) { // just put back in any case
-        _M_str.push_back( _Traits::to_char_type(__c) );
-        this->pbump(1);
-      } else if ( _M_mode & ios_base::in ) {
-        ptrdiff_t __offset = this->gptr() - this->eback();
-        _M_str.push_back(_Traits::to_char_type(__c));
-        _CharT* __data_ptr = _S_start(_M_str);
-        this->setg(__data_ptr, __data_ptr + __offset, _S_finish(_M_str));
-        this->setp(__data_ptr, _S_finish(_M_str));
-        this->pbump((int)_M_str.size());
-      } else {
-        _M_str.push_back( _Traits::to_char_type(__c) );
-        this->setp(_S_start(_M_str), _S_finish(_M_str));
-        this->pbump((int)_M_str.size());
+      if ( (_M_mode & ios_base::app) && this->pptr() != 0 ) {
+        _M_append_pos();
+      }
+      if ( this->pptr() == this->epptr() ) {
+        _M_grow(this->pptr() - this->pbase() + 1);
       }
+      *this->pptr() = _Traits::to_char_type(__c);
+      this->pbump(1);
       return __c;
     }
     return _Traits::eof(); // Overflow always fails if it's read-only
@@ -167,132 +233,63 @@ __BSB_int_type__ basic_stringbuf<_CharT, _Traits, _Alloc>::overflow(int_type __c
   return _Traits::not_eof(__c); // __c is EOF, so we don't have to do anything
 }
 
+// Both overwrite contents after pptr() and append: all is in put area,
+// after string growth if needed.
 template <class _CharT, class _Traits, class _Alloc>
 streamsize
 basic_stringbuf<_CharT, _Traits, _Alloc>::xsputn(const char_type* __s, streamsize __n)
 {
-  streamsize __nwritten = 0;
-
   if ((_M_mode & ios_base::out) && __n > 0) {
-    // If the put pointer is somewhere in the middle of the string,
-    // then overwrite instead of append.
-    if ( !_M_str.empty() && this->pbase() == _S_start(_M_str)) {
-      ptrdiff_t __avail = _S_finish(_M_str) - this->pptr();
-      if (__avail > __n) {
-        _Traits::copy(this->pptr(), __s, __STATIC_CAST(size_t, __n));
-        this->pbump((int)__n);
-        return __n;
-      }
-
-      if ( __avail > 0 ) {
-        _Traits::copy(this->pptr(), __s, __avail);
-        __nwritten += __avail;
-        __n -= __avail;
-        __s += __avail;
-      }
+    if ((_M_mode & ios_base::app) && this->pptr() != 0) {
+      _M_append_pos();
     }
-
-    // At this point we know we're appending.
-    _CharT* __data_ptr;
-    if (_M_mode & ios_base::in) {
-      ptrdiff_t __get_offset = this->gptr() - this->eback();
-      _M_str.append(__s, __s + __STATIC_CAST(ptrdiff_t, __n));
-      __data_ptr = _S_start(_M_str);
-      this->setg(__data_ptr, __data_ptr + __get_offset, _S_finish(_M_str));
-    } else {
-      _M_str.append(__s, __s + __STATIC_CAST(ptrdiff_t, __n));
-      __data_ptr = _S_start(_M_str);
+    if (this->epptr() - this->pptr() < __n) {
+      // __s may point to our own contents
+      const bool __own = __s >= this->pbase() && __s < this->epptr();
+      const ptrdiff_t __soff = __s - this->pbase();
+      _M_grow(this->pptr() - this->pbase() + __STATIC_CAST(size_t, __n));
+      if (__own) {
+        __s = this->pbase() + __soff;
+      }
     }
-
-    this->setp(__data_ptr, _S_finish(_M_str));
-    this->pbump((int)_M_str.size());
-    __nwritten += __n;
+    _Traits::move(this->pptr(), __s, __STATIC_CAST(size_t, __n));
+    this->pbump((int)__n);
+    return __n;
   }
 
-  return __nwritten;
+  return 0;
 }
 
 template <class _CharT, class _Traits, class _Alloc>
 streamsize
 basic_stringbuf<_CharT, _Traits, _Alloc>::_M_xsputnc(char_type __c,
                                                      streamsize __n) {
-  streamsize __nwritten = 0;
-
   if ((_M_mode & ios_base::out) && __n > 0) {
-    // If the put pointer is somewhere in the middle of the string,
-    // then overwrite instead of append.
-    if (this->pbase() == _S_start(_M_str)) {
-      ptrdiff_t __avail = _S_finish(_M_str) - this->pptr();
-      if (__avail > __n) {
-        _Traits::assign(this->pptr(), __STATIC_CAST(size_t, __n), __c);
-        this->pbump(__STATIC_CAST(int, __n));
-        return __n;
-      }
-      else {
-        _Traits::assign(this->pptr(), __avail, __c);
-        __nwritten += __avail;
-        __n -= __avail;
-      }
+    if ((_M_mode & ios_base::app) && this->pptr() != 0) {
+      _M_append_pos();
     }
-
-    // At this point we know we're appending.
     size_t __app_size = sizeof(streamsize) > sizeof(size_t) ? __STATIC_CAST(size_t, (min)(__n, __STATIC_CAST(streamsize, _M_str.max_size())))
                                                             : __STATIC_CAST(size_t, __n);
-    _CharT* __data_ptr;
-    if (this->_M_mode & ios_base::in) {
-      ptrdiff_t __get_offset = this->gptr() - this->eback();
-      _M_str.append(__app_size, __c);
-      __data_ptr = _S_start(_M_str);
-      this->setg(__data_ptr, __data_ptr + __get_offset, _S_finish(_M_str));
-    } else {
-      _M_str.append(__app_size, __c);
-      __data_ptr = _S_start(_M_str);
+    if (__STATIC_CAST(size_t, this->epptr() - this->pptr()) < __app_size) {
+      _M_grow(this->pptr() - this->pbase() + __app_size);
     }
-
-    this->setp(__data_ptr, _S_finish(_M_str));
-    this->pbump((int)_M_str.size());
-    __nwritten += __app_size;
+    _Traits::assign(this->pptr(), __app_size, __c);
+    this->pbump((int)__app_size);
+    return __app_size;
   }
 
-  return __nwritten;
+  return 0;
 }
 
 // According to the C++ standard the effects of setbuf are implementation
 // defined, except that setbuf(0, 0) has no effect.  In this implementation,
-// setbuf(<anything>, n), for n > 0, calls reserve(n) on the underlying
-// string.
+// setbuf(<anything>, n), for n > 0, is reserve(n).
 template <class _CharT, class _Traits, class _Alloc>
 basic_streambuf<_CharT, _Traits>*
 basic_stringbuf<_CharT, _Traits, _Alloc>::setbuf(_CharT*, streamsize __n) {
   if (__n > 0) {
-    bool __do_get_area = false;
-    bool __do_put_area = false;
-    ptrdiff_t __offg = 0;
-    ptrdiff_t __offp = 0;
-
-    if (this->pbase() == _S_start(_M_str)) {
-      __do_put_area = true;
-      __offp = this->pptr() - this->pbase();
-    }
-
-    if (this->eback() == _S_start(_M_str)) {
-      __do_get_area = true;
-      __offg = this->gptr() - this->eback();
-    }
-
-    _M_str.reserve(sizeof(streamsize) > sizeof(size_t) ? __STATIC_CAST(size_t, (min)(__n, __STATIC_CAST(streamsize, _M_str.max_size())))
-                                                       : __STATIC_CAST(size_t, __n));
-
-    _CharT* __data_ptr = _S_start(_M_str);
-
-    if (__do_get_area) {
-      this->setg(__data_ptr, __data_ptr + __offg, _S_finish(_M_str));
-    }
-
-    if (__do_put_area) {
-      this->setp(__data_ptr, _S_finish(_M_str));
-      this->pbump((int)__offp);
-    }
+    reserve(sizeof(streamsize) > sizeof(size_t) ? __STATIC_CAST(size_t, (min)(__n, __STATIC_CAST(streamsize, _M_str.max_size())))
+                                                : __STATIC_CAST(size_t, __n));
   }
 
   return this;
@@ -315,13 +312,15 @@ basic_stringbuf<_CharT, _Traits, _Alloc>
   if ( (__imode && (this->gptr() == 0)) || (__omode && (this->pptr() == 0)) )
     return pos_type(off_type(-1));
 
+  _M_size = _M_length(); // keep contents length, pptr() may move back
+
   streamoff __newoff;
   switch(__dir) {
     case ios_base::beg:
       __newoff = 0;
       break;
     case ios_base::end:
-      __newoff = _M_str.size();
+      __newoff = _M_size;
       break;
     case ios_base::cur:
       __newoff = __imode ? this->gptr() - this->eback() : this->pptr() - this->pbase();
@@ -336,7 +335,7 @@ basic_stringbuf<_CharT, _Traits, _Alloc>
   __off += __newoff;
 
   if (__imode) {
-    ptrdiff_t __n = this->egptr() - this->eback();
+    ptrdiff_t __n = _M_size;
 
     if (__off < 0 || __off > __n)
       return pos_type(off_type(-1));
@@ -345,11 +344,11 @@ basic_stringbuf<_CharT, _Traits, _Alloc>
   }
 
   if (__omode) {
-    ptrdiff_t __n = this->epptr() - this->pbase();
+    ptrdiff_t __n = _M_size;
 
     if (__off < 0 || __off > __n)
       return pos_type(off_type(-1));
-    this->setp(this->pbase(), this->pbase() + __n);
+    this->setp(this->pbase(), (_M_mode & ios_base::app) ? this->pbase() + __STATIC_CAST(ptrdiff_t, __off) : _S_finish(_M_str));
     this->pbump((int)__off);
   }
 
@@ -371,19 +370,21 @@ basic_stringbuf<_CharT, _Traits, _Alloc>
   if ( (__imode && (this->gptr() == 0)) || (__omode && (this->pptr() == 0)) )
     return pos_type(off_type(-1));
 
+  _M_size = _M_length(); // keep contents length, pptr() may move back
+
   const off_type __n = __pos - pos_type(off_type(0));
 
   if (__imode) {
-    if (__n < 0 || __n > this->egptr() - this->eback())
+    if (__n < 0 || size_t(__n) > _M_size)
       return pos_type(off_type(-1));
-    this->setg(this->eback(), this->eback() + __STATIC_CAST(ptrdiff_t, __n), this->egptr());
+    this->setg(this->eback(), this->eback() + __STATIC_CAST(ptrdiff_t, __n), this->eback() + _M_size);
   }
 
   if (__omode) {
-    if (__n < 0 || size_t(__n) > _M_str.size())
+    if (__n < 0 || size_t(__n) > _M_size)
       return pos_type(off_type(-1));
 
-    this->setp(_S_start(_M_str), _S_finish(_M_str));
+    this->setp(this->pbase(), (_M_mode & ios_base::app) ? this->pbase() + __STATIC_CAST(ptrdiff_t, __n) : _S_finish(_M_str));
     this->pbump((int)__n);
   }
 
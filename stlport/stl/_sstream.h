@@ -49,11 +49,11 @@ template <class _CharT, class _Traits, class _Alloc> class basic_stringstream;
 // basic_string's iterators are pointers.  It also assumes (as allowed
 // by the standard) that _CharT is a POD type.
 
-// We have a very small buffer for the put area, just so that we don't
-// have to use append() for every sputc.  Conceptually, the buffer
-// immediately follows the end of the underlying string.  We use this
-// buffer when appending to write-only streambufs, but we don't use it
-// for read-write streambufs.
+// In output mode the whole capacity of the underlying string is the put
+// area: string is resized to its capacity, and contents are its first
+// _M_length() characters (high-water mark of pptr()).  When put area is
+// full, string grows geometrically, so appending is amortized constant
+// time and most of sputc/sputn don't reach virtual functions at all.
 
 template <class _CharT, class _Traits, class _Alloc>
 class basic_stringbuf :
@@ -77,10 +77,18 @@ class basic_stringbuf :
     virtual ~basic_stringbuf();
 
   public:                         // Get or set the string.
-    _String str() const { return _M_str; }
+    _String str() const &
+      { return _String(_S_start(_M_str), _S_start(_M_str) + _M_length(), _M_str.get_allocator()); }
+    // Move contents out, without copy; stringbuf is left empty.
+    _String str() &&;
     void str(const _String& __s);
 
+    // Room for __n characters of contents (in output mode), so that output
+    // up to that size doesn't reallocate.
+    void reserve(size_t __n);
+
   protected:                      // Overridden virtual member functions.
+    virtual streamsize showmanyc();
     virtual int_type underflow();
     virtual int_type uflow();
     virtual int_type pbackfail(int_type __c);
@@ -98,12 +106,30 @@ class basic_stringbuf :
 
   private:                        // Helper functions.
     void _M_set_ptrs();
+    // Contents length: string beyond it is free part of put area.
+    size_t _M_length() const
+      {
+        return (this->pptr() != 0 && __STATIC_CAST(size_t, this->pptr() - this->pbase()) > _M_size) ?
+          __STATIC_CAST(size_t, this->pptr() - this->pbase()) : _M_size;
+      }
+    void _M_grow(size_t __n);
+    void _M_append_pos();
+    // Output isn't seen by get area until it is needed: extend egptr() to
+    // contents written so far.
+    void _M_update_egptr()
+      {
+        if ((_M_mode & ios_base::out) && this->eback() != 0 &&
+            __STATIC_CAST(size_t, this->egptr() - this->eback()) < _M_length()) {
+          this->setg(this->eback(), this->gptr(), this->eback() + _M_length());
+        }
+      }
     static _CharT* _S_start(const _String& __str) { return __CONST_CAST(_CharT*, __str.data()); }
     static _CharT* _S_finish(const _String& __str) { return __CONST_CAST(_CharT*, __str.data()) + __str.size(); }
 
   private:
     ios_base::openmode _M_mode;
     _String _M_str;
+    size_t _M_size; // contents length, as of last move of pptr() back
 
     friend class basic_istringstream<_CharT,_Traits,_Alloc>;
     friend class basic_ostringstream<_CharT,_Traits,_Alloc>;
@@ -153,8 +179,10 @@ class basic_istringstream :
     basic_stringbuf<_CharT, _Traits, _Alloc>* rdbuf() const
       { return __CONST_CAST(_Buf*,&_M_buf); }
 
-    _String str() const
-      { return _M_buf._M_str; }
+    _String str() const &
+      { return _M_buf.str(); }
+    _String str() &&
+      { return _STLP_STD::move(_M_buf).str(); }
     void str(const _String& __s)
       { _M_buf.str(__s); }
 
@@ -199,10 +227,14 @@ class basic_ostringstream :
     basic_stringbuf<_CharT, _Traits, _Alloc>* rdbuf() const
       { return __CONST_CAST(_Buf*,&_M_buf); }
 
-    _String str() const
-      { return _M_buf._M_str; }
+    _String str() const &
+      { return _M_buf.str(); }
+    _String str() &&
+      { return _STLP_STD::move(_M_buf).str(); }
     void str(const _String& __s)
       { _M_buf.str(__s); } // dwa 02/07/00 - BUG STOMPER DAVE
+    void reserve(size_t __n)
+      { _M_buf.reserve(__n); }
 
   private:
     basic_stringbuf<_CharT, _Traits, _Alloc> _M_buf;
@@ -247,10 +279,14 @@ class basic_stringstream :
     basic_stringbuf<_CharT, _Traits, _Alloc>* rdbuf() const
       { return __CONST_CAST(_Buf*,&_M_buf); }
 
-    _String str() const
-      { return _M_buf._M_str; }
+    _String str() const &
+      { return _M_buf.str(); }
+    _String str() &&
+      { return _STLP_STD::move(_M_buf).str(); }
     void str(const _String& __s)
       { _M_buf.str(__s); }
+    void reserve(size_t __n)
+      { _M_buf.reserve(__n); }
 
   private:
     basic_stringbuf<_CharT, _Traits, _Alloc> _M_buf;
@@ -125,6 +125,87 @@ inline _InputIter __str_find_first_not_of(_InputIter __first1, _InputIter __last
   return __str_find_first_not_of_aux1(__first1, __last1, __first2, __last2, __traits, true_type() /* _STLportTraits() */ );
 }
 
+// Pointer based search helpers of basic_string members, return __l if
+// nothing found. Overloads for char_traits<char> use vectorized
+// primitives of _Char_search.
+template <class _CharT, class _Traits>
+inline const _CharT* __str_find(const _CharT* __f, const _CharT* __l, _CharT __c, _Traits*)
+{ return _STLP_STD::find_if(__f, __l, _STLP_PRIV _Eq_char_bound<_Traits>(__c)); }
+
+template <class _CharT, class _Traits>
+inline const _CharT* __str_rfind(const _CharT* __f, const _CharT* __l, _CharT __c, _Traits*) {
+  for (const _CharT* __p = __l; __p != __f; ) {
+    if (_Traits::eq(*--__p, __c))
+      return __p;
+  }
+  return __l;
+}
+
+template <class _CharT, class _Traits>
+inline const _CharT* __str_search(const _CharT* __f, const _CharT* __l,
+                                  const _CharT* __s, size_t __n, _Traits*)
+{ return _STLP_STD::search(__f, __l, __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>()); }
+
+template <class _CharT, class _Traits>
+inline const _CharT* __str_rsearch(const _CharT* __f, const _CharT* __l,
+                                   const _CharT* __s, size_t __n, _Traits*)
+{ return _STLP_STD::find_end(__f, __l, __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>()); }
+
+// first char that is in [__s, __s + __n) if __in, or that is not otherwise
+template <class _CharT, class _Traits>
+inline const _CharT* __str_find_of(const _CharT* __f, const _CharT* __l,
+                                   const _CharT* __s, size_t __n, bool __in, _Traits* __traits) {
+  return __in ? __str_find_first_of(__f, __l, __s, __s + __n, __traits) :
+                __str_find_first_not_of(__f, __l, __s, __s + __n, __traits);
+}
+
+template <class _CharT, class _Traits>
+inline const _CharT* __str_rfind_of(const _CharT* __f, const _CharT* __l,
+                                    const _CharT* __s, size_t __n, bool __in, _Traits*) {
+  for (const _CharT* __p = __l; __p != __f; ) {
+    --__p;
+    if ((_Traits::find(__s, __n, *__p) != 0) == __in)
+      return __p;
+  }
+  return __l;
+}
+
+#if !defined (_STLP_USE_NO_IOSTREAMS)
+inline const char* __str_find(const char* __f, const char* __l, char __c, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_find(__f, __l - __f, __c);
+  return __r != 0 ? __r : __l;
+}
+
+inline const char* __str_rfind(const char* __f, const char* __l, char __c, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_rfind(__f, __l - __f, __c);
+  return __r != 0 ? __r : __l;
+}
+
+inline const char* __str_search(const char* __f, const char* __l,
+                                const char* __s, size_t __n, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_search(__f, __l - __f, __s, __n);
+  return __r != 0 ? __r : __l;
+}
+
+inline const char* __str_rsearch(const char* __f, const char* __l,
+                                 const char* __s, size_t __n, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_rsearch(__f, __l - __f, __s, __n);
+  return __r != 0 ? __r : __l;
+}
+
+inline const char* __str_find_of(const char* __f, const char* __l,
+                                 const char* __s, size_t __n, bool __in, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_find_of(__f, __l - __f, __s, __n, __in);
+  return __r != 0 ? __r : __l;
+}
+
+inline const char* __str_rfind_of(const char* __f, const char* __l,
+                                  const char* __s, size_t __n, bool __in, _STLP_STD::char_traits<char>*) {
+  const char* __r = _Char_search::_S_rfind_of(__f, __l - __f, __s, __n, __in);
+  return __r != 0 ? __r : __l;
+}
+#endif /* _STLP_USE_NO_IOSTREAMS */
+
 // ------------------------------------------------------------
 // Non-inline declarations.
 
@@ -407,8 +488,8 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::find( const _CharT* __s, size
   }
 
   const_pointer __result =
-    _STLP_STD::search(this->_M_Start() + __pos, this->_M_Finish(),
-                      __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>());
+    _STLP_PRIV __str_search(this->_M_Start() + __pos, this->_M_Finish(),
+                            __s, __n, __STATIC_CAST(_Traits*, 0));
   return __result != this->_M_Finish() ? __result - this->_M_Start() : npos;
 }
 
@@ -420,8 +501,8 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::find(_CharT __c, size_type __
   }
 
   const_pointer __result =
-    _STLP_STD::find_if(this->_M_Start() + __pos, this->_M_Finish(),
-                       _STLP_PRIV _Eq_char_bound<_Traits>(__c));
+    _STLP_PRIV __str_find(this->_M_Start() + __pos, this->_M_Finish(),
+                          __c, __STATIC_CAST(_Traits*, 0));
   return __result != this->_M_Finish() ? __result - this->_M_Start() : npos;
 }
 
@@ -437,8 +518,8 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::rfind(const _CharT* __s, size
   if ( __n == 0 ) { // marginal case
     return __last - this->_M_Start();
   }
-  const_pointer __result = _STLP_STD::find_end(this->_M_Start(), __last,
-                                               __s, __s + __n, _STLP_PRIV _Eq_traits<_Traits>());
+  const_pointer __result = _STLP_PRIV __str_rsearch(this->_M_Start(), __last,
+                                                    __s, __n, __STATIC_CAST(_Traits*, 0));
   return __result != __last ? __result - this->_M_Start() : npos;
 }
 
@@ -449,11 +530,10 @@ __size_type__ basic_string<_CharT,_Traits,_Alloc>::rfind(_CharT __c, size_type _
   if ( __len < 1 ) {
     return npos;
   }
-  const_iterator __last = begin() + (min)(__len - 1, __pos) + 1;
-  const_reverse_iterator __rresult =
-    _STLP_STD::find_if(const_reverse_iterator(__last), rend(),
-                       _STLP_PRIV _Eq_char_bound<_Traits>(__c));
-  return __rresult != rend() ? (__rresult.base() - 1) - begin() : npos;
+  const_pointer __last = this->_M_Start() + (min)(__len - 1, __pos) + 1;
+  const_pointer __result = _STLP_PRIV __str_rfind(this->_M_Start(), __last,
+                                                  __c, __STATIC_CAST(_Traits*, 0));
+  return __result != __last ? __result - this->_M_Start() : npos;
 }
 
 template <class _CharT, class _Traits, class _Alloc> __size_type__
@@ -462,10 +542,10 @@ basic_string<_CharT,_Traits,_Alloc> ::find_first_of(const _CharT* __s, size_type
   if (__pos >= size()) /*__pos + 1 > size()*/
     return npos;
   else {
-    const_iterator __result = _STLP_PRIV __str_find_first_of(begin() + __pos, end(),
-                                                             __s, __s + __n,
-                                                             __STATIC_CAST(_Traits*, 0));
-    return __result != end() ? __result - begin() : npos;
+    const_pointer __result = _STLP_PRIV __str_find_of(this->_M_Start() + __pos, this->_M_Finish(),
+                                                      __s, __n, true,
+                                                      __STATIC_CAST(_Traits*, 0));
+    return __result != this->_M_Finish() ? __result - this->_M_Start() : npos;
   }
 }
 
@@ -478,12 +558,11 @@ basic_string<_CharT,_Traits,_Alloc> ::find_last_of(const _CharT* __s, size_type
   if ( __len < 1 ) {
     return npos;
   }
-  const const_iterator __last = begin() + (min)(__len - 1, __pos) + 1;
-  const const_reverse_iterator __rresult =
-    _STLP_PRIV __str_find_first_of(const_reverse_iterator(__last), rend(),
-                                   __s, __s + __n,
-                                   __STATIC_CAST(_Traits*, 0));
-  return __rresult != rend() ? (__rresult.base() - 1) - begin() : npos;
+  const const_pointer __last = this->_M_Start() + (min)(__len - 1, __pos) + 1;
+  const const_pointer __result = _STLP_PRIV __str_rfind_of(this->_M_Start(), __last,
+                                                           __s, __n, true,
+                                                           __STATIC_CAST(_Traits*, 0));
+  return __result != __last ? __result - this->_M_Start() : npos;
 }
 
 
@@ -494,21 +573,20 @@ basic_string<_CharT,_Traits,_Alloc> ::find_first_not_of(const _CharT* __s, size_
   if (__pos >= size()) /*__pos + 1 >= size()*/
     return npos;
   else {
-    const_pointer __result = _STLP_PRIV __str_find_first_not_of(this->_M_Start() + __pos, this->_M_Finish(),
-                                                                __STATIC_CAST(const _CharType*, __s),
-                                                                __STATIC_CAST(const _CharType*, __s) + __n,
-                                                                __STATIC_CAST(_Traits*, 0));
+    const_pointer __result = _STLP_PRIV __str_find_of(this->_M_Start() + __pos, this->_M_Finish(),
+                                                      __STATIC_CAST(const _CharType*, __s), __n, false,
+                                                      __STATIC_CAST(_Traits*, 0));
     return __result != this->_M_finish ? __result - this->_M_Start() : npos;
   }
 }
 
 template <class _CharT, class _Traits, class _Alloc> __size_type__
 basic_string<_CharT,_Traits,_Alloc> ::find_first_not_of(_CharT __c, size_type __pos) const {
-  if (1 > size())
+  if (__pos >= size()) /*__pos + 1 > size()*/
     return npos;
   else {
-    const_pointer __result = _STLP_STD::find_if(this->_M_Start() + __pos, this->_M_Finish(),
-                                                _STLP_PRIV _Neq_char_bound<_Traits>(__c));
+    const_pointer __result = _STLP_PRIV __str_find_of(this->_M_Start() + __pos, this->_M_Finish(),
+                                                      &__c, 1, false, __STATIC_CAST(_Traits*, 0));
     return __result != this->_M_finish ? __result - this->_M_Start() : npos;
   }
 }
@@ -522,14 +600,11 @@ basic_string<_CharT,_Traits,_Alloc>::find_last_not_of(const _CharT* __s, size_ty
   if ( __len < 1 ) {
     return npos;
   }
-  const_iterator __last = begin() + (min)(__len - 1, __pos) + 1;
-  const_reverse_iterator __rlast = const_reverse_iterator(__last);
-  const_reverse_iterator __rresult =
-    _STLP_PRIV __str_find_first_not_of(__rlast, rend(),
-                                       __STATIC_CAST(const _CharType*, __s),
-                                       __STATIC_CAST(const _CharType*, __s) + __n,
-                                       __STATIC_CAST(_Traits*, 0));
-  return __rresult != rend() ? (__rresult.base() - 1) - begin() : npos;
+  const_pointer __last = this->_M_Start() + (min)(__len - 1, __pos) + 1;
+  const_pointer __result = _STLP_PRIV __str_rfind_of(this->_M_Start(), __last,
+                                                     __STATIC_CAST(const _CharType*, __s), __n, false,
+                                                     __STATIC_CAST(_Traits*, 0));
+  return __result != __last ? __result - this->_M_Start() : npos;
 }
 
 template <class _CharT, class _Traits, class _Alloc>
@@ -540,12 +615,10 @@ basic_string<_CharT, _Traits, _Alloc>::find_last_not_of(_CharT __c, size_type __
   if ( __len < 1 ) {
     return npos;
   }
-  const_iterator __last = begin() + (min)(__len - 1, __pos) + 1;
-  const_reverse_iterator __rlast = const_reverse_iterator(__last);
-  const_reverse_iterator __rresult =
-    _STLP_STD::find_if(__rlast, rend(),
-                       _STLP_PRIV _Neq_char_bound<_Traits>(__c));
-  return __rresult != rend() ? (__rresult.base() - 1) - begin() : npos;
+  const_pointer __last = this->_M_Start() + (min)(__len - 1, __pos) + 1;
+  const_pointer __result = _STLP_PRIV __str_rfind_of(this->_M_Start(), __last,
+                                                     &__c, 1, false, __STATIC_CAST(_Traits*, 0));
+  return __result != __last ? __result - this->_M_Start() : npos;
 }
 
 #if !defined (basic_string)
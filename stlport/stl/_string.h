@@ -261,6 +261,15 @@ public:
     return *this;
   }
 
+  // Moved-from string is left empty (it may keep storage of *this).
+  _Self& operator=(_Self&& __s) {
+    if (&__s != this) {
+      this->_M_swap(__s);
+      __s.clear();
+    }
+    return *this;
+  }
+
   _Self& operator=(const _CharT* __s) {
     _STLP_FIX_LITERAL_BUG(__s)
     return _M_assign(__s, __s + traits_type::length(__s));
@@ -50,7 +50,19 @@ class _String_base
     typedef size_t size_type;
 
   protected:
+#if defined (_STLP_USE_SHORT_STRING_OPTIM)
+    /* Inline buffer is measured in bytes, not in characters: it share
+     * storage with _M_end_of_storage and take 4 pointers whatever the
+     * character type is, so basic_string<char> keep 31 chars inline
+     * (15 on 32-bit targets) and wide strings are not bloated.
+     * Character types wider than that still keep room for one character
+     * and the terminating null.
+     */
+    static const size_type _DEFAULT_SIZE = (4 * sizeof( void * )) / sizeof(_Tp) < 2 ?
+                                           2 : (4 * sizeof( void * )) / sizeof(_Tp);
+#else
     static const size_type _DEFAULT_SIZE = 4 * sizeof( void * );
+#endif
   private:
 #if defined (_STLP_USE_SHORT_STRING_OPTIM)
   union _Buffers
@@ -155,7 +167,7 @@ class _String_base
     _String_base(_String_base&& x) :
 #if defined (_STLP_USE_SHORT_STRING_OPTIM)
         _M_finish(_M_buffers._M_static_buf),
-        _M_start_of_storage( allocator_type(), _M_buffers._M_static_buf)
+        _M_start_of_storage((const allocator_type&)x._M_start_of_storage, _M_buffers._M_static_buf)
 #else
         _M_end_of_storage(0),
         _M_finish(0),
@@ -163,7 +175,7 @@ class _String_base
 #endif
       {
 #if defined (_STLP_USE_SHORT_STRING_OPTIM)
-# error "mot implemented"
+        _M_steal(x);
 #else
         _STLP_PRIV __swap(_M_end_of_storage, x._M_end_of_storage);
         _STLP_PRIV __swap(_M_start_of_storage._M_data, x._M_start_of_storage._M_data);
@@ -185,6 +197,26 @@ class _String_base
         _M_start_of_storage._M_data = __start;
       }
 
+#if defined (_STLP_USE_SHORT_STRING_OPTIM)
+    // Take content of __s (allocators are assumed equal); __s become empty.
+    // Short string is copied (buffer is few words), long one is stolen.
+    void _M_steal( _Self& __s )
+      {
+        if (__s._M_using_static_buf()) {
+          _M_buffers = __s._M_buffers;
+          _M_finish = _M_buffers._M_static_buf + (__s._M_finish - __s._M_buffers._M_static_buf);
+          _M_start_of_storage._M_data = _M_buffers._M_static_buf;
+        } else {
+          _M_buffers._M_end_of_storage = __s._M_buffers._M_end_of_storage;
+          _M_start_of_storage._M_data = __s._M_start_of_storage._M_data;
+          _M_finish = __s._M_finish;
+          __s._M_start_of_storage._M_data = __s._M_buffers._M_static_buf;
+        }
+        __s._M_finish = __s._M_buffers._M_static_buf;
+        *__s._M_finish = _Tp();
+      }
+#endif
+
     void _M_swap( _Self& __s )
       {
         if ( static_cast<allocator_type&>(_M_start_of_storage) != static_cast<allocator_type&>(__s._M_start_of_storage) ) {
@@ -35,6 +35,10 @@ template <class _CharT, class _Traits, class _Alloc>
 inline size_t
 __stl_string_hash(const basic_string<_CharT,_Traits,_Alloc>& __s)
 {
+#if !defined (_STLP_USE_LEGACY_STRING_HASH)
+  // length is known, no need to look for terminator
+  return _STLP_PRIV __stl_hash_bytes(__s.data(), __s.size() * sizeof(_CharT));
+#else
   uint32_t __h = 0;
   size_t __len = __s.size();
   const _CharT* __data = __s.data();
@@ -43,6 +47,7 @@ __stl_string_hash(const basic_string<_CharT,_Traits,_Alloc>& __s)
   }
 
   return size_t(__h);
+#endif
 }
 
 template <class _CharT, class _Traits, class _Alloc>
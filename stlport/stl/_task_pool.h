@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_TASK_POOL_H
+#define _STLP_INTERNAL_TASK_POOL_H
+
+#include <cstddef>
+#include <atomic>
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Tasks of parallel algorithms. Library keeps pool of worker threads
+ * (one less than online CPUs), started on first use. Every worker
+ * has own deque of tasks: worker push and pop tasks at back, idle
+ * workers steal oldest (i.e. biggest) tasks from front of other deques.
+ * Tasks spawned by other threads go to shared queue.
+ *
+ * Tasks are spawned within _Task_group. Group created with concurrency
+ * limit n admit at most n threads (own thread included) to its tasks;
+ * nested groups share limit with parent group. Thread that wait for
+ * group execute tasks of the same top-level group meanwhile.
+ *
+ * Task should not throw: exception terminate program, as for parallel
+ * algorithms.
+ */
+
+class _Task_arena;
+
+class _STLP_CLASS_DECLSPEC _Task_group
+{
+  public:
+    typedef void (*task_type)( void* );
+
+    // top-level group; concurrency 0 mean number of online CPUs
+    explicit _Task_group( size_t __concurrency );
+    // nested group
+    explicit _Task_group( _Task_group& __parent );
+    ~_Task_group();
+
+    // *__arg should live until wait() return
+    void run( task_type __task, void* __arg );
+    void wait();
+
+    // number of threads that may work on tasks of the group
+    size_t concurrency() const;
+
+    template <class _Job>
+    void run( _Job& __job )
+      { run( &_S_invoke<_Job>, static_cast<void*>(&__job) ); }
+
+  private:
+    template <class _Job>
+    static void _S_invoke( void* __p )
+      { (*static_cast<_Job*>(__p))(); }
+
+    _Task_arena* _M_arena;
+    bool _M_own_arena;
+    atomic<long> _M_pending;
+
+    friend class _Task_pool;
+
+    _Task_group( const _Task_group& );
+    _Task_group& operator =( const _Task_group& );
+};
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_TASK_POOL_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -300,6 +300,28 @@ _Rb_global<_Dummy>::_M_increment(_Rb_tree_node_base* _M_node) {
   return _M_node;
 }
 
+// Left subtree get (__n - 1) / 2 nodes, so sizes of siblings differ by one
+// at most, and all levels but the last one are full; red last level keep
+// black height the same on all paths.
+template <class _Dummy> _Rb_tree_node_base* _STLP_CALL
+_Rb_global<_Dummy>::_Build_tree(_Rb_tree_node_base*& __list, size_t __n,
+                                size_t __depth, size_t __red_depth) {
+  if (__n == 0)
+    return 0;
+  size_t __n_left = (__n - 1) / 2;
+  _Rb_tree_node_base* __left = _Build_tree(__list, __n_left, __depth + 1, __red_depth);
+  _Rb_tree_node_base* __x = __list;
+  __list = __list->_M_left;
+  __x->_M_left = __left;
+  if (__left != 0)
+    __left->_M_parent = __x;
+  __x->_M_right = _Build_tree(__list, __n - 1 - __n_left, __depth + 1, __red_depth);
+  if (__x->_M_right != 0)
+    __x->_M_right->_M_parent = __x;
+  __x->_M_color = __depth == __red_depth ? _S_rb_tree_red : _S_rb_tree_black;
+  return __x;
+}
+
 #endif /* _STLP_EXPOSE_GLOBALS_IMPLEMENTATION */
 
 
@@ -341,32 +363,236 @@ _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_insert(_Rb_tree_node_base
 {
   // We do not create the node here as, depending on tests, we might call
   // _M_key_compare that can throw an exception.
-  _Base_ptr __new_node;
+  bool __left = __parent == &this->_M_header._M_data ||
+                ( __on_right == 0 &&     // If __on_right != 0, the remainder fails to false
+                  ( __on_left != 0 ||    // If __on_left != 0, the remainder succeeds to true
+                    _M_key_compare( _KeyOfValue()(__val), _S_key(__parent) ) ) );
+  _Base_ptr __new_node = _M_create_node(__val);
+  _M_link_node(__new_node, __parent, __left);
+  return iterator(__new_node);
+}
 
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+void
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_link_node(_Rb_tree_node_base* __z,
+                                                                _Rb_tree_node_base* __parent,
+                                                                bool __left)
+{
   if ( __parent == &this->_M_header._M_data ) {
-    __new_node = _M_create_node(__val);
-    _S_left(__parent) = __new_node;   // also makes _M_leftmost() = __new_node
-    _M_root() = __new_node;
-    _M_rightmost() = __new_node;
-  }
-  else if ( __on_right == 0 &&     // If __on_right != 0, the remainder fails to false
-           ( __on_left != 0 ||     // If __on_left != 0, the remainder succeeds to true
-             _M_key_compare( _KeyOfValue()(__val), _S_key(__parent) ) ) ) {
-    __new_node = _M_create_node(__val);
-    _S_left(__parent) = __new_node;
+    _S_left(__parent) = __z;   // also makes _M_leftmost() = __z
+    _M_root() = __z;
+    _M_rightmost() = __z;
+  }
+  else if ( __left ) {
+    _S_left(__parent) = __z;
     if (__parent == _M_leftmost())
-      _M_leftmost() = __new_node;   // maintain _M_leftmost() pointing to min node
+      _M_leftmost() = __z;   // maintain _M_leftmost() pointing to min node
   }
   else {
-    __new_node = _M_create_node(__val);
-    _S_right(__parent) = __new_node;
+    _S_right(__parent) = __z;
     if (__parent == _M_rightmost())
-      _M_rightmost() = __new_node;  // maintain _M_rightmost() pointing to max node
+      _M_rightmost() = __z;  // maintain _M_rightmost() pointing to max node
   }
-  _S_parent(__new_node) = __parent;
-  _Rb_global_inst::_Rebalance(__new_node, this->_M_header._M_data._M_parent);
+  _S_parent(__z) = __parent;
+  _Rb_global_inst::_Rebalance(__z, this->_M_header._M_data._M_parent);
   ++_M_node_count;
-  return iterator(__new_node);
+}
+
+// Link __z just before __pos; caller checked the order
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+void
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_link_before(_Rb_tree_node_base* __pos,
+                                                                  _Rb_tree_node_base* __z)
+{
+  if (__pos == &this->_M_header._M_data) {
+    if (_M_root() == 0)
+      _M_link_node(__z, __pos, true);
+    else
+      _M_link_node(__z, _M_rightmost(), false);
+  }
+  else if (_S_left(__pos) == 0)
+    _M_link_node(__z, __pos, true);
+  else // predecessor is the rightmost node of left subtree
+    _M_link_node(__z, _S_maximum(_S_left(__pos)), false);
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+_Rb_tree_node_base*
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_unlink(_Rb_tree_node_base* __z)
+{
+  _Base_ptr __x = _Rb_global_inst::_Rebalance_for_erase(__z,
+                                                        this->_M_header._M_data._M_parent,
+                                                        this->_M_header._M_data._M_left,
+                                                        this->_M_header._M_data._M_right);
+  _S_left(__x) = 0;
+  _S_right(__x) = 0;
+  --_M_node_count;
+  return __x;
+}
+
+// Where node with key __k should be linked; if there is node with
+// equivalent key already, return it.
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+_Rb_tree_node_base*
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_unique_pos(const key_type& __k,
+                                                                 _Rb_tree_node_base*& __parent,
+                                                                 bool& __left)
+{
+  _Base_ptr __y = &this->_M_header._M_data;
+  _Base_ptr __x = _M_root();
+  bool __comp = true;
+  while (__x != 0) {
+    __y = __x;
+    __comp = _M_key_compare(__k, _S_key(__x));
+    __x = __comp ? _S_left(__x) : _S_right(__x);
+  }
+  __parent = __y;
+  __left = __comp;
+  if (__comp) {
+    if (__y == _M_leftmost())
+      return 0;
+    __y = _Rb_global_inst::_M_decrement(__y);
+  }
+  return _M_key_compare(_S_key(__y), __k) ? 0 : __y;
+}
+
+// Build tree from sorted prefix of input; tree should be empty.
+// Return the first element that is out of order.
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+template <class _II>
+_II _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_bulk_load(_II __first, _II __last, bool __unique)
+{
+  // nodes are linked through _M_left: _M_erase free such list without
+  // recursion
+  _Base_ptr __head = 0;
+  _Base_ptr __tail = 0;
+  size_type __n = 0;
+  _STLP_TRY {
+    for ( ; __first != __last; ++__first) {
+      if (__tail != 0) {
+        if (_M_key_compare(_KeyOfValue()(*__first), _S_key(__tail)))
+          break;
+        if (__unique && !_M_key_compare(_S_key(__tail), _KeyOfValue()(*__first)))
+          continue; // equivalent to previous one
+      }
+      _Base_ptr __z = _M_create_node(*__first);
+      if (__tail == 0)
+        __head = __z;
+      else
+        _S_left(__tail) = __z;
+      __tail = __z;
+      ++__n;
+    }
+  }
+  _STLP_UNWIND(_M_erase(__head))
+
+  if (__n != 0) {
+    size_type __red_depth = 0;
+    for (size_type __i = __n; __i > 1; __i >>= 1)
+      ++__red_depth;
+    _M_leftmost() = __head;
+    _M_rightmost() = __tail;
+    _M_root() = _Rb_global_inst::_Build_tree(__head, __n, 0, __red_depth);
+    _S_parent(_M_root()) = &this->_M_header._M_data;
+    _S_color(_M_root()) = _S_rb_tree_black;
+    _M_node_count = __n;
+  }
+  return __first;
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+pair<typename _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::iterator, bool>
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_insert_node_unique(_Rb_tree_node_base* __z)
+{
+  _Base_ptr __parent;
+  bool __left;
+  _Base_ptr __y = _M_unique_pos(_S_key(__z), __parent, __left);
+  if (__y != 0)
+    return pair<iterator,bool>(iterator(__y), false);
+  _M_link_node(__z, __parent, __left);
+  return pair<iterator,bool>(iterator(__z), true);
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+pair<typename _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::iterator, bool>
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_insert_node_unique(iterator __position,
+                                                                         _Rb_tree_node_base* __z)
+{
+  _Base_ptr __pos = __position._M_node;
+  if ((__pos == &this->_M_header._M_data || _M_key_compare(_S_key(__z), _S_key(__pos))) &&
+      (__pos == _M_leftmost() ||
+       _M_key_compare(_S_key(_Rb_global_inst::_M_decrement(__pos)), _S_key(__z)))) {
+    _M_link_before(__pos, __z);
+    return pair<iterator,bool>(iterator(__z), true);
+  }
+  return _M_insert_node_unique(__z);
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+typename _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::iterator
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_insert_node_equal(_Rb_tree_node_base* __z)
+{
+  _Base_ptr __y = &this->_M_header._M_data;
+  _Base_ptr __x = _M_root();
+  bool __left = true;
+  while (__x != 0) {
+    __y = __x;
+    __left = _M_key_compare(_S_key(__z), _S_key(__x));
+    __x = __left ? _S_left(__x) : _S_right(__x);
+  }
+  _M_link_node(__z, __y, __left);
+  return iterator(__z);
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+typename _Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::iterator
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_insert_node_equal(iterator __position,
+                                                                        _Rb_tree_node_base* __z)
+{
+  _Base_ptr __pos = __position._M_node;
+  if ((__pos == &this->_M_header._M_data || !_M_key_compare(_S_key(__pos), _S_key(__z))) &&
+      (__pos == _M_leftmost() ||
+       !_M_key_compare(_S_key(__z), _S_key(_Rb_global_inst::_M_decrement(__pos))))) {
+    _M_link_before(__pos, __z);
+    return iterator(__z);
+  }
+  return _M_insert_node_equal(__z);
+}
+
+// Nodes with keys that are absent in *this are moved from __src
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+template <class _Compare2>
+void
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_merge_unique(_Rb_tree<_Key,_Compare2,_Value,_KeyOfValue,_Alloc>& __src)
+{
+  if (static_cast<void*>(&__src) == static_cast<void*>(this))
+    return;
+  _Base_ptr __end = &__src._M_header._M_data;
+  _Base_ptr __x = __src._M_leftmost();
+  while (__x != __end) {
+    _Base_ptr __next = _Rb_global_inst::_M_increment(__x);
+    _Base_ptr __parent;
+    bool __left;
+    if (_M_unique_pos(_S_key(__x), __parent, __left) == 0)
+      _M_link_node(__src._M_unlink(__x), __parent, __left);
+    __x = __next;
+  }
+}
+
+template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
+template <class _Compare2>
+void
+_Rb_tree<_Key,_Compare,_Value,_KeyOfValue,_Alloc>::_M_merge_equal(_Rb_tree<_Key,_Compare2,_Value,_KeyOfValue,_Alloc>& __src)
+{
+  if (static_cast<void*>(&__src) == static_cast<void*>(this))
+    return;
+  _Base_ptr __end = &__src._M_header._M_data;
+  _Base_ptr __x = __src._M_leftmost();
+  while (__x != __end) {
+    _Base_ptr __next = _Rb_global_inst::_M_increment(__x);
+    _M_insert_node_equal(__src._M_unlink(__x));
+    __x = __next;
+  }
 }
 
 template <class _Key, class _Compare, class _Value, class _KeyOfValue, class _Alloc>
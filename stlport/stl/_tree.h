@@ -121,6 +121,10 @@ public:
   static _Base_ptr  _STLP_CALL _M_decrement (_Base_ptr);
   static void       _STLP_CALL _Rotate_left (_Base_ptr __x, _Base_ptr& __root);
   static void       _STLP_CALL _Rotate_right(_Base_ptr __x, _Base_ptr& __root);
+  // balanced tree of __n nodes, taken in order from list linked through _M_left;
+  // nodes at __red_depth are red, others black
+  static _Base_ptr  _STLP_CALL _Build_tree(_Base_ptr& __list, size_t __n,
+                                           size_t __depth, size_t __red_depth);
 };
 
 # if defined (_STLP_USE_TEMPLATE_EXPORT)
@@ -288,6 +292,143 @@ class _Rb_tree_iterator<_Value const>
     friend class _Rb_tree_iterator<value_type>;
 };
 
+// Node taken out of tree by extract(): owns the node and value in it,
+// and give it to insert() of other container of the same type.
+
+template <class _Value, class _Alloc>
+class _Rb_tree_node_handle_base
+{
+  private:
+    typedef _Rb_tree_node_handle_base<_Value, _Alloc> _Self;
+    typedef _Rb_tree_node<_Value> _Node;
+    typedef typename _Alloc::template rebind<_Node>::other _Node_allocator_type;
+
+  public:
+    typedef _Alloc allocator_type;
+
+    _Rb_tree_node_handle_base() :
+        _M_node(0),
+        _M_alloc()
+      { }
+    _Rb_tree_node_handle_base(_Rb_tree_node_base* __node, const allocator_type& __a) :
+        _M_node(__node),
+        _M_alloc(__a)
+      { }
+    _Rb_tree_node_handle_base(_Self&& __x) :
+        _M_node(__x._M_node),
+        _M_alloc(__x._M_alloc)
+      { __x._M_node = 0; }
+
+    ~_Rb_tree_node_handle_base()
+      { _M_destroy(); }
+
+    _Self& operator =(_Self&& __x)
+      {
+        if (this != &__x) {
+          _M_destroy();
+          _M_node = __x._M_node;
+          _M_alloc = __x._M_alloc;
+          __x._M_node = 0;
+        }
+        return *this;
+      }
+
+    bool empty() const
+      { return _M_node == 0; }
+    explicit operator bool() const
+      { return _M_node != 0; }
+    allocator_type get_allocator() const
+      { return _M_alloc; }
+
+    void swap(_Self& __x)
+      {
+        _STLP_PRIV __swap(_M_node, __x._M_node);
+        _STLP_PRIV __swap(_M_alloc, __x._M_alloc);
+      }
+
+    _Rb_tree_node_base* _M_get() const
+      { return _M_node; }
+    // node is given to tree
+    _Rb_tree_node_base* _M_release()
+      {
+        _Rb_tree_node_base* __x = _M_node;
+        _M_node = 0;
+        return __x;
+      }
+
+  protected:
+    _Value& _M_value() const
+      { return static_cast<_Node*>(_M_node)->_M_value_field; }
+
+  private:
+    void _M_destroy()
+      {
+        if (_M_node != 0) {
+          _M_alloc.destroy(&_M_value());
+          _Node_allocator_type(_M_alloc).deallocate(static_cast<_Node*>(_M_node), 1);
+        }
+      }
+
+    _Rb_tree_node_base* _M_node;
+    allocator_type _M_alloc;
+
+    _Rb_tree_node_handle_base(const _Self&);
+    _Self& operator =(const _Self&);
+};
+
+template <class _Value, class _Alloc>
+class _Rb_tree_set_node_handle :
+    public _Rb_tree_node_handle_base<_Value, _Alloc>
+{
+  private:
+    typedef _Rb_tree_node_handle_base<_Value, _Alloc> _Base;
+
+  public:
+    typedef _Value value_type;
+
+    _Rb_tree_set_node_handle()
+      { }
+    _Rb_tree_set_node_handle(_Rb_tree_node_base* __node, const _Alloc& __a) :
+        _Base(__node, __a)
+      { }
+
+    value_type& value() const
+      { return this->_M_value(); }
+};
+
+template <class _Key, class _Tp, class _Alloc>
+class _Rb_tree_map_node_handle :
+    public _Rb_tree_node_handle_base<pair<_STLP_CONST _Key, _Tp>, _Alloc>
+{
+  private:
+    typedef _Rb_tree_node_handle_base<pair<_STLP_CONST _Key, _Tp>, _Alloc> _Base;
+
+  public:
+    typedef _Key key_type;
+    typedef _Tp mapped_type;
+
+    _Rb_tree_map_node_handle()
+      { }
+    _Rb_tree_map_node_handle(_Rb_tree_node_base* __node, const _Alloc& __a) :
+        _Base(__node, __a)
+      { }
+
+    // key may be changed while node is out of container
+    key_type& key() const
+      { return const_cast<key_type&>(this->_M_value().first); }
+    mapped_type& mapped() const
+      { return this->_M_value().second; }
+};
+
+// insert() of node handle into set or map
+template <class _Iterator, class _NodeHandle>
+struct _Rb_tree_insert_return
+{
+    _Iterator position;
+    bool inserted;
+    _NodeHandle node;
+};
+
 // Base class to help EH
 
 template <class _Tp, class _Alloc>
@@ -433,9 +574,17 @@ public:
 
 private:
   iterator _M_insert(_Base_ptr __parent, const value_type& __val, _Base_ptr __on_left = 0, _Base_ptr __on_right = 0);
+  void _M_link_node(_Base_ptr __z, _Base_ptr __parent, bool __left);
+  void _M_link_before(_Base_ptr __pos, _Base_ptr __z);
+  _Base_ptr _M_unlink(_Base_ptr __z);
+  _Base_ptr _M_unique_pos(const key_type& __k, _Base_ptr& __parent, bool& __left);
+  template <class _II> _II _M_bulk_load(_II __first, _II __last, bool __unique);
   _Base_ptr _M_copy(_Base_ptr __x, _Base_ptr __p);
   void _M_erase(_Base_ptr __x);
 
+  template <class _Key2, class _Compare2, class _Value2, class _KeyOfValue2, class _Alloc2>
+  friend class _Rb_tree;
+
 public:
                                 // allocation/deallocation
   _Rb_tree()
@@ -525,15 +674,42 @@ public:
   iterator insert_unique(iterator __pos, const value_type& __x);
   iterator insert_equal(iterator __pos, const value_type& __x);
 
+  // Sorted input go to empty tree without rebalancing. The rest is
+  // inserted with end() hint: equal element must go after ones already
+  // present, and hint next to previous element could put it before them;
+  // input that goes past rightmost element is still appended in O(1).
   template<class _II> void insert_equal(_II __first, _II __last) {
-    for ( ; __first != __last; ++__first)
-      insert_equal(*__first);
+    if (_M_node_count == 0)
+      __first = _M_bulk_load(__first, __last, false);
+    for ( ; __first != __last; ++__first) {
+      insert_equal(end(), *__first);
+    }
   }
+  // Unique input is inserted with hint next to previous element, that is
+  // right for sorted input and cost a few comparisons otherwise.
   template<class _II> void insert_unique(_II __first, _II __last) {
-    for ( ; __first != __last; ++__first)
-      insert_unique(*__first);
+    if (_M_node_count == 0)
+      __first = _M_bulk_load(__first, __last, true);
+    for (iterator __pos = end(); __first != __last; ++__first) {
+      __pos = insert_unique(__pos, *__first);
+      ++__pos;
+    }
   }
 
+                                // node transfer
+  _Base_ptr _M_extract(iterator __pos)
+  { return _M_unlink(__pos._M_node); }
+
+  pair<iterator,bool> _M_insert_node_unique(_Base_ptr __z);
+  pair<iterator,bool> _M_insert_node_unique(iterator __pos, _Base_ptr __z);
+  iterator _M_insert_node_equal(_Base_ptr __z);
+  iterator _M_insert_node_equal(iterator __pos, _Base_ptr __z);
+
+  template <class _Compare2>
+  void _M_merge_unique(_Rb_tree<_Key, _Compare2, _Value, _KeyOfValue, _Alloc>& __src);
+  template <class _Compare2>
+  void _M_merge_equal(_Rb_tree<_Key, _Compare2, _Value, _KeyOfValue, _Alloc>& __src);
+
   void erase(iterator __pos) {
     _Base_ptr __x = _Rb_global_inst::_Rebalance_for_erase(__pos._M_node,
                                                           this->_M_header._M_data._M_parent,
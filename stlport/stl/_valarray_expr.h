@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_VALARRAY_EXPR_H
+#define _STLP_INTERNAL_VALARRAY_EXPR_H
+
+#ifndef _STLP_INTERNAL_VALARRAY_SIMD_H
+#  include <stl/_valarray_simd.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+class slice;
+class gslice;
+template <class _Tp> class valarray;
+template <class _Tp, class _Clos> class _Valarray_expr;
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+/*
+ * Lazy valarray expressions. Arithmetic, logical operators and math
+ * functions of valarray return _Valarray_expr, that only refer to its
+ * operands (26.6.1/3 allow such replacement of valarray return type).
+ * Expression is evaluated when valarray is constructed or assigned from
+ * it: in single pass, without temporary arrays.
+ *
+ * Expression is tree of closures: _Va_ref (elements of valarray),
+ * _Va_scalar, _Va_unary and _Va_binary (operation _Op on results of
+ * subexpressions). Closure return element i by operator[]. If all nodes
+ * of expression have SIMD variant for element type (_S_simd), closure
+ * also return packet of elements from i by _M_packet, and expression is
+ * evaluated by packets.
+ *
+ * Expression refer to valarrays, so it should not outlive them (don't
+ * keep it in 'auto' variable if operands are temporaries).
+ */
+
+template <class _Tp>
+struct _Va_simd_any
+{ enum { _S_on = _Va_packet<_Tp>::_S_width != 0 }; };
+
+template <class _Tp>
+struct _Va_simd_floating
+{ enum { _S_on = _Va_packet<_Tp>::_S_floating }; };
+
+template <class _Tp>
+struct _Va_simd_integral
+{ enum { _S_on = _Va_packet<_Tp>::_S_integral }; };
+
+template <class _Tp>
+struct _Va_simd_none
+{ enum { _S_on = 0 }; };
+
+// Math functions on single element; float and double use the same
+// kernels as packets, if any (see _valarray_simd.h)
+
+template <class _Tp>
+inline _Tp __va_exp( const _Tp& __x )
+{ return ::exp( __x ); }
+
+template <class _Tp>
+inline _Tp __va_log( const _Tp& __x )
+{ return ::log( __x ); }
+
+template <class _Tp>
+inline _Tp __va_sin( const _Tp& __x )
+{ return ::sin( __x ); }
+
+template <class _Tp>
+inline _Tp __va_cos( const _Tp& __x )
+{ return ::cos( __x ); }
+
+#if defined (_STLP_VALARRAY_SIMD)
+
+inline double __va_exp( double __x )
+{ return _Va_math<double>::_S_exp( _Va_math<double>::_S_set1( __x ) )[0]; }
+
+inline double __va_log( double __x )
+{ return _Va_math<double>::_S_log( _Va_math<double>::_S_set1( __x ) )[0]; }
+
+inline double __va_sin( double __x )
+{ return _Va_math<double>::_S_sin( _Va_math<double>::_S_set1( __x ) )[0]; }
+
+inline double __va_cos( double __x )
+{ return _Va_math<double>::_S_cos( _Va_math<double>::_S_set1( __x ) )[0]; }
+
+inline float __va_exp( float __x )
+{ return _Va_math<float>::_S_exp( _Va_math<float>::_S_set1( __x ) )[0]; }
+
+inline float __va_log( float __x )
+{ return _Va_math<float>::_S_log( _Va_math<float>::_S_set1( __x ) )[0]; }
+
+inline float __va_sin( float __x )
+{ return _Va_math<float>::_S_sin( _Va_math<float>::_S_set1( __x ) )[0]; }
+
+inline float __va_cos( float __x )
+{ return _Va_math<float>::_S_cos( _Va_math<float>::_S_set1( __x ) )[0]; }
+
+#endif /* _STLP_VALARRAY_SIMD */
+
+// Operations: _S_apply on elements, _S_packet on packets of _Tp,
+// _Simd<_Tp>::_S_on tell whether _S_packet is available
+
+#define _STLP_VA_BINARY_OP(_Name, _Expr, _Simd_on)                        \
+struct _Name                                                               \
+{                                                                          \
+    template <class _Tp>                                                   \
+    struct _Simd : public _Simd_on<_Tp> { };                               \
+                                                                           \
+    template <class _Tp>                                                   \
+    static _Tp _S_apply( const _Tp& __x, const _Tp& __y )                  \
+      { return _Expr; }                                                    \
+                                                                           \
+    template <class _Tp>                                                   \
+    static typename _Va_packet<_Tp>::_Type                                 \
+    _S_packet( typename _Va_packet<_Tp>::_Type __x,                        \
+               typename _Va_packet<_Tp>::_Type __y )                       \
+      { return _Expr; }                                                    \
+};
+
+_STLP_VA_BINARY_OP(_Va_plus, __x + __y, _Va_simd_any)
+_STLP_VA_BINARY_OP(_Va_minus, __x - __y, _Va_simd_any)
+_STLP_VA_BINARY_OP(_Va_multiplies, __x * __y, _Va_simd_any)
+// integer division and shifts have no SIMD instructions
+_STLP_VA_BINARY_OP(_Va_divides, __x / __y, _Va_simd_floating)
+_STLP_VA_BINARY_OP(_Va_modulus, __x % __y, _Va_simd_none)
+_STLP_VA_BINARY_OP(_Va_bitwise_xor, __x ^ __y, _Va_simd_integral)
+_STLP_VA_BINARY_OP(_Va_bitwise_and, __x & __y, _Va_simd_integral)
+_STLP_VA_BINARY_OP(_Va_bitwise_or, __x | __y, _Va_simd_integral)
+_STLP_VA_BINARY_OP(_Va_shift_left, __x << __y, _Va_simd_none)
+_STLP_VA_BINARY_OP(_Va_shift_right, __x >> __y, _Va_simd_none)
+_STLP_VA_BINARY_OP(_Va_atan2, ::atan2( __x, __y ), _Va_simd_none)
+_STLP_VA_BINARY_OP(_Va_pow, ::pow( __x, __y ), _Va_simd_none)
+
+#undef _STLP_VA_BINARY_OP
+
+#define _STLP_VA_PREDICATE(_Name, _Expr)                                   \
+struct _Name                                                               \
+{                                                                          \
+    template <class _Tp>                                                   \
+    struct _Simd : public _Va_simd_none<_Tp> { };                          \
+                                                                           \
+    template <class _Tp>                                                   \
+    static bool _S_apply( const _Tp& __x, const _Tp& __y )                 \
+      { return _Expr; }                                                    \
+                                                                           \
+    template <class _Tp>                                                   \
+    static typename _Va_packet<_Tp>::_Type                                 \
+    _S_packet( typename _Va_packet<_Tp>::_Type __x,                        \
+               typename _Va_packet<_Tp>::_Type __y );                      \
+};
+
+_STLP_VA_PREDICATE(_Va_equal_to, __x == __y)
+_STLP_VA_PREDICATE(_Va_not_equal_to, __x != __y)
+_STLP_VA_PREDICATE(_Va_less, __x < __y)
+_STLP_VA_PREDICATE(_Va_greater, __x > __y)
+_STLP_VA_PREDICATE(_Va_less_equal, __x <= __y)
+_STLP_VA_PREDICATE(_Va_greater_equal, __x >= __y)
+_STLP_VA_PREDICATE(_Va_logical_and, __x && __y)
+_STLP_VA_PREDICATE(_Va_logical_or, __x || __y)
+
+#undef _STLP_VA_PREDICATE
+
+#define _STLP_VA_UNARY_OP(_Name, _Res, _Expr, _Packet, _Simd_on)           \
+struct _Name                                                               \
+{                                                                          \
+    template <class _Tp>                                                   \
+    struct _Simd : public _Simd_on<_Tp> { };                               \
+                                                                           \
+    template <class _Tp>                                                   \
+    static _Res _S_apply( const _Tp& __x )                                 \
+      { return _Expr; }                                                    \
+                                                                           \
+    template <class _Tp>                                                   \
+    static typename _Va_packet<_Tp>::_Type                                 \
+    _S_packet( typename _Va_packet<_Tp>::_Type __x )                       \
+      { return _Packet; }                                                  \
+};
+
+_STLP_VA_UNARY_OP(_Va_negate, _Tp, -__x, -__x, _Va_simd_any)
+_STLP_VA_UNARY_OP(_Va_bitwise_not, _Tp, ~__x, ~__x, _Va_simd_integral)
+_STLP_VA_UNARY_OP(_Va_logical_not, bool, !__x, __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_abs, _Tp, ::abs( __x ), _Va_math<_Tp>::_S_abs( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_sqrt, _Tp, ::sqrt( __x ), _Va_math<_Tp>::_S_sqrt( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_exp, _Tp, __va_exp( __x ), _Va_math<_Tp>::_S_exp( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_log, _Tp, __va_log( __x ), _Va_math<_Tp>::_S_log( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_sin, _Tp, __va_sin( __x ), _Va_math<_Tp>::_S_sin( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_cos, _Tp, __va_cos( __x ), _Va_math<_Tp>::_S_cos( __x ), _Va_simd_floating)
+_STLP_VA_UNARY_OP(_Va_acos, _Tp, ::acos( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_asin, _Tp, ::asin( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_atan, _Tp, ::atan( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_cosh, _Tp, ::cosh( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_log10, _Tp, ::log10( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_sinh, _Tp, ::sinh( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_tan, _Tp, ::tan( __x ), __x, _Va_simd_none)
+_STLP_VA_UNARY_OP(_Va_tanh, _Tp, ::tanh( __x ), __x, _Va_simd_none)
+
+#undef _STLP_VA_UNARY_OP
+
+// Closures
+
+template <class _Tp>
+class _Va_ref
+{
+  public:
+    typedef _Tp value_type;
+    typedef typename _Va_packet<_Tp>::_Type _Packet;
+    enum { _S_simd = _Va_packet<_Tp>::_S_width != 0 };
+
+    explicit _Va_ref( const valarray<_Tp>& __x ) :
+        _M_first( __x._M_first ),
+        _M_size( __x._M_size )
+      { }
+
+    value_type operator[]( size_t __i ) const
+      { return _M_first[__i]; }
+
+    size_t size() const
+      { return _M_size; }
+
+    _Packet _M_packet( size_t __i ) const
+      { return _Va_packet<_Tp>::_S_load( _M_first + __i ); }
+
+  private:
+    const _Tp* _M_first;
+    size_t _M_size;
+};
+
+template <class _Tp>
+class _Va_scalar
+{
+  public:
+    typedef _Tp value_type;
+    typedef typename _Va_packet<_Tp>::_Type _Packet;
+    enum { _S_simd = _Va_packet<_Tp>::_S_width != 0 };
+
+    // __n: size of other operand
+    _Va_scalar( const _Tp& __c, size_t __n ) :
+        _M_c( __c ),
+        _M_size( __n )
+      { }
+
+    value_type operator[]( size_t ) const
+      { return _M_c; }
+
+    size_t size() const
+      { return _M_size; }
+
+    _Packet _M_packet( size_t ) const
+      { return _Va_packet<_Tp>::_S_set1( _M_c ); }
+
+  private:
+    _Tp _M_c;
+    size_t _M_size;
+};
+
+template <class _Res, class _Op, class _Cl>
+class _Va_unary
+{
+  public:
+    typedef _Res value_type;
+    typedef typename _Va_packet<_Res>::_Type _Packet;
+    enum { _S_simd = _Cl::_S_simd && _Op::template _Simd<_Res>::_S_on };
+
+    explicit _Va_unary( const _Cl& __x ) :
+        _M_x( __x )
+      { }
+
+    value_type operator[]( size_t __i ) const
+      { return _Op::_S_apply( _M_x[__i] ); }
+
+    size_t size() const
+      { return _M_x.size(); }
+
+    _Packet _M_packet( size_t __i ) const
+      { return _Op::template _S_packet<_Res>( _M_x._M_packet( __i ) ); }
+
+  private:
+    _Cl _M_x;
+};
+
+template <class _Res, class _Op, class _Cl1, class _Cl2>
+class _Va_binary
+{
+  public:
+    typedef _Res value_type;
+    typedef typename _Va_packet<_Res>::_Type _Packet;
+    enum { _S_simd = _Cl1::_S_simd && _Cl2::_S_simd && _Op::template _Simd<_Res>::_S_on };
+
+    _Va_binary( const _Cl1& __x, const _Cl2& __y ) :
+        _M_x( __x ),
+        _M_y( __y )
+      { }
+
+    value_type operator[]( size_t __i ) const
+      { return _Op::_S_apply( _M_x[__i], _M_y[__i] ); }
+
+    size_t size() const
+      { return _M_x.size(); }
+
+    _Packet _M_packet( size_t __i ) const
+      { return _Op::template _S_packet<_Res>( _M_x._M_packet( __i ), _M_y._M_packet( __i ) ); }
+
+  private:
+    _Cl1 _M_x;
+    _Cl2 _M_y;
+};
+
+// Types of expressions: _Ret, and _S_make that build it from closures
+
+template <class _Res, class _Op, class _Cl>
+struct _Va_unary_expr
+{
+    typedef _Va_unary<_Res, _Op, _Cl> _Clos;
+    typedef _Valarray_expr<_Res, _Clos> _Ret;
+
+    static _Ret _S_make( const _Cl& __x )
+      { return _Ret( _Clos( __x ) ); }
+};
+
+template <class _Res, class _Op, class _Cl1, class _Cl2>
+struct _Va_binary_expr
+{
+    typedef _Va_binary<_Res, _Op, _Cl1, _Cl2> _Clos;
+    typedef _Valarray_expr<_Res, _Clos> _Ret;
+
+    static _Ret _S_make( const _Cl1& __x, const _Cl2& __y )
+      { return _Ret( _Clos( __x, __y ) ); }
+};
+
+// Evaluation: __dst[i] = __e[i], i in [0, __n)
+
+template <class _Tp, class _Clos>
+inline void __va_assign( _Tp* __dst, const _Clos& __e, size_t __n, const true_type& /* simd */ )
+{
+  typedef _Va_packet<_Tp> _Pk;
+  size_t __i = 0;
+  for ( ; __i + _Pk::_S_width <= __n; __i += _Pk::_S_width ) {
+    _Pk::_S_store( __dst + __i, __e._M_packet( __i ) );
+  }
+  for ( ; __i < __n; ++__i ) {
+    __dst[__i] = __e[__i];
+  }
+}
+
+template <class _Tp, class _Clos>
+inline void __va_assign( _Tp* __dst, const _Clos& __e, size_t __n, const false_type& /* simd */ )
+{
+  for ( size_t __i = 0; __i < __n; ++__i ) {
+    __dst[__i] = __e[__i];
+  }
+}
+
+template <class _Tp, class _Clos>
+inline void __va_assign( _Tp* __dst, const _Clos& __e, size_t __n )
+{ __va_assign( __dst, __e, __n, integral_constant<bool, _Clos::_S_simd>() ); }
+
+// The same on uninitialized __dst; SIMD types are trivial
+template <class _Tp, class _Clos>
+inline void __va_construct( _Tp* __dst, const _Clos& __e, size_t __n, const true_type& /* simd */ )
+{ __va_assign( __dst, __e, __n, true_type() ); }
+
+template <class _Tp, class _Clos>
+inline void __va_construct( _Tp* __dst, const _Clos& __e, size_t __n, const false_type& /* simd */ )
+{
+  size_t __i = 0;
+  _STLP_TRY {
+    for ( ; __i < __n; ++__i ) {
+      ::new (static_cast<void*>(__dst + __i)) _Tp( __e[__i] );
+    }
+  }
+  _STLP_UNWIND(_STLP_STD::detail::_Destroy_Range( __dst, __dst + __i ))
+}
+
+template <class _Tp, class _Clos>
+inline void __va_construct( _Tp* __dst, const _Clos& __e, size_t __n )
+{ __va_construct( __dst, __e, __n, integral_constant<bool, _Clos::_S_simd>() ); }
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+// Expression of valarray<_Tp> type; it has const members of valarray
+template <class _Tp, class _Clos>
+class _Valarray_expr
+{
+  public:
+    typedef _Tp value_type;
+
+    explicit _Valarray_expr( const _Clos& __c ) :
+        _M_c( __c )
+      { }
+
+    value_type operator[]( size_t __i ) const
+      { return _M_c[__i]; }
+
+    size_t size() const
+      { return _M_c.size(); }
+
+    valarray<_Tp> operator[]( const slice& __s ) const
+      { return valarray<_Tp>( *this )[__s]; }
+
+    valarray<_Tp> operator[]( const gslice& __s ) const
+      { return valarray<_Tp>( *this )[__s]; }
+
+    valarray<_Tp> operator[]( const valarray<bool>& __mask ) const
+      { return valarray<_Tp>( *this )[__mask]; }
+
+    valarray<_Tp> operator[]( const valarray<size_t>& __ind ) const
+      { return valarray<_Tp>( *this )[__ind]; }
+
+    typename _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Va_negate, _Clos>::_Ret operator -() const
+      { return _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Va_negate, _Clos>::_S_make( _M_c ); }
+
+    _Valarray_expr operator +() const
+      { return *this; }
+
+    typename _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Va_bitwise_not, _Clos>::_Ret operator ~() const
+      { return _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Va_bitwise_not, _Clos>::_S_make( _M_c ); }
+
+    typename _STLP_PRIV _Va_unary_expr<bool, _STLP_PRIV _Va_logical_not, _Clos>::_Ret operator !() const
+      { return _STLP_PRIV _Va_unary_expr<bool, _STLP_PRIV _Va_logical_not, _Clos>::_S_make( _M_c ); }
+
+    // The result is undefined for empty expressions
+    value_type sum() const
+      {
+        _STLP_ASSERT(size() != 0)
+        value_type __s = _M_c[0];
+        for ( size_t __i = 1; __i < size(); ++__i ) {
+          __s += _M_c[__i];
+        }
+        return __s;
+      }
+
+    value_type (min)() const
+      {
+        _STLP_ASSERT(size() != 0)
+        value_type __m = _M_c[0];
+        for ( size_t __i = 1; __i < size(); ++__i ) {
+          value_type __x = _M_c[__i];
+          if ( __x < __m ) {
+            __m = __x;
+          }
+        }
+        return __m;
+      }
+
+    value_type (max)() const
+      {
+        _STLP_ASSERT(size() != 0)
+        value_type __m = _M_c[0];
+        for ( size_t __i = 1; __i < size(); ++__i ) {
+          value_type __x = _M_c[__i];
+          if ( __m < __x ) {
+            __m = __x;
+          }
+        }
+        return __m;
+      }
+
+    valarray<_Tp> shift( int __n ) const
+      { return valarray<_Tp>( *this ).shift( __n ); }
+
+    valarray<_Tp> cshift( int __n ) const
+      { return valarray<_Tp>( *this ).cshift( __n ); }
+
+    valarray<_Tp> apply( value_type __f(value_type) ) const
+      { return valarray<_Tp>( *this ).apply( __f ); }
+
+    valarray<_Tp> apply( value_type __f(const value_type&) ) const
+      { return valarray<_Tp>( *this ).apply( __f ); }
+
+    const _Clos& _M_closure() const
+      { return _M_c; }
+
+  private:
+    _Clos _M_c;
+};
+
+/*
+ * Overloads of binary operation _Fun for valarray and expression
+ * operands, and for scalar operand on either side. Behavior is undefined
+ * if array operands have different lengths.
+ */
+#define _STLP_VALARRAY_ARRAY_OPERATION(_Fun, _Op, _Res)                                   \
+template <class _Tp>                                                                       \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _STLP_PRIV _Va_ref<_Tp>,  \
+                                           _STLP_PRIV _Va_ref<_Tp> >::_Ret _STLP_CALL     \
+_Fun( const valarray<_Tp>& __x, const valarray<_Tp>& __y )                                 \
+{                                                                                          \
+  _STLP_ASSERT(__x.size() == __y.size())                                                   \
+  typedef _STLP_PRIV _Va_ref<_Tp> _Ref;                                                    \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Ref, _Ref>::_S_make( _Ref( __x ), _Ref( __y ) ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp, class _Clos>                                                          \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _STLP_PRIV _Va_ref<_Tp>,  \
+                                           _Clos>::_Ret _STLP_CALL                         \
+_Fun( const valarray<_Tp>& __x, const _Valarray_expr<_Tp, _Clos>& __y )                    \
+{                                                                                          \
+  _STLP_ASSERT(__x.size() == __y.size())                                                   \
+  typedef _STLP_PRIV _Va_ref<_Tp> _Ref;                                                    \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Ref, _Clos>::_S_make( _Ref( __x ), __y._M_closure() ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp, class _Clos>                                                          \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos,                    \
+                                           _STLP_PRIV _Va_ref<_Tp> >::_Ret _STLP_CALL     \
+_Fun( const _Valarray_expr<_Tp, _Clos>& __x, const valarray<_Tp>& __y )                    \
+{                                                                                          \
+  _STLP_ASSERT(__x.size() == __y.size())                                                   \
+  typedef _STLP_PRIV _Va_ref<_Tp> _Ref;                                                    \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos, _Ref>::_S_make( __x._M_closure(), _Ref( __y ) ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp, class _Clos1, class _Clos2>                                           \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos1, _Clos2>::_Ret _STLP_CALL \
+_Fun( const _Valarray_expr<_Tp, _Clos1>& __x, const _Valarray_expr<_Tp, _Clos2>& __y )     \
+{                                                                                          \
+  _STLP_ASSERT(__x.size() == __y.size())                                                   \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos1, _Clos2>::_S_make( __x._M_closure(), __y._M_closure() ); \
+}
+
+#define _STLP_VALARRAY_SCALAR_OPERATION(_Fun, _Op, _Res)                                  \
+template <class _Tp>                                                                       \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _STLP_PRIV _Va_ref<_Tp>,  \
+                                           _STLP_PRIV _Va_scalar<_Tp> >::_Ret _STLP_CALL  \
+_Fun( const valarray<_Tp>& __x, const _Tp& __c )                                           \
+{                                                                                          \
+  typedef _STLP_PRIV _Va_ref<_Tp> _Ref;                                                    \
+  typedef _STLP_PRIV _Va_scalar<_Tp> _Scalar;                                              \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Ref, _Scalar>::_S_make( _Ref( __x ), _Scalar( __c, __x.size() ) ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp>                                                                       \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _STLP_PRIV _Va_scalar<_Tp>, \
+                                           _STLP_PRIV _Va_ref<_Tp> >::_Ret _STLP_CALL     \
+_Fun( const _Tp& __c, const valarray<_Tp>& __x )                                           \
+{                                                                                          \
+  typedef _STLP_PRIV _Va_ref<_Tp> _Ref;                                                    \
+  typedef _STLP_PRIV _Va_scalar<_Tp> _Scalar;                                              \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Scalar, _Ref>::_S_make( _Scalar( __c, __x.size() ), _Ref( __x ) ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp, class _Clos>                                                          \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos,                    \
+                                           _STLP_PRIV _Va_scalar<_Tp> >::_Ret _STLP_CALL  \
+_Fun( const _Valarray_expr<_Tp, _Clos>& __x, const _Tp& __c )                              \
+{                                                                                          \
+  typedef _STLP_PRIV _Va_scalar<_Tp> _Scalar;                                              \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Clos, _Scalar>::_S_make( __x._M_closure(), _Scalar( __c, __x.size() ) ); \
+}                                                                                          \
+                                                                                           \
+template <class _Tp, class _Clos>                                                          \
+inline typename _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _STLP_PRIV _Va_scalar<_Tp>, \
+                                           _Clos>::_Ret _STLP_CALL                         \
+_Fun( const _Tp& __c, const _Valarray_expr<_Tp, _Clos>& __x )                              \
+{                                                                                          \
+  typedef _STLP_PRIV _Va_scalar<_Tp> _Scalar;                                              \
+  return _STLP_PRIV _Va_binary_expr<_Res, _STLP_PRIV _Op, _Scalar, _Clos>::_S_make( _Scalar( __c, __x.size() ), __x._M_closure() ); \
+}
+
+#define _STLP_VALARRAY_BINARY_OPERATION(_Fun, _Op, _Res)                                  \
+_STLP_VALARRAY_ARRAY_OPERATION(_Fun, _Op, _Res)                                           \
+_STLP_VALARRAY_SCALAR_OPERATION(_Fun, _Op, _Res)
+
+// Overloads of math function _Fun for valarray and expression
+#define _STLP_VALARRAY_UNARY_FUNCTION(_Fun, _Op)                                          \
+template <class _Tp>                                                                       \
+inline typename _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Op, _STLP_PRIV _Va_ref<_Tp> >::_Ret \
+_Fun( const valarray<_Tp>& __x )                                                           \
+{ return _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Op, _STLP_PRIV _Va_ref<_Tp> >::_S_make( _STLP_PRIV _Va_ref<_Tp>( __x ) ); } \
+                                                                                           \
+template <class _Tp, class _Clos>                                                          \
+inline typename _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Op, _Clos>::_Ret                \
+_Fun( const _Valarray_expr<_Tp, _Clos>& __x )                                              \
+{ return _STLP_PRIV _Va_unary_expr<_Tp, _STLP_PRIV _Op, _Clos>::_S_make( __x._M_closure() ); }
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_VALARRAY_EXPR_H */
+
+// Local Variables:
+// mode:C++
+// End:
@@ -0,0 +1,509 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+/* NOTE: This is an internal header file, included by other STL headers.
+ *   You should not attempt to use it directly.
+ */
+
+#ifndef _STLP_INTERNAL_VALARRAY_SIMD_H
+#define _STLP_INTERNAL_VALARRAY_SIMD_H
+
+#ifndef _STLP_INTERNAL_CMATH
+#  include <stl/_cmath.h>
+#endif
+
+/*
+ * SIMD packets of valarray elements, used by evaluation of valarray
+ * expressions (see _valarray_expr.h).
+ *
+ * Packet is GCC vector extension type of 16 bytes (SSE2) or 32 bytes
+ * (if code is compiled for AVX/AVX2), so the same source serve both.
+ * Packets are provided for float, double and integral types except
+ * bool and char types; _Va_packet<_Tp>::_S_width is 0 for other types,
+ * and expressions of such types are evaluated element by element.
+ *
+ * _Va_math<float> and _Va_math<double> are packet kernels of exp, log,
+ * sin and cos (Cephes polynomials, without branches). Results are within
+ * few ulp of libm; out of range arguments of sin and cos are passed to
+ * libm lane by lane. _STLP_NO_SSE2 turn all this off.
+ */
+
+#if !defined (_STLP_NO_SSE2) && defined (__GNUC__) && (__GNUC__ >= 5 || defined (__clang__)) && \
+    (defined (__SSE2__) || defined (__x86_64__))
+#  define _STLP_VALARRAY_SIMD 1
+#  if defined (__AVX__)
+#    define _STLP_VALARRAY_SIMD_BYTES 32
+#  else
+#    define _STLP_VALARRAY_SIMD_BYTES 16
+#  endif
+#  include <immintrin.h>
+#endif
+
+_STLP_BEGIN_NAMESPACE
+
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+template <class _Tp>
+struct _Va_packet
+{
+    typedef _Tp _Type;
+    enum { _S_width = 0, _S_integral = 0, _S_floating = 0 };
+};
+
+// Packet kernels of math functions, for float and double
+template <class _Tp>
+struct _Va_math;
+
+#if defined (_STLP_VALARRAY_SIMD)
+
+template <class _Tp, bool _Floating>
+struct _Va_packet_base
+{
+    typedef _Tp _Type __attribute__((__vector_size__(_STLP_VALARRAY_SIMD_BYTES)));
+    enum {
+      _S_width = _STLP_VALARRAY_SIMD_BYTES / sizeof(_Tp),
+      _S_integral = !_Floating,
+      _S_floating = _Floating
+    };
+
+    static _Type _S_load( const _Tp* __p )
+      {
+        _Type __v;
+        __builtin_memcpy( &__v, __p, sizeof(_Type) );
+        return __v;
+      }
+
+    static void _S_store( _Tp* __p, _Type __v )
+      { __builtin_memcpy( __p, &__v, sizeof(_Type) ); }
+
+    // lanes are assigned, not added to zero: 0 + -0.0 is +0.0
+    static _Type _S_set1( _Tp __c )
+      {
+        _Type __v;
+        for ( int __i = 0; __i < _S_width; ++__i ) {
+          __v[__i] = __c;
+        }
+        return __v;
+      }
+};
+
+template <> struct _Va_packet<short> : public _Va_packet_base<short, false> { };
+template <> struct _Va_packet<unsigned short> : public _Va_packet_base<unsigned short, false> { };
+template <> struct _Va_packet<int> : public _Va_packet_base<int, false> { };
+template <> struct _Va_packet<unsigned int> : public _Va_packet_base<unsigned int, false> { };
+template <> struct _Va_packet<long> : public _Va_packet_base<long, false> { };
+template <> struct _Va_packet<unsigned long> : public _Va_packet_base<unsigned long, false> { };
+#  if defined (_STLP_LONG_LONG)
+template <> struct _Va_packet<_STLP_LONG_LONG> : public _Va_packet_base<_STLP_LONG_LONG, false> { };
+template <> struct _Va_packet<unsigned _STLP_LONG_LONG> : public _Va_packet_base<unsigned _STLP_LONG_LONG, false> { };
+#  endif
+template <> struct _Va_packet<float> : public _Va_packet_base<float, true> { };
+template <> struct _Va_packet<double> : public _Va_packet_base<double, true> { };
+
+// IEEE 754 layout and lane helpers of floating point packets
+template <class _Tp>
+struct _Va_fp;
+
+template <>
+struct _Va_fp<double>
+{
+    typedef long long _Int;
+    typedef _Int _IType __attribute__((__vector_size__(_STLP_VALARRAY_SIMD_BYTES)));
+    typedef _Va_packet<double>::_Type _Type;
+
+    static const int _S_mant = 52;
+    static const _Int _S_exp_mask = 0x7ff;
+    static const _Int _S_half = 0x3fe0000000000000LL; // 0.5
+    static const _Int _S_mant_mask = 0x000fffffffffffffLL;
+    static const _Int _S_sign_mask = 0x8000000000000000LL;
+    static const _Int _S_nan = 0x7ff8000000000000LL;
+    static const _Int _S_inf = 0x7ff0000000000000LL;
+    static const _Int _S_bias = 1023;
+
+    // 1.5 * 2^52: x + magic round x to integer, that is in low bits
+    static double _S_magic()
+      { return 6755399441055744.0; }
+
+    static bool _S_any( _IType __m )
+      {
+#  if _STLP_VALARRAY_SIMD_BYTES == 32
+        return _mm256_movemask_pd( (__m256d)__m ) != 0;
+#  else
+        return _mm_movemask_pd( (__m128d)__m ) != 0;
+#  endif
+      }
+
+    static _Type _S_sqrt( _Type __x )
+      {
+#  if _STLP_VALARRAY_SIMD_BYTES == 32
+        return (_Type)_mm256_sqrt_pd( (__m256d)__x );
+#  else
+        return (_Type)_mm_sqrt_pd( (__m128d)__x );
+#  endif
+      }
+};
+
+template <>
+struct _Va_fp<float>
+{
+    typedef int _Int;
+    typedef _Int _IType __attribute__((__vector_size__(_STLP_VALARRAY_SIMD_BYTES)));
+    typedef _Va_packet<float>::_Type _Type;
+
+    static const int _S_mant = 23;
+    static const _Int _S_exp_mask = 0xff;
+    static const _Int _S_half = 0x3f000000;
+    static const _Int _S_mant_mask = 0x007fffff;
+    static const _Int _S_sign_mask = static_cast<_Int>(0x80000000U);
+    static const _Int _S_nan = 0x7fc00000;
+    static const _Int _S_inf = 0x7f800000;
+    static const _Int _S_bias = 127;
+
+    // 1.5 * 2^23
+    static float _S_magic()
+      { return 12582912.0f; }
+
+    static bool _S_any( _IType __m )
+      {
+#  if _STLP_VALARRAY_SIMD_BYTES == 32
+        return _mm256_movemask_ps( (__m256)__m ) != 0;
+#  else
+        return _mm_movemask_ps( (__m128)__m ) != 0;
+#  endif
+      }
+
+    static _Type _S_sqrt( _Type __x )
+      {
+#  if _STLP_VALARRAY_SIMD_BYTES == 32
+        return (_Type)_mm256_sqrt_ps( (__m256)__x );
+#  else
+        return (_Type)_mm_sqrt_ps( (__m128)__x );
+#  endif
+      }
+};
+
+// Lane operations common for float and double
+template <class _Tp>
+struct _Va_lanes :
+    public _Va_fp<_Tp>
+{
+    typedef _Va_fp<_Tp> _Base;
+    typedef typename _Base::_Int _Int;
+    typedef typename _Base::_IType _IType;
+    typedef typename _Base::_Type _Type;
+
+    static _Type _S_set1( _Tp __c )
+      { return _Va_packet<_Tp>::_S_set1( __c ); }
+
+    static _IType _S_iset1( _Int __c )
+      {
+        _IType __v;
+        for ( int __i = 0; __i < _Va_packet<_Tp>::_S_width; ++__i ) {
+          __v[__i] = __c;
+        }
+        return __v;
+      }
+
+    static _IType _S_bits( _Type __x )
+      { return (_IType)__x; }
+
+    static _Type _S_float( _IType __i )
+      { return (_Type)__i; }
+
+    // lanes of __m are all ones (take __x) or all zeros (take __y)
+    static _Type _S_select( _IType __m, _Type __x, _Type __y )
+      { return _S_float( (__m & _S_bits( __x )) | (~__m & _S_bits( __y )) ); }
+
+    static _Type _S_abs( _Type __x )
+      { return _S_float( _S_bits( __x ) & ~_S_iset1( _Base::_S_sign_mask ) ); }
+
+    // round to nearest integer; __n receive it as integer
+    static _Type _S_round( _Type __x, _IType& __n )
+      {
+        _Type __m = _S_set1( _Base::_S_magic() );
+        _Type __t = __x + __m;
+        __n = _S_bits( __t ) - _S_bits( __m );
+        return __t - __m;
+      }
+
+    // integer to floating point, |__n| < 2^(mantissa bits - 1)
+    static _Type _S_to_float( _IType __n )
+      {
+        _Type __m = _S_set1( _Base::_S_magic() );
+        return _S_float( __n + _S_bits( __m ) ) - __m;
+      }
+
+    // 2^__n, __n within normal exponent range
+    static _Type _S_pow2( _IType __n )
+      { return _S_float( (__n + _Base::_S_bias) << _Base::_S_mant ); }
+
+    // __x = m * 2^__e, 0.5 <= m < 1, for positive normal __x
+    static _Type _S_frexp( _Type __x, _IType& __e )
+      {
+        _IType __b = _S_bits( __x );
+        __e = ((__b >> _Base::_S_mant) & _Base::_S_exp_mask) - (_Base::_S_bias - 1);
+        return _S_float( (__b & _Base::_S_mant_mask) | _Base::_S_half );
+      }
+
+    static _Type _S_nan()
+      { return _S_float( _S_iset1( _Base::_S_nan ) ); }
+
+    static _Type _S_inf()
+      { return _S_float( _S_iset1( _Base::_S_inf ) ); }
+};
+
+template <>
+struct _Va_math<double> :
+    public _Va_lanes<double>
+{
+    static _Type _S_exp( _Type __x )
+      {
+        const double __hi = 709.782712893384;
+        const double __lo = -745.1332191019412;
+
+        _Type __xc = _S_select( (_IType)(__x > __hi), _S_set1( __hi ), __x );
+        __xc = _S_select( (_IType)(__xc < __lo), _S_set1( __lo ), __xc );
+
+        // exp(x) = 2^n * exp(r), |r| <= ln(2)/2
+        _IType __n;
+        _Type __fn = _S_round( __xc * 1.4426950408889634073599, __n );
+        _Type __r = __xc - __fn * 6.93145751953125E-1;
+        __r = __r - __fn * 1.42860682030941723212E-6;
+
+        _Type __rr = __r * __r;
+        _Type __p = ((1.26177193074810590878E-4 * __rr + 3.02994407707441961300E-2) * __rr
+                     + 9.99999999999999999910E-1) * __r;
+        _Type __q = ((3.00198505138664455042E-6 * __rr + 2.52448340349684104192E-3) * __rr
+                     + 2.27265548208155028766E-1) * __rr + 2.00000000000000000009E0;
+        _Type __y = 1.0 + 2.0 * (__p / (__q - __p));
+
+        // two steps, to reach subnormals and 2^1024
+        _IType __n1 = __n >> 1;
+        __y = __y * _S_pow2( __n1 ) * _S_pow2( __n - __n1 );
+
+        __y = _S_select( (_IType)(__x > __hi), _S_inf(), __y );
+        __y = _S_select( (_IType)(__x < __lo), _S_set1( 0.0 ), __y );
+        return _S_select( (_IType)(__x != __x), __x, __y );
+      }
+
+    static _Type _S_log( _Type __x )
+      {
+        // subnormals: scale by 2^54
+        _IType __tiny = (_IType)(__x < 2.2250738585072014e-308);
+        _Type __xs = _S_select( __tiny, __x * 18014398509481984.0, __x );
+
+        _IType __e;
+        _Type __m = _S_frexp( __xs, __e );
+        __e = __e - (__tiny & 54);
+
+        // m in [sqrt(1/2), sqrt(2)), x = m - 1
+        _IType __small = (_IType)(__m < 0.70710678118654752440);
+        __e = __e + __small;
+        __m = __m + _S_float( _S_bits( __m ) & __small ) - 1.0;
+
+        _Type __fe = _S_to_float( __e );
+        _Type __z = __m * __m;
+        _Type __p = ((((1.01875663804580931796E-4 * __m + 4.97494994976747001425E-1) * __m
+                       + 4.70579119878881725854E0) * __m + 1.44989225341610930846E1) * __m
+                     + 1.79368678507819816313E1) * __m + 7.70838733755885391666E0;
+        _Type __q = ((((__m + 1.12873587189167450590E1) * __m + 4.52279145837532221105E1) * __m
+                      + 8.29875266912776603211E1) * __m + 7.11544750618563894466E1) * __m
+                    + 2.31251620126765340583E1;
+        _Type __y = __m * (__z * __p / __q);
+        __y = __y - __fe * 2.121944400546905827679E-4;
+        __y = __y - 0.5 * __z;
+        __y = (__m + __y) + __fe * 0.693359375;
+
+        __y = _S_select( (_IType)(__x == _S_inf()), __x, __y );
+        __y = _S_select( (_IType)(__x == 0.0), -_S_inf(), __y );
+        __y = _S_select( (_IType)(__x < 0.0), _S_nan(), __y );
+        return _S_select( (_IType)(__x != __x), __x, __y );
+      }
+
+    static _Type _S_sin( _Type __x )
+      { return _S_sincos( __x, false ); }
+
+    static _Type _S_cos( _Type __x )
+      { return _S_sincos( __x, true ); }
+
+  private:
+    static _Type _S_sincos( _Type __x, bool __cos )
+      {
+        // argument reduction is exact enough up to this bound
+        const double __lossth = 1048576.0;
+
+        _Type __ax = _S_abs( __x );
+        if ( _S_any( ~(_IType)(__ax <= __lossth) ) ) {
+          return _S_by_lane( __x, __cos );
+        }
+
+        // x = q * pi/2 + z, |z| <= pi/4
+        _IType __q;
+        _Type __fq = _S_round( __ax * 0.63661977236758134308, __q );
+        // pi/2 in four parts, products of first three are exact
+        _Type __z = __ax - __fq * 1.570796326734125614166259765625;
+        __z = __z - __fq * 6.077100506303965976595549136618501506745E-11;
+        __z = __z - __fq * 2.022266248711166455795995623655170701782E-21;
+        __z = __z - __fq * 8.478427660368899569973653786709666645018E-32;
+
+        _Type __zz = __z * __z;
+        _Type __s = (((((1.58962301576546568060E-10 * __zz - 2.50507477628578072866E-8) * __zz
+                        + 2.75573136213857245213E-6) * __zz - 1.98412698295895385996E-4) * __zz
+                      + 8.33333333332211858878E-3) * __zz - 1.66666666666666307295E-1) * __zz * __z + __z;
+        _Type __c = (((((-1.13585365213876817300E-11 * __zz + 2.08757008419747316778E-9) * __zz
+                        - 2.75573141792967388112E-7) * __zz + 2.48015872888517045348E-5) * __zz
+                      - 1.38888888888730564116E-3) * __zz + 4.16666666666665929218E-2) * __zz * __zz
+                    - 0.5 * __zz + 1.0;
+
+        _IType __sign;
+        if ( __cos ) {
+          // quadrants 1, 2 are negative; sin(x) polynomial in 1, 3
+          __sign = ((__q + 1) & 2) << (63 - 1);
+        } else {
+          // quadrants 2, 3 are negative; cos(x) polynomial in 1, 3
+          __sign = ((__q & 2) << (63 - 1)) ^ (_S_bits( __x ) & _S_sign_mask);
+        }
+        _IType __odd = -(__q & 1);
+        _Type __y = __cos ? _S_select( __odd, __s, __c ) : _S_select( __odd, __c, __s );
+        return _S_float( _S_bits( __y ) ^ __sign );
+      }
+
+    static _Type _S_by_lane( _Type __x, bool __cos )
+      {
+        for ( int __i = 0; __i < _Va_packet<double>::_S_width; ++__i ) {
+          __x[__i] = __cos ? ::cos( __x[__i] ) : ::sin( __x[__i] );
+        }
+        return __x;
+      }
+};
+
+template <>
+struct _Va_math<float> :
+    public _Va_lanes<float>
+{
+    static _Type _S_exp( _Type __x )
+      {
+        const float __hi = 88.7228394f;
+        const float __lo = -103.972084f;
+
+        _Type __xc = _S_select( (_IType)(__x > __hi), _S_set1( __hi ), __x );
+        __xc = _S_select( (_IType)(__xc < __lo), _S_set1( __lo ), __xc );
+
+        _IType __n;
+        _Type __fn = _S_round( __xc * 1.44269504088896341f, __n );
+        _Type __r = __xc - __fn * 0.693359375f;
+        __r = __r - __fn * -2.12194440e-4f;
+
+        _Type __rr = __r * __r;
+        _Type __y = (((((1.9875691500E-4f * __r + 1.3981999507E-3f) * __r + 8.3334519073E-3f) * __r
+                       + 4.1665795894E-2f) * __r + 1.6666665459E-1f) * __r + 5.0000001201E-1f) * __rr
+                    + __r + 1.0f;
+
+        _IType __n1 = __n >> 1;
+        __y = __y * _S_pow2( __n1 ) * _S_pow2( __n - __n1 );
+
+        __y = _S_select( (_IType)(__x > __hi), _S_inf(), __y );
+        __y = _S_select( (_IType)(__x < __lo), _S_set1( 0.0f ), __y );
+        return _S_select( (_IType)(__x != __x), __x, __y );
+      }
+
+    static _Type _S_log( _Type __x )
+      {
+        // subnormals: scale by 2^25
+        _IType __tiny = (_IType)(__x < 1.17549435e-38f);
+        _Type __xs = _S_select( __tiny, __x * 33554432.0f, __x );
+
+        _IType __e;
+        _Type __m = _S_frexp( __xs, __e );
+        __e = __e - (__tiny & 25);
+
+        _IType __small = (_IType)(__m < 0.707106781186547524f);
+        __e = __e + __small;
+        __m = __m + _S_float( _S_bits( __m ) & __small ) - 1.0f;
+
+        _Type __fe = _S_to_float( __e );
+        _Type __z = __m * __m;
+        _Type __y = ((((((((7.0376836292E-2f * __m - 1.1514610310E-1f) * __m + 1.1676998740E-1f) * __m
+                          - 1.2420140846E-1f) * __m + 1.4249322787E-1f) * __m - 1.6668057665E-1f) * __m
+                       + 2.0000714765E-1f) * __m - 2.4999993993E-1f) * __m + 3.3333331174E-1f) * __m * __z;
+        __y = __y - __fe * 2.12194440e-4f;
+        __y = __y - 0.5f * __z;
+        __y = (__m + __y) + __fe * 0.693359375f;
+
+        __y = _S_select( (_IType)(__x == _S_inf()), __x, __y );
+        __y = _S_select( (_IType)(__x == 0.0f), -_S_inf(), __y );
+        __y = _S_select( (_IType)(__x < 0.0f), _S_nan(), __y );
+        return _S_select( (_IType)(__x != __x), __x, __y );
+      }
+
+    static _Type _S_sin( _Type __x )
+      { return _S_sincos( __x, false ); }
+
+    static _Type _S_cos( _Type __x )
+      { return _S_sincos( __x, true ); }
+
+  private:
+    static _Type _S_sincos( _Type __x, bool __cos )
+      {
+        const float __lossth = 8192.0f;
+
+        _Type __ax = _S_abs( __x );
+        if ( _S_any( ~(_IType)(__ax <= __lossth) ) ) {
+          return _S_by_lane( __x, __cos );
+        }
+
+        _IType __q;
+        _Type __fq = _S_round( __ax * 0.636619772367581343f, __q );
+        // pi/2 in four parts, products of first three are exact
+        _Type __z = __ax - __fq * 1.5703125f;
+        __z = __z - __fq * 4.837512969970703125E-4f;
+        __z = __z - __fq * 7.54953362047672271728515625E-8f;
+        __z = __z - __fq * 2.56334406825708960298E-12f;
+
+        _Type __zz = __z * __z;
+        _Type __s = ((-1.9515295891E-4f * __zz + 8.3321608736E-3f) * __zz - 1.6666654611E-1f) * __zz * __z + __z;
+        _Type __c = ((2.443315711809948E-5f * __zz - 1.388731625493765E-3f) * __zz + 4.166664568298827E-2f) * __zz * __zz
+                    - 0.5f * __zz + 1.0f;
+
+        _IType __sign;
+        if ( __cos ) {
+          __sign = ((__q + 1) & 2) << (31 - 1);
+        } else {
+          __sign = ((__q & 2) << (31 - 1)) ^ (_S_bits( __x ) & _S_sign_mask);
+        }
+        _IType __odd = -(__q & 1);
+        _Type __y = __cos ? _S_select( __odd, __s, __c ) : _S_select( __odd, __c, __s );
+        return _S_float( _S_bits( __y ) ^ __sign );
+      }
+
+    static _Type _S_by_lane( _Type __x, bool __cos )
+      {
+        for ( int __i = 0; __i < _Va_packet<float>::_S_width; ++__i ) {
+          __x[__i] = __cos ? ::cos( __x[__i] ) : ::sin( __x[__i] );
+        }
+        return __x;
+      }
+};
+
+#endif /* _STLP_VALARRAY_SIMD */
+
+_STLP_MOVE_TO_STD_NAMESPACE
+
+_STLP_END_NAMESPACE
+
+#endif /* _STLP_INTERNAL_VALARRAY_SIMD_H */
+
+// Local Variables:
+// mode:C++
+// End:
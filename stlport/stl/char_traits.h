@@ -208,6 +208,33 @@ template <class _CharT>
 class char_traits
   : public __char_traits_base<_CharT, _CharT> {};
 
+#if !defined (_STLP_USE_NO_IOSTREAMS)
+_STLP_MOVE_TO_PRIV_NAMESPACE
+
+// Search primitives for char sequences, used by char_traits<char> and
+// basic_string<char>. Implemented in library by SSE2/AVX2 kernels,
+// chosen at runtime by CPUID; portable code on other platforms.
+// All of them return 0 if nothing found.
+class _STLP_CLASS_DECLSPEC _Char_search
+{
+  public:
+    // first (last) __c in [__s, __s + __n)
+    static const char* _STLP_CALL _S_find(const char* __s, size_t __n, char __c);
+    static const char* _STLP_CALL _S_rfind(const char* __s, size_t __n, char __c);
+
+    // first (last) occurrence of [__p, __p + __m) in [__s, __s + __n); 0 < __m
+    static const char* _STLP_CALL _S_search(const char* __s, size_t __n, const char* __p, size_t __m);
+    static const char* _STLP_CALL _S_rsearch(const char* __s, size_t __n, const char* __p, size_t __m);
+
+    // first (last) char that is in set [__set, __set + __m) if __in,
+    // and that is not in set otherwise
+    static const char* _STLP_CALL _S_find_of(const char* __s, size_t __n, const char* __set, size_t __m, bool __in);
+    static const char* _STLP_CALL _S_rfind_of(const char* __s, size_t __n, const char* __set, size_t __m, bool __in);
+};
+
+_STLP_MOVE_TO_STD_NAMESPACE
+#endif
+
 // Specialization for char.
 
 _STLP_TEMPLATE_NULL
@@ -240,6 +267,13 @@ public:
     memset(__s, __c, __n);
     return __s;
   }
+
+  static const char* _STLP_CALL find(const char* __s, size_t __n, const char& __c)
+#if !defined (_STLP_USE_NO_IOSTREAMS)
+  { return _STLP_PRIV _Char_search::_S_find(__s, __n, __c); }
+#else
+  { return __n == 0 ? 0 : (const char*)memchr(__s, (unsigned char)__c, __n); }
+#endif
 };
 
 #if defined (_STLP_HAS_WCHAR_T)
@@ -127,7 +127,9 @@
 #endif
 
 #if !defined (_STLP_DONT_USE_SHORT_STRING_OPTIM) && !defined (_STLP_USE_SHORT_STRING_OPTIM)
-// #  define _STLP_USE_SHORT_STRING_OPTIM 1
+#  if defined (__linux__)
+#    define _STLP_USE_SHORT_STRING_OPTIM 1
+#  endif
 #endif
 
 #if !defined (_STLP_NO_EXTENSIONS) && \
@@ -836,6 +838,11 @@ typedef int bool;
 #  define _STLP_SHRED_BYTE 0xA3
 #endif /* _STLP_SHRED_BYTE */
 
+/* size of deque's block in bytes, see user_config.h */
+#ifndef _STLP_DEQUE_BLOCK_BYTES
+#  define _STLP_DEQUE_BLOCK_BYTES 4096
+#endif
+
 /* shared library tune-up */
 #ifndef _STLP_IMPORT_DECLSPEC
 #  define _STLP_IMPORT_DECLSPEC
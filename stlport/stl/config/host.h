@@ -142,6 +142,19 @@
 #define _STLP_USE_NODE_ALLOC 1
 */
 
+/*
+ * Uncomment _STLP_USE_NODE_ALLOC_MAGAZINES to put per-thread caches
+ * (magazines) of free nodes in front of "node_alloc" free lists.
+ * Common allocate/deallocate calls then don't use locks or atomic operations
+ * at all, shared free lists are refilled and flushed by batches of nodes.
+ * This reduce contention in massively multi-threaded programs at the cost
+ * of some nodes kept by every thread. Implemented for POSIX threads only.
+ * STLport rebuild: Yes
+ */
+/*
+#define _STLP_USE_NODE_ALLOC_MAGAZINES 1
+*/
+
 /*
  * Set _STLP_DEBUG_ALLOC to use allocators that perform memory debugging,
  * such as padding/checking for memory consistency
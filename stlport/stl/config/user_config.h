@@ -272,17 +272,67 @@
 
 
 /*
- * By default the STLport basic_string implementation use a little static buffer
- * (of 16 chars when writing this doc) to avoid systematically memory allocation
- * in case of little basic_string. The drawback of such a method is bigger
- * basic_string size and some performance penalty for method like swap. If you
- * prefer systematical dynamic allocation turn on this macro.
+ * On Linux the STLport basic_string implementation use a little static buffer
+ * (4 pointers wide, i.e. 31 chars on 64-bit targets) to avoid systematically
+ * memory allocation in case of little basic_string. The drawback of such
+ * a method is bigger basic_string size and a bit more work for move and swap.
+ * This macro select the old layout with systematical dynamic allocation
+ * (binary incompatible with default one). On other platforms static buffer
+ * is off unless _STLP_USE_SHORT_STRING_OPTIM is defined.
  * STLport rebuild: Yes
  */
 /*
 #define _STLP_DONT_USE_SHORT_STRING_OPTIM 1
 */
 
+/*
+ * By default hash<string> and hash<const char*> process key by machine words
+ * (MurmurHash2 variants for 32-bit and 64-bit size_t). Turn this macro on
+ * to get old byte by byte 'h = 33 * h + c' hash, i.e. if hash values are
+ * stored somewhere.
+ */
+/*
+#define _STLP_USE_LEGACY_STRING_HASH 1
+*/
+
+/*
+ * hash<> of integral types return key value unchanged. That's good for
+ * prime number of buckets, but keys with regular low bits (ids with step,
+ * values from bit masks, etc.) will be clustered within few buckets if bucket
+ * count is power of 2. Turn this macro on to pass integers through
+ * a finalizer that spread every bit of key over all bits of hash.
+ * hash<void*> always mixes pointer value.
+ */
+/*
+#define _STLP_USE_INTEGER_HASH_MIX 1
+*/
+
+/*
+ * unordered_set<>, unordered_map<> and multi variants use prime numbers of
+ * buckets, so finding key's bucket cost an integer division. Turn this macro
+ * on to use powers of 2 numbers of buckets instead: bucket is selected by
+ * a mask applied to the post-mixed hash code, so even poor hash functions
+ * (like identity hash<> of integers) are well distributed.
+ * Bucket policy may also be given explicitly to internal hashtable as
+ * last template parameter (_Stl_prime_type or _Stl_pow2_type).
+ */
+/*
+#define _STLP_USE_POW2_HASH_BUCKETS 1
+*/
+
+/*
+ * deque<> store elements in blocks of _STLP_DEQUE_BLOCK_BYTES bytes (or one
+ * element, if it is bigger); 4096 by default. Smaller value reduce memory
+ * overhead of small deques, bigger one reduce number of allocator calls and
+ * map size. 256 was used before (binary incompatible with default one).
+ * Block size for particular type may be set by std::deque_block_traits<>
+ * specialization.
+ * STLport rebuild: Yes
+ */
+/*
+#define _STLP_DEQUE_BLOCK_BYTES 256
+*/
+
 /*
  * To reduce the famous code bloat trouble due to the use of templates STLport grant
  * a specialization of some containers for pointer types. So all instantiations
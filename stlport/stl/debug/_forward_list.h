@@ -505,6 +505,11 @@ class forward_list :
   template <class _StrictWeakOrdering>
   void sort(_StrictWeakOrdering __comp)
   { _M_non_dbg_impl.sort(__comp); }
+
+  void reserve_nodes(size_type __n)
+  { _M_non_dbg_impl.reserve_nodes(__n); }
+  void shrink_node_pool()
+  { _M_non_dbg_impl.shrink_node_pool(); }
 };
 
 _STLP_END_NAMESPACE
@@ -94,16 +94,69 @@ struct _Vector_const_traits<bool, _Bit_iterator>
     typedef _Vector_nonconst_traits<bool, _Bit_iterator> _NonConstTraits;
 };
 
+// Extensions of vector<bool> (count, find_first, &= ...), forwarded by
+// debug vector to underlying one; nothing for other value types.
+template <class _Vector, class _Tp, class _NonDbgVector>
+class _Vector_ext
+{ };
+
+#if !defined (_STLP_NO_BOOL)
+template <class _Vector, class _NonDbgVector>
+class _Vector_ext<_Vector, bool, _NonDbgVector>
+{
+  public:
+    typedef size_t size_type;
+
+    size_type count() const
+      { return _M_impl().count(); }
+    bool any() const
+      { return _M_impl().any(); }
+    bool none() const
+      { return _M_impl().none(); }
+    size_type find_first() const
+      { return _M_impl().find_first(); }
+    size_type find_next(size_type __prev) const
+      { return _M_impl().find_next(__prev); }
+
+    _Vector& operator&=(const _Vector& __x)
+      {
+         _STLP_VERBOSE_ASSERT(_M_impl().size() == __x._M_non_dbg_impl.size(), _StlMsg_INVALID_ARGUMENT)
+         _M_impl() &= __x._M_non_dbg_impl;
+         return *static_cast<_Vector*>(this);
+      }
+    _Vector& operator|=(const _Vector& __x)
+      {
+         _STLP_VERBOSE_ASSERT(_M_impl().size() == __x._M_non_dbg_impl.size(), _StlMsg_INVALID_ARGUMENT)
+         _M_impl() |= __x._M_non_dbg_impl;
+         return *static_cast<_Vector*>(this);
+      }
+    _Vector& operator^=(const _Vector& __x)
+      {
+         _STLP_VERBOSE_ASSERT(_M_impl().size() == __x._M_non_dbg_impl.size(), _StlMsg_INVALID_ARGUMENT)
+         _M_impl() ^= __x._M_non_dbg_impl;
+         return *static_cast<_Vector*>(this);
+      }
+
+  private:
+    _NonDbgVector& _M_impl()
+      { return static_cast<_Vector*>(this)->_M_non_dbg_impl; }
+    const _NonDbgVector& _M_impl() const
+      { return static_cast<const _Vector*>(this)->_M_non_dbg_impl; }
+};
+#endif
+
 _STLP_MOVE_TO_STD_NAMESPACE
 
 template <class _Tp, _STLP_DFL_TMPL_PARAM(_Alloc, allocator<_Tp>) >
 class vector :
-    _STLP_PRIV __construct_checker< _STLP_NON_DBG_VECTOR >
+    _STLP_PRIV __construct_checker< _STLP_NON_DBG_VECTOR >,
+    public _STLP_PRIV _Vector_ext<vector<_Tp, _Alloc>, _Tp, _STLP_NON_DBG_VECTOR >
 {
   private:
     typedef _STLP_NON_DBG_VECTOR _Base;
     typedef vector<_Tp, _Alloc> _Self;
     typedef _STLP_PRIV __construct_checker<_STLP_NON_DBG_VECTOR > _ConstructCheck;
+    friend class _STLP_PRIV _Vector_ext<_Self, _Tp, _Base>;
     _Base _M_non_dbg_impl;
     _STLP_PRIV __owned_list _M_iter_list;
 
@@ -256,6 +256,9 @@ public:
   void sort(_StrictWeakOrdering __comp)
   { _M_impl.sort(_STLP_PRIV _BinaryPredWrapper<_StorageType, _Tp, _StrictWeakOrdering>(__comp)); }
 
+  void reserve_nodes(size_type __n) { _M_impl.reserve_nodes(__n); }
+  void shrink_node_pool() { _M_impl.shrink_node_pool(); }
+
 private:
   _Base _M_impl;
 };
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "alloc_perf.h"
+#include "perf.h"
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <condition_variable>
+#include <cstdio>
+
+#if defined (STLPORT)
+
+namespace node_alloc_ns {
+
+const int rounds = 20000;
+const int depth = 64; // nodes alive per thread, like small map or list
+
+std::barrier* start;
+
+void run()
+{
+  void* p[depth];
+  size_t sz[depth];
+
+  start->wait();
+
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( int i = 0; i < depth; ++i ) {
+      sz[i] = 8 + ((i + r) * 24) % 248; // from 8 up to 255 bytes
+      p[i] = std::__node_alloc::allocate( sz[i] );
+    }
+    // free odd in order and even in reverse order, to mix free lists a bit
+    for ( int i = 1; i < depth; i += 2 ) {
+      std::__node_alloc::deallocate( p[i], sz[i] );
+    }
+    for ( int i = depth - 2; i >= 0; i -= 2 ) {
+      std::__node_alloc::deallocate( p[i], sz[i] );
+    }
+  }
+}
+
+} // namespace node_alloc_ns
+
+#endif
+
+int EXAM_IMPL(alloc_perf::node_alloc_contention)
+{
+#if defined (STLPORT)
+  using namespace node_alloc_ns;
+
+# if defined (_STLP_USE_NODE_ALLOC_MAGAZINES)
+  const char* variant = "magazines";
+# else
+  const char* variant = "shared free lists";
+# endif
+
+  std::barrier solo( 1 );
+
+  start = &solo;
+  node_alloc_ns::run(); // warm up free lists
+
+  const unsigned max_thr = perf::ncpu();
+  double base_rate = 0.0;
+
+  // 1, 2, 4, ... threads, and number of CPUs as the last step
+  for ( unsigned n = 1; n <= max_thr; n = (n < max_thr && n * 2 > max_thr) ? max_thr : n * 2 ) {
+    std::barrier bar( n + 1 );
+    std::vector<std::thread*> thr( n );
+
+    start = &bar;
+    for ( unsigned i = 0; i < n; ++i ) {
+      thr[i] = new std::thread( node_alloc_ns::run );
+    }
+
+    bar.wait();
+    perf::timer tm;
+    for ( unsigned i = 0; i < n; ++i ) {
+      thr[i]->join();
+      delete thr[i];
+    }
+    long long ns = tm.ns();
+
+    unsigned long long ops = 2ULL * rounds * depth * n; // allocate + deallocate
+    char buf[64];
+
+    std::sprintf( buf, "%s, %u threads", variant, n );
+    perf::report( "node_alloc contention", buf, ops, ns );
+
+    double rate = static_cast<double>(ops) / static_cast<double>(ns);
+    if ( n == 1 ) {
+      base_rate = rate;
+    } else {
+      perf::note( "node_alloc contention", buf, "scaling vs 1 thread", rate / base_rate );
+    }
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
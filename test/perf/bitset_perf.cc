@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "bitset_perf.h"
+#include "perf.h"
+
+#include <bitset>
+#if defined (STLPORT)
+#  include <dynamic_bitset>
+#endif
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bitset_ns {
+
+const unsigned long long nbits = 4000000000ULL;
+
+// every bit set with probability __permille / 1000
+template <class B>
+void scatter( B& b, size_t n, int permille )
+{
+  std::srand( 17 );
+  for ( size_t i = 0; i < n; ++i ) {
+    if ( std::rand() % 1000 < permille ) {
+      b[i] = true;
+    }
+  }
+}
+
+template <size_t N>
+void bitset_count( const char* test )
+{
+  const int rounds = static_cast<int>(nbits / N);
+  std::bitset<N>* b = new std::bitset<N>;
+  scatter( *b, N, 500 );
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( *b );
+    sum += b->count();
+  }
+  long long ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, "bitset::count", static_cast<unsigned long long>(rounds) * N, ns );
+  delete b;
+}
+
+void bvector_count( const char* test, size_t n )
+{
+  const int rounds = static_cast<int>(nbits / 4 / n);
+  std::vector<bool> v( n );
+  scatter( v, n, 500 );
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( v );
+    sum += std::count( v.begin(), v.end(), true );
+  }
+  perf::report( test, "std::count", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+#if defined (STLPORT)
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( v );
+    sum += v.count();
+  }
+  perf::report( test, "vector<bool>::count", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+#endif
+  perf::keep( sum );
+}
+
+// visit set bits of sparse vector
+void bvector_find( const char* test, size_t n, int permille )
+{
+  const int rounds = static_cast<int>(nbits / 16 / n);
+  std::vector<bool> v( n );
+  scatter( v, n, permille );
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( v );
+    for ( size_t i = 0; i < n; ++i ) {
+      if ( v[i] ) {
+        sum += i;
+      }
+    }
+  }
+  perf::report( test, "operator[] loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+#if defined (STLPORT)
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( v );
+    for ( size_t i = v.find_first(); i != n; i = v.find_next( i ) ) {
+      sum += i;
+    }
+  }
+  perf::report( test, "find_first/find_next", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+#endif
+  perf::keep( sum );
+}
+
+template <size_t N>
+void bitset_find( const char* test, int permille )
+{
+  const int rounds = static_cast<int>(nbits / 16 / N);
+  std::bitset<N>* b = new std::bitset<N>;
+  scatter( *b, N, permille );
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( *b );
+    for ( size_t i = 0; i < N; ++i ) {
+      if ( (*b)[i] ) {
+        sum += i;
+      }
+    }
+  }
+  perf::report( test, "operator[] loop", static_cast<unsigned long long>(rounds) * N, tm.ns() );
+
+#if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( *b );
+    for ( size_t i = b->_Find_first(); i != N; i = b->_Find_next( i ) ) {
+      sum += i;
+    }
+  }
+  perf::report( test, "_Find_first/_Find_next", static_cast<unsigned long long>(rounds) * N, tm.ns() );
+#endif
+  perf::keep( sum );
+  delete b;
+}
+
+} // namespace bitset_ns
+
+int EXAM_IMPL(bitset_perf::count)
+{
+  using namespace bitset_ns;
+
+  bitset_count<64>( "count of bitset<64>" );
+  bitset_count<512>( "count of bitset<512>" );
+  bitset_count<65536>( "count of bitset<65536>" );
+
+  bvector_count( "count of vector<bool>(512)", 512 );
+  bvector_count( "count of vector<bool>(1000000)", 1000000 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(bitset_perf::find)
+{
+  using namespace bitset_ns;
+
+  const int density[] = { 1, 50, 500 };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(density) / sizeof(density[0]); ++k ) {
+    std::sprintf( test, "set bits of bitset<65536>, density %.1f%%", density[k] / 10.0 );
+    bitset_find<65536>( test, density[k] );
+    std::sprintf( test, "set bits of vector<bool>(1000000), density %.1f%%", density[k] / 10.0 );
+    bvector_find( test, 1000000, density[k] );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(bitset_perf::bulk)
+{
+  using namespace bitset_ns;
+
+  const size_t n = 1000000;
+  const int rounds = static_cast<int>(nbits / 16 / n);
+  std::vector<bool> a( n ), b( n );
+  scatter( a, n, 500 );
+  scatter( b, n, 300 );
+  const char* test = "vector<bool>(1000000) and";
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( size_t i = 0; i < n; ++i ) {
+      a[i] = a[i] && b[i];
+    }
+    perf::keep( a );
+  }
+  perf::report( test, "element loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+#if defined (STLPORT)
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    a &= b;
+    perf::keep( a );
+  }
+  perf::report( test, "operator&=", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(bitset_perf::dynamic)
+{
+#if defined (STLPORT)
+  using namespace bitset_ns;
+
+  const size_t n = 1000000;
+  const int rounds = static_cast<int>(nbits / 16 / n);
+  std::vector<bool> va( n ), vb( n );
+  std::dynamic_bitset<> a( n ), b( n );
+  scatter( va, n, 500 );
+  scatter( vb, n, 300 );
+  scatter( a, n, 500 );
+  scatter( b, n, 300 );
+  size_t sum = 0;
+
+  const char* test = "set difference of 1000000 bits";
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( size_t i = 0; i < n; ++i ) {
+      va[i] = va[i] && !vb[i];
+    }
+    perf::keep( va );
+  }
+  perf::report( test, "vector<bool> element loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    a -= b;
+    perf::keep( a );
+  }
+  perf::report( test, "dynamic_bitset::operator-=", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  scatter( va, n, 500 );
+  scatter( a, n, 500 );
+
+  test = "intersection count of 1000000 bits";
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( va );
+    for ( size_t i = 0; i < n; ++i ) {
+      sum += va[i] && vb[i];
+    }
+  }
+  perf::report( test, "vector<bool> element loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::vector<bool> t( va );
+    t &= vb;
+    sum += t.count();
+  }
+  perf::report( test, "vector<bool> &= and count", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( a );
+    sum += a.intersection_count( b );
+  }
+  perf::report( test, "dynamic_bitset::intersection_count", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  test = "subset and intersection tests of 1000000 bits";
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( a );
+    sum += a.is_subset_of( b );
+    sum += a.intersects( b );
+  }
+  perf::report( test, "is_subset_of and intersects", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  std::dynamic_bitset<> s( n );
+  scatter( s, n, 10 );
+
+  test = "set bits of 1000000 bits, density 1.0%";
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( s );
+    for ( size_t i = 0; i < n; ++i ) {
+      if ( s[i] ) {
+        sum += i;
+      }
+    }
+  }
+  perf::report( test, "dynamic_bitset operator[] loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    perf::keep( s );
+    for ( std::dynamic_bitset<>::ones_iterator i = s.ones_begin(); i != s.ones_end(); ++i ) {
+      sum += *i;
+    }
+  }
+  perf::report( test, "dynamic_bitset ones_iterator", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  perf::keep( sum );
+#endif
+
+  return EXAM_RESULT;
+}
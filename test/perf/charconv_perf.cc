@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "charconv_perf.h"
+#include "perf.h"
+
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#if defined (STLPORT)
+#  include <charconv>
+#endif
+
+/*
+ * Both layers of number conversion: to_chars/from_chars primitives,
+ * and num_put/num_get facets built on them (through ostream/istream),
+ * with C library for reference.
+ */
+
+namespace charconv_ns {
+
+const int nvalues = 200000;
+const int rounds = 5;
+
+// integers of 1..19 digits, half of them negative
+void make_integers( std::vector<long long>& vals )
+{
+  unsigned long long x = 97531;
+
+  vals.reserve( nvalues );
+  for ( int i = 0; i < nvalues; ++i ) {
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    long long v = static_cast<long long>(x >> (1 + (x >> 32) % 62));
+    vals.push_back( (x & 1) ? v : -v );
+  }
+}
+
+// values of full precision over wide range of exponents, as in num_put_perf
+void make_doubles( std::vector<double>& vals )
+{
+  unsigned x = 24680;
+
+  vals.reserve( nvalues );
+  for ( int i = 0; i < nvalues; ++i ) {
+    x = x * 1103515245U + 12345U;
+    double m = static_cast<double>(x) / 4294967296.0 + 1.0;
+    x = x * 1103515245U + 12345U;
+    m += static_cast<double>(x) / 4294967296.0 / 4294967296.0;
+    x = x * 1103515245U + 12345U;
+    vals.push_back( std::ldexp( (x & 1) ? m : -m, static_cast<int>((x >> 16) % 200) - 100 ) );
+  }
+}
+
+template <class T>
+std::string make_text( const std::vector<T>& vals )
+{
+  std::ostringstream s;
+  s << std::setprecision(17);
+  for ( typename std::vector<T>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+    s << *i << '\n';
+  }
+  return s.str();
+}
+
+} // namespace charconv_ns
+
+int EXAM_IMPL(charconv_perf::integer_output)
+{
+  using namespace charconv_ns;
+
+  std::vector<long long> vals;
+  make_integers( vals );
+  const unsigned long long n = static_cast<unsigned long long>(rounds) * vals.size();
+  const char* test = "long long to chars";
+  char buf[64];
+  size_t bytes = 0;
+
+  perf::timer tm;
+#if defined (STLPORT)
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( std::vector<long long>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      bytes += std::to_chars( buf, buf + sizeof(buf), *i ).ptr - buf;
+    }
+  }
+  perf::report( test, "to_chars", n, tm.ns() );
+#endif
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( std::vector<long long>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      bytes += std::snprintf( buf, sizeof(buf), "%lld", *i );
+    }
+  }
+  perf::report( test, "snprintf", n, tm.ns() );
+
+  std::ostringstream s;
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    s.str( std::string() );
+    for ( std::vector<long long>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      s << *i << ' ';
+    }
+    bytes += s.str().size();
+  }
+  perf::report( test, "num_put", n, tm.ns() );
+  perf::keep( bytes );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(charconv_perf::integer_input)
+{
+  using namespace charconv_ns;
+
+  std::vector<long long> vals;
+  make_integers( vals );
+  const std::string text = make_text( vals );
+  const char* test = "long long from chars";
+  long long sum = 0;
+  unsigned long long n = 0;
+
+  perf::timer tm;
+#if defined (STLPORT)
+  for ( int r = 0; r < rounds; ++r ) {
+    const char* p = text.data();
+    const char* last = p + text.size();
+    long long val;
+    for ( std::from_chars_result res; (res = std::from_chars( p, last, val )).ec == std::errc(); p = res.ptr + 1 ) {
+      sum += val;
+      ++n;
+    }
+  }
+  perf::report( test, "from_chars", n, tm.ns() );
+#endif
+
+  n = 0;
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    const char* p = text.c_str();
+    char* end;
+    for ( ;; ) {
+      long long val = std::strtoll( p, &end, 10 );
+      if ( end == p ) {
+        break;
+      }
+      sum += val;
+      ++n;
+      p = end;
+    }
+  }
+  perf::report( test, "strtoll", n, tm.ns() );
+
+  n = 0;
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::istringstream s( text );
+    long long val;
+    while ( s >> val ) {
+      sum += val;
+      ++n;
+    }
+  }
+  perf::report( test, "num_get", n, tm.ns() );
+  perf::keep( sum );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(charconv_perf::double_output)
+{
+  using namespace charconv_ns;
+
+  std::vector<double> vals;
+  make_doubles( vals );
+  const unsigned long long n = static_cast<unsigned long long>(rounds) * vals.size();
+  const char* test = "double to chars, shortest round trip";
+  char buf[64];
+  size_t bytes = 0;
+
+  perf::timer tm;
+#if defined (STLPORT)
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( std::vector<double>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      bytes += std::to_chars( buf, buf + sizeof(buf), *i ).ptr - buf;
+    }
+  }
+  perf::report( test, "to_chars", n, tm.ns() );
+#endif
+
+  // no shortest format in C library: max_digits10 is the nearest one
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( std::vector<double>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      bytes += std::snprintf( buf, sizeof(buf), "%.17g", *i );
+    }
+  }
+  perf::report( test, "snprintf %.17g", n, tm.ns() );
+
+  std::ostringstream s;
+  s << std::setprecision(17);
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    s.str( std::string() );
+    for ( std::vector<double>::const_iterator i = vals.begin(); i != vals.end(); ++i ) {
+      s << *i << ' ';
+    }
+    bytes += s.str().size();
+  }
+  perf::report( test, "num_put max_digits10", n, tm.ns() );
+  perf::keep( bytes );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(charconv_perf::double_input)
+{
+  using namespace charconv_ns;
+
+  std::vector<double> vals;
+  make_doubles( vals );
+  const std::string text = make_text( vals );
+  const char* test = "double from chars, max_digits10";
+  double sum = 0;
+  unsigned long long n = 0;
+
+  perf::timer tm;
+#if defined (STLPORT)
+  for ( int r = 0; r < rounds; ++r ) {
+    const char* p = text.data();
+    const char* last = p + text.size();
+    double val;
+    for ( std::from_chars_result res; (res = std::from_chars( p, last, val )).ec == std::errc(); p = res.ptr + 1 ) {
+      sum += val;
+      ++n;
+    }
+  }
+  perf::report( test, "from_chars", n, tm.ns() );
+#endif
+
+  n = 0;
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    const char* p = text.c_str();
+    char* end;
+    for ( ;; ) {
+      double val = std::strtod( p, &end );
+      if ( end == p ) {
+        break;
+      }
+      sum += val;
+      ++n;
+      p = end;
+    }
+  }
+  perf::report( test, "strtod", n, tm.ns() );
+
+  n = 0;
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::istringstream s( text );
+    double val;
+    while ( s >> val ) {
+      sum += val;
+      ++n;
+    }
+  }
+  perf::report( test, "num_get", n, tm.ns() );
+  perf::keep( sum );
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "deque_perf.h"
+#include "perf.h"
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <cstdio>
+
+namespace deque_ns {
+
+// 64-byte message, typical element of work queues
+struct message
+{
+    unsigned long long id;
+    char payload[56];
+};
+
+// the same, but stored 4 per block, as with old 256-byte deque blocks
+struct small_block_message :
+    public message
+{
+};
+
+} // namespace deque_ns
+
+#if defined (STLPORT)
+namespace std {
+
+template <>
+struct deque_block_traits<deque_ns::small_block_message>
+{
+    static const size_t elements = 256 / sizeof(deque_ns::small_block_message);
+};
+
+} // namespace std
+#endif
+
+namespace deque_ns {
+
+const unsigned long long nops = 10000000ULL;
+const size_t depths[] = { 16, 1024, 65536 };
+
+const char* variants[] = { "256-byte blocks", "default blocks" };
+
+unsigned long long allocs = 0;
+
+template <class T>
+class counting_allocator :
+    public std::allocator<T>
+{
+  public:
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator()
+      { }
+
+    template <class U>
+    counting_allocator( const counting_allocator<U>& )
+      { }
+
+    T* allocate( size_t n, const void* = 0 )
+      {
+        ++allocs;
+        return std::allocator<T>::allocate( n );
+      }
+};
+
+template <class T, class U>
+bool operator ==( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return true; }
+
+template <class T, class U>
+bool operator !=( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return false; }
+
+// queue of constant depth: producer push_back, consumer pop_front
+template <class Q>
+void run_fifo( const char* test, const char* variant, size_t depth )
+{
+  Q q;
+  typename Q::value_type m = typename Q::value_type();
+  unsigned long long sum = 0;
+
+  for ( size_t i = 0; i < depth; ++i ) {
+    m.id = i;
+    q.push_back( m );
+  }
+  perf::timer tm;
+  for ( unsigned long long i = 0; i < nops; ++i ) {
+    m.id = i;
+    q.push_back( m );
+    sum += q.front().id;
+    q.pop_front();
+  }
+  long long ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, variant, nops, ns );
+}
+
+// whole batch is queued, then processed
+template <class Q>
+void run_fill_drain( const char* test, const char* variant, size_t n )
+{
+  typename Q::value_type m = typename Q::value_type();
+  unsigned long long sum = 0;
+  const int rounds = static_cast<int>(nops / n);
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    Q q;
+    for ( size_t i = 0; i < n; ++i ) {
+      m.id = i;
+      q.push_back( m );
+    }
+    while ( !q.empty() ) {
+      sum += q.front().id;
+      q.pop_front();
+    }
+  }
+  long long ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * n, ns );
+}
+
+} // namespace deque_ns
+
+int EXAM_IMPL(deque_perf::fifo)
+{
+  using namespace deque_ns;
+
+  char test[64];
+  for ( size_t k = 0; k < sizeof(depths) / sizeof(depths[0]); ++k ) {
+    std::sprintf( test, "deque FIFO, depth %u", static_cast<unsigned>(depths[k]) );
+    run_fifo<std::deque<small_block_message> >( test, variants[0], depths[k] );
+    run_fifo<std::deque<message> >( test, variants[1], depths[k] );
+    run_fifo<std::list<message> >( test, "list", depths[k] );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(deque_perf::fill_drain)
+{
+  using namespace deque_ns;
+
+  const size_t sizes[] = { 1000, 1000000 };
+  char test[64];
+  for ( size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k ) {
+    std::sprintf( test, "deque fill and drain, %u messages", static_cast<unsigned>(sizes[k]) );
+    run_fill_drain<std::deque<small_block_message> >( test, variants[0], sizes[k] );
+    run_fill_drain<std::deque<message> >( test, variants[1], sizes[k] );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(deque_perf::allocations)
+{
+  using namespace deque_ns;
+
+  const unsigned long long n = 1000000ULL;
+
+  {
+    std::deque<small_block_message, counting_allocator<small_block_message> > q;
+    small_block_message m = small_block_message();
+    allocs = 0;
+    for ( unsigned long long i = 0; i < n; ++i ) {
+      q.push_back( m );
+    }
+    perf::note( "deque push_back 1M messages", variants[0], "allocations", static_cast<double>(allocs) );
+    allocs = 0;
+    for ( unsigned long long i = 0; i < n; ++i ) {
+      q.push_back( m );
+      q.pop_front();
+    }
+    perf::note( "deque FIFO 1M messages, depth 1M", variants[0], "allocations", static_cast<double>(allocs) );
+  }
+
+  {
+    std::deque<message, counting_allocator<message> > q;
+    message m = message();
+    allocs = 0;
+    for ( unsigned long long i = 0; i < n; ++i ) {
+      q.push_back( m );
+    }
+    perf::note( "deque push_back 1M messages", variants[1], "allocations", static_cast<double>(allocs) );
+    allocs = 0;
+    for ( unsigned long long i = 0; i < n; ++i ) {
+      q.push_back( m );
+      q.pop_front();
+    }
+    perf::note( "deque FIFO 1M messages, depth 1M", variants[1], "allocations", static_cast<double>(allocs) );
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "flat_hash_perf.h"
+#include "perf.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdio>
+#if defined (STLPORT)
+#  include <flat_hash_map>
+#endif
+
+namespace flat_hash_ns {
+
+#if defined (STLPORT)
+
+const int rounds = 10;
+
+template <class M, class K>
+void insert( const char* test, const char* variant, const std::vector<K>& keys )
+{
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    M m;
+    for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      m[*i] = 1;
+    }
+    perf::keep( m.size() );
+  }
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+}
+
+// probes: keys[0], keys[2], ... present, keys[1], keys[3], ... absent
+template <class M, class K>
+void lookup( const char* test, const char* variant, const std::vector<K>& keys )
+{
+  M m;
+  for ( size_t i = 0; i < keys.size(); i += 2 ) {
+    m[keys[i]] = 1;
+  }
+
+  size_t found = 0;
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds * 4; ++r ) {
+    for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      found += m.count( *i );
+    }
+  }
+  perf::keep( found );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * 4 * keys.size(), tm.ns() );
+}
+
+template <class M, class K>
+void iterate( const char* test, const char* variant, const std::vector<K>& keys )
+{
+  M m;
+  for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+    m[*i] = 1;
+  }
+
+  size_t sum = 0;
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds * 4; ++r ) {
+    for ( typename M::const_iterator i = m.begin(); i != m.end(); ++i ) {
+      sum += i->second;
+    }
+  }
+  perf::keep( sum );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * 4 * m.size(), tm.ns() );
+}
+
+typedef void (*bench_int)( const char*, const char*, const std::vector<size_t>& );
+typedef void (*bench_str)( const char*, const char*, const std::vector<std::string>& );
+
+void run( const char* what, bench_int fi, bench_int ui, bench_str fs, bench_str us )
+{
+  char test[128];
+
+  // fit in cache and much bigger than cache
+  const size_t sizes[] = { 1000, 1000000 };
+
+  for ( size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s ) {
+    std::vector<size_t> keys;
+    for ( size_t i = 0; i < sizes[s]; ++i ) {
+      keys.push_back( i * 1024 );
+    }
+    std::sprintf( test, "%s, %lu integers", what, static_cast<unsigned long>(sizes[s]) );
+    fi( test, "flat_hash_map", keys );
+    ui( test, "unordered_map", keys );
+  }
+
+  std::vector<std::string> skeys;
+  char buf[32];
+  for ( int i = 0; i < 100000; ++i ) {
+    std::sprintf( buf, "user_%08d", i * 7 );
+    skeys.push_back( buf );
+  }
+  std::sprintf( test, "%s, 100000 strings", what );
+  fs( test, "flat_hash_map", skeys );
+  us( test, "unordered_map", skeys );
+}
+
+typedef std::flat_hash_map<size_t,int> fmap_int;
+typedef std::unordered_map<size_t,int> umap_int;
+typedef std::flat_hash_map<std::string,int> fmap_str;
+typedef std::unordered_map<std::string,int> umap_str;
+
+#endif // STLPORT
+
+} // namespace flat_hash_ns
+
+int EXAM_IMPL(flat_hash_perf::insert)
+{
+#if defined (STLPORT)
+  using namespace flat_hash_ns;
+
+  run( "map insert", &flat_hash_ns::insert<fmap_int>, &flat_hash_ns::insert<umap_int>,
+       &flat_hash_ns::insert<fmap_str>, &flat_hash_ns::insert<umap_str> );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_hash_perf::lookup)
+{
+#if defined (STLPORT)
+  using namespace flat_hash_ns;
+
+  run( "map lookup, 50% hits", &flat_hash_ns::lookup<fmap_int>, &flat_hash_ns::lookup<umap_int>,
+       &flat_hash_ns::lookup<fmap_str>, &flat_hash_ns::lookup<umap_str> );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_hash_perf::iterate)
+{
+#if defined (STLPORT)
+  using namespace flat_hash_ns;
+
+  run( "map iteration", &flat_hash_ns::iterate<fmap_int>, &flat_hash_ns::iterate<umap_int>,
+       &flat_hash_ns::iterate<fmap_str>, &flat_hash_ns::iterate<umap_str> );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "flat_map_perf.h"
+#include "perf.h"
+
+#include <map>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#if defined (STLPORT)
+#  include <flat_map>
+#endif
+
+namespace flat_map_ns {
+
+#if defined (STLPORT)
+
+long long live_bytes = 0;
+
+template <class T>
+class counting_allocator :
+    public std::allocator<T>
+{
+  public:
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator()
+      { }
+
+    template <class U>
+    counting_allocator( const counting_allocator<U>& )
+      { }
+
+    T* allocate( size_t n, const void* = 0 )
+      {
+        live_bytes += static_cast<long long>(n * sizeof(T));
+        return std::allocator<T>::allocate( n );
+      }
+
+    void deallocate( T* p, size_t n )
+      {
+        live_bytes -= static_cast<long long>(n * sizeof(T));
+        std::allocator<T>::deallocate( p, n );
+      }
+};
+
+template <class T, class U>
+bool operator ==( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return true; }
+
+template <class T, class U>
+bool operator !=( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return false; }
+
+std::vector<int> random_keys( size_t n )
+{
+  std::vector<int> v( n );
+  for ( size_t i = 0; i < n; ++i ) {
+    v[i] = static_cast<int>(i) * 2;
+  }
+  std::srand( 17 );
+  for ( size_t i = n; i > 1; --i ) {
+    std::swap( v[i - 1], v[std::rand() % i] );
+  }
+  return v;
+}
+
+template <class M>
+void memory( const char* variant, const std::vector<int>& keys )
+{
+  long long before = live_bytes;
+  {
+    M m;
+    for ( size_t i = 0; i < keys.size(); ++i ) {
+      m[keys[i]] = static_cast<int>(i);
+    }
+    perf::note( "map of 1M int to int", variant, "bytes per element",
+                static_cast<double>(live_bytes - before) / static_cast<double>(keys.size()) );
+  }
+}
+
+// probes: even keys present, odd keys absent
+template <class M>
+void lookup( const char* test, const char* variant, const std::vector<int>& keys, size_t nprobes )
+{
+  M m;
+  for ( size_t i = 0; i < keys.size(); ++i ) {
+    m.insert( typename M::value_type( keys[i], 1 ) );
+  }
+
+  std::vector<int> probes( nprobes );
+  std::srand( 5 );
+  for ( size_t i = 0; i < nprobes; ++i ) {
+    probes[i] = std::rand() % static_cast<int>(keys.size() * 2);
+  }
+
+  size_t found = 0;
+  perf::timer tm;
+  for ( std::vector<int>::const_iterator i = probes.begin(); i != probes.end(); ++i ) {
+    found += m.find( *i ) != m.end();
+  }
+  long long ns = tm.ns();
+  perf::keep( found );
+  perf::report( test, variant, nprobes, ns );
+}
+
+// batches of random keys added to map with 1M elements
+template <class M>
+void range_insert( const char* test, const char* variant, const std::vector<int>& keys, size_t batch )
+{
+  M m;
+  for ( size_t i = 0; i < keys.size(); i += 2 ) {
+    m.insert( typename M::value_type( keys[i], 1 ) );
+  }
+
+  std::vector<std::pair<int,int> > add;
+  for ( size_t i = 1; i < keys.size() && add.size() < batch * 8; i += 2 ) {
+    add.push_back( std::pair<int,int>( keys[i], 2 ) );
+  }
+
+  perf::timer tm;
+  for ( size_t i = 0; i < add.size(); i += batch ) {
+    m.insert( add.begin() + i, add.begin() + std::min( i + batch, add.size() ) );
+  }
+  long long ns = tm.ns();
+  perf::keep( m );
+  perf::report( test, variant, add.size(), ns );
+}
+
+#endif // STLPORT
+
+} // namespace flat_map_ns
+
+int EXAM_IMPL(flat_map_perf::memory)
+{
+#if defined (STLPORT)
+  using namespace flat_map_ns;
+
+  std::vector<int> keys = random_keys( 1000000 );
+
+  flat_map_ns::memory<std::flat_map<int, int, std::less<int>, counting_allocator<std::pair<const int, int> > > >( "flat_map", keys );
+  flat_map_ns::memory<std::map<int, int, std::less<int>, counting_allocator<std::pair<const int, int> > > >( "map", keys );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_map_perf::lookup)
+{
+#if defined (STLPORT)
+  using namespace flat_map_ns;
+
+  // fit in L1, in L2/L3, and much bigger than cache
+  const size_t sizes[] = { 1000, 64000, 1000000 };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k ) {
+    std::vector<int> keys = random_keys( sizes[k] );
+    std::sprintf( test, "find in map of %u ints, 50%% hits", static_cast<unsigned>(sizes[k]) );
+    flat_map_ns::lookup<std::flat_map<int, int> >( test, "flat_map", keys, 4000000 );
+    flat_map_ns::lookup<std::map<int, int> >( test, "map", keys, 4000000 );
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_map_perf::range_insert)
+{
+#if defined (STLPORT)
+  using namespace flat_map_ns;
+
+  std::vector<int> keys = random_keys( 2000000 );
+  const size_t batches[] = { 1000, 100000 };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(batches) / sizeof(batches[0]); ++k ) {
+    std::sprintf( test, "insert batches of %u into map of 1M ints", static_cast<unsigned>(batches[k]) );
+    flat_map_ns::range_insert<std::flat_map<int, int> >( test, "flat_map", keys, batches[k] );
+    flat_map_ns::range_insert<std::map<int, int> >( test, "map", keys, batches[k] );
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
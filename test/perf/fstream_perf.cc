@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "fstream_perf.h"
+#include "perf.h"
+
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * Bulk transfers between file and memory in blocks of different size:
+ * small blocks go through filebuf's buffer, large ones may bypass it.
+ * write(2)/read(2) and stdio with the same blocks for reference.
+ *
+ * Scans of file under filebuf's memory-mapping policies (STLport
+ * extension): sequential, and seek to random record.
+ *
+ * Latency of log records written by several threads through one ostream,
+ * synchronous and in write-behind mode (STLport extension): percentiles
+ * show stalls of producers on write(2).
+ */
+
+namespace fstream_ns {
+
+const long long total = 64LL * 1024 * 1024; // bytes per pass
+const size_t blocks[] = { 64, 4096, 65536, 1024 * 1024 };
+const int nblocks = sizeof(blocks) / sizeof(blocks[0]);
+
+const char* src_name = "fstream_perf.src";
+const char* dst_name = "fstream_perf.dst";
+
+void fill_file( const char* name )
+{
+  std::vector<char> buf( 1024 * 1024 );
+  for ( size_t i = 0; i < buf.size(); ++i ) {
+    buf[i] = static_cast<char>( i * 131 + (i >> 8) );
+  }
+  std::FILE* f = std::fopen( name, "wb" );
+  for ( long long n = 0; n < total; n += buf.size() ) {
+    std::fwrite( &buf[0], 1, buf.size(), f );
+  }
+  std::fclose( f );
+}
+
+// "ofstream 4096" etc.
+const char* variant( char* buf, size_t bufsize, const char* what, size_t block )
+{
+  std::snprintf( buf, bufsize, "%s %lu", what, static_cast<unsigned long>(block) );
+  return buf;
+}
+
+void report( const char* test, const char* v, long long ns, size_t block )
+{
+  perf::report( test, v, static_cast<unsigned long long>(total / block), ns );
+  perf::note( test, v, "MB/s", ns == 0 ? 0.0 : static_cast<double>(total) * 1.0e3 / static_cast<double>(ns) );
+}
+
+#if defined (STLPORT)
+struct policy
+{
+    const char* name;
+    int flags;
+};
+
+const policy policies[] = {
+  { "mmap_off", std::filebuf::mmap_off },
+  { "mmap_window", std::filebuf::mmap_window },
+  { "mmap_whole", std::filebuf::mmap_whole },
+  { "mmap_whole|mmap_random", std::filebuf::mmap_whole | std::filebuf::mmap_random }
+};
+const int npolicies = sizeof(policies) / sizeof(policies[0]);
+#endif
+
+const int producers = 4;
+const int records = 200000; // per producer
+
+std::mutex* log_lock;
+std::ostream* log_stream;
+
+// time of every record, in ns
+void produce( int id, std::vector<long long>* lat )
+{
+  lat->resize( records );
+  for ( int i = 0; i < records; ++i ) {
+    perf::timer tm;
+    {
+      std::lock_guard<std::mutex> lk( *log_lock );
+      *log_stream << "producer " << id << " record " << i << " value " << i * 7919 << '\n';
+    }
+    (*lat)[i] = tm.ns();
+  }
+}
+
+void latency( const char* test, const char* v, std::ostream& s )
+{
+  std::mutex m;
+  std::vector<std::vector<long long> > lat( producers );
+  std::vector<std::thread*> thr( producers );
+
+  log_lock = &m;
+  log_stream = &s;
+
+  perf::timer tm;
+  for ( int i = 0; i < producers; ++i ) {
+    thr[i] = new std::thread( produce, i, &lat[i] );
+  }
+  for ( int i = 0; i < producers; ++i ) {
+    thr[i]->join();
+    delete thr[i];
+  }
+  s.flush();
+  perf::report( test, v, static_cast<unsigned long long>(producers) * records, tm.ns() );
+
+  std::vector<long long> all;
+  for ( int i = 0; i < producers; ++i ) {
+    all.insert( all.end(), lat[i].begin(), lat[i].end() );
+  }
+  std::sort( all.begin(), all.end() );
+  const double q[] = { 0.5, 0.99, 0.999 };
+  const char* qn[] = { "p50 ns", "p99 ns", "p99.9 ns" };
+  for ( int i = 0; i < 3; ++i ) {
+    perf::note( test, v, qn[i], static_cast<double>(all[static_cast<size_t>(q[i] * (all.size() - 1))]) );
+  }
+  perf::note( test, v, "max ns", static_cast<double>(all.back()) );
+}
+
+} // namespace fstream_ns
+
+int EXAM_IMPL(fstream_perf::bulk_write)
+{
+  using namespace fstream_ns;
+
+  const char* test = "bulk write";
+  std::vector<char> data( blocks[nblocks - 1], 'x' );
+  char v[64];
+
+  for ( int b = 0; b < nblocks; ++b ) {
+    const size_t block = blocks[b];
+
+    perf::timer tm;
+    {
+      std::ofstream out( dst_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+      for ( long long n = 0; n < total; n += block ) {
+        out.write( &data[0], block );
+      }
+    }
+    report( test, variant( v, sizeof(v), "ofstream", block ), tm.ns(), block );
+
+    tm.restart();
+    {
+      std::FILE* f = std::fopen( dst_name, "wb" );
+      for ( long long n = 0; n < total; n += block ) {
+        std::fwrite( &data[0], 1, block, f );
+      }
+      std::fclose( f );
+    }
+    report( test, variant( v, sizeof(v), "fwrite", block ), tm.ns(), block );
+
+    tm.restart();
+    {
+      int fd = ::open( dst_name, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+      for ( long long n = 0; n < total; n += block ) {
+        perf::keep( ::write( fd, &data[0], block ) );
+      }
+      ::close( fd );
+    }
+    report( test, variant( v, sizeof(v), "write", block ), tm.ns(), block );
+  }
+
+  std::remove( dst_name );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_perf::bulk_read)
+{
+  using namespace fstream_ns;
+
+  const char* test = "bulk read";
+  std::vector<char> data( blocks[nblocks - 1] );
+  char v[64];
+  long long got = 0;
+
+  fill_file( src_name );
+
+  for ( int b = 0; b < nblocks; ++b ) {
+    const size_t block = blocks[b];
+
+    perf::timer tm;
+    {
+      std::ifstream in( src_name, std::ios_base::in | std::ios_base::binary );
+      while ( in.read( &data[0], block ) ) {
+        got += in.gcount();
+      }
+    }
+    report( test, variant( v, sizeof(v), "ifstream", block ), tm.ns(), block );
+
+    tm.restart();
+    {
+      std::FILE* f = std::fopen( src_name, "rb" );
+      for ( size_t n; (n = std::fread( &data[0], 1, block, f )) != 0; ) {
+        got += n;
+      }
+      std::fclose( f );
+    }
+    report( test, variant( v, sizeof(v), "fread", block ), tm.ns(), block );
+
+    tm.restart();
+    {
+      int fd = ::open( src_name, O_RDONLY );
+      for ( ssize_t n; (n = ::read( fd, &data[0], block )) > 0; ) {
+        got += n;
+      }
+      ::close( fd );
+    }
+    report( test, variant( v, sizeof(v), "read", block ), tm.ns(), block );
+  }
+  perf::keep( got );
+
+  std::remove( src_name );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_perf::copy)
+{
+  using namespace fstream_ns;
+
+  const char* test = "file copy";
+  std::vector<char> data( blocks[nblocks - 1] );
+  char v[64];
+
+  fill_file( src_name );
+
+  for ( int b = 0; b < nblocks; ++b ) {
+    const size_t block = blocks[b];
+
+    perf::timer tm;
+    {
+      std::ifstream in( src_name, std::ios_base::in | std::ios_base::binary );
+      std::ofstream out( dst_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+      while ( in.read( &data[0], block ) || in.gcount() != 0 ) {
+        out.write( &data[0], in.gcount() );
+      }
+    }
+    report( test, variant( v, sizeof(v), "fstream", block ), tm.ns(), block );
+
+    tm.restart();
+    {
+      int in = ::open( src_name, O_RDONLY );
+      int out = ::open( dst_name, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+      for ( ssize_t n; (n = ::read( in, &data[0], block )) > 0; ) {
+        perf::keep( ::write( out, &data[0], n ) );
+      }
+      ::close( in );
+      ::close( out );
+    }
+    report( test, variant( v, sizeof(v), "read/write", block ), tm.ns(), block );
+  }
+
+  std::remove( src_name );
+  std::remove( dst_name );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_perf::mmap_sequential)
+{
+#if defined (STLPORT)
+  using namespace fstream_ns;
+
+  const char* test = "sequential scan";
+  std::vector<char> data( 4096 );
+  unsigned sum = 0;
+
+  fill_file( src_name );
+
+  for ( int i = 0; i < npolicies; ++i ) {
+    perf::timer tm;
+    {
+      std::filebuf fb;
+      fb.set_mmap_policy( policies[i].flags );
+      fb.open( src_name, std::ios_base::in | std::ios_base::binary );
+      for ( std::streamsize n; (n = fb.sgetn( &data[0], data.size() )) > 0; ) {
+        sum += static_cast<unsigned char>( data[n - 1] );
+      }
+    }
+    perf::report( test, policies[i].name, static_cast<unsigned long long>(total / data.size()), tm.ns() );
+  }
+
+  // no copy: whole file through view
+  perf::timer tm;
+  {
+    std::filebuf fb;
+    fb.set_mmap_policy( std::filebuf::mmap_whole );
+    fb.open( src_name, std::ios_base::in | std::ios_base::binary );
+    for ( const char* p; (p = fb.data()) != 0; ) {
+      std::streamsize n = fb.size();
+      for ( std::streamsize k = 0; k < n; k += data.size() ) {
+        sum += static_cast<unsigned char>( p[k] );
+      }
+      fb.pubseekoff( n, std::ios_base::cur );
+    }
+  }
+  perf::report( test, "data() view", static_cast<unsigned long long>(total / data.size()), tm.ns() );
+
+  perf::keep( sum );
+  std::remove( src_name );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_perf::mmap_random)
+{
+#if defined (STLPORT)
+  using namespace fstream_ns;
+
+  const char* test = "random record reads";
+  const int nreads = 200000;
+  const std::streamsize rec = 64;
+  char buf[64];
+  unsigned sum = 0;
+
+  fill_file( src_name );
+
+  for ( int i = 0; i < npolicies; ++i ) {
+    unsigned x = 13579;
+    perf::timer tm;
+    {
+      std::filebuf fb;
+      fb.set_mmap_policy( policies[i].flags );
+      fb.open( src_name, std::ios_base::in | std::ios_base::binary );
+      for ( int r = 0; r < nreads; ++r ) {
+        x = x * 1103515245U + 12345U;
+        fb.pubseekpos( static_cast<std::streamoff>(x % (total / rec)) * rec );
+        fb.sgetn( buf, rec );
+        sum += static_cast<unsigned char>( buf[0] );
+      }
+    }
+    perf::report( test, policies[i].name, nreads, tm.ns() );
+  }
+
+  unsigned x = 13579;
+  perf::timer tm;
+  {
+    int fd = ::open( src_name, O_RDONLY );
+    for ( int r = 0; r < nreads; ++r ) {
+      x = x * 1103515245U + 12345U;
+      perf::keep( ::pread( fd, buf, rec, static_cast<off_t>(x % (total / rec)) * rec ) );
+      sum += static_cast<unsigned char>( buf[0] );
+    }
+    ::close( fd );
+  }
+  perf::report( test, "pread", nreads, tm.ns() );
+
+  perf::keep( sum );
+  std::remove( src_name );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_perf::log_latency)
+{
+  using namespace fstream_ns;
+
+  const char* test = "log record latency";
+
+  {
+    std::ofstream out( dst_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+    latency( test, "ofstream", out );
+  }
+
+#if defined (STLPORT)
+  const size_t nbufs[] = { 2, 4, 16 };
+  char v[64];
+  for ( int i = 0; i < 3; ++i ) {
+    std::ofstream out;
+    out.rdbuf()->set_write_behind( nbufs[i] );
+    out.open( dst_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+    std::snprintf( v, sizeof(v), "write-behind %lu buffers", static_cast<unsigned long>(nbufs[i]) );
+    latency( test, v, out );
+  }
+#endif
+
+  std::remove( dst_name );
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "hash_perf.h"
+#include "perf.h"
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <cstdio>
+#include <stdint.h>
+
+namespace hash_ns {
+
+// previous hash<string>, for comparison
+struct legacy_string_hash
+{
+    size_t operator()( const std::string& s ) const
+      {
+        uint32_t h = 0;
+        for ( std::string::const_iterator i = s.begin(); i != s.end(); ++i ) {
+          h += (h << 5) + *i; // h = 33 * h + s[i]
+        }
+        return size_t(h);
+      }
+};
+
+// previous hash<> of integral types
+struct identity_hash
+{
+    size_t operator()( size_t x ) const
+      { return x; }
+};
+
+#if defined (STLPORT)
+// hash<> of integral types with _STLP_USE_INTEGER_HASH_MIX
+struct mixed_hash
+{
+    size_t operator()( size_t x ) const
+      { return _STLP_PRIV __stl_hash_mix( x ); }
+};
+#endif
+
+const int rounds = 20;
+
+template <class K, class H>
+void throughput( const char* test, const char* variant, const std::vector<K>& keys, H h )
+{
+  size_t sum = 0;
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      sum += h( *i );
+    }
+  }
+  perf::keep( sum );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+}
+
+/*
+ * Quality of distribution: sum over buckets of c*(c+1)/2 (cost of
+ * successful lookups), divided by the same value expected for uniformly
+ * random hash; 1.0 is ideal, bigger is worse.
+ */
+template <class K, class H>
+void distribution( const char* test, const char* variant, const std::vector<K>& keys, H h, size_t nb )
+{
+  std::vector<size_t> cnt( nb, 0 );
+
+  for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+    ++cnt[h( *i ) % nb];
+  }
+
+  double s = 0.0;
+  size_t max_len = 0;
+  for ( size_t i = 0; i < nb; ++i ) {
+    s += static_cast<double>(cnt[i]) * (cnt[i] + 1) / 2.0;
+    if ( cnt[i] > max_len ) {
+      max_len = cnt[i];
+    }
+  }
+  double n = static_cast<double>(keys.size());
+  double m = static_cast<double>(nb);
+  double expected = (n / (2.0 * m)) * (n + 2.0 * m - 1.0);
+
+  char buf[128];
+
+  std::sprintf( buf, "%s, %lu buckets", variant, static_cast<unsigned long>(nb) );
+  perf::note( test, buf, "quality (1.0 ideal)", s / expected );
+  perf::note( test, buf, "longest chain", static_cast<double>(max_len) );
+}
+
+template <class K, class H>
+void distributions( const char* test, const char* variant, const std::vector<K>& keys, H h )
+{
+  // bucket count that unordered_set choose for this number of elements (prime)
+  size_t prime = std::unordered_set<int>( keys.size() ).bucket_count();
+  size_t pow2 = 1;
+  while ( pow2 < keys.size() ) {
+    pow2 <<= 1;
+  }
+
+  distribution( test, variant, keys, h, prime );
+  distribution( test, variant, keys, h, pow2 );
+}
+
+void make_identifiers( std::vector<std::string>& keys, int n )
+{
+  char buf[32];
+
+  for ( int i = 0; i < n; ++i ) {
+    std::sprintf( buf, "user_%08d", i * 7 );
+    keys.push_back( buf );
+  }
+}
+
+void make_urls( std::vector<std::string>& keys, int n )
+{
+  char buf[128];
+
+  for ( int i = 0; i < n; ++i ) {
+    std::sprintf( buf, "https://www.example.com/catalog/item/%d/details?lang=en&ref=%d", i, i % 97 );
+    keys.push_back( buf );
+  }
+}
+
+void make_blobs( std::vector<std::string>& keys, int n )
+{
+  for ( int i = 0; i < n; ++i ) {
+    std::string s( 1024, 'x' );
+    std::sprintf( &s[0], "%d", i ); // differ in first bytes only
+    s[s.size() - 1] = static_cast<char>(i);
+    keys.push_back( s );
+  }
+}
+
+template <class H1, class H2>
+void string_set( const char* test, const std::vector<std::string>& keys, H1 h1, H2 h2 )
+{
+  throughput( test, "word by word", keys, h1 );
+  throughput( test, "33 * h + c", keys, h2 );
+  distributions( test, "word by word", keys, h1 );
+  distributions( test, "33 * h + c", keys, h2 );
+}
+
+void integer_set( const char* test, const std::vector<size_t>& keys )
+{
+#if defined (STLPORT)
+  throughput( test, "mixed", keys, mixed_hash() );
+#endif
+  throughput( test, "identity", keys, identity_hash() );
+#if defined (STLPORT)
+  distributions( test, "mixed", keys, mixed_hash() );
+#endif
+  distributions( test, "identity", keys, identity_hash() );
+}
+
+} // namespace hash_ns
+
+int EXAM_IMPL(hash_perf::strings)
+{
+  using namespace hash_ns;
+
+  std::vector<std::string> keys;
+
+  make_identifiers( keys, 100000 );
+  string_set( "string hash, 13 chars ids", keys, std::hash<std::string>(), legacy_string_hash() );
+
+  keys.clear();
+  make_urls( keys, 100000 );
+  string_set( "string hash, urls", keys, std::hash<std::string>(), legacy_string_hash() );
+
+  keys.clear();
+  make_blobs( keys, 5000 );
+  string_set( "string hash, 1 KiB keys", keys, std::hash<std::string>(), legacy_string_hash() );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(hash_perf::integers)
+{
+  using namespace hash_ns;
+
+  std::vector<size_t> keys;
+
+  for ( size_t i = 0; i < 100000; ++i ) {
+    keys.push_back( i );
+  }
+  integer_set( "integer hash, sequential ids", keys );
+
+  keys.clear();
+  for ( size_t i = 0; i < 100000; ++i ) {
+    keys.push_back( i * 1024 );
+  }
+  integer_set( "integer hash, ids with step 1024", keys );
+
+  // heap pointers: aligned, so low bits are the same
+  std::vector<int*> p;
+  keys.clear();
+  for ( int i = 0; i < 100000; ++i ) {
+    p.push_back( new int( i ) );
+    keys.push_back( reinterpret_cast<size_t>(p.back()) );
+  }
+  integer_set( "integer hash, heap pointers", keys );
+
+  std::vector<void*> vp( p.begin(), p.end() );
+  throughput( "pointer hash", "hash<void*>", vp, std::hash<void*>() );
+  distributions( "pointer hash", "hash<void*>", vp, std::hash<void*>() );
+
+  for ( std::vector<int*>::iterator i = p.begin(); i != p.end(); ++i ) {
+    delete *i;
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "hashtable_perf.h"
+#include "perf.h"
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <cstdio>
+
+namespace hashtable_ns {
+
+#if defined (STLPORT)
+
+// Internal hashtable with explicit bucket policy, as unordered_set use it.
+template <class K, class Bkt>
+struct table
+{
+    typedef _STLP_PRIV hashtable<K, K, std::hash<K>, _STLP_PRIV _Identity<K>,
+                                 std::equal_to<K>, std::allocator<K>, Bkt> type;
+};
+
+const int rounds = 10;
+
+template <class K, class Bkt>
+void insert( const char* test, const char* variant, const std::vector<K>& keys )
+{
+  typedef typename table<K,Bkt>::type ht_type;
+
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    ht_type ht( 0, std::hash<K>(), std::equal_to<K>() );
+    for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      ht.insert_unique( *i );
+    }
+    perf::keep( ht.size() );
+  }
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+}
+
+/*
+ * Half of lookups are for keys that are absent (probe is a key from
+ * other half of keys, not inserted).
+ */
+template <class K, class Bkt>
+void lookup( const char* test, const char* variant, const std::vector<K>& keys )
+{
+  typedef typename table<K,Bkt>::type ht_type;
+
+  ht_type ht( 0, std::hash<K>(), std::equal_to<K>() );
+  for ( size_t i = 0; i < keys.size(); i += 2 ) {
+    ht.insert_unique( keys[i] );
+  }
+
+  size_t found = 0;
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds * 4; ++r ) {
+    for ( typename std::vector<K>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      found += ht.count( *i );
+    }
+  }
+  perf::keep( found );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * 4 * keys.size(), tm.ns() );
+
+  char buf[64];
+
+  std::sprintf( buf, "%s, load %.2f", variant, static_cast<double>(ht.load_factor()) );
+  perf::note( test, buf, "buckets", static_cast<double>(ht.bucket_count()) );
+}
+
+template <class K>
+void both( const char* test, const std::vector<K>& keys, bool is_insert )
+{
+  if ( is_insert ) {
+    insert<K,_STLP_PRIV _Stl_prime_type>( test, "prime, modulo", keys );
+    insert<K,_STLP_PRIV _Stl_pow2_type>( test, "power of 2, mask", keys );
+  } else {
+    lookup<K,_STLP_PRIV _Stl_prime_type>( test, "prime, modulo", keys );
+    lookup<K,_STLP_PRIV _Stl_pow2_type>( test, "power of 2, mask", keys );
+  }
+}
+
+void run( bool is_insert )
+{
+  const char* what = is_insert ? "insert" : "lookup";
+  char test[128];
+
+  // table fit in cache, and table much bigger than cache
+  const size_t sizes[] = { 1000, 1000000 };
+
+  for ( size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s ) {
+    std::vector<size_t> ikeys;
+    for ( size_t i = 0; i < sizes[s]; ++i ) {
+      ikeys.push_back( i * 1024 ); // regular low bits
+    }
+    std::sprintf( test, "hashtable %s, %lu integers with step 1024", what, static_cast<unsigned long>(sizes[s]) );
+    both( test, ikeys, is_insert );
+
+    ikeys.clear();
+    for ( size_t i = 0; i < sizes[s]; ++i ) {
+      ikeys.push_back( i );
+    }
+    std::sprintf( test, "hashtable %s, %lu sequential integers", what, static_cast<unsigned long>(sizes[s]) );
+    both( test, ikeys, is_insert );
+  }
+
+  std::vector<std::string> skeys;
+  char buf[32];
+  for ( int i = 0; i < 100000; ++i ) {
+    std::sprintf( buf, "user_%08d", i * 7 );
+    skeys.push_back( buf );
+  }
+  std::sprintf( test, "hashtable %s, 100000 strings", what );
+  both( test, skeys, is_insert );
+}
+
+#endif // STLPORT
+
+} // namespace hashtable_ns
+
+int EXAM_IMPL(hashtable_perf::insert)
+{
+#if defined (STLPORT)
+  hashtable_ns::run( true );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(hashtable_perf::lookup)
+{
+#if defined (STLPORT)
+  hashtable_ns::run( false );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
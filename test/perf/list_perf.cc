@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "list_perf.h"
+#include "perf.h"
+
+#include <list>
+#include <forward_list>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace list_ns {
+
+const unsigned long long nelems = 10000000ULL;
+
+// list used as work queue: filled and drained again and again
+template <class L>
+void fill_drain( const char* test, const char* variant, size_t depth, bool pool )
+{
+  const int rounds = static_cast<int>(nelems / depth);
+  L l;
+#if defined (STLPORT)
+  if ( pool ) {
+    l.reserve_nodes( depth );
+  }
+#endif
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    for ( size_t i = 0; i < depth; ++i ) {
+      l.push_front( static_cast<int>(i) );
+    }
+    while ( !l.empty() ) {
+      sum += l.front();
+      l.pop_front();
+    }
+  }
+  long long ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * depth, ns );
+}
+
+std::vector<int> keys( size_t n, int kind )
+{
+  std::vector<int> v( n );
+  std::srand( 17 );
+  for ( size_t i = 0; i < n; ++i ) {
+    switch ( kind ) {
+      case 0: // random
+        v[i] = std::rand();
+        break;
+      case 1: // sorted
+        v[i] = static_cast<int>(i);
+        break;
+      default: // sorted, with 1% random values
+        v[i] = std::rand() % 100 == 0 ? std::rand() : static_cast<int>(i);
+        break;
+    }
+  }
+  return v;
+}
+
+template <class L>
+void run_sort( const char* test, const char* variant, const std::vector<int>& v )
+{
+  const int rounds = std::max( 1, static_cast<int>(nelems / 4 / v.size()) );
+  long long ns = 0;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    L l( v.begin(), v.end() );
+    perf::timer tm;
+    l.sort();
+    ns += tm.ns();
+    perf::keep( l );
+  }
+  perf::report( test, variant, static_cast<unsigned long long>(rounds) * v.size(), ns );
+}
+
+// reference: copy to vector, sort there and copy back
+template <class L>
+void run_vector_sort( const char* test, const std::vector<int>& v )
+{
+  const int rounds = std::max( 1, static_cast<int>(nelems / 4 / v.size()) );
+  long long ns = 0;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    L l( v.begin(), v.end() );
+    perf::timer tm;
+    std::vector<int> tmp( l.begin(), l.end() );
+    std::sort( tmp.begin(), tmp.end() );
+    std::copy( tmp.begin(), tmp.end(), l.begin() );
+    ns += tm.ns();
+    perf::keep( l );
+  }
+  perf::report( test, "copy, vector sort, copy back", static_cast<unsigned long long>(rounds) * v.size(), ns );
+}
+
+} // namespace list_ns
+
+int EXAM_IMPL(list_perf::node_pool)
+{
+  using namespace list_ns;
+
+  const size_t depths[] = { 16, 1024, 65536 };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(depths) / sizeof(depths[0]); ++k ) {
+    std::sprintf( test, "list fill and drain, depth %u", static_cast<unsigned>(depths[k]) );
+    fill_drain<std::list<int> >( test, "allocator", depths[k], false );
+#if defined (STLPORT)
+    fill_drain<std::list<int> >( test, "node pool", depths[k], true );
+#endif
+    std::sprintf( test, "forward_list fill and drain, depth %u", static_cast<unsigned>(depths[k]) );
+    fill_drain<std::forward_list<int> >( test, "allocator", depths[k], false );
+#if defined (STLPORT)
+    fill_drain<std::forward_list<int> >( test, "node pool", depths[k], true );
+#endif
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(list_perf::sort)
+{
+  using namespace list_ns;
+
+  const size_t sizes[] = { 1000, 1000000 };
+  const char* kinds[] = { "random", "sorted", "nearly sorted" };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k ) {
+    for ( int kind = 0; kind < 3; ++kind ) {
+      std::vector<int> v = keys( sizes[k], kind );
+      std::sprintf( test, "sort of %u %s ints", static_cast<unsigned>(sizes[k]), kinds[kind] );
+      run_sort<std::list<int> >( test, "list::sort", v );
+      run_sort<std::forward_list<int> >( test, "forward_list::sort", v );
+      run_vector_sort<std::list<int> >( test, v );
+    }
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "num_get_perf.h"
+#include "perf.h"
+
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace num_get_ns {
+
+const int nvalues = 200000;
+const int rounds = 5;
+
+/*
+ * Large numeric text, as in CSV or JSON files: values with short decimal
+ * representation (prices, measurements: n / 100), values written with
+ * max_digits10 over wide range of exponents (dumps of computation
+ * results), and integers of up to 10 digits.
+ */
+void make_text( std::string* text )
+{
+  std::ostringstream s[3];
+  unsigned x = 13579;
+
+  s[1] << std::setprecision(17);
+  for ( int i = 0; i < nvalues; ++i ) {
+    x = x * 1103515245U + 12345U;
+    s[0] << static_cast<double>(x >> 12) / 100.0 << '\n';
+    x = x * 1103515245U + 12345U;
+    double m = static_cast<double>(x) / 4294967296.0 + 1.0;
+    x = x * 1103515245U + 12345U;
+    m += static_cast<double>(x) / 4294967296.0 / 4294967296.0;
+    x = x * 1103515245U + 12345U;
+    s[1] << std::ldexp( (x & 1) ? m : -m, static_cast<int>((x >> 16) % 200) - 100 ) << '\n';
+    x = x * 1103515245U + 12345U;
+    s[2] << x << '\n';
+  }
+  for ( int k = 0; k < 3; ++k ) {
+    text[k] = s[k].str();
+  }
+}
+
+const char* kinds[] = { "short values", "max_digits10 values", "integers" };
+
+} // namespace num_get_ns
+
+int EXAM_IMPL(num_get_perf::istream_double)
+{
+  using namespace num_get_ns;
+
+  std::string text[3];
+  make_text( text );
+
+  char test[128];
+  for ( int k = 0; k < 3; ++k ) {
+    double sum = 0.0;
+    unsigned long long n = 0;
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      std::istringstream s( text[k] );
+      double val;
+      while ( s >> val ) {
+        sum += val;
+        ++n;
+      }
+    }
+    long long ns = tm.ns();
+    perf::keep( sum );
+    std::sprintf( test, "istream >> double, %s", kinds[k] );
+    perf::report( test, "num_get", n, ns );
+  }
+
+  return EXAM_RESULT;
+}
+
+// the same text by C library, for reference
+int EXAM_IMPL(num_get_perf::strtod_double)
+{
+  using namespace num_get_ns;
+
+  std::string text[3];
+  make_text( text );
+
+  char test[128];
+  for ( int k = 0; k < 3; ++k ) {
+    double sum = 0.0;
+    unsigned long long n = 0;
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      const char* p = text[k].c_str();
+      char* end;
+      for ( ;; ) {
+        double val = std::strtod( p, &end );
+        if ( end == p ) {
+          break;
+        }
+        sum += val;
+        ++n;
+        p = end;
+      }
+    }
+    long long ns = tm.ns();
+    perf::keep( sum );
+    std::sprintf( test, "istream >> double, %s", kinds[k] );
+    perf::report( test, "strtod", n, ns );
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "num_put_perf.h"
+#include "perf.h"
+
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+namespace num_put_ns {
+
+const int nvalues = 200000;
+const int rounds = 5;
+
+/*
+ * Two kinds of input: values with short decimal representation (prices,
+ * measurements: n / 100), and values of full precision over wide range
+ * of exponents (results of computations).
+ */
+void make_values( std::vector<double>& short_vals, std::vector<double>& long_vals )
+{
+  unsigned x = 24680;
+
+  short_vals.reserve( nvalues );
+  long_vals.reserve( nvalues );
+  for ( int i = 0; i < nvalues; ++i ) {
+    x = x * 1103515245U + 12345U;
+    short_vals.push_back( static_cast<double>(x >> 12) / 100.0 );
+    x = x * 1103515245U + 12345U;
+    double m = static_cast<double>(x) / 4294967296.0 + 1.0;
+    x = x * 1103515245U + 12345U;
+    m += static_cast<double>(x) / 4294967296.0 / 4294967296.0;
+    x = x * 1103515245U + 12345U;
+    long_vals.push_back( std::ldexp( (x & 1) ? m : -m, static_cast<int>((x >> 16) % 200) - 100 ) );
+  }
+}
+
+struct format
+{
+    const char* name;
+    std::ios_base::fmtflags flags;
+    int precision;
+    const char* printf_format;
+};
+
+const format formats[] = {
+  { "default", std::ios_base::fmtflags(0), 6, "%.*g" },
+  { "max_digits10", std::ios_base::fmtflags(0), 17, "%.*g" },
+  { "fixed 2", std::ios_base::fixed, 2, "%.*f" },
+  { "scientific 10", std::ios_base::scientific, 10, "%.*e" }
+};
+
+const char* kinds[] = { "short values", "long values" };
+
+} // namespace num_put_ns
+
+int EXAM_IMPL(num_put_perf::ostream_double)
+{
+  using namespace num_put_ns;
+
+  std::vector<double> vals[2];
+  make_values( vals[0], vals[1] );
+
+  char test[128];
+  for ( size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f ) {
+    for ( int k = 0; k < 2; ++k ) {
+      std::ostringstream s;
+      s.flags( formats[f].flags );
+      s.precision( formats[f].precision );
+      size_t bytes = 0;
+      perf::timer tm;
+      for ( int r = 0; r < rounds; ++r ) {
+        s.str( std::string() );
+        for ( std::vector<double>::const_iterator i = vals[k].begin(); i != vals[k].end(); ++i ) {
+          s << *i << ' ';
+        }
+        bytes += s.str().size();
+      }
+      long long ns = tm.ns();
+      perf::keep( bytes );
+      std::sprintf( test, "ostream << double, %s, %s", formats[f].name, kinds[k] );
+      perf::report( test, "num_put", static_cast<unsigned long long>(rounds) * vals[k].size(), ns );
+    }
+  }
+
+  return EXAM_RESULT;
+}
+
+// the same formats by C library, for reference
+int EXAM_IMPL(num_put_perf::snprintf_double)
+{
+  using namespace num_put_ns;
+
+  std::vector<double> vals[2];
+  make_values( vals[0], vals[1] );
+
+  char test[128];
+  char buf[512];
+  for ( size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f ) {
+    for ( int k = 0; k < 2; ++k ) {
+      size_t bytes = 0;
+      perf::timer tm;
+      for ( int r = 0; r < rounds; ++r ) {
+        for ( std::vector<double>::const_iterator i = vals[k].begin(); i != vals[k].end(); ++i ) {
+          bytes += std::snprintf( buf, sizeof(buf), formats[f].printf_format, formats[f].precision, *i );
+        }
+      }
+      long long ns = tm.ns();
+      perf::keep( bytes );
+      std::sprintf( test, "ostream << double, %s, %s", formats[f].name, kinds[k] );
+      perf::report( test, "snprintf", static_cast<unsigned long long>(rounds) * vals[k].size(), ns );
+    }
+  }
+
+  return EXAM_RESULT;
+}
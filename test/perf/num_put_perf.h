@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef __TEST_NUM_PUT_PERF_H
+#define __TEST_NUM_PUT_PERF_H
+
+#define __FIT_EXAM
+
+#include <exam/suite.h>
+
+class num_put_perf
+{
+  public:
+    int EXAM_DECL(ostream_double);
+    int EXAM_DECL(snprintf_double);
+};
+
+#endif // __TEST_NUM_PUT_PERF_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef __TEST_PERF_H
+#define __TEST_PERF_H
+
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+
+/*
+ * Helpers for performance test cases: all of them measure wall time
+ * of some loop and print one line per measurement:
+ *
+ *   <test> [<variant>]: <n> ops, <ns> ns/op, <rate> Mops/s
+ */
+
+namespace perf {
+
+class timer
+{
+  public:
+    timer() :
+        _start( std::chrono::steady_clock::now() )
+      { }
+
+    void restart()
+      { _start = std::chrono::steady_clock::now(); }
+
+    // nanoseconds since construction or last restart
+    long long ns() const
+      { return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - _start ).count(); }
+
+  private:
+    std::chrono::steady_clock::time_point _start;
+};
+
+inline void report( const char* test, const char* variant, unsigned long long n, long long ns )
+{
+  double per_op = n == 0 ? 0.0 : static_cast<double>(ns) / static_cast<double>(n);
+  double rate = ns == 0 ? 0.0 : static_cast<double>(n) * 1.0e3 / static_cast<double>(ns);
+
+  std::printf( "%s [%s]: %llu ops, %.2f ns/op, %.2f Mops/s\n", test, variant, n, per_op, rate );
+}
+
+// free-form line, for values that aren't time (distribution, memory, etc.)
+inline void note( const char* test, const char* variant, const char* what, double value )
+{
+  std::printf( "%s [%s]: %s %.4f\n", test, variant, what, value );
+}
+
+inline unsigned ncpu()
+{
+  long n = ::sysconf( _SC_NPROCESSORS_ONLN );
+
+  return n > 0 ? static_cast<unsigned>(n) : 1U;
+}
+
+// prevent optimizer from throwing away results of measured code
+template <class T>
+inline void keep( const T& v )
+{
+#ifdef __GNUC__
+  __asm__ __volatile__ ( "" : : "g" (&v) : "memory" );
+#else
+  static const void* volatile sink;
+  sink = &v;
+#endif
+}
+
+} // namespace perf
+
+#endif // __TEST_PERF_H
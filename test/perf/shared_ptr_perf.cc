@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "shared_ptr_perf.h"
+#include "perf.h"
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+
+#if defined (STLPORT)
+
+namespace shared_ptr_ns {
+
+const int rounds = 1000000;
+
+struct payload
+{
+    payload() :
+        v( 0 )
+      { }
+
+    long v;
+};
+
+std::barrier* start;
+std::shared_ptr<payload>* src;
+std::weak_ptr<payload>* wsrc;
+std::mutex* guard;
+
+// lock-free counters: concurrent copies of the same shared_ptr are safe
+void copy_atomic()
+{
+  start->wait();
+
+  for ( int r = 0; r < rounds; ++r ) {
+    std::shared_ptr<payload> p( *src );
+    perf::keep( p );
+  }
+}
+
+// the way shared_ptr handles were passed between threads while counters
+// weren't thread safe: every copy and destroy under mutex
+void copy_mutex()
+{
+  start->wait();
+
+  for ( int r = 0; r < rounds; ++r ) {
+    std::shared_ptr<payload>* p;
+    {
+      std::lock_guard<std::mutex> lk( *guard );
+      p = new std::shared_ptr<payload>( *src );
+    }
+    perf::keep( p );
+    {
+      std::lock_guard<std::mutex> lk( *guard );
+      delete p;
+    }
+  }
+}
+
+void weak_lock()
+{
+  start->wait();
+
+  for ( int r = 0; r < rounds; ++r ) {
+    std::shared_ptr<payload> p( wsrc->lock() );
+    perf::keep( p );
+  }
+}
+
+typedef void (*func_type)();
+
+// run f in 1, 2, 4, ... threads (number of CPUs as the last step)
+void scale( const char* test, const char* variant, func_type f )
+{
+  const unsigned max_thr = perf::ncpu();
+
+  for ( unsigned n = 1; n <= max_thr; n = (n < max_thr && n * 2 > max_thr) ? max_thr : n * 2 ) {
+    std::barrier bar( n + 1 );
+    std::vector<std::thread*> thr( n );
+
+    start = &bar;
+    for ( unsigned i = 0; i < n; ++i ) {
+      thr[i] = new std::thread( f );
+    }
+
+    bar.wait();
+    perf::timer tm;
+    for ( unsigned i = 0; i < n; ++i ) {
+      thr[i]->join();
+      delete thr[i];
+    }
+    long long ns = tm.ns();
+
+    char buf[64];
+
+    std::sprintf( buf, "%s, %u threads", variant, n );
+    perf::report( test, buf, static_cast<unsigned long long>(rounds) * n, ns );
+  }
+}
+
+} // namespace shared_ptr_ns
+
+#endif
+
+int EXAM_IMPL(shared_ptr_perf::copy_contention)
+{
+#if defined (STLPORT)
+  using namespace shared_ptr_ns;
+
+  std::shared_ptr<payload> p( new payload() );
+  std::mutex mtx;
+
+  src = &p;
+  guard = &mtx;
+
+  scale( "shared_ptr copy/destroy", "atomic counters", copy_atomic );
+  scale( "shared_ptr copy/destroy", "mutex guarded", copy_mutex );
+
+  EXAM_CHECK( p.use_count() == 1 );
+
+  src = 0;
+  guard = 0;
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(shared_ptr_perf::weak_lock_contention)
+{
+#if defined (STLPORT)
+  using namespace shared_ptr_ns;
+
+  std::shared_ptr<payload> p( std::make_shared<payload>() );
+  std::weak_ptr<payload> w( p );
+
+  wsrc = &w;
+
+  scale( "weak_ptr lock", "atomic counters", weak_lock );
+
+  EXAM_CHECK( p.use_count() == 1 );
+
+  wsrc = 0;
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(shared_ptr_perf::creation)
+{
+#if defined (STLPORT)
+  using namespace shared_ptr_ns;
+
+  perf::timer tm;
+
+  for ( int r = 0; r < rounds; ++r ) {
+    std::shared_ptr<payload> p( new payload() );
+    perf::keep( p );
+  }
+  perf::report( "shared_ptr creation", "new, two allocations", rounds, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::shared_ptr<payload> p( std::make_shared<payload>() );
+    perf::keep( p );
+  }
+  perf::report( "shared_ptr creation", "make_shared, one allocation", rounds, tm.ns() );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
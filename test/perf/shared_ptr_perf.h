@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef __TEST_SHARED_PTR_PERF_H
+#define __TEST_SHARED_PTR_PERF_H
+
+#define __FIT_EXAM
+
+#include <exam/suite.h>
+
+class shared_ptr_perf
+{
+  public:
+    int EXAM_DECL(copy_contention);
+    int EXAM_DECL(weak_lock_contention);
+    int EXAM_DECL(creation);
+};
+
+#endif // __TEST_SHARED_PTR_PERF_H
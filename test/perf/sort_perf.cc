@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "sort_perf.h"
+#include "perf.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <algorithm>
+#include <execution>
+#include <cstdio>
+
+namespace sort_ns {
+
+const size_t n = 10000000;
+const int rounds = 3;
+
+std::vector<double> random_input()
+{
+  std::vector<double> v( n );
+  unsigned long long r = 1;
+  for ( size_t i = 0; i < n; ++i ) {
+    r = r * 6364136223846793005ULL + 1442695040888963407ULL;
+    v[i] = static_cast<double>(r >> 11);
+  }
+  return v;
+}
+
+// comparator that isn't std::less, so sort() doesn't use radix sort
+template <class T>
+struct user_less
+{
+    bool operator()( const T& a, const T& b ) const
+      { return a < b; }
+};
+
+// comparison sort in both serial and parallel runs, so that speedup is
+// of threads only (radix sort is timed by radix_vs_comparison)
+struct sort_op
+{
+    void operator()( std::vector<double>& v )
+      { std::sort( v.begin(), v.end(), user_less<double>() ); }
+
+    void operator()( const std::execution::parallel_policy& pol, std::vector<double>& v )
+      { std::sort( pol, v.begin(), v.end(), user_less<double>() ); }
+};
+
+struct stable_sort_op
+{
+    void operator()( std::vector<double>& v )
+      { std::stable_sort( v.begin(), v.end() ); }
+
+    void operator()( const std::execution::parallel_policy& pol, std::vector<double>& v )
+      { std::stable_sort( pol, v.begin(), v.end() ); }
+};
+
+struct nth_element_op
+{
+    void operator()( std::vector<double>& v )
+      { std::nth_element( v.begin(), v.begin() + v.size() / 2, v.end() ); }
+
+    void operator()( const std::execution::parallel_policy& pol, std::vector<double>& v )
+      { std::nth_element( pol, v.begin(), v.begin() + v.size() / 2, v.end() ); }
+};
+
+// serial algorithm, then par with 1, 2, 4, ... threads and number of CPUs
+template <class Op>
+void scaling( const char* test )
+{
+  const std::vector<double> input = random_input();
+  std::vector<double> v;
+  Op op;
+
+  long long ns = 0;
+  for ( int k = 0; k < rounds; ++k ) {
+    v = input;
+    perf::timer tm;
+    op( v );
+    ns += tm.ns();
+  }
+  perf::keep( v );
+  perf::report( test, "serial", rounds * n, ns );
+  const double serial_ns = static_cast<double>(ns);
+
+  const unsigned max_thr = perf::ncpu();
+  for ( unsigned t = 1; t <= max_thr; t = (t < max_thr && t * 2 > max_thr) ? max_thr : t * 2 ) {
+    std::execution::parallel_policy pol( t );
+    ns = 0;
+    for ( int k = 0; k < rounds; ++k ) {
+      v = input;
+      perf::timer tm;
+      op( pol, v );
+      ns += tm.ns();
+    }
+    perf::keep( v );
+
+    char buf[64];
+    std::sprintf( buf, "par, %u threads", t );
+    perf::report( test, buf, rounds * n, ns );
+    perf::note( test, buf, "speedup vs serial", serial_ns / static_cast<double>(ns) );
+  }
+}
+
+template <class T>
+void radix_vs_comparison( const char* test, size_t m )
+{
+  std::vector<T> input( m );
+  unsigned long long r = 1;
+  for ( size_t i = 0; i < m; ++i ) {
+    r = r * 6364136223846793005ULL + 1442695040888963407ULL;
+    input[i] = static_cast<T>(static_cast<long long>(r) >> 8);
+  }
+  std::vector<T> v( input );
+
+  perf::timer tm;
+  std::sort( v.begin(), v.end(), user_less<T>() );
+  long long cmp_ns = tm.ns();
+  perf::keep( v );
+  perf::report( test, "comparison sort", m, cmp_ns );
+
+  v = input;
+  tm.restart();
+  std::sort( v.begin(), v.end() );
+  long long ns = tm.ns();
+  perf::keep( v );
+  perf::report( test, "sort (radix)", m, ns );
+  perf::note( test, "sort (radix)", "speedup vs comparison sort", static_cast<double>(cmp_ns) / static_cast<double>(ns) );
+}
+
+const size_t dn = 1000000;
+
+const char* const dist_name[] = {
+  "random", "sorted", "reversed", "organ pipe", "few distinct", "sorted, 1% noise"
+};
+
+const int dists = sizeof(dist_name) / sizeof(dist_name[0]);
+
+int dist_value( int dist, size_t i, unsigned long long& r )
+{
+  r = r * 6364136223846793005ULL + 1442695040888963407ULL;
+  int x = static_cast<int>(r >> 33);
+  switch ( dist ) {
+    case 0:
+      return x;
+    case 1:
+      return static_cast<int>(i);
+    case 2:
+      return static_cast<int>(dn - i);
+    case 3:
+      return static_cast<int>(i < dn / 2 ? i : dn - i);
+    case 4:
+      return x % 16;
+  }
+  return x % 100 == 0 ? x : static_cast<int>(i);
+}
+
+template <class C>
+void time_sort( const char* test, const char* variant, const C& input )
+{
+  C v( input );
+  perf::timer tm;
+  std::sort( v.begin(), v.end(), user_less<typename C::value_type>() );
+  perf::keep( v );
+  perf::report( test, variant, v.size(), tm.ns() );
+}
+
+template <class C>
+void time_sort_default( const char* test, const char* variant, const C& input )
+{
+  C v( input );
+  perf::timer tm;
+  std::sort( v.begin(), v.end() );
+  perf::keep( v );
+  perf::report( test, variant, v.size(), tm.ns() );
+}
+
+} // namespace sort_ns
+
+int EXAM_IMPL(sort_perf::sort_scaling)
+{
+  sort_ns::scaling<sort_ns::sort_op>( "sort 10M doubles, user's less" );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sort_perf::stable_sort_scaling)
+{
+  sort_ns::scaling<sort_ns::stable_sort_op>( "stable_sort 10M doubles" );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sort_perf::nth_element_scaling)
+{
+  sort_ns::scaling<sort_ns::nth_element_op>( "nth_element 10M doubles, median" );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sort_perf::radix_vs_comparison)
+{
+  sort_ns::radix_vs_comparison<int>( "sort 1M ints", 1000000 );
+  sort_ns::radix_vs_comparison<int>( "sort 10M ints", 10000000 );
+  sort_ns::radix_vs_comparison<int>( "sort 100M ints", 100000000 );
+  sort_ns::radix_vs_comparison<double>( "sort 1M doubles", 1000000 );
+  sort_ns::radix_vs_comparison<double>( "sort 10M doubles", 10000000 );
+  sort_ns::radix_vs_comparison<double>( "sort 100M doubles", 100000000 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sort_perf::distributions)
+{
+  using namespace sort_ns;
+
+  for ( int d = 0; d < dists; ++d ) {
+    std::vector<int> v( dn );
+    unsigned long long r = 1;
+    for ( size_t i = 0; i < dn; ++i ) {
+      v[i] = dist_value( d, i, r );
+    }
+    char buf[64];
+    std::sprintf( buf, "sort 1M, %s", dist_name[d] );
+
+    // deque: no radix sort, cheap comparison (branchless partition)
+    time_sort_default( buf, "ints in deque", std::deque<int>( v.begin(), v.end() ) );
+    // user's comparator: partition with branches
+    time_sort( buf, "ints, user's less", v );
+
+    std::vector<std::string> s( dn );
+    char num[16];
+    for ( size_t i = 0; i < dn; ++i ) {
+      std::sprintf( num, "%011d", v[i] );
+      s[i] = num;
+    }
+    time_sort_default( buf, "strings", s );
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "sstream_perf.h"
+#include "perf.h"
+
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <cstdio>
+
+/*
+ * Formatting of large text in ostringstream: tabular report of numbers
+ * and names, and output char by char.  Contents are taken with str()
+ * (copy), and, in STLport, after reserve() and with move out of str().
+ */
+
+namespace sstream_ns {
+
+const int rows = 200000; // report lines, about 14 MB
+const int rounds = 5;
+
+const char* names[] = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" };
+
+void format( std::ostream& s )
+{
+  for ( int i = 0; i < rows; ++i ) {
+    s << std::setw( 8 ) << i << ' '
+      << std::setw( 10 ) << names[i % 8] << ' '
+      << std::setw( 12 ) << std::fixed << std::setprecision( 3 ) << i * 1.25 << ' '
+      << std::setw( 10 ) << (i * 7919) % 100003 << " |" << '\n';
+  }
+}
+
+} // namespace sstream_ns
+
+int EXAM_IMPL(sstream_perf::report)
+{
+  using namespace sstream_ns;
+
+  const char* test = "report formatting";
+  size_t len = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    std::ostringstream s;
+    format( s );
+    std::string res = s.str();
+    len += res.size();
+  }
+  perf::report( test, "str()", static_cast<unsigned long long>(rows) * rounds, tm.ns() );
+
+#if defined (STLPORT)
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::ostringstream s;
+    format( s );
+    std::string res = std::move( s ).str();
+    len += res.size();
+  }
+  perf::report( test, "move str()", static_cast<unsigned long long>(rows) * rounds, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    std::ostringstream s;
+    s.reserve( 64 * rows );
+    format( s );
+    std::string res = std::move( s ).str();
+    len += res.size();
+  }
+  perf::report( test, "reserve, move str()", static_cast<unsigned long long>(rows) * rounds, tm.ns() );
+#endif
+
+  perf::keep( len );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sstream_perf::char_output)
+{
+  using namespace sstream_ns;
+
+  const char* test = "char output";
+  const int n = 16 * 1024 * 1024;
+  size_t len = 0;
+
+  perf::timer tm;
+  {
+    std::ostringstream s;
+    for ( int i = 0; i < n; ++i ) {
+      s.put( static_cast<char>('a' + (i & 15)) );
+    }
+    len += s.str().size();
+  }
+  perf::report( test, "ostream::put", n, tm.ns() );
+
+  tm.restart();
+  {
+    std::stringbuf sb;
+    for ( int i = 0; i < n; ++i ) {
+      sb.sputc( static_cast<char>('a' + (i & 15)) );
+    }
+    len += sb.str().size();
+  }
+  perf::report( test, "stringbuf::sputc", n, tm.ns() );
+
+  tm.restart();
+  {
+    std::string str;
+    for ( int i = 0; i < n; ++i ) {
+      str.push_back( static_cast<char>('a' + (i & 15)) );
+    }
+    len += str.size();
+  }
+  perf::report( test, "string::push_back", n, tm.ns() );
+
+  perf::keep( len );
+
+  return EXAM_RESULT;
+}
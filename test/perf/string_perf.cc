@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "string_perf.h"
+#include "perf.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <cstdio>
+
+namespace string_ns {
+
+#if defined (_STLP_USE_SHORT_STRING_OPTIM)
+const char* variant = "short string optim";
+#else
+const char* variant = "heap only";
+#endif
+
+const int nkeys = 100000;
+const int rounds = 10;
+
+// allocator that count calls of allocate()
+unsigned long long allocs = 0;
+
+template <class T>
+class counting_allocator :
+    public std::allocator<T>
+{
+  public:
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator()
+      { }
+
+    template <class U>
+    counting_allocator( const counting_allocator<U>& )
+      { }
+
+    T* allocate( size_t n, const void* = 0 )
+      {
+        ++allocs;
+        return std::allocator<T>::allocate( n );
+      }
+};
+
+template <class T, class U>
+bool operator ==( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return true; }
+
+template <class T, class U>
+bool operator !=( const counting_allocator<T>&, const counting_allocator<U>& )
+{ return false; }
+
+typedef std::basic_string<char, std::char_traits<char>, counting_allocator<char> > cstring;
+
+// identifiers-like keys, 4 - 24 chars, as in symbol tables or JSON objects
+template <class S>
+void make_keys( std::vector<S>& keys )
+{
+  static const char alpha[] = "abcdefghijklmnopqrstuvwxyz_0123456789";
+  unsigned x = 12345;
+
+  keys.reserve( nkeys );
+  for ( int i = 0; i < nkeys; ++i ) {
+    x = x * 1103515245U + 12345U;
+    S k( 4 + (x >> 16) % 21, 'a' );
+    for ( typename S::size_type j = 0; j < k.size(); ++j ) {
+      x = x * 1103515245U + 12345U;
+      k[j] = alpha[(x >> 16) % (sizeof(alpha) - 1)];
+    }
+    keys.push_back( k );
+  }
+}
+
+const size_t hay_sizes[] = { 16, 64, 256, 4096, 65536 };
+const size_t scan_bytes = 64 * 1024 * 1024; // per measurement
+
+// haystack of lowercase text without 'X' and digits: needles built from
+// them are found at the very end, so whole haystack is scanned
+std::string make_haystack( size_t n )
+{
+  std::string h( n, ' ' );
+  unsigned x = 98765;
+
+  for ( size_t i = 0; i < n; ++i ) {
+    x = x * 1103515245U + 12345U;
+    h[i] = "abcdefghijklmnopqrstuvwxyz    "[(x >> 16) % 30];
+  }
+  return h;
+}
+
+struct eq_char
+{
+    bool operator ()( char a, char b ) const
+      { return a == b; }
+};
+
+} // namespace string_ns
+
+int EXAM_IMPL(string_perf::allocations)
+{
+  using namespace string_ns;
+
+  std::vector<cstring> keys;
+  make_keys( keys );
+
+  std::vector<cstring> copies;
+  copies.reserve( keys.size() );
+
+  allocs = 0;
+  for ( std::vector<cstring>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+    copies.push_back( *i );
+  }
+  perf::note( "string short keys copy", variant, "allocations per key", static_cast<double>(allocs) / keys.size() );
+
+  allocs = 0;
+  for ( std::vector<cstring>::iterator i = copies.begin(); i != copies.end(); ++i ) {
+    *i += "_suffix";
+  }
+  perf::note( "string short keys append", variant, "allocations per key", static_cast<double>(allocs) / keys.size() );
+
+  allocs = 0;
+  {
+    std::vector<cstring> moved;
+    moved.reserve( copies.size() );
+    for ( std::vector<cstring>::iterator i = copies.begin(); i != copies.end(); ++i ) {
+      moved.push_back( std::move( *i ) );
+    }
+    perf::keep( moved.size() );
+  }
+  perf::note( "string short keys move", variant, "allocations per key", static_cast<double>(allocs) / keys.size() );
+
+  allocs = 0;
+  {
+    std::map<cstring, int> m;
+    for ( std::vector<cstring>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+      ++m[*i];
+    }
+    perf::keep( m.size() );
+  }
+  perf::note( "string short keys map insert", variant, "allocations per key", static_cast<double>(allocs) / keys.size() );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_perf::short_keys)
+{
+  using namespace string_ns;
+
+  std::vector<std::string> keys;
+  make_keys( keys );
+
+  {
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      std::vector<std::string> copies( keys );
+      perf::keep( copies.back() );
+    }
+    perf::report( "string short keys copy", variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+  }
+
+  {
+    std::vector<std::string> sorted( keys );
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      std::copy( keys.begin(), keys.end(), sorted.begin() );
+      std::sort( sorted.begin(), sorted.end() );
+      perf::keep( sorted.front() );
+    }
+    perf::report( "string short keys sort", variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+  }
+
+  {
+    std::map<std::string, int> m;
+    for ( size_t i = 0; i < keys.size(); i += 2 ) {
+      m[keys[i]] = 1;
+    }
+    size_t found = 0;
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      for ( std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i ) {
+        found += m.count( *i );
+      }
+    }
+    perf::keep( found );
+    perf::report( "string short keys map lookup", variant, static_cast<unsigned long long>(rounds) * keys.size(), tm.ns() );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_perf::move_swap)
+{
+  using namespace string_ns;
+
+  std::vector<std::string> keys;
+  make_keys( keys );
+
+  // mix of short and long strings: swap and move between inline and heap
+  for ( size_t i = 0; i < keys.size(); i += 4 ) {
+    keys[i].append( 40, 'x' );
+  }
+
+  {
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      for ( size_t i = 1; i < keys.size(); ++i ) {
+        keys[i - 1].swap( keys[i] );
+      }
+    }
+    perf::report( "string swap", variant, static_cast<unsigned long long>(rounds) * (keys.size() - 1), tm.ns() );
+  }
+
+  {
+    perf::timer tm;
+    for ( int r = 0; r < rounds; ++r ) {
+      std::vector<std::string> moved;
+      moved.reserve( keys.size() );
+      for ( std::vector<std::string>::iterator i = keys.begin(); i != keys.end(); ++i ) {
+        moved.push_back( std::move( *i ) );
+      }
+      for ( size_t i = 0; i < keys.size(); ++i ) {
+        keys[i] = std::move( moved[i] );
+      }
+    }
+    perf::report( "string move", variant, static_cast<unsigned long long>(rounds) * 2 * keys.size(), tm.ns() );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_perf::find_char)
+{
+  using namespace string_ns;
+
+  for ( size_t k = 0; k < sizeof(hay_sizes) / sizeof(hay_sizes[0]); ++k ) {
+    std::string h = make_haystack( hay_sizes[k] );
+    h[h.size() - 1] = 'X';
+    const size_t reps = scan_bytes / h.size();
+    char buf[64];
+    size_t sum = 0;
+
+    std::sprintf( buf, "haystack %u", static_cast<unsigned>(h.size()) );
+
+    perf::timer tm;
+    for ( size_t r = 0; r < reps; ++r ) {
+      sum += h.find( 'X' );
+    }
+    perf::report( "string find char", buf, reps, tm.ns() );
+
+    tm.restart();
+    for ( size_t r = 0; r < reps; ++r ) {
+      sum += h.rfind( 'X', h.size() - 2 ) == std::string::npos ? 1 : 0;
+    }
+    perf::report( "string rfind char", buf, reps, tm.ns() );
+
+    tm.restart();
+    for ( size_t r = 0; r < reps; ++r ) {
+      sum += std::find( h.begin(), h.end(), 'X' ) - h.begin();
+    }
+    perf::report( "std::find char", buf, reps, tm.ns() );
+    perf::keep( sum );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_perf::find_substr)
+{
+  using namespace string_ns;
+
+  const size_t needle_sizes[] = { 2, 4, 8, 16, 64 };
+
+  for ( size_t k = 0; k < sizeof(hay_sizes) / sizeof(hay_sizes[0]); ++k ) {
+    for ( size_t j = 0; j < sizeof(needle_sizes) / sizeof(needle_sizes[0]); ++j ) {
+      if ( needle_sizes[j] > hay_sizes[k] ) {
+        continue;
+      }
+      std::string h = make_haystack( hay_sizes[k] );
+      // needle is copy of haystack tail with mark at end: prefix of it
+      // occur often, but whole needle only at the end
+      std::string n = h.substr( h.size() - needle_sizes[j] );
+      h[h.size() - 1] = 'X';
+      n[n.size() - 1] = 'X';
+
+      const size_t reps = scan_bytes / h.size();
+      char buf[64];
+      size_t sum = 0;
+
+      std::sprintf( buf, "haystack %u, needle %u", static_cast<unsigned>(h.size()), static_cast<unsigned>(n.size()) );
+
+      perf::timer tm;
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += h.find( n );
+      }
+      perf::report( "string find", buf, reps, tm.ns() );
+
+      tm.restart();
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += h.rfind( n );
+      }
+      perf::report( "string rfind", buf, reps, tm.ns() );
+
+      tm.restart();
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += std::search( h.begin(), h.end(), n.begin(), n.end(), eq_char() ) - h.begin();
+      }
+      perf::report( "std::search", buf, reps, tm.ns() );
+      perf::keep( sum );
+    }
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_perf::find_first_of)
+{
+  using namespace string_ns;
+
+  // sets of digits and 'X': no one is in haystack except last char
+  const char* sets[] = { "X0", "X012", "X0123456", "X0123456789ABCDEFGHIJKLMNOPQRSTUVWYZ" };
+
+  for ( size_t k = 0; k < sizeof(hay_sizes) / sizeof(hay_sizes[0]); ++k ) {
+    for ( size_t j = 0; j < sizeof(sets) / sizeof(sets[0]); ++j ) {
+      std::string h = make_haystack( hay_sizes[k] );
+      h[h.size() - 1] = 'X';
+
+      const std::string set( sets[j] );
+      const size_t reps = scan_bytes / h.size();
+      char buf[64];
+      size_t sum = 0;
+
+      std::sprintf( buf, "haystack %u, set %u", static_cast<unsigned>(h.size()), static_cast<unsigned>(set.size()) );
+
+      perf::timer tm;
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += h.find_first_of( set );
+      }
+      perf::report( "string find_first_of", buf, reps, tm.ns() );
+
+      tm.restart();
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += h.find_first_not_of( "abcdefghijklmnopqrstuvwxyz " );
+      }
+      perf::report( "string find_first_not_of", buf, reps, tm.ns() );
+
+      tm.restart();
+      for ( size_t r = 0; r < reps; ++r ) {
+        sum += std::find_first_of( h.begin(), h.end(), set.begin(), set.end(), eq_char() ) - h.begin();
+      }
+      perf::report( "std::find_first_of", buf, reps, tm.ns() );
+      perf::keep( sum );
+    }
+  }
+
+  return EXAM_RESULT;
+}
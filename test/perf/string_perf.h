@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#ifndef __TEST_STRING_PERF_H
+#define __TEST_STRING_PERF_H
+
+#define __FIT_EXAM
+
+#include <exam/suite.h>
+
+class string_perf
+{
+  public:
+    int EXAM_DECL(allocations);
+    int EXAM_DECL(short_keys);
+    int EXAM_DECL(move_swap);
+    int EXAM_DECL(find_char);
+    int EXAM_DECL(find_substr);
+    int EXAM_DECL(find_first_of);
+};
+
+#endif // __TEST_STRING_PERF_H
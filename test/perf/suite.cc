@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#define __FIT_EXAM
+
+#include <exam/suite.h>
+
+#include <misc/opts.h>
+#include <string>
+#include <sstream>
+
+#include "alloc_perf.h"
+#include "shared_ptr_perf.h"
+#include "hash_perf.h"
+#include "hashtable_perf.h"
+#include "flat_hash_perf.h"
+#include "string_perf.h"
+#include "num_put_perf.h"
+#include "num_get_perf.h"
+#include "deque_perf.h"
+#include "sort_perf.h"
+#include "tree_perf.h"
+#include "flat_map_perf.h"
+#include "list_perf.h"
+#include "valarray_perf.h"
+#include "bitset_perf.h"
+#include "charconv_perf.h"
+#include "fstream_perf.h"
+#include "sstream_perf.h"
+
+int main( int argc, const char** argv )
+{
+  Opts opts;
+
+  opts.description( "performance tests for STLport" );
+  opts.usage( "[options]" );
+
+  opts << option<void>( "print this help message", 'h', "help" )
+       << option<void>( "list all test cases", 'l', "list" )
+       << option<std::string>( "run tests by number", 'r', "run" )["0"]
+       << option<void>( "print status of tests within test suite", 'v', "verbose" )
+       << option<void>(  "trace checks", 't', "trace" );
+
+  try {
+    opts.parse( argc, argv );
+  }
+  catch (...) {
+    opts.help( std::cerr );
+    return 1;
+  }
+
+  if ( opts.is_set( 'h' ) ) {
+    opts.help( std::cerr );
+    return 0;
+  }
+
+  exam::test_suite t( "STLport performance test" );
+
+  alloc_perf alloc_prf;
+
+  t.add( &alloc_perf::node_alloc_contention, alloc_prf, "node_alloc contention" );
+
+  shared_ptr_perf shared_ptr_prf;
+
+  t.add( &shared_ptr_perf::copy_contention, shared_ptr_prf, "shared_ptr copy contention" );
+  t.add( &shared_ptr_perf::weak_lock_contention, shared_ptr_prf, "weak_ptr lock contention" );
+  t.add( &shared_ptr_perf::creation, shared_ptr_prf, "shared_ptr creation" );
+
+  hash_perf hash_prf;
+
+  t.add( &hash_perf::strings, hash_prf, "string hash" );
+  t.add( &hash_perf::integers, hash_prf, "integer hash" );
+
+  hashtable_perf hashtable_prf;
+
+  t.add( &hashtable_perf::insert, hashtable_prf, "hashtable insert, prime vs power of 2 buckets" );
+  t.add( &hashtable_perf::lookup, hashtable_prf, "hashtable lookup, prime vs power of 2 buckets" );
+
+  flat_hash_perf flat_hash_prf;
+
+  t.add( &flat_hash_perf::insert, flat_hash_prf, "flat_hash_map vs unordered_map insert" );
+  t.add( &flat_hash_perf::lookup, flat_hash_prf, "flat_hash_map vs unordered_map lookup" );
+  t.add( &flat_hash_perf::iterate, flat_hash_prf, "flat_hash_map vs unordered_map iteration" );
+
+  string_perf string_prf;
+
+  t.add( &string_perf::allocations, string_prf, "string allocations, short keys" );
+  t.add( &string_perf::short_keys, string_prf, "string short keys throughput" );
+  t.add( &string_perf::move_swap, string_prf, "string move and swap" );
+  t.add( &string_perf::find_char, string_prf, "string find char" );
+  t.add( &string_perf::find_substr, string_prf, "string find substring" );
+  t.add( &string_perf::find_first_of, string_prf, "string find_first_of" );
+
+  num_put_perf num_put_prf;
+
+  t.add( &num_put_perf::ostream_double, num_put_prf, "ostream << double" );
+  t.add( &num_put_perf::snprintf_double, num_put_prf, "snprintf of double, reference" );
+
+  num_get_perf num_get_prf;
+
+  t.add( &num_get_perf::istream_double, num_get_prf, "istream >> double" );
+  t.add( &num_get_perf::strtod_double, num_get_prf, "strtod of double, reference" );
+
+  deque_perf deque_prf;
+
+  t.add( &deque_perf::fifo, deque_prf, "deque FIFO throughput" );
+  t.add( &deque_perf::fill_drain, deque_prf, "deque fill and drain" );
+  t.add( &deque_perf::allocations, deque_prf, "deque allocator calls" );
+
+  sort_perf sort_prf;
+
+  t.add( &sort_perf::sort_scaling, sort_prf, "parallel sort scaling" );
+  t.add( &sort_perf::stable_sort_scaling, sort_prf, "parallel stable_sort scaling" );
+  t.add( &sort_perf::nth_element_scaling, sort_prf, "parallel nth_element scaling" );
+  t.add( &sort_perf::radix_vs_comparison, sort_prf, "radix sort vs comparison sort" );
+  t.add( &sort_perf::distributions, sort_prf, "sort of random, sorted, reversed, organ-pipe and few distinct values" );
+
+  tree_perf tree_prf;
+
+  t.add( &tree_perf::range_construction, tree_prf, "set construction from range vs one by one insert" );
+  t.add( &tree_perf::node_transfer, tree_prf, "map merge and node extract vs copies" );
+
+  flat_map_perf flat_map_prf;
+
+  t.add( &flat_map_perf::memory, flat_map_prf, "flat_map vs map memory footprint" );
+  t.add( &flat_map_perf::lookup, flat_map_prf, "flat_map vs map lookup" );
+  t.add( &flat_map_perf::range_insert, flat_map_prf, "flat_map vs map batched insert" );
+
+  list_perf list_prf;
+
+  t.add( &list_perf::node_pool, list_prf, "list and forward_list node pool vs allocator" );
+  t.add( &list_perf::sort, list_prf, "list and forward_list sort" );
+
+  valarray_perf valarray_prf;
+
+  t.add( &valarray_perf::arithmetic, valarray_prf, "valarray expressions vs hand-written loops" );
+  t.add( &valarray_perf::math, valarray_prf, "valarray math functions vs libm" );
+
+  bitset_perf bitset_prf;
+
+  t.add( &bitset_perf::count, bitset_prf, "bitset and vector<bool> count" );
+  t.add( &bitset_perf::find, bitset_prf, "bitset and vector<bool> scan for set bits" );
+  t.add( &bitset_perf::bulk, bitset_prf, "vector<bool> bitwise operations vs element loop" );
+  t.add( &bitset_perf::dynamic, bitset_prf, "dynamic_bitset set operations and iteration" );
+
+  charconv_perf charconv_prf;
+
+  t.add( &charconv_perf::integer_output, charconv_prf, "long long to_chars vs snprintf and ostream" );
+  t.add( &charconv_perf::integer_input, charconv_prf, "long long from_chars vs strtoll and istream" );
+  t.add( &charconv_perf::double_output, charconv_prf, "double to_chars vs snprintf and ostream" );
+  t.add( &charconv_perf::double_input, charconv_prf, "double from_chars vs strtod and istream" );
+
+  fstream_perf fstream_prf;
+
+  t.add( &fstream_perf::bulk_write, fstream_prf, "ofstream write in blocks vs fwrite and write" );
+  t.add( &fstream_perf::bulk_read, fstream_prf, "ifstream read in blocks vs fread and read" );
+  t.add( &fstream_perf::copy, fstream_prf, "file copy with fstreams vs read/write" );
+  t.add( &fstream_perf::mmap_sequential, fstream_prf, "filebuf sequential scan under mmap policies" );
+  t.add( &fstream_perf::mmap_random, fstream_prf, "filebuf random reads under mmap policies vs pread" );
+  t.add( &fstream_perf::log_latency, fstream_prf, "log records from threads through ofstream, sync vs write-behind" );
+
+  sstream_perf sstream_prf;
+
+  t.add( &sstream_perf::report, sstream_prf, "large report formatting in ostringstream" );
+  t.add( &sstream_perf::char_output, sstream_prf, "char by char output to ostringstream vs string" );
+
+  if ( opts.is_set( 'l' ) ) {
+    t.print_graph( std::cout );
+    return 0;
+  }
+
+  if ( opts.is_set( 'v' ) ) {
+    t.flags( t.flags() | exam::base_logger::verbose );
+  }
+
+  if ( opts.is_set( 't' ) ) {
+    t.flags( t.flags() | exam::base_logger::trace );
+  }
+
+  if ( opts.is_set( 'r' ) ) {
+    std::stringstream ss( opts.get<std::string>( 'r' ) );
+    int n;
+    int res = 0;
+    while ( ss >> n ) {
+      res |= t.single( n );
+    }
+
+    return res;
+  }
+
+  return t.girdle();
+}
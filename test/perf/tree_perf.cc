@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "tree_perf.h"
+#include "perf.h"
+
+#include <set>
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tree_ns {
+
+const unsigned long long nelems = 4000000ULL;
+
+std::vector<int> sorted_keys( size_t n )
+{
+  std::vector<int> v( n );
+  for ( size_t i = 0; i < n; ++i ) {
+    v[i] = static_cast<int>(i) * 2;
+  }
+  return v;
+}
+
+std::vector<int> random_keys( size_t n )
+{
+  std::vector<int> v = sorted_keys( n );
+  std::srand( 17 );
+  for ( size_t i = n; i > 1; --i ) {
+    std::swap( v[i - 1], v[std::rand() % i] );
+  }
+  return v;
+}
+
+// set built from range, vs the same values inserted one by one
+template <class S>
+void run_construction( const char* test, const std::vector<int>& v )
+{
+  const int rounds = static_cast<int>(nelems / v.size());
+  size_t sum = 0;
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    S s( v.begin(), v.end() );
+    sum += s.size();
+  }
+  long long ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, "range", static_cast<unsigned long long>(rounds) * v.size(), ns );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    S s;
+    for ( std::vector<int>::const_iterator i = v.begin(); i != v.end(); ++i ) {
+      s.insert( *i );
+    }
+    sum += s.size();
+  }
+  ns = tm.ns();
+  perf::keep( sum );
+  perf::report( test, "one by one", static_cast<unsigned long long>(rounds) * v.size(), ns );
+}
+
+} // namespace tree_ns
+
+int EXAM_IMPL(tree_perf::range_construction)
+{
+  using namespace tree_ns;
+
+  const size_t sizes[] = { 1000, 1000000 };
+  char test[64];
+  for ( size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k ) {
+    std::vector<int> v = sorted_keys( sizes[k] );
+    std::sprintf( test, "set of %u sorted ints", static_cast<unsigned>(sizes[k]) );
+    run_construction<std::set<int> >( test, v );
+    std::sprintf( test, "multiset of %u sorted ints", static_cast<unsigned>(sizes[k]) );
+    run_construction<std::multiset<int> >( test, v );
+    v = random_keys( sizes[k] );
+    std::sprintf( test, "set of %u random ints", static_cast<unsigned>(sizes[k]) );
+    run_construction<std::set<int> >( test, v );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(tree_perf::node_transfer)
+{
+  using namespace tree_ns;
+
+  const size_t n = 1000000;
+  std::vector<int> v = random_keys( n );
+  std::vector<int> odd( v );
+  for ( size_t i = 0; i < n; ++i ) {
+    ++odd[i];
+  }
+  long long ns;
+
+  {
+    std::map<int, int> a, b;
+    for ( size_t i = 0; i < n; ++i ) {
+      a[v[i]] = 0;
+      b[odd[i]] = 0;
+    }
+    perf::timer tm;
+    a.merge( b );
+    ns = tm.ns();
+    perf::keep( a );
+    perf::report( "map union of 1M and 1M keys", "merge", n, ns );
+  }
+
+  {
+    std::map<int, int> a, b;
+    for ( size_t i = 0; i < n; ++i ) {
+      a[v[i]] = 0;
+      b[odd[i]] = 0;
+    }
+    perf::timer tm;
+    a.insert( b.begin(), b.end() );
+    b.clear();
+    ns = tm.ns();
+    perf::keep( a );
+    perf::report( "map union of 1M and 1M keys", "insert copies", n, ns );
+  }
+
+  {
+    // change of key without reallocation of node
+    std::map<int, int> a;
+    for ( size_t i = 0; i < n; ++i ) {
+      a[v[i]] = 0;
+    }
+    perf::timer tm;
+    for ( size_t i = 0; i < n; ++i ) {
+      std::map<int, int>::node_type nh = a.extract( v[i] );
+      nh.key() = odd[i];
+      a.insert( std::move( nh ) );
+    }
+    ns = tm.ns();
+    perf::keep( a );
+    perf::report( "map change of key", "extract and insert node", n, ns );
+
+    tm.restart();
+    for ( size_t i = 0; i < n; ++i ) {
+      a.erase( odd[i] );
+      a[v[i]] = 0;
+    }
+    ns = tm.ns();
+    perf::keep( a );
+    perf::report( "map change of key", "erase and insert", n, ns );
+  }
+
+  return EXAM_RESULT;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "valarray_perf.h"
+#include "perf.h"
+
+#include <valarray>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+namespace valarray_ns {
+
+const unsigned long long nelems = 100000000ULL;
+
+template <class T>
+void fill( std::valarray<T>& v, T scale )
+{
+  for ( size_t i = 0; i < v.size(); ++i ) {
+    v[i] = scale * static_cast<T>(i % 1000) / static_cast<T>(1000);
+  }
+}
+
+// r = a * b + c * d: one pass over memory, no temporaries
+template <class T>
+void madd( const char* test, size_t n )
+{
+  const int rounds = static_cast<int>(nelems / n);
+  std::valarray<T> a( n ), b( n ), c( n ), d( n ), r( n );
+  fill( a, T(1) );
+  fill( b, T(2) );
+  fill( c, T(3) );
+  fill( d, T(4) );
+
+  perf::timer tm;
+  for ( int k = 0; k < rounds; ++k ) {
+    r = a * b + c * d;
+    perf::keep( r );
+  }
+  perf::report( test, "valarray expression", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int k = 0; k < rounds; ++k ) {
+    const T* pa = &a[0];
+    const T* pb = &b[0];
+    const T* pc = &c[0];
+    const T* pd = &d[0];
+    T* pr = &r[0];
+    for ( size_t i = 0; i < n; ++i ) {
+      pr[i] = pa[i] * pb[i] + pc[i] * pd[i];
+    }
+    perf::keep( r );
+  }
+  perf::report( test, "hand-written loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+}
+
+// y += k * x, FIR-like accumulation
+template <class T>
+void axpy( const char* test, size_t n )
+{
+  const int rounds = static_cast<int>(nelems / n);
+  std::valarray<T> x( n ), y( n );
+  fill( x, T(1) );
+  const T k = static_cast<T>(1.0e-6);
+
+  perf::timer tm;
+  for ( int r = 0; r < rounds; ++r ) {
+    y += k * x;
+    perf::keep( y );
+  }
+  perf::report( test, "valarray expression", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int r = 0; r < rounds; ++r ) {
+    const T* px = &x[0];
+    T* py = &y[0];
+    for ( size_t i = 0; i < n; ++i ) {
+      py[i] += k * px[i];
+    }
+    perf::keep( y );
+  }
+  perf::report( test, "hand-written loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+}
+
+double libm_sin( double x ) { return std::sin( x ); }
+float libm_sin( float x ) { return std::sin( x ); }
+double libm_exp( double x ) { return std::exp( x ); }
+float libm_exp( float x ) { return std::exp( x ); }
+
+// windowed oscillator: r = sin(a) * exp(-b)
+template <class T>
+void osc( const char* test, size_t n )
+{
+  const int rounds = static_cast<int>(nelems / 10 / n);
+  std::valarray<T> a( n ), b( n ), r( n );
+  fill( a, T(100) );
+  fill( b, T(10) );
+
+  perf::timer tm;
+  for ( int k = 0; k < rounds; ++k ) {
+    r = sin( a ) * exp( -b );
+    perf::keep( r );
+  }
+  perf::report( test, "valarray expression", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+
+  tm.restart();
+  for ( int k = 0; k < rounds; ++k ) {
+    for ( size_t i = 0; i < n; ++i ) {
+      r[i] = libm_sin( a[i] ) * libm_exp( -b[i] );
+    }
+    perf::keep( r );
+  }
+  perf::report( test, "libm loop", static_cast<unsigned long long>(rounds) * n, tm.ns() );
+}
+
+} // namespace valarray_ns
+
+int EXAM_IMPL(valarray_perf::arithmetic)
+{
+  using namespace valarray_ns;
+
+  // in cache and in memory
+  const size_t sizes[] = { 4096, 4000000 };
+  char test[64];
+
+  for ( size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k ) {
+    std::sprintf( test, "a*b + c*d, %u doubles", static_cast<unsigned>(sizes[k]) );
+    madd<double>( test, sizes[k] );
+    std::sprintf( test, "a*b + c*d, %u floats", static_cast<unsigned>(sizes[k]) );
+    madd<float>( test, sizes[k] );
+    std::sprintf( test, "a*b + c*d, %u ints", static_cast<unsigned>(sizes[k]) );
+    madd<int>( test, sizes[k] );
+    std::sprintf( test, "y += k*x, %u doubles", static_cast<unsigned>(sizes[k]) );
+    axpy<double>( test, sizes[k] );
+    std::sprintf( test, "y += k*x, %u floats", static_cast<unsigned>(sizes[k]) );
+    axpy<float>( test, sizes[k] );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(valarray_perf::math)
+{
+  using namespace valarray_ns;
+
+  const size_t n = 4096;
+  char test[64];
+
+  std::sprintf( test, "sin(a) * exp(-b), %u doubles", static_cast<unsigned>(n) );
+  osc<double>( test, n );
+  std::sprintf( test, "sin(a) * exp(-b), %u floats", static_cast<unsigned>(n) );
+  osc<float>( test, n );
+
+  return EXAM_RESULT;
+}
@@ -16,6 +16,8 @@
  */
 
 #include <atomic>
+#include <thread>
+#include <condition_variable>
 #include "atomic_test.h"
 
 int EXAM_IMPL(atomic_test::atomic_int)
@@ -30,3 +32,347 @@ int EXAM_IMPL(atomic_test::atomic_int)
   
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(atomic_test::integral)
+{
+  std::atomic<unsigned char> uc( 250 );
+
+  EXAM_CHECK( uc.is_lock_free() );
+  EXAM_CHECK( uc.fetch_add( 10 ) == 250 );
+  EXAM_CHECK( uc.load() == 4 ); // modulo 256
+
+  std::atomic<long long> ll( 0x100000000LL );
+
+  EXAM_CHECK( (ll += 5) == 0x100000005LL );
+  EXAM_CHECK( ll-- == 0x100000005LL );
+  EXAM_CHECK( --ll == 0x100000003LL );
+  EXAM_CHECK( ll.fetch_and( 0xff ) == 0x100000003LL );
+  EXAM_CHECK( ll.fetch_or( 0x10, std::memory_order_relaxed ) == 3 );
+  EXAM_CHECK( ll.fetch_xor( 0x13, std::memory_order_acq_rel ) == 0x13 );
+  EXAM_CHECK( ll == 0 );
+
+  std::atomic<int> ai( 1 );
+  int e = 2;
+
+  EXAM_CHECK( !ai.compare_exchange_strong( e, 3 ) );
+  EXAM_CHECK( e == 1 ); // expected updated by current value
+  EXAM_CHECK( ai.compare_exchange_strong( e, 3, std::memory_order_acq_rel, std::memory_order_acquire ) );
+  EXAM_CHECK( ai.exchange( 7, std::memory_order_release ) == 3 );
+  EXAM_CHECK( std::atomic_fetch_add( &ai, 1 ) == 7 );
+  EXAM_CHECK( std::atomic_load_explicit( &ai, std::memory_order_acquire ) == 8 );
+
+  volatile std::atomic<unsigned> vu( 1 );
+
+  vu |= 6;
+  EXAM_CHECK( vu.load() == 7 );
+
+  std::atomic<bool> ab( false );
+  bool b = false;
+
+  EXAM_CHECK( ab.compare_exchange_strong( b, true ) );
+  EXAM_CHECK( ab.load() );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::pointer)
+{
+  int a[8];
+  std::atomic<int*> p( a );
+
+  EXAM_CHECK( p.is_lock_free() );
+  EXAM_CHECK( p.fetch_add( 2 ) == a ); // scaled by sizeof(int)
+  EXAM_CHECK( p.load() == a + 2 );
+  EXAM_CHECK( ++p == a + 3 );
+  EXAM_CHECK( (p -= 3) == a );
+  EXAM_CHECK( std::atomic_fetch_add( &p, 5 ) == a );
+  EXAM_CHECK( p == a + 5 );
+
+  return EXAM_RESULT;
+}
+
+namespace atomic_test_ns {
+
+struct big
+{
+    long a;
+    long b;
+    long c;
+};
+
+const int n_threads = 4;
+const int n_rounds = 100000;
+
+std::atomic<big> abig;
+std::atomic<long> counter;
+
+void big_incr()
+{
+  for ( int i = 0; i < n_rounds; ++i ) {
+    big o = abig.load( std::memory_order_relaxed );
+    big n;
+    do {
+      n = o;
+      ++n.a;
+      n.b += 2;
+      n.c = n.a + n.b;
+    } while ( !abig.compare_exchange_weak( o, n ) );
+  }
+}
+
+void relaxed_incr()
+{
+  for ( int i = 0; i < n_rounds; ++i ) {
+    counter.fetch_add( 1, std::memory_order_relaxed );
+  }
+}
+
+// message passing: data written before release store is visible after acquire load
+long data;
+std::atomic<int> ready;
+
+void producer()
+{
+  for ( int i = 1; i <= n_rounds; ++i ) {
+    while ( ready.load( std::memory_order_acquire ) != 0 ) {
+      std::this_thread::yield();
+    }
+    data = i;
+    ready.store( i, std::memory_order_release );
+  }
+}
+
+std::atomic<long*> published;
+
+void publisher()
+{
+  for ( int i = 1; i <= n_rounds; ++i ) {
+    while ( published.load( std::memory_order_acquire ) != NULL ) {
+      std::this_thread::yield();
+    }
+    long* p = new long( i );
+    published.store( p, std::memory_order_release );
+  }
+}
+
+// spinlock on compare_exchange with acq_rel, protect non-atomic counter
+std::atomic<int> spin;
+long plain;
+
+void locked_incr()
+{
+  for ( int i = 0; i < n_rounds; ++i ) {
+    int e = 0;
+    while ( !spin.compare_exchange_weak( e, 1, std::memory_order_acq_rel, std::memory_order_relaxed ) ) {
+      e = 0;
+      std::this_thread::yield();
+    }
+    ++plain;
+    spin.store( 0, std::memory_order_release );
+  }
+}
+
+// store buffering (Dekker): with seq_cst both threads can't see zero
+const int sb_rounds = 20000;
+std::atomic<int> x;
+std::atomic<int> y;
+int r1;
+int r2;
+std::barrier* sb_bar;
+
+void sb_thread()
+{
+  for ( int i = 0; i < sb_rounds; ++i ) {
+    sb_bar->wait();
+    x.store( 1, std::memory_order_seq_cst );
+    r1 = y.load( std::memory_order_seq_cst );
+    sb_bar->wait();
+  }
+}
+
+std::atomic_flag aflag = ATOMIC_FLAG_INIT;
+long flag_plain;
+
+void flag_incr()
+{
+  for ( int i = 0; i < n_rounds; ++i ) {
+    while ( aflag.test_and_set( std::memory_order_acquire ) ) {
+      std::this_thread::yield();
+    }
+    ++flag_plain;
+    aflag.clear( std::memory_order_release );
+  }
+}
+
+} // namespace atomic_test_ns
+
+using namespace atomic_test_ns;
+
+int EXAM_IMPL(atomic_test::not_lock_free)
+{
+  big z = { 0, 0, 0 };
+
+  abig.store( z );
+
+  EXAM_CHECK( !abig.is_lock_free() );
+
+  std::thread* thr[n_threads];
+
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i] = new std::thread( big_incr );
+  }
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i]->join();
+    delete thr[i];
+  }
+
+  big r = abig.load();
+
+  EXAM_CHECK( r.a == n_threads * n_rounds );
+  EXAM_CHECK( r.b == 2 * n_threads * n_rounds );
+  EXAM_CHECK( r.c == r.a + r.b ); // no torn values
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::relaxed)
+{
+  counter.store( 0, std::memory_order_relaxed );
+
+  std::thread* thr[n_threads];
+
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i] = new std::thread( relaxed_incr );
+  }
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i]->join();
+    delete thr[i];
+  }
+
+  // relaxed don't order other memory operations, but read-modify-write is still atomic
+  EXAM_CHECK( counter.load( std::memory_order_relaxed ) == n_threads * n_rounds );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::acquire_release)
+{
+  data = 0;
+  ready.store( 0 );
+
+  std::thread t( producer );
+  int bad = 0;
+
+  for ( int i = 1; i <= n_rounds; ++i ) {
+    int v;
+    while ( (v = ready.load( std::memory_order_acquire )) == 0 ) {
+      std::this_thread::yield();
+    }
+    if ( data != v ) {
+      ++bad;
+    }
+    ready.store( 0, std::memory_order_release );
+  }
+
+  t.join();
+
+  EXAM_CHECK( bad == 0 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::consume)
+{
+  published.store( NULL );
+
+  std::thread t( publisher );
+  int bad = 0;
+
+  for ( int i = 1; i <= n_rounds; ++i ) {
+    long* p;
+    while ( (p = published.load( std::memory_order_consume )) == NULL ) {
+      std::this_thread::yield();
+    }
+    // dependent read via published pointer
+    if ( *p != i ) {
+      ++bad;
+    }
+    delete p;
+    published.store( NULL, std::memory_order_release );
+  }
+
+  t.join();
+
+  EXAM_CHECK( bad == 0 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::acq_rel)
+{
+  spin.store( 0 );
+  plain = 0;
+
+  std::thread* thr[n_threads];
+
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i] = new std::thread( locked_incr );
+  }
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i]->join();
+    delete thr[i];
+  }
+
+  EXAM_CHECK( plain == n_threads * n_rounds );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::seq_cst)
+{
+  std::barrier bar( 2 );
+  int both_zero = 0;
+
+  sb_bar = &bar;
+
+  std::thread t( sb_thread );
+
+  for ( int i = 0; i < sb_rounds; ++i ) {
+    x.store( 0 );
+    y.store( 0 );
+    bar.wait();
+    y.store( 1, std::memory_order_seq_cst );
+    r2 = x.load( std::memory_order_seq_cst );
+    bar.wait();
+    if ( r1 == 0 && r2 == 0 ) {
+      ++both_zero;
+    }
+  }
+
+  t.join();
+
+  EXAM_CHECK( both_zero == 0 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(atomic_test::flag)
+{
+  flag_plain = 0;
+
+  std::thread* thr[n_threads];
+
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i] = new std::thread( flag_incr );
+  }
+  for ( int i = 0; i < n_threads; ++i ) {
+    thr[i]->join();
+    delete thr[i];
+  }
+
+  EXAM_CHECK( flag_plain == n_threads * n_rounds );
+  EXAM_CHECK( !aflag.test_and_set() );
+  aflag.clear();
+
+  return EXAM_RESULT;
+}
@@ -27,6 +27,15 @@ class atomic_test
   public:
   // int EXAM_DECL(align);
     int EXAM_DECL(atomic_int);
+    int EXAM_DECL(integral);
+    int EXAM_DECL(pointer);
+    int EXAM_DECL(not_lock_free);
+    int EXAM_DECL(relaxed);
+    int EXAM_DECL(acquire_release);
+    int EXAM_DECL(consume);
+    int EXAM_DECL(acq_rel);
+    int EXAM_DECL(seq_cst);
+    int EXAM_DECL(flag);
 };
 
 #endif // __TEST_ATOMIC_TEST_H
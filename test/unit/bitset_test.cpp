@@ -90,3 +90,52 @@ int EXAM_IMPL(bitset_test::iostream)
 #endif
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(bitset_test::count_find)
+{
+#if !defined (STLPORT) || !defined (_STLP_NON_TYPE_TMPL_PARAM_BUG)
+  // long enough to be counted by library kernels
+  bitset<2000> b;
+  EXAM_CHECK( b.count() == 0 );
+  EXAM_CHECK( b.none() );
+
+  for ( size_t i = 3; i < b.size(); i += 7 ) {
+    b.set( i );
+  }
+  EXAM_CHECK( b.count() == (b.size() - 3 + 6) / 7 );
+
+  b.flip();
+  EXAM_CHECK( b.count() == b.size() - (b.size() - 3 + 6) / 7 );
+  b.set();
+  EXAM_CHECK( b.count() == b.size() );
+  b.reset();
+
+  b.set( 1999 );
+  b.set( 64 );
+  b.set( 63 );
+  EXAM_CHECK( b.count() == 3 );
+  EXAM_CHECK( (b << 1).count() == 2 );
+  EXAM_CHECK( (b >> 64).count() == 2 );
+
+#  if defined (STLPORT) && !defined (_STLP_NO_EXTENSIONS)
+  EXAM_CHECK( b._Find_first() == 63 );
+  EXAM_CHECK( b._Find_next( 63 ) == 64 );
+  EXAM_CHECK( b._Find_next( 64 ) == 1999 );
+  EXAM_CHECK( b._Find_next( 1999 ) == 2000 );
+
+  bitset<64> w;
+  EXAM_CHECK( w._Find_first() == 64 );
+  w.set( 63 );
+  EXAM_CHECK( w._Find_first() == 63 );
+  EXAM_CHECK( w._Find_next( 62 ) == 63 );
+  EXAM_CHECK( w._Find_next( 63 ) == 64 );
+#  endif
+
+  bitset<200> e;
+  e.set( 150 );
+  e.set( 17 );
+  EXAM_CHECK( e.count() == 2 );
+#endif
+
+  return EXAM_RESULT;
+}
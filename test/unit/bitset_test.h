@@ -10,6 +10,15 @@ class bitset_test
   public:
     int EXAM_DECL(bitset1);
     int EXAM_DECL(iostream);
+    int EXAM_DECL(count_find);
+};
+
+class dynamic_bitset_test
+{
+  public:
+    int EXAM_DECL(basic);
+    int EXAM_DECL(set_operations);
+    int EXAM_DECL(iteration);
 };
 
 #endif // __TEST_BITSET_TEST_H
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "num_put_get_test.h"
+
+#include <limits>
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <cmath>
+#if defined (STLPORT)
+#  include <charconv>
+#endif
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+#if defined (STLPORT)
+template <class _Tp>
+static string to_str( _Tp x )
+{
+  char buf[64];
+  to_chars_result r = to_chars( buf, buf + sizeof(buf), x );
+  return r.ec == errc() ? string( buf, r.ptr ) : string( "error" );
+}
+
+template <class _Tp>
+static string to_str( _Tp x, chars_format fmt )
+{
+  char buf[1200];
+  to_chars_result r = to_chars( buf, buf + sizeof(buf), x, fmt );
+  return r.ec == errc() ? string( buf, r.ptr ) : string( "error" );
+}
+
+template <class _Tp>
+static string to_str( _Tp x, chars_format fmt, int precision )
+{
+  char buf[1200];
+  to_chars_result r = to_chars( buf, buf + sizeof(buf), x, fmt, precision );
+  return r.ec == errc() ? string( buf, r.ptr ) : string( "error" );
+}
+
+template <class _Tp>
+static bool from_str( const char* s, _Tp& x, errc ec = errc(), ptrdiff_t n = -1 )
+{
+  const char* last = s + strlen(s);
+  from_chars_result r = from_chars( s, last, x );
+  return r.ec == ec && r.ptr == (n < 0 ? last : s + n);
+}
+
+template <class _Tp>
+static bool from_str( const char* s, _Tp& x, chars_format fmt, errc ec = errc(), ptrdiff_t n = -1 )
+{
+  const char* last = s + strlen(s);
+  from_chars_result r = from_chars( s, last, x, fmt );
+  return r.ec == ec && r.ptr == (n < 0 ? last : s + n);
+}
+
+// streambuf that give few chars at once, so numbers cross get area bounds
+class chunked_buf :
+    public streambuf
+{
+  public:
+    chunked_buf( const string& s, size_t chunk ) :
+        _str( s ),
+        _pos( 0 ),
+        _chunk( chunk )
+      { }
+
+  protected:
+    virtual int_type underflow()
+      {
+        if ( _pos >= _str.size() ) {
+          return traits_type::eof();
+        }
+        const size_t n = min( _chunk, _str.size() - _pos );
+        char* p = const_cast<char*>(_str.data()) + _pos;
+        setg( p, p, p + n );
+        _pos += n;
+        return traits_type::to_int_type( *p );
+      }
+
+  private:
+    string _str;
+    size_t _pos;
+    size_t _chunk;
+};
+#endif
+
+int EXAM_IMPL(charconv_test::integers)
+{
+#if defined (STLPORT)
+  EXAM_CHECK( to_str( 0 ) == "0" );
+  EXAM_CHECK( to_str( -1 ) == "-1" );
+  EXAM_CHECK( to_str( 1234567890 ) == "1234567890" );
+  EXAM_CHECK( to_str( numeric_limits<long long>::min() ) == "-9223372036854775808" );
+  EXAM_CHECK( to_str( numeric_limits<unsigned long long>::max() ) == "18446744073709551615" );
+  EXAM_CHECK( to_str( static_cast<signed char>(-128) ) == "-128" );
+
+  char buf[80];
+  to_chars_result r = to_chars( buf, buf + sizeof(buf), 255, 16 );
+  EXAM_CHECK( r.ec == errc() && string( buf, r.ptr ) == "ff" );
+  r = to_chars( buf, buf + sizeof(buf), -35, 36 );
+  EXAM_CHECK( r.ec == errc() && string( buf, r.ptr ) == "-z" );
+  r = to_chars( buf, buf + sizeof(buf), 5u, 2 );
+  EXAM_CHECK( r.ec == errc() && string( buf, r.ptr ) == "101" );
+  r = to_chars( buf, buf + sizeof(buf), numeric_limits<unsigned long long>::max(), 2 );
+  EXAM_CHECK( r.ec == errc() && r.ptr == buf + 64 );
+  r = to_chars( buf, buf + 3, 1000 );
+  EXAM_CHECK( r.ec == errc::value_too_large && r.ptr == buf + 3 );
+  r = to_chars( buf, buf, -1 );
+  EXAM_CHECK( r.ec == errc::value_too_large && r.ptr == buf );
+
+  int i = 7;
+  EXAM_CHECK( from_str( "123", i ) && i == 123 );
+  EXAM_CHECK( from_str( "-2147483648", i ) && i == numeric_limits<int>::min() );
+  EXAM_CHECK( from_str( "00012x", i, errc(), 5 ) && i == 12 );
+  i = 7;
+  EXAM_CHECK( from_str( "2147483648", i, errc::result_out_of_range ) && i == 7 );
+  EXAM_CHECK( from_str( "99999999999999999999999", i, errc::result_out_of_range ) && i == 7 );
+  EXAM_CHECK( from_str( "+1", i, errc::invalid_argument, 0 ) && i == 7 );
+  EXAM_CHECK( from_str( " 1", i, errc::invalid_argument, 0 ) && i == 7 );
+  EXAM_CHECK( from_str( "-", i, errc::invalid_argument, 0 ) && i == 7 );
+  EXAM_CHECK( from_str( "", i, errc::invalid_argument, 0 ) && i == 7 );
+
+  unsigned u = 7;
+  EXAM_CHECK( from_str( "-1", u, errc::invalid_argument, 0 ) && u == 7 );
+  EXAM_CHECK( from_str( "4294967295", u ) && u == 4294967295U );
+
+  unsigned long long ull = 0;
+  EXAM_CHECK( from_str( "18446744073709551615", ull ) && ull == numeric_limits<unsigned long long>::max() );
+  EXAM_CHECK( from_str( "18446744073709551616", ull, errc::result_out_of_range ) );
+  EXAM_CHECK( from_str( "12345678123456781", ull ) && ull == 12345678123456781ULL );
+
+  const char hex[] = "7fFfz";
+  from_chars_result fr = from_chars( hex, hex + 5, i, 16 );
+  EXAM_CHECK( fr.ec == errc() && fr.ptr == hex + 4 && i == 0x7fff );
+  fr = from_chars( hex, hex + 5, i, 36 );
+  EXAM_CHECK( fr.ec == errc() && fr.ptr == hex + 5 );
+
+  return EXAM_RESULT;
+#else
+  throw exam::skip_exception();
+#endif
+}
+
+int EXAM_IMPL(charconv_test::floats)
+{
+#if defined (STLPORT)
+  if ( !numeric_limits<double>::is_iec559 ) {
+    throw exam::skip_exception();
+  }
+
+  // shortest: fixed or scientific, whichever shorter
+  EXAM_CHECK( to_str( 0.0 ) == "0" );
+  EXAM_CHECK( to_str( -0.0 ) == "-0" );
+  EXAM_CHECK( to_str( 0.1 ) == "0.1" );
+  EXAM_CHECK( to_str( 123456.0 ) == "123456" );
+  EXAM_CHECK( to_str( 1e22 ) == "1e+22" );
+  EXAM_CHECK( to_str( 1e23 ) == "1e+23" );
+  EXAM_CHECK( to_str( 0.0001 ) == "1e-04" );
+  EXAM_CHECK( to_str( 5e-324 ) == "5e-324" );
+  EXAM_CHECK( to_str( 1.7976931348623157e308 ) == "1.7976931348623157e+308" );
+  EXAM_CHECK( to_str( 0.3f ) == "0.3" );
+  EXAM_CHECK( to_str( numeric_limits<double>::infinity() ) == "inf" );
+  EXAM_CHECK( to_str( -numeric_limits<double>::infinity() ) == "-inf" );
+  EXAM_CHECK( to_str( numeric_limits<double>::quiet_NaN() ) == "nan" );
+
+  EXAM_CHECK( to_str( 1e-5, chars_format::scientific ) == "1e-05" );
+  EXAM_CHECK( to_str( 1e21, chars_format::fixed ) == "1000000000000000000000" );
+  EXAM_CHECK( to_str( 1e23, chars_format::fixed ) == "99999999999999991611392" );
+  EXAM_CHECK( to_str( 1234567.0, chars_format::general ) == "1.234567e+06" );
+  EXAM_CHECK( to_str( 1.0, chars_format::hex ) == "1p+0" );
+  EXAM_CHECK( to_str( 0.5, chars_format::hex ) == "1p-1" );
+  EXAM_CHECK( to_str( 3.0, chars_format::hex ) == "1.8p+1" );
+
+  // with precision, as printf
+  EXAM_CHECK( to_str( 3.14159, chars_format::fixed, 2 ) == "3.14" );
+  EXAM_CHECK( to_str( 2.5, chars_format::fixed, 0 ) == "2" );
+  EXAM_CHECK( to_str( 1.0, chars_format::scientific, 3 ) == "1.000e+00" );
+  EXAM_CHECK( to_str( 1234567.0, chars_format::general, 6 ) == "1.23457e+06" );
+  EXAM_CHECK( to_str( 0.0001, chars_format::general, 6 ) == "0.0001" );
+  EXAM_CHECK( to_str( 1.0, chars_format::hex, 2 ) == "1.00p+0" );
+  EXAM_CHECK( to_str( 0.1, chars_format::fixed, 30 ) == "0.100000000000000005551115123126" );
+  EXAM_CHECK( to_str( 5e-324, chars_format::scientific, 20 ) == "4.94065645841246544177e-324" );
+
+  char buf[8];
+  to_chars_result r = to_chars( buf, buf + sizeof(buf), 1.0 / 3 );
+  EXAM_CHECK( r.ec == errc::value_too_large && r.ptr == buf + sizeof(buf) );
+  r = to_chars( buf, buf + sizeof(buf), 1e300, chars_format::fixed );
+  EXAM_CHECK( r.ec == errc::value_too_large && r.ptr == buf + sizeof(buf) );
+  r = to_chars( buf, buf + 3, 0.5 );
+  EXAM_CHECK( r.ec == errc() && string( buf, r.ptr ) == "0.5" );
+
+  double d = 7;
+  EXAM_CHECK( from_str( "0.1", d ) && d == 0.1 );
+  EXAM_CHECK( from_str( "-1.5e+3x", d, errc(), 7 ) && d == -1500.0 );
+  EXAM_CHECK( from_str( ".5", d ) && d == 0.5 );
+  EXAM_CHECK( from_str( "1.", d ) && d == 1.0 );
+  EXAM_CHECK( from_str( "1e", d, errc(), 1 ) && d == 1.0 );
+  EXAM_CHECK( from_str( "inf", d ) && d == numeric_limits<double>::infinity() );
+  EXAM_CHECK( from_str( "-Infinity", d ) && d == -numeric_limits<double>::infinity() );
+  EXAM_CHECK( from_str( "nan(abc_1)", d ) && d != d );
+  d = 7;
+  EXAM_CHECK( from_str( "+1", d, errc::invalid_argument, 0 ) && d == 7 );
+  EXAM_CHECK( from_str( ".", d, errc::invalid_argument, 0 ) && d == 7 );
+  EXAM_CHECK( from_str( "e5", d, errc::invalid_argument, 0 ) && d == 7 );
+  EXAM_CHECK( from_str( "1e500", d, errc::result_out_of_range ) && d == 7 );
+  EXAM_CHECK( from_str( "1e-500", d, errc::result_out_of_range ) && d == 7 );
+
+  // formats restrict pattern
+  EXAM_CHECK( from_str( "1e5", d, chars_format::fixed, errc(), 1 ) && d == 1.0 );
+  EXAM_CHECK( from_str( "1.5", d, chars_format::scientific, errc::invalid_argument, 0 ) );
+  EXAM_CHECK( from_str( "1.8p1", d, chars_format::hex ) && d == 3.0 );
+  EXAM_CHECK( from_str( "0x1p3", d, chars_format::hex, errc(), 1 ) && d == 0.0 );
+  EXAM_CHECK( from_str( "ffp-2", d, chars_format::hex ) && d == 63.75 );
+
+  // rounding: halfway cases, denormals, more than 19 digits
+  EXAM_CHECK( from_str( "9007199254740993", d ) && d == 9007199254740992.0 );
+  EXAM_CHECK( from_str( "9007199254740993.0000000000000000000001", d ) && d == 9007199254740994.0 );
+  EXAM_CHECK( from_str( "2.4703282292062328e-324", d ) && d == 5e-324 );
+  EXAM_CHECK( from_str( "2.4703282292062327e-324", d, errc::result_out_of_range ) );
+  EXAM_CHECK( from_str( "1.7976931348623158e308", d ) && d == 1.7976931348623157e308 );
+  EXAM_CHECK( from_str( "123456789012345678901234567890", d ) && d == 1.2345678901234568e29 );
+
+  // 5 * 2^-1075, exactly between 2 and 3 times denorm_min: 753 digits
+  string s( "1.23516411460311636044142198217055343091264950653581191106396420"
+             "6251688768175521879663249590904089980949491411738614294327316641"
+             "7758898494909969369900269546953157517829757785113196145429196224"
+             "5525922179659014249682680762501596852288391246096828118349318292"
+             "4037850079288463495185315596413977927566646391716920467598900776"
+             "5623298631789787311383232636413610028187003242749988548299735227"
+             "0104140831131189286967253681695039838809652887533700881623368004"
+             "8447567026776872925833056711188333930208107984023095723364592015"
+             "0265028765424524382695855693295823119762456311826940939818119686"
+             "6402119455093361742488341175449316942939628141513779978287622277"
+             "5362759465684541812738959347433399748416202485291051425659272569"
+             "81069188614130727188467062660492956638336181640625" );
+  const double dmin = numeric_limits<double>::denorm_min();
+  EXAM_CHECK( from_str( (s + "e-323").c_str(), d ) && d == 2 * dmin );
+  s += string( 1000, '0' );
+  EXAM_CHECK( from_str( (s + "e-323").c_str(), d ) && d == 2 * dmin );
+  s += "1e-323";
+  EXAM_CHECK( from_str( s.c_str(), d ) && d == 3 * dmin );
+
+  float f = 7;
+  EXAM_CHECK( from_str( "0.3", f ) && f == 0.3f );
+  EXAM_CHECK( from_str( "3.4028235e38", f ) && f == numeric_limits<float>::max() );
+  EXAM_CHECK( from_str( "3.4028236e38", f, errc::result_out_of_range ) );
+  EXAM_CHECK( from_str( "3.5e38", f, errc::result_out_of_range ) );
+  EXAM_CHECK( from_str( "1e-46", f, errc::result_out_of_range ) );
+
+  return EXAM_RESULT;
+#else
+  throw exam::skip_exception();
+#endif
+}
+
+int EXAM_IMPL(charconv_test::round_trip)
+{
+#if defined (STLPORT)
+  typedef numeric_limits<double> limits;
+  if ( !limits::is_iec559 ) {
+    throw exam::skip_exception();
+  }
+
+  static const chars_format fmts[] = { chars_format::general, chars_format::scientific,
+                                       chars_format::fixed, chars_format::hex };
+  char buf[1200];
+  unsigned long long m = 0x2545f4914f6cdd1dULL;
+  unsigned failed = 0;
+  for ( int e = limits::min_exponent - limits::digits + 1; e < limits::max_exponent; ++e ) {
+    m = m * 6364136223846793005ULL + 1442695040888963407ULL;
+    const double val = ldexp( static_cast<double>((m >> 11) | (1ULL << 52)), e - limits::digits );
+    for ( size_t i = 0; i < sizeof(fmts) / sizeof(fmts[0]); ++i ) {
+      to_chars_result r = to_chars( buf, buf + sizeof(buf), val, fmts[i] );
+      double in_val = 0;
+      from_chars_result fr = from_chars( buf, r.ptr, in_val, fmts[i] );
+      failed += (r.ec != errc() || fr.ec != errc() || fr.ptr != r.ptr || in_val != val);
+    }
+    // 17 significant digits always enough
+    to_chars_result r = to_chars( buf, buf + sizeof(buf), -val, chars_format::scientific, 16 );
+    double in_val = 0;
+    from_chars( buf, r.ptr, in_val );
+    failed += (in_val != -val);
+
+    const float fval = static_cast<float>(val);
+    if ( fval != 0 && fval == fval && fval - fval == 0 ) {
+      r = to_chars( buf, buf + sizeof(buf), fval );
+      float in_fval = 0;
+      from_chars( buf, r.ptr, in_fval );
+      failed += (in_fval != fval);
+    }
+  }
+  EXAM_CHECK( failed == 0 );
+
+  failed = 0;
+  for ( int i = 0; i < 10000; ++i ) {
+    m = m * 6364136223846793005ULL + 1442695040888963407ULL;
+    const long long x = static_cast<long long>(m) >> (m % 64);
+    for ( int base = 2; base <= 36; base += 7 ) {
+      to_chars_result r = to_chars( buf, buf + sizeof(buf), x, base );
+      long long y = 0;
+      from_chars_result fr = from_chars( buf, r.ptr, y, base );
+      failed += (fr.ec != errc() || fr.ptr != r.ptr || y != x);
+    }
+  }
+  EXAM_CHECK( failed == 0 );
+
+  return EXAM_RESULT;
+#else
+  throw exam::skip_exception();
+#endif
+}
+
+int EXAM_IMPL(charconv_test::stream_fast_path)
+{
+#if defined (STLPORT)
+  // same input read from one get area and from get area of few chars
+  const string input( "12 -7 4294967296 +5 0.25 -1e-2 123456789012345678901 3.5x 77" );
+  for ( size_t chunk = 1; chunk <= input.size(); chunk += chunk < 4 ? 1 : 40 ) {
+    chunked_buf cb( input, chunk );
+    istringstream whole( input );
+    istream chunked( &cb );
+    istream* streams[] = { &whole, &chunked };
+
+    for ( int i = 0; i < 2; ++i ) {
+      istream& in = *streams[i];
+      int n = 0;
+      long long ll = 0;
+      unsigned u = 0;
+      double d = 0;
+      float f = 0;
+      in >> n;
+      EXAM_CHECK( in.good() && n == 12 );
+      in >> n;
+      EXAM_CHECK( in.good() && n == -7 );
+      in >> ll;
+      EXAM_CHECK( in.good() && ll == 4294967296LL );
+      in >> u;
+      EXAM_CHECK( in.good() && u == 5 );
+      in >> d;
+      EXAM_CHECK( in.good() && d == 0.25 );
+      in >> f;
+      EXAM_CHECK( in.good() && f == -1e-2f );
+      in >> ll;
+      EXAM_CHECK( in.fail() );
+      in.clear();
+      in >> d;
+      EXAM_CHECK( in.good() && d == 3.5 );
+      EXAM_CHECK( in.get() == 'x' );
+      in >> n;
+      EXAM_CHECK( !in.fail() && in.eof() && n == 77 );
+    }
+  }
+
+  istringstream hex_in( "ff 1,234" );
+  int n = 0;
+  hex_in >> hex >> n;
+  EXAM_CHECK( hex_in.good() && n == 255 );
+  hex_in >> dec >> n;
+  EXAM_CHECK( hex_in.good() && n == 1 );
+
+  return EXAM_RESULT;
+#else
+  throw exam::skip_exception();
+#endif
+}
+
+int EXAM_IMPL(charconv_test::long_double_hex)
+{
+#if defined (STLPORT) && !defined (_STLP_NO_LONG_DOUBLE)
+  if ( numeric_limits<long double>::digits != 64 ) {
+    throw exam::skip_exception();
+  }
+
+  // 17th hex digit is in 64-bit mantissa or rounded, not dropped
+  const long double one = 1.0L;
+  long double x = 7;
+  EXAM_CHECK( from_str( "1.0000000000000018p0", x, chars_format::hex ) && x == one + ldexp( 3.0L, -61 ) );
+  EXAM_CHECK( from_str( "1.0000000000000001p0", x, chars_format::hex ) && x == one );
+  EXAM_CHECK( from_str( "1.0000000000000003p0", x, chars_format::hex ) && x == one + ldexp( one, -62 ) );
+  EXAM_CHECK( from_str( "1.000000000000000fp0", x, chars_format::hex ) && x == one + ldexp( one, -60 ) );
+  EXAM_CHECK( from_str( "1.00000000000000010000000001p0", x, chars_format::hex ) && x == one + ldexp( one, -63 ) );
+  EXAM_CHECK( from_str( "ffffffffffffffff8p0", x, chars_format::hex ) && x == ldexp( one, 68 ) );
+  EXAM_CHECK( from_str( "fffffffffffffffe8p0", x, chars_format::hex ) && x == ldexp( 0xfffffffffffffffeULL * one, 4 ) );
+  EXAM_CHECK( from_str( "fffffffffffffffd8p0", x, chars_format::hex ) && x == ldexp( 0xfffffffffffffffeULL * one, 4 ) );
+
+  // denormal: precision is lower, rounding point moves
+  const long double dmin = numeric_limits<long double>::denorm_min();
+  EXAM_CHECK( from_str( "1.8p-16445", x, chars_format::hex ) && x == 2 * dmin );
+  EXAM_CHECK( from_str( "2.8000000000000000001p-16445", x, chars_format::hex ) && x == 3 * dmin );
+
+  return EXAM_RESULT;
+#else
+  throw exam::skip_exception();
+#endif
+}
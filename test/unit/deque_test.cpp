@@ -200,10 +200,10 @@ int EXAM_IMPL(deque_test::auto_ref)
 
 int EXAM_IMPL(deque_test::allocator_with_state)
 {
-  char buf1[1024];
+  char buf1[16384]; // two deques of one 4 KiB block each
   StackAllocator<int> stack1(buf1, buf1 + sizeof(buf1));
 
-  char buf2[1024];
+  char buf2[16384];
   StackAllocator<int> stack2(buf2, buf2 + sizeof(buf2));
 
   {
@@ -416,6 +416,118 @@ int EXAM_IMPL(deque_test::init_range)
   return EXAM_RESULT;
 }
 
+#if defined (STLPORT)
+struct small_block_item
+{
+    int v;
+};
+
+namespace std {
+
+template <>
+struct deque_block_traits<small_block_item>
+{
+    static const size_t elements = 3;
+};
+
+} // namespace std
+
+// allocator that count calls of allocate()
+template <class T>
+class counting_allocator :
+    public allocator<T>
+{
+  public:
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator( int* c ) :
+        counter( c )
+      { }
+
+    template <class U>
+    counting_allocator( const counting_allocator<U>& a ) :
+        counter( a.counter )
+      { }
+
+    T* allocate( size_t n, const void* = 0 )
+      {
+        ++*counter;
+        return allocator<T>::allocate( n );
+      }
+
+    int* counter;
+};
+
+template <class T, class U>
+bool operator ==( const counting_allocator<T>& a, const counting_allocator<U>& b )
+{ return a.counter == b.counter; }
+
+template <class T, class U>
+bool operator !=( const counting_allocator<T>& a, const counting_allocator<U>& b )
+{ return a.counter != b.counter; }
+#endif
+
+int EXAM_IMPL(deque_test::block_size)
+{
+#if defined (STLPORT)
+  // three elements per block: every operation cross block boundaries
+  deque<small_block_item> d;
+  for ( int i = 0; i < 100; ++i ) {
+    small_block_item item = { i };
+    if ( i % 2 ) {
+      d.push_back( item );
+    } else {
+      d.push_front( item );
+    }
+  }
+  EXAM_REQUIRE( d.size() == 100 );
+  for ( int i = 0; i < 50; ++i ) {
+    EXAM_CHECK( d[i].v == 98 - 2 * i );
+    EXAM_CHECK( (d.end() - 50 + i)->v == 2 * i + 1 );
+  }
+  EXAM_CHECK( (d.end() - d.begin()) == 100 );
+
+  small_block_item item = { -1 };
+  d.insert( d.begin() + 10, 7, item );
+  d.erase( d.begin() + 40, d.begin() + 60 );
+  EXAM_CHECK( d.size() == 87 );
+  EXAM_CHECK( d[9].v == 80 && d[10].v == -1 && d[16].v == -1 && d[17].v == 78 );
+
+  // queue churn: after warm-up, released block is reused
+  int allocs = 0;
+  deque<int, counting_allocator<int> > q( (counting_allocator<int>( &allocs )) );
+  const int n = static_cast<int>(deque_block_traits<int>::elements) * 3;
+  for ( int i = 0; i < n; ++i ) {
+    q.push_back( i );
+  }
+  int expected = 0;
+  bool in_order = true;
+  for ( int i = 0; i < n; ++i ) {
+    in_order = in_order && (q.front() == expected++);
+    q.pop_front();
+  }
+  int warm = allocs;
+  for ( int r = 0; r < 10; ++r ) {
+    for ( int i = 0; i < n; ++i ) {
+      q.push_back( n + r * n + i );
+      in_order = in_order && (q.front() == expected++);
+      q.pop_front();
+    }
+  }
+  EXAM_CHECK( in_order );
+  EXAM_CHECK( q.empty() );
+  EXAM_CHECK( allocs == warm );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
 /* Simple compilation test: Check that nested types like iterator
  * can be access even if type used to instanciate container is not
  * yet completely defined.
@@ -39,6 +39,7 @@ class deque_test
     int EXAM_DECL(fill_non_trivial);
     int EXAM_DECL(init_integral);
     int EXAM_DECL(init_range);
+    int EXAM_DECL(block_size);
 };
 
 class queue_test
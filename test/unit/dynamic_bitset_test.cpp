@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "bitset_test.h"
+
+#include <vector>
+#include <stdexcept>
+#if defined (STLPORT)
+#  include <dynamic_bitset>
+#endif
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+int EXAM_IMPL(dynamic_bitset_test::basic)
+{
+#if defined (STLPORT)
+  dynamic_bitset<> b;
+  EXAM_CHECK( b.empty() );
+  EXAM_CHECK( b.size() == 0 );
+  EXAM_CHECK( b.count() == 0 );
+  EXAM_CHECK( b.none() );
+  EXAM_CHECK( b.find_first() == dynamic_bitset<>::npos );
+
+  dynamic_bitset<> v( 13, 0x1111 );
+  EXAM_CHECK( v.size() == 13 );
+  EXAM_CHECK( v.count() == 4 );
+  EXAM_CHECK( v[0] && v[4] && v[8] && v[12] );
+  EXAM_CHECK( !v[1] );
+
+  // bits beyond size are dropped
+  dynamic_bitset<unsigned char> c( 10, 0xffff );
+  EXAM_CHECK( c.count() == 10 );
+  EXAM_CHECK( c.all() );
+  EXAM_CHECK( c.num_blocks() == 2 );
+
+  v.resize( 200, true );
+  EXAM_CHECK( v.size() == 200 );
+  EXAM_CHECK( v.count() == 4 + 187 );
+  EXAM_CHECK( !v[11] && v[13] && v[199] );
+  v.resize( 9 );
+  EXAM_CHECK( v.count() == 3 );
+  v.resize( 100 );
+  EXAM_CHECK( v.count() == 3 );
+  EXAM_CHECK( !v[12] );
+
+  v[99] = true;
+  v[0] = false;
+  v[1].flip();
+  EXAM_CHECK( v.count() == 4 );
+  EXAM_CHECK( v.test( 99 ) && v.test( 1 ) && !v.test( 0 ) );
+
+  v.set( 50 ).reset( 99 ).flip( 2 );
+  EXAM_CHECK( v.test( 50 ) && !v.test( 99 ) && v.test( 2 ) );
+
+  bool thrown = false;
+  try {
+    v.set( 100 );
+  }
+  catch ( out_of_range& ) {
+    thrown = true;
+  }
+  EXAM_CHECK( thrown );
+
+  v.set();
+  EXAM_CHECK( v.count() == 100 );
+  EXAM_CHECK( (~v).none() );
+  v.reset();
+  EXAM_CHECK( v.none() );
+
+  dynamic_bitset<unsigned short> p;
+  for ( int i = 0; i < 21; ++i ) {
+    p.push_back( i % 3 == 0 );
+  }
+  p.append( 0x8001 );
+  EXAM_CHECK( p.size() == 37 );
+  EXAM_CHECK( p.count() == 7 + 2 );
+  EXAM_CHECK( p[21] && !p[22] && p[36] );
+
+  dynamic_bitset<unsigned short> q( p );
+  EXAM_CHECK( q == p );
+  q.clear();
+  EXAM_CHECK( q.empty() );
+  q.swap( p );
+  EXAM_CHECK( p.empty() );
+  EXAM_CHECK( q.size() == 37 );
+#else
+  throw exam::skip_exception();
+#endif
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(dynamic_bitset_test::set_operations)
+{
+#if defined (STLPORT)
+  // long enough for SIMD packets and library count kernels, with tail
+  const size_t n = 1000;
+  dynamic_bitset<> a( n ), b( n ), c( n );
+  for ( size_t i = 0; i < n; ++i ) {
+    a[i] = i % 2 == 0;
+    b[i] = i % 3 == 0;
+    c[i] = i % 6 == 0;
+  }
+
+  EXAM_CHECK( (a & b) == c );
+  EXAM_CHECK( (a & b).count() == 167 );
+  EXAM_CHECK( a.intersection_count( b ) == 167 );
+  EXAM_CHECK( (a | b).count() == 500 + 334 - 167 );
+  EXAM_CHECK( (a ^ b).count() == 500 + 334 - 2 * 167 );
+  EXAM_CHECK( (a - b).count() == 500 - 167 );
+  EXAM_CHECK( ((a - b) & b).none() );
+
+  EXAM_CHECK( c.is_subset_of( a ) );
+  EXAM_CHECK( c.is_subset_of( b ) );
+  EXAM_CHECK( c.is_proper_subset_of( a ) );
+  EXAM_CHECK( !a.is_subset_of( b ) );
+  EXAM_CHECK( a.is_subset_of( a ) );
+  EXAM_CHECK( !a.is_proper_subset_of( a ) );
+  EXAM_CHECK( a.intersects( b ) );
+  EXAM_CHECK( !(a - b).intersects( c ) );
+
+  // difference only in last bit
+  dynamic_bitset<> d( c );
+  d[n - 1] = true;
+  EXAM_CHECK( c.is_subset_of( d ) );
+  EXAM_CHECK( !d.is_subset_of( c ) );
+  EXAM_CHECK( d != c );
+
+  dynamic_bitset<> r( a );
+  r &= b;
+  r |= d;
+  r ^= c;
+  EXAM_CHECK( r.count() == 1 );
+  EXAM_CHECK( r.find_first() == n - 1 );
+
+  dynamic_bitset<> e( n );
+  EXAM_CHECK( e.is_subset_of( a ) );
+  EXAM_CHECK( !e.intersects( a ) );
+  EXAM_CHECK( e.intersection_count( a ) == 0 );
+#else
+  throw exam::skip_exception();
+#endif
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(dynamic_bitset_test::iteration)
+{
+#if defined (STLPORT)
+  dynamic_bitset<unsigned int> b( 300 );
+  vector<size_t> expected;
+  for ( size_t i = 7; i < b.size(); i += 29 ) {
+    b[i] = true;
+    expected.push_back( i );
+  }
+  b[299] = true;
+  expected.push_back( 299 );
+
+  vector<size_t> found;
+  for ( size_t i = b.find_first(); i != dynamic_bitset<unsigned int>::npos; i = b.find_next( i ) ) {
+    found.push_back( i );
+  }
+  EXAM_CHECK( found == expected );
+
+  vector<size_t> ones( b.ones_begin(), b.ones_end() );
+  EXAM_CHECK( ones == expected );
+
+  EXAM_CHECK( b.find_next( 299 ) == dynamic_bitset<unsigned int>::npos );
+
+  dynamic_bitset<unsigned int> e( 64 );
+  EXAM_CHECK( e.ones_begin() == e.ones_end() );
+#else
+  throw exam::skip_exception();
+#endif
+  return EXAM_RESULT;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "map_test.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#if defined (STLPORT)
+#  include <flat_hash_set>
+#  include <flat_hash_map>
+#endif
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+const int NB_FLAT_ELEMS = 2000;
+
+int EXAM_IMPL(flat_hash_test::fset)
+{
+#if defined (STLPORT)
+  typedef flat_hash_set<int> fsettype;
+  fsettype s;
+
+  EXAM_CHECK( s.empty() );
+  EXAM_CHECK( s.begin() == s.end() );
+  EXAM_CHECK( s.find(1) == s.end() );
+  EXAM_CHECK( s.count(1) == 0 );
+  EXAM_CHECK( s.erase(1) == 0 );
+
+  pair<fsettype::iterator, bool> ret = s.insert(1);
+  EXAM_CHECK( ret.second );
+  EXAM_CHECK( *ret.first == 1 );
+
+  ret = s.insert(1);
+  EXAM_CHECK( !ret.second );
+  EXAM_CHECK( *ret.first == 1 );
+  EXAM_CHECK( s.size() == 1 );
+
+  int i;
+  for (i = 0; i < NB_FLAT_ELEMS; ++i) {
+    s.insert(i);
+  }
+  EXAM_CHECK( s.size() == NB_FLAT_ELEMS );
+  EXAM_CHECK( s.load_factor() <= s.max_load_factor() );
+
+  vector<int> elems(s.begin(), s.end());
+  sort(elems.begin(), elems.end());
+  for (i = 0; i < NB_FLAT_ELEMS; ++i) {
+    EXAM_CHECK( elems[i] == i );
+    EXAM_CHECK( s.count(i) == 1 );
+  }
+  EXAM_CHECK( s.count(NB_FLAT_ELEMS) == 0 );
+  EXAM_CHECK( s.count(-1) == 0 );
+
+  pair<fsettype::const_iterator, fsettype::const_iterator> range = s.equal_range(10);
+  EXAM_CHECK( distance(range.first, range.second) == 1 );
+  EXAM_CHECK( *range.first == 10 );
+  range = s.equal_range(-10);
+  EXAM_CHECK( range.first == s.end() );
+  EXAM_CHECK( range.second == s.end() );
+
+  s.clear();
+  EXAM_CHECK( s.empty() );
+  EXAM_CHECK( s.begin() == s.end() );
+  EXAM_CHECK( s.count(10) == 0 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_hash_test::fmap)
+{
+#if defined (STLPORT)
+  typedef flat_hash_map<string, int> fmaptype;
+  fmaptype m;
+
+  m["one"] = 1;
+  m["two"] = 2;
+  EXAM_CHECK( m.size() == 2 );
+  EXAM_CHECK( m["one"] == 1 );
+  EXAM_CHECK( m["three"] == 0 );
+  EXAM_CHECK( m.size() == 3 );
+
+  pair<fmaptype::iterator, bool> ret = m.insert(fmaptype::value_type("two", 20));
+  EXAM_CHECK( !ret.second );
+  EXAM_CHECK( ret.first->second == 2 );
+
+  ret = m.emplace("four", 4);
+  EXAM_CHECK( ret.second );
+  EXAM_CHECK( ret.first->first == "four" );
+
+  fmaptype::iterator it = m.find("one");
+  EXAM_CHECK( it != m.end() );
+  it->second = 10;
+  EXAM_CHECK( m["one"] == 10 );
+
+  // reference to map: string keys with hash collisions in 7 low bits are likely
+  unordered_map<string, int> ref;
+  char buf[32];
+  for (int i = 0; i < NB_FLAT_ELEMS; ++i) {
+    sprintf(buf, "key%d", i);
+    m[buf] = i;
+    ref[buf] = i;
+  }
+  ref["one"] = 10;
+  ref["two"] = 2;
+  ref["three"] = 0;
+  ref["four"] = 4;
+  EXAM_CHECK( m.size() == ref.size() );
+
+  size_t n = 0;
+  for (fmaptype::const_iterator cit = m.begin(); cit != m.end(); ++cit, ++n) {
+    EXAM_CHECK( ref[cit->first] == cit->second );
+  }
+  EXAM_CHECK( n == ref.size() );
+
+  EXAM_CHECK( m.erase("one") == 1 );
+  EXAM_CHECK( m.erase("one") == 0 );
+  EXAM_CHECK( m.find("one") == m.end() );
+  EXAM_CHECK( m.size() == ref.size() - 1 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+/*
+ * Many erase/insert cycles on same table: tombstones left by erase must not
+ * break lookup and must not make table grow for ever.
+ */
+int EXAM_IMPL(flat_hash_test::erase_insert)
+{
+#if defined (STLPORT)
+  typedef flat_hash_set<size_t> fsettype;
+  fsettype s;
+
+  size_t i;
+  for (i = 0; i < NB_FLAT_ELEMS; ++i) {
+    s.insert(i * 1024);
+  }
+  size_t nbSlots = s.bucket_count();
+
+  // each round replace every key by new one
+  for (size_t round = 0; round < 20; ++round) {
+    for (i = 0; i < NB_FLAT_ELEMS; ++i) {
+      EXAM_CHECK( s.erase((i + round * NB_FLAT_ELEMS) * 1024) == 1 );
+      EXAM_CHECK( s.insert((i + (round + 1) * NB_FLAT_ELEMS) * 1024).second );
+    }
+    EXAM_CHECK( s.size() == NB_FLAT_ELEMS );
+    for (i = 0; i < NB_FLAT_ELEMS; ++i) {
+      EXAM_CHECK( s.count((i + round * NB_FLAT_ELEMS) * 1024) == 0 );
+      EXAM_CHECK( s.count((i + (round + 1) * NB_FLAT_ELEMS) * 1024) == 1 );
+    }
+  }
+  EXAM_CHECK( s.bucket_count() <= 2 * nbSlots );
+
+  // erase during iteration don't invalidate other iterators
+  for (fsettype::iterator it = s.begin(); it != s.end(); ) {
+    if ((*it / 1024) % 3 == 0) {
+      s.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  for (fsettype::iterator it = s.begin(); it != s.end(); ++it) {
+    EXAM_CHECK( (*it / 1024) % 3 != 0 );
+  }
+
+  s.erase(s.begin(), s.end());
+  EXAM_CHECK( s.empty() );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_hash_test::copy_move)
+{
+#if defined (STLPORT)
+  typedef flat_hash_map<int, string> fmaptype;
+  fmaptype m;
+
+  for (int i = 0; i < 100; ++i) {
+    m[i] = string(i, 'a');
+  }
+
+  fmaptype m2(m);
+  EXAM_CHECK( m2.size() == m.size() );
+  for (int i = 0; i < 100; ++i) {
+    EXAM_CHECK( m2[i] == string(i, 'a') );
+  }
+
+  fmaptype m3(_STLP_STD::move(m2));
+  EXAM_CHECK( m2.empty() );
+  EXAM_CHECK( m3.size() == 100 );
+  EXAM_CHECK( m3[99] == string(99, 'a') );
+
+  m2 = m3;
+  m3.clear();
+  EXAM_CHECK( m2.size() == 100 );
+  EXAM_CHECK( m3.empty() );
+
+  m3.swap(m2);
+  EXAM_CHECK( m2.empty() );
+  EXAM_CHECK( m3.size() == 100 );
+
+  // reusable after move
+  m2[1] = "b";
+  EXAM_CHECK( m2.size() == 1 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_hash_test::reserve)
+{
+#if defined (STLPORT)
+  typedef flat_hash_map<int, int> fmaptype;
+  fmaptype m;
+
+  m.reserve(NB_FLAT_ELEMS);
+  size_t nbSlots = m.bucket_count();
+  EXAM_CHECK( (nbSlots & (nbSlots - 1)) == 0 );
+
+  // no rehash up to reserved size: iterators stay valid
+  m[0] = 0;
+  fmaptype::iterator first = m.find(0);
+  for (int i = 1; i < NB_FLAT_ELEMS; ++i) {
+    m[i] = i;
+  }
+  EXAM_CHECK( m.bucket_count() == nbSlots );
+  EXAM_CHECK( first == m.find(0) );
+
+  m.rehash(nbSlots * 4);
+  EXAM_CHECK( m.bucket_count() >= nbSlots * 4 );
+  for (int i = 0; i < NB_FLAT_ELEMS; ++i) {
+    EXAM_CHECK( m[i] == i );
+  }
+
+  m.max_load_factor(0.5f);
+  EXAM_CHECK( m.load_factor() <= 0.5f );
+  m.max_load_factor(2.0f); // too big for open addressing
+  EXAM_CHECK( m.max_load_factor() < 1.0f );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
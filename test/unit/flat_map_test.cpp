@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This material is provided "as is", with absolutely no warranty expressed
+ * or implied. Any use is at your own risk.
+ *
+ * Permission to use or copy this software for any purpose is hereby granted
+ * without fee, provided the above notices are retained on all copies.
+ * Permission to modify the code and to distribute modified code is granted,
+ * provided the above notices are retained, and a notice that the code was
+ * modified is included with the above copyright notice.
+ *
+ */
+
+#include "map_test.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#if defined (STLPORT)
+#  include <flat_set>
+#  include <flat_map>
+#endif
+
+#if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
+using namespace std;
+#endif
+
+int EXAM_IMPL(flat_map_test::fset)
+{
+#if defined (STLPORT)
+  typedef flat_set<int> fsettype;
+  fsettype s;
+
+  EXAM_CHECK( s.empty() );
+  EXAM_CHECK( s.find(1) == s.end() );
+  EXAM_CHECK( s.erase(1) == 0 );
+
+  pair<fsettype::iterator, bool> ret = s.insert(5);
+  EXAM_CHECK( ret.second );
+  EXAM_CHECK( *ret.first == 5 );
+  ret = s.insert(5);
+  EXAM_CHECK( !ret.second );
+  EXAM_CHECK( s.size() == 1 );
+
+  s.insert(s.begin(), 1);
+  s.insert(s.end(), 9);
+  s.insert(s.begin(), 7); // wrong hint
+  int expected[] = { 1, 5, 7, 9 };
+  EXAM_CHECK( s.size() == 4 );
+  EXAM_CHECK( equal(s.begin(), s.end(), expected) );
+
+  EXAM_CHECK( *s.lower_bound(6) == 7 );
+  EXAM_CHECK( *s.upper_bound(7) == 9 );
+  EXAM_CHECK( s.lower_bound(10) == s.end() );
+  EXAM_CHECK( s.count(7) == 1 );
+  EXAM_CHECK( s.erase(7) == 1 );
+  EXAM_CHECK( s.count(7) == 0 );
+
+  flat_multiset<int, greater<int> > ms;
+  ms.insert(3);
+  ms.insert(1);
+  ms.insert(3);
+  EXAM_CHECK( ms.size() == 3 );
+  EXAM_CHECK( *ms.begin() == 3 );
+  EXAM_CHECK( ms.count(3) == 2 );
+  EXAM_CHECK( distance(ms.equal_range(3).first, ms.equal_range(3).second) == 2 );
+  EXAM_CHECK( ms.erase(3) == 2 );
+  EXAM_CHECK( ms.size() == 1 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_map_test::fmap)
+{
+#if defined (STLPORT)
+  typedef flat_map<string, int> fmaptype;
+  fmaptype m;
+
+  m["two"] = 2;
+  m["one"] = 1;
+  m["three"] = 3;
+  EXAM_CHECK( m.size() == 3 );
+  EXAM_CHECK( m["two"] == 2 );
+  EXAM_CHECK( m.at("one") == 1 );
+  EXAM_CHECK( m.find("four") == m.end() );
+
+  // keys and values are in parallel sorted vectors
+  EXAM_CHECK( m.keys()[0] == "one" );
+  EXAM_CHECK( m.keys()[2] == "two" );
+  EXAM_CHECK( m.values()[1] == 3 );
+
+  fmaptype::iterator i = m.find("three");
+  EXAM_CHECK( i != m.end() );
+  EXAM_CHECK( (*i).first == "three" );
+  i->second = 33;
+  EXAM_CHECK( m["three"] == 33 );
+
+  pair<fmaptype::iterator, bool> ret = m.insert(make_pair(string("one"), 11));
+  EXAM_CHECK( !ret.second );
+  EXAM_CHECK( ret.first->second == 1 );
+
+  int sum = 0;
+  for (fmaptype::const_iterator j = m.begin(); j != m.end(); ++j) {
+    sum += j->second;
+  }
+  EXAM_CHECK( sum == 36 );
+
+  m.erase(m.begin());
+  EXAM_CHECK( m.size() == 2 );
+  EXAM_CHECK( m.begin()->first == "three" );
+
+  flat_multimap<int, char> mm;
+  mm.insert(make_pair(1, 'a'));
+  mm.insert(make_pair(0, 'b'));
+  mm.insert(make_pair(1, 'c'));
+  EXAM_CHECK( mm.count(1) == 2 );
+  // equivalent keys keep order of insertion
+  pair<flat_multimap<int, char>::iterator, flat_multimap<int, char>::iterator> r = mm.equal_range(1);
+  EXAM_CHECK( r.first->second == 'a' );
+  EXAM_CHECK( (r.first + 1)->second == 'c' );
+  EXAM_CHECK( r.second == mm.end() );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(flat_map_test::range_insert)
+{
+#if defined (STLPORT)
+  vector<int> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back((i * 37) % 50);
+  }
+
+  flat_set<int> s(v.begin(), v.end());
+  EXAM_CHECK( s.size() == 50 );
+  EXAM_CHECK( is_sorted(s.begin(), s.end()) );
+
+  flat_multiset<int> ms(v.begin(), v.end());
+  EXAM_CHECK( ms.size() == 100 );
+  EXAM_CHECK( ms.count(7) == 2 );
+
+  // merge of new elements with old ones
+  vector<int> w;
+  for (int i = 40; i < 60; ++i) {
+    w.push_back(i);
+  }
+  s.insert(w.begin(), w.end());
+  EXAM_CHECK( s.size() == 60 );
+  EXAM_CHECK( *s.rbegin() == 59 );
+
+  vector<pair<int, int> > p;
+  for (int i = 0; i < 100; ++i) {
+    p.push_back(make_pair(v[i], i));
+  }
+  flat_map<int, int> m(p.begin(), p.end());
+  EXAM_CHECK( m.size() == 50 );
+  // first of equivalent elements win
+  EXAM_CHECK( m[v[0]] == 0 );
+  EXAM_CHECK( m[v[99]] == 49 );
+
+  flat_multimap<int, int> mm(p.begin(), p.end());
+  EXAM_CHECK( mm.size() == 100 );
+  EXAM_CHECK( mm.find(v[99])->second == 49 );
+  EXAM_CHECK( (mm.find(v[99]) + 1)->second == 99 );
+
+  m.insert(p.begin(), p.end());
+  EXAM_CHECK( m.size() == 50 );
+  EXAM_CHECK( m[v[0]] == 0 );
+
+  flat_map<int, int>::key_container_type k = m.keys();
+  flat_map<int, int>::mapped_container_type val = m.values();
+  flat_map<int, int> m2;
+  m2.replace(_STLP_STD::move(k), _STLP_STD::move(val));
+  EXAM_CHECK( m2 == m );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
@@ -35,6 +35,8 @@ class forward_list_test
     int EXAM_DECL(allocator_with_state);
     int EXAM_DECL(move);
     int EXAM_DECL(assign);
+    int EXAM_DECL(sort);
+    int EXAM_DECL(node_pool);
 };
 
 #endif // __TEST_SLIST_TEST_H
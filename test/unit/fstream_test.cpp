@@ -29,6 +29,7 @@
 #include <iostream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 #include <stdio.h>
 
@@ -909,6 +910,243 @@ int EXAM_IMPL(fstream_test::big_file)
   return EXAM_RESULT;
 }
 
+int EXAM_IMPL(fstream_test::large_blocks)
+{
+  // blocks larger than any reasonable filebuf buffer (and than
+  // memory-mapped window of input), mixed with small ones
+  const streamsize big = 1500001;
+  vector<char> block(big);
+  for (streamsize i = 0; i < big; ++i) {
+    block[i] = static_cast<char>('a' + (i * 7 + i / 251) % 26);
+  }
+
+  {
+    ofstream out( "test_file.txt", ios_base::out | ios_base::binary | ios_base::trunc );
+    out << "head";
+    out.write( &block[0], big );
+    EXAM_CHECK( out.tellp() == streampos(4 + big) );
+    out.put( '|' );
+    out.write( &block[0], big );
+    out << "tail";
+    EXAM_CHECK( out.good() );
+    EXAM_CHECK( out.tellp() == streampos(4 + big + 1 + big + 4) );
+  }
+
+  {
+    ifstream in( "test_file.txt", ios_base::in | ios_base::binary );
+    char head[4];
+    in.read( head, 4 );
+    EXAM_CHECK( in.gcount() == 4 );
+    EXAM_CHECK( string(head, 4) == "head" );
+
+    vector<char> got(big);
+    in.read( &got[0], big );
+    EXAM_CHECK( in.gcount() == big );
+    EXAM_CHECK( got == block );
+    EXAM_CHECK( in.tellg() == streampos(4 + big) );
+
+    // putback of last character read
+    EXAM_CHECK( in.putback( got[big - 1] ).good() );
+    EXAM_CHECK( in.get() == got[big - 1] );
+    EXAM_CHECK( in.get() == '|' );
+
+    in.seekg( 4 + 1000, ios_base::beg );
+    in.read( &got[0], big - 1000 );
+    EXAM_CHECK( in.gcount() == big - 1000 );
+    EXAM_CHECK( equal(got.begin(), got.begin() + (big - 1000), block.begin() + 1000) );
+    EXAM_CHECK( in.get() == '|' );
+
+    // the rest is shorter than request
+    got.assign( big + 10, 0 );
+    in.read( &got[0], big + 10 );
+    EXAM_CHECK( in.gcount() == big + 4 );
+    EXAM_CHECK( in.eof() && in.fail() );
+    EXAM_CHECK( equal(block.begin(), block.end(), got.begin()) );
+    EXAM_CHECK( string(&got[big], 4) == "tail" );
+  }
+
+  {
+    // unbuffered: every block, however small, goes to file directly
+    filebuf fb;
+    fb.pubsetbuf( 0, 0 );
+    EXAM_CHECK( fb.open( "test_file.txt", ios_base::in | ios_base::out | ios_base::binary | ios_base::trunc ) != 0 );
+    EXAM_CHECK( fb.sputn( "0123456789", 10 ) == 10 );
+    EXAM_CHECK( fb.sputn( &block[0], big ) == big );
+    EXAM_CHECK( fb.pubseekoff( 0, ios_base::cur ) == streampos(10 + big) );
+    EXAM_CHECK( fb.pubseekoff( 0, ios_base::beg ) == streampos(0) );
+
+    char digits[10];
+    EXAM_CHECK( fb.sgetn( digits, 10 ) == 10 );
+    EXAM_CHECK( string(digits, 10) == "0123456789" );
+    EXAM_CHECK( fb.pubseekoff( 0, ios_base::cur ) == streampos(10) );
+    vector<char> got(big);
+    EXAM_CHECK( fb.sgetn( &got[0], big ) == big );
+    EXAM_CHECK( got == block );
+    EXAM_CHECK( fb.sgetc() == char_traits<char>::eof() );
+    EXAM_CHECK( fb.close() != 0 );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_test::mmap_view)
+{
+#if defined (STLPORT)
+  const streamsize sz = 3 * 1024 * 1024 + 123;
+  vector<char> content(sz);
+  for (streamsize i = 0; i < sz; ++i) {
+    content[i] = static_cast<char>(i * 13 + i / 4093);
+  }
+  {
+    ofstream out( "test_file.txt", ios_base::out | ios_base::binary | ios_base::trunc );
+    out.write( &content[0], sz );
+    EXAM_CHECK( out.good() );
+  }
+
+  {
+    // whole file in one view
+    filebuf fb;
+    fb.set_mmap_policy( filebuf::mmap_whole );
+    EXAM_CHECK( fb.mmap_policy() == filebuf::mmap_whole );
+    EXAM_CHECK( fb.open( "test_file.txt", ios_base::in | ios_base::binary ) != 0 );
+    const char* p = fb.data();
+#  if defined (_STLP_USE_UNIX_IO)
+    EXAM_CHECK( p != 0 );
+#  endif
+    if ( p != 0 ) {
+      EXAM_CHECK( fb.size() == sz );
+      EXAM_CHECK( equal(content.begin(), content.end(), p) );
+
+      // seeks inside view keep it
+      EXAM_CHECK( fb.pubseekpos( 2000000 ) == streampos(2000000) );
+      EXAM_CHECK( fb.data() == p + 2000000 );
+      EXAM_CHECK( fb.size() == sz - 2000000 );
+      EXAM_CHECK( fb.sbumpc() == char_traits<char>::to_int_type(content[2000000]) );
+      EXAM_CHECK( fb.pubseekoff( -1000001, ios_base::cur ) == streampos(1000000) );
+      EXAM_CHECK( fb.data() == p + 1000000 );
+    }
+    EXAM_CHECK( fb.pubseekoff( 0, ios_base::cur ) == streampos(p != 0 ? 1000000 : 0) );
+    EXAM_CHECK( fb.pubseekoff( sz - 1, ios_base::beg ) == streampos(sz - 1) );
+    EXAM_CHECK( fb.sbumpc() == char_traits<char>::to_int_type(content[sz - 1]) );
+    EXAM_CHECK( fb.sgetc() == char_traits<char>::eof() );
+    EXAM_CHECK( fb.data() == 0 );
+    EXAM_CHECK( fb.size() == 0 );
+  }
+
+  {
+    // small sliding window, sequential scan and random seeks
+    filebuf fb;
+    fb.set_mmap_policy( filebuf::mmap_window | filebuf::mmap_random, 10000 );
+    EXAM_CHECK( fb.open( "test_file.txt", ios_base::in | ios_base::binary ) != 0 );
+    vector<char> got(sz);
+    streamsize n = 0;
+    for (streamsize k = 1; n < sz; k = k * 3 % 7919) {
+      streamsize r = fb.sgetn( &got[n], (min)(k, sz - n) );
+      EXAM_CHECK( r > 0 );
+      if ( r <= 0 ) {
+        break;
+      }
+      n += r;
+      EXAM_CHECK( fb.pubseekoff( 0, ios_base::cur ) == streampos(n) );
+    }
+    EXAM_CHECK( got == content );
+
+    streamoff pos = 17;
+    for (int i = 0; i < 1000; ++i) {
+      pos = (pos * 7 + 12345) % sz;
+      EXAM_CHECK( fb.pubseekpos( pos ) == streampos(pos) );
+      EXAM_CHECK( fb.sgetc() == char_traits<char>::to_int_type(content[pos]) );
+      if ( fb.data() != 0 ) {
+        EXAM_CHECK( fb.size() > 0 && fb.size() <= sz - pos );
+        EXAM_CHECK( *fb.data() == content[pos] );
+      }
+    }
+  }
+
+  {
+    // no mapping: no view, input as usual
+    ifstream in;
+    in.rdbuf()->set_mmap_policy( filebuf::mmap_off );
+    in.open( "test_file.txt", ios_base::in | ios_base::binary );
+    EXAM_CHECK( in.rdbuf()->data() == 0 );
+    vector<char> got(sz);
+    EXAM_CHECK( in.read( &got[0], sz ).gcount() == sz );
+    EXAM_CHECK( got == content );
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(fstream_test::write_behind)
+{
+#if defined (STLPORT)
+  string expect;
+  {
+    ofstream out;
+    out.rdbuf()->set_write_behind( 3, 4096 );
+    out.open( "test_file.txt", ios_base::out | ios_base::binary | ios_base::trunc );
+    EXAM_CHECK( out.good() );
+    EXAM_CHECK( !out.rdbuf()->write_behind() ); // started by first output
+
+    for (int i = 0; i < 20000; ++i) {
+      out << "record " << i << '\n';
+      if ( i % 5000 == 4999 ) {
+        string big( 3 * 4096 + 17, static_cast<char>('a' + i % 26) );
+        out.write( big.data(), big.size() );
+        ostringstream os;
+        os << "record " << i << '\n' << big;
+        expect += os.str();
+      } else {
+        ostringstream os;
+        os << "record " << i << '\n';
+        expect += os.str();
+      }
+    }
+#  if defined (_STLP_THREADS)
+    EXAM_CHECK( out.rdbuf()->write_behind() );
+#  endif
+    out.flush();
+    EXAM_CHECK( out.good() );
+    EXAM_CHECK( out.tellp() == streampos(expect.size()) );
+
+    // seek waits for writer, then output continues
+    out.seekp( 7 );
+    out << "XYZ";
+    expect.replace( 7, 3, "XYZ" );
+    out.seekp( 0, ios_base::end );
+    out << "tail";
+    expect += "tail";
+    EXAM_CHECK( out.good() );
+    out.close();
+    EXAM_CHECK( !out.fail() );
+    EXAM_CHECK( !out.rdbuf()->write_behind() );
+  }
+
+  {
+    ifstream in( "test_file.txt", ios_base::in | ios_base::binary );
+    string got( (istreambuf_iterator<char>(in)), istreambuf_iterator<char>() );
+    EXAM_CHECK( got.size() == expect.size() );
+    EXAM_CHECK( got == expect );
+  }
+
+  {
+    // turned off: output is synchronous
+    ofstream out;
+    out.rdbuf()->set_write_behind( 0 );
+    out.open( "test_file.txt", ios_base::out | ios_base::binary | ios_base::trunc );
+    out << "sync";
+    EXAM_CHECK( !out.rdbuf()->write_behind() );
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
 int EXAM_IMPL(fstream_test::null_stream)
 {
 #  if defined (_STLP_USE_WIN32_IO) || defined (WIN32) || defined (_WIN32)
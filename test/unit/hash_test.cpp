@@ -553,3 +553,41 @@ int EXAM_IMPL(hash_test::remains)
 
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(hash_test::hash_functions)
+{
+  const char* keys[] = { "", "a", "ab", "abc", "abcd", "abcdefg", "abcdefgh",
+                         "abcdefghi", "The quick brown fox jumps over the lazy dog" };
+
+  for ( size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i ) {
+    string s( keys[i] );
+
+    // C string and basic_string have the same hash
+    EXAM_CHECK( hash<string>()( s ) == hash<const char*>()( keys[i] ) );
+    EXAM_CHECK( hash<string>()( s ) == hash<string>()( string( keys[i] ) ) );
+  }
+
+  // last byte of long key affects hash (processed by words + tail)
+  EXAM_CHECK( hash<string>()( string( "abcdefghi" ) ) != hash<string>()( string( "abcdefghj" ) ) );
+  EXAM_CHECK( hash<string>()( string( "abcdefgh" ) ) != hash<string>()( string( "abcdefg" ) ) );
+
+#if defined (STLPORT)
+  // pointers are aligned (here low 6 bits are the same), but low bits
+  // of hash should still differ: count distinct values of 4 low bits
+  struct line { char c[64]; };
+  line a[64];
+  size_t low_bits = 0;
+  for ( int i = 0; i < 64; ++i ) {
+    low_bits |= size_t(1) << (hash<void*>()( &a[i] ) & 0xf);
+  }
+  int distinct = 0;
+  for ( int i = 0; i < 16; ++i ) {
+    distinct += (low_bits >> i) & 1;
+  }
+  EXAM_CHECK( distinct >= 8 ); // about 16 expected for good mix, 1 for identity
+#endif
+
+  EXAM_CHECK( hash<int>()( 5 ) == hash<int>()( 5 ) );
+
+  return EXAM_RESULT;
+}
@@ -515,3 +515,121 @@ int EXAM_IMPL(list_test::insert)
 
   return EXAM_RESULT;
 }
+
+#if defined (STLPORT)
+// allocator that count calls of allocate()
+template <class T>
+class counting_allocator :
+    public allocator<T>
+{
+  public:
+    template <class U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator( int* c ) :
+        counter( c )
+      { }
+
+    template <class U>
+    counting_allocator( const counting_allocator<U>& a ) :
+        counter( a.counter )
+      { }
+
+    T* allocate( size_t n, const void* = 0 )
+      {
+        ++*counter;
+        return allocator<T>::allocate( n );
+      }
+
+    int* counter;
+};
+
+template <class T, class U>
+bool operator ==( const counting_allocator<T>& a, const counting_allocator<U>& b )
+{ return a.counter == b.counter; }
+
+template <class T, class U>
+bool operator !=( const counting_allocator<T>& a, const counting_allocator<U>& b )
+{ return a.counter != b.counter; }
+#endif
+
+struct less_first
+{
+    bool operator()( const pair<int,int>& a, const pair<int,int>& b ) const
+      { return a.first < b.first; }
+};
+
+int EXAM_IMPL(list_test::sort)
+{
+  // runs of different kinds: ascending, strictly descending, equal keys
+  list<pair<int,int> > l;
+  for ( int i = 0; i < 1000; ++i ) {
+    int k = i < 300 ? i % 50 : i < 600 ? 600 - i : (i * 7919) % 101;
+    l.push_back( make_pair( k, i ) );
+  }
+
+  l.sort( less_first() );
+
+  EXAM_CHECK( l.size() == 1000 );
+  list<pair<int,int> >::const_iterator prev = l.begin();
+  for ( list<pair<int,int> >::const_iterator i = ++l.begin(); i != l.end(); prev = i++ ) {
+    EXAM_CHECK( prev->first <= i->first );
+    // stable: equal keys keep original order
+    EXAM_CHECK( prev->first < i->first || prev->second < i->second );
+  }
+
+  list<int> r;
+  for ( int i = 0; i < 100; ++i ) {
+    r.push_front( i );
+  }
+  r.sort();
+  int k = 0;
+  for ( list<int>::const_iterator i = r.begin(); i != r.end(); ++i, ++k ) {
+    EXAM_CHECK( *i == k );
+  }
+  EXAM_CHECK( k == 100 );
+  r.sort( greater<int>() );
+  EXAM_CHECK( r.front() == 99 );
+  EXAM_CHECK( r.back() == 0 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(list_test::node_pool)
+{
+#if defined (STLPORT)
+  int allocs = 0;
+  list<int, counting_allocator<int> > l( (counting_allocator<int>( &allocs )) );
+
+  l.reserve_nodes( 10 );
+  EXAM_CHECK( allocs == 10 );
+
+  // nodes of erased elements go back to pool
+  for ( int r = 0; r < 5; ++r ) {
+    for ( int i = 0; i < 10; ++i ) {
+      l.push_front( i );
+    }
+    EXAM_CHECK( l.size() == 10 );
+    l.pop_front();
+    l.clear();
+  }
+  EXAM_CHECK( allocs == 10 );
+
+  for ( int i = 0; i < 12; ++i ) {
+    l.push_front( i );
+  }
+  EXAM_CHECK( allocs == 12 );
+
+  l.clear();
+  l.shrink_node_pool();
+  l.push_front( 1 );
+  EXAM_CHECK( allocs == 13 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
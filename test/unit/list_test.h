@@ -40,6 +40,8 @@ class list_test
     int EXAM_DECL(swap);
     int EXAM_DECL(adl);
     int EXAM_DECL(insert);
+    int EXAM_DECL(sort);
+    int EXAM_DECL(node_pool);
     //int EXAM_DECL(const_list);
 };
 
@@ -25,6 +25,7 @@
 #include "map_test.h"
 
 #include <map>
+#include <string>
 #include <algorithm>
 
 #if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
@@ -440,6 +441,83 @@ int EXAM_IMPL(map_test::template_methods)
   return EXAM_RESULT;
 }
 
+int EXAM_IMPL(map_test::node_transfer)
+{
+  map<int, string> m;
+  m[1] = "one";
+  m[2] = "two";
+  m[3] = "three";
+
+  map<int, string>::node_type n = m.extract( 2 );
+  EXAM_CHECK( m.size() == 2 );
+  EXAM_CHECK( n.key() == 2 );
+  EXAM_CHECK( n.mapped() == "two" );
+
+  // key of extracted node may be changed
+  n.key() = 4;
+  map<int, string>::insert_return_type r = m.insert( move(n) );
+  EXAM_CHECK( r.inserted );
+  EXAM_CHECK( r.position->first == 4 );
+  EXAM_CHECK( r.position->second == "two" );
+
+  multimap<int, string> mm;
+  mm.insert( make_pair( 1, string( "uno" ) ) );
+  mm.insert( make_pair( 5, string( "cinque" ) ) );
+  mm.insert( make_pair( 5, string( "five" ) ) );
+  m.merge( mm );
+  EXAM_CHECK( m.size() == 4 );
+  EXAM_CHECK( m[1] == "one" );
+  EXAM_CHECK( m[5] == "cinque" );
+  EXAM_CHECK( mm.size() == 2 );
+  EXAM_CHECK( mm.count( 1 ) == 1 );
+  EXAM_CHECK( mm.count( 5 ) == 1 );
+
+  mm.insert( m.extract( m.begin() ) );
+  EXAM_CHECK( mm.count( 1 ) == 2 );
+  EXAM_CHECK( m.size() == 3 );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(map_test::mmap_range_order)
+{
+  typedef multimap<int, char> mmap;
+  typedef pair<int, char> pair_type;
+
+  // range insert keep equal keys in insertion order, after present ones
+  mmap m;
+  m.insert( pair_type( 1, 'a' ) );
+  m.insert( pair_type( 2, 'x' ) );
+
+  pair_type r1[] = { pair_type( 0, 'q' ), pair_type( 1, 'b' ) };
+  m.insert( r1, r1 + 2 );
+  EXAM_CHECK( m.size() == 4 );
+  mmap::iterator i = m.lower_bound( 1 );
+  EXAM_CHECK( i->second == 'a' );
+  ++i;
+  EXAM_CHECK( i->second == 'b' );
+
+  pair_type r2[] = { pair_type( 2, 'y' ), pair_type( 1, 'c' ), pair_type( 2, 'z' ), pair_type( 3, 'k' ) };
+  m.insert( r2, r2 + 4 );
+  const char order[] = "qabcxyzk";
+  EXAM_CHECK( m.size() == 8 );
+  int n = 0;
+  for ( i = m.begin(); i != m.end(); ++i, ++n ) {
+    EXAM_CHECK( i->second == order[n] );
+  }
+
+  // sorted prefix and unsorted tail into empty container
+  pair_type r3[] = { pair_type( 1, 'a' ), pair_type( 1, 'b' ), pair_type( 2, 'c' ), pair_type( 1, 'd' ), pair_type( 2, 'e' ) };
+  mmap m2( r3, r3 + 5 );
+  const char order2[] = "abdce";
+  n = 0;
+  for ( i = m2.begin(); i != m2.end(); ++i, ++n ) {
+    EXAM_CHECK( i->second == order2[n] );
+  }
+
+  return EXAM_RESULT;
+}
+
 #  if !defined (__DMC__)
 /* Simple compilation test: Check that nested types like iterator
  * can be access even if type used to instanciate container is not
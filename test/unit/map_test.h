@@ -35,6 +35,8 @@ class map_test
     int EXAM_DECL(equal_range);
     int EXAM_DECL(allocator_with_state);
     int EXAM_DECL(template_methods);
+    int EXAM_DECL(node_transfer);
+    int EXAM_DECL(mmap_range_order);
 };
 
 class set_test
@@ -51,6 +53,8 @@ class set_test
     int EXAM_DECL(allocator_with_state);
     int EXAM_DECL(reverse_iterator_test);
     int EXAM_DECL(template_methods);
+    int EXAM_DECL(range_insert);
+    int EXAM_DECL(node_transfer);
 };
 
 class multiset_test
@@ -72,6 +76,7 @@ class hash_test
     int EXAM_DECL(insert_erase);
     int EXAM_DECL(allocator_with_state);
     int EXAM_DECL(remains);
+    int EXAM_DECL(hash_functions);
     // int EXAM_DECL(equality);
 };
 
@@ -85,6 +90,8 @@ class unordered_test
     int EXAM_DECL(user_case);
     int EXAM_DECL(hash_policy);
     int EXAM_DECL(buckets);
+    int EXAM_DECL(pow2_buckets);
+    int EXAM_DECL(with_forward_list);
     int EXAM_DECL(equal_range);
     // (benchmark1);
     // (benchmark2);
@@ -94,10 +101,31 @@ class unordered_test
     int EXAM_DECL(move);
 };
 
+class flat_hash_test
+{
+  public:
+    int EXAM_DECL(fset);
+    int EXAM_DECL(fmap);
+    int EXAM_DECL(erase_insert);
+    int EXAM_DECL(copy_move);
+    int EXAM_DECL(reserve);
+};
+
+class flat_map_test
+{
+  public:
+    int EXAM_DECL(fset);
+    int EXAM_DECL(fmap);
+    int EXAM_DECL(range_insert);
+};
+
 class valarray_test
 {
   public:
     int EXAM_DECL(transcendentals);
+    int EXAM_DECL(expressions);
+    int EXAM_DECL(math);
+    int EXAM_DECL(signed_zero);
 };
 
 #endif // __TEST_MAP_TEST_H
@@ -26,6 +26,8 @@
 #include <string>
 #include <sstream>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
 /*
 #include <iostream>
 #include <ieee754.h>
@@ -361,7 +363,10 @@ int EXAM_IMPL(num_put_get_test::num_put_float)
       output = reset_stream(ostr);
       digits = "1";
       complete_digits(digits);
-      EXAM_CHECK(output == string("1.23456780e-") + digits );
+      // 0.12345678f is 0.1234567835927009582519531250 exactly; 9 significant
+      // digits of it are 1.23456784, as printf("%.8e") gives; former
+      // expectation 1.23456780 was not correctly rounded
+      EXAM_CHECK(output == string("1.23456784e-") + digits );
     }
 
     {
@@ -1287,3 +1292,82 @@ int EXAM_IMPL(num_put_get_test::custom_numpunct)
 #endif
   return EXAM_RESULT;
 }
+
+template <class F>
+static bool round_trip( stringstream& str, F val )
+{
+  F in_val = 0;
+  str.str( string() );
+  str.clear();
+  str << val;
+  str >> in_val;
+  return !str.fail() && in_val == val;
+}
+
+/*
+ * Float written with numeric_limits<float>::max_digits10 (9) significant
+ * digits must read back exactly. It's a sample, not exhaustive check
+ * (all 2^32 patterns through streams take hours): edge values and about
+ * 260000 patterns over whole range (prime stride over bit patterns, so
+ * every exponent and mantissa bit are visited), in default and
+ * scientific forms.
+ * Double written with digits10 (15) significant digits must be read and
+ * written again to the same string; written with 17 significant digits
+ * it must read back exactly, both normal and denormal values.
+ */
+int EXAM_IMPL(num_put_get_test::float_round_trip)
+{
+  stringstream str;
+  stringstream sci;
+  unsigned failed = 0;
+
+  str << setprecision(9);
+  sci << scientific << setprecision(8);
+
+  const unsigned int edges[] = { 0x00000001U, 0x007fffffU, 0x00800000U, 0x00800001U,
+                                 0x3f800000U, 0x3dcccccdU, 0x4b7fffffU, 0x7f7fffffU };
+  for ( size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); ++i ) {
+    float val;
+    memcpy( &val, &edges[i], sizeof(val) );
+    failed += !round_trip( str, val ) + !round_trip( str, -val ) + !round_trip( sci, val );
+  }
+  // sample: every 8191th positive finite pattern (and its negation)
+  for ( unsigned int bits = 1; bits < 0x7f800000U; bits += 8191 ) {
+    float val;
+    memcpy( &val, &bits, sizeof(val) );
+    failed += !round_trip( str, val ) + !round_trip( sci, -val );
+  }
+  EXAM_CHECK( failed == 0 );
+
+  typedef numeric_limits<double> limits;
+
+  unsigned long long m = 0x2545f4914f6cdd1dULL;
+  failed = 0;
+  for ( int e = limits::min_exponent; e < limits::max_exponent; ++e ) {
+    m = m * 6364136223846793005ULL + 1442695040888963407ULL;
+    double val = ldexp( static_cast<double>((m >> 11) | (1ULL << 52)), e - limits::digits );
+    ostringstream out;
+    out << setprecision(limits::digits10) << val;
+    double in_val = 0;
+    str.str( out.str() );
+    str.clear();
+    str >> in_val;
+    ostringstream again;
+    again << setprecision(limits::digits10) << in_val;
+    failed += (str.fail() || again.str() != out.str());
+  }
+  EXAM_CHECK( failed == 0 );
+
+  stringstream dstr;
+  dstr << setprecision(17);
+  failed = 0;
+  for ( int e = limits::min_exponent - limits::digits + 1; e < limits::max_exponent; ++e ) {
+    m = m * 6364136223846793005ULL + 1442695040888963407ULL;
+    double val = ldexp( static_cast<double>((m >> 11) | (1ULL << 52)), e - limits::digits );
+    failed += !round_trip( dstr, val ) + !round_trip( dstr, -val );
+    failed += !round_trip( dstr, ldexp( static_cast<double>(m >> 40), e - 24 ) );
+  }
+  EXAM_CHECK( failed == 0 );
+
+  return EXAM_RESULT;
+}
@@ -16,6 +16,17 @@ class num_put_get_test
     int EXAM_DECL(pointer);
     int EXAM_DECL(fix_float_long);
     int EXAM_DECL(custom_numpunct);
+    int EXAM_DECL(float_round_trip);
+};
+
+class charconv_test
+{
+  public:
+    int EXAM_DECL(integers);
+    int EXAM_DECL(floats);
+    int EXAM_DECL(round_trip);
+    int EXAM_DECL(stream_fast_path);
+    int EXAM_DECL(long_double_hex);
 };
 
 #endif // __TEST_NUM_PUT_GET_TEST_H
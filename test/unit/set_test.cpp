@@ -25,6 +25,7 @@
 #include "map_test.h"
 
 #include <set>
+#include <vector>
 #include <algorithm>
 
 #if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
@@ -498,6 +499,124 @@ int EXAM_IMPL(set_test::template_methods)
   return EXAM_RESULT;
 }
 
+// order by first only, so equal elements can be told apart by second
+struct first_less
+{
+    bool operator()( const pair<int, char>& l, const pair<int, char>& r ) const
+      { return l.first < r.first; }
+};
+
+int EXAM_IMPL(set_test::range_insert)
+{
+  vector<int> v;
+  for ( int i = 0; i < 1000; ++i ) {
+    v.push_back( i / 2 );
+  }
+
+  // sorted input, with duplicates
+  set<int> s( v.begin(), v.end() );
+  EXAM_CHECK( s.size() == 500 );
+  EXAM_CHECK( *s.begin() == 0 );
+  EXAM_CHECK( *s.rbegin() == 499 );
+
+  multiset<int> ms( v.begin(), v.end() );
+  EXAM_CHECK( ms.size() == 1000 );
+  EXAM_CHECK( equal( ms.begin(), ms.end(), v.begin() ) );
+
+  // sorted prefix, then out of order tail
+  v.push_back( 100 );
+  v.push_back( -1 );
+  v.push_back( 1000 );
+  set<int> s2( v.begin(), v.end() );
+  EXAM_CHECK( s2.size() == 502 );
+  EXAM_CHECK( *s2.begin() == -1 );
+  EXAM_CHECK( *s2.rbegin() == 1000 );
+
+  multiset<int> ms2( v.begin(), v.end() );
+  EXAM_CHECK( ms2.size() == 1003 );
+  EXAM_CHECK( ms2.count( 100 ) == 3 );
+  EXAM_CHECK( is_sorted( ms2.begin(), ms2.end() ) );
+
+  // into non-empty container
+  s.insert( v.rbegin(), v.rend() );
+  EXAM_CHECK( s == s2 );
+
+  for ( int i = 0; i < 500; i += 2 ) {
+    s.erase( i );
+  }
+  EXAM_CHECK( s.size() == 252 );
+  EXAM_CHECK( s.count( 2 ) == 0 );
+  EXAM_CHECK( s.count( 3 ) == 1 );
+
+  // equal elements of range go after present ones, in input order
+  typedef pair<int, char> pair_type;
+  multiset<pair_type, first_less> ms3;
+  ms3.insert( pair_type( 1, 'a' ) );
+  ms3.insert( pair_type( 2, 'x' ) );
+  pair_type r[] = { pair_type( 0, 'q' ), pair_type( 1, 'b' ), pair_type( 2, 'y' ), pair_type( 1, 'c' ) };
+  ms3.insert( r, r + 4 );
+  const char order[] = "qabcxy";
+  EXAM_CHECK( ms3.size() == 6 );
+  int n = 0;
+  for ( multiset<pair_type, first_less>::iterator i = ms3.begin(); i != ms3.end(); ++i, ++n ) {
+    EXAM_CHECK( i->second == order[n] );
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(set_test::node_transfer)
+{
+  set<int> s;
+  for ( int i = 0; i < 10; ++i ) {
+    s.insert( i );
+  }
+
+  set<int>::node_type n = s.extract( 5 );
+  EXAM_CHECK( !n.empty() );
+  EXAM_CHECK( n.value() == 5 );
+  EXAM_CHECK( s.size() == 9 );
+  EXAM_CHECK( s.extract( 5 ).empty() );
+
+  n.value() = 15;
+  set<int>::insert_return_type r = s.insert( move(n) );
+  EXAM_CHECK( r.inserted );
+  EXAM_CHECK( *r.position == 15 );
+  EXAM_CHECK( n.empty() );
+  EXAM_CHECK( s.size() == 10 );
+
+  // equivalent key: node stay in handle
+  set<int> other;
+  other.insert( 3 );
+  r = s.insert( other.extract( other.begin() ) );
+  EXAM_CHECK( !r.inserted );
+  EXAM_CHECK( *r.position == 3 );
+  EXAM_CHECK( !r.node.empty() );
+  EXAM_CHECK( r.node.value() == 3 );
+
+  multiset<int> ms;
+  ms.insert( 1 );
+  ms.insert( 1 );
+  ms.insert( 20 );
+  s.merge( ms );
+  EXAM_CHECK( s.size() == 11 );
+  EXAM_CHECK( s.count( 20 ) == 1 );
+  EXAM_CHECK( ms.size() == 2 );
+  EXAM_CHECK( ms.count( 1 ) == 2 );
+
+  ms.merge( s );
+  EXAM_CHECK( s.empty() );
+  EXAM_CHECK( ms.size() == 13 );
+  EXAM_CHECK( ms.count( 1 ) == 3 );
+  EXAM_CHECK( is_sorted( ms.begin(), ms.end() ) );
+
+  multiset<int>::iterator i = ms.insert( ms.begin(), ms.extract( ms.find( 20 ) ) );
+  EXAM_CHECK( *i == 20 );
+  EXAM_CHECK( is_sorted( ms.begin(), ms.end() ) );
+
+  return EXAM_RESULT;
+}
+
 #  if !defined (__DMC__)
 /* Simple compilation test: Check that nested types like iterator
  * can be access even if type used to instanciate container is not
@@ -19,6 +19,9 @@
 
 #include <memory>
 #include <type_traits>
+#include <thread>
+#include <atomic>
+#include <vector>
 
 #if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
 using namespace std;
@@ -1139,6 +1142,92 @@ int EXAM_IMPL(shared_ptr_test::casts)
   return EXAM_RESULT;
 }
 
+namespace shared_ptr_test_ns {
+
+struct Shared
+{
+    Shared()
+      { ++cnt; }
+    ~Shared()
+      { --cnt; }
+
+    // checked while other thread destroys object: if shared_ptr is
+    // broken, this should be a test failure, not a data race
+    static std::atomic<int> cnt;
+};
+
+std::atomic<int> Shared::cnt( 0 );
+
+const int shared_rounds = 100000;
+
+shared_ptr<Shared>* shared_src;
+weak_ptr<Shared>* weak_src;
+
+void copy_destroy()
+{
+  for ( int i = 0; i < shared_rounds; ++i ) {
+    shared_ptr<Shared> p( *shared_src );
+    weak_ptr<Shared> wp( p );
+    shared_ptr<Shared> l( weak_src->lock() );
+  }
+}
+
+void lock_and_check( int* failed )
+{
+  for ( int i = 0; i < shared_rounds; ++i ) {
+    shared_ptr<Shared> l( weak_src->lock() );
+    if ( l && (Shared::cnt != 1) ) { // object must be alive while l own it
+      ++*failed;
+    }
+  }
+}
+
+} // namespace shared_ptr_test_ns
+
+int EXAM_IMPL(shared_ptr_test::threads)
+{
+  {
+    shared_ptr<Shared> p( new Shared() );
+    weak_ptr<Shared> w( p );
+    std::vector<std::thread*> thr;
+
+    shared_src = &p;
+    weak_src = &w;
+    for ( int i = 0; i < 4; ++i ) {
+      thr.push_back( new std::thread( copy_destroy ) );
+    }
+    for ( int i = 0; i < 4; ++i ) {
+      thr[i]->join();
+      delete thr[i];
+    }
+
+    EXAM_CHECK( p.use_count() == 1 );
+    EXAM_CHECK( Shared::cnt == 1 );
+  }
+
+  EXAM_CHECK( Shared::cnt == 0 );
+
+  {
+    shared_ptr<Shared> p = make_shared<Shared>();
+    weak_ptr<Shared> w( p );
+    int failed = 0;
+
+    weak_src = &w;
+    std::thread t( lock_and_check, &failed );
+
+    p.reset(); // race with lock() in other thread
+
+    t.join();
+
+    EXAM_CHECK( failed == 0 );
+    EXAM_CHECK( w.expired() );
+    EXAM_CHECK( !w.lock() );
+    EXAM_CHECK( Shared::cnt == 0 );
+  }
+
+  return EXAM_RESULT;
+}
+
 int EXAM_IMPL(weak_ptr_test::base)
 {
   {
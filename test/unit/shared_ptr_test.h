@@ -51,6 +51,7 @@ class shared_ptr_test
     int EXAM_DECL(assign);
     int EXAM_DECL(deleter);
     int EXAM_DECL(casts);
+    int EXAM_DECL(threads);
 };
 
 class weak_ptr_test
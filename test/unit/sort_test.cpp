@@ -1,8 +1,12 @@
 #include "sort_test.h"
 
 #include <vector>
+#include <deque>
 #include <algorithm>
 #include <functional>
+#if defined (STLPORT)
+#  include <execution>
+#endif
 
 #if defined (STLPORT) && defined (_STLP_DEBUG) && defined (_STLP_DEBUG_MODE_THROWS)
 #  define _STLP_DO_CHECK_BAD_PREDICATE
@@ -198,3 +202,190 @@ int EXAM_IMPL(sort_test::bad_predicate_detected)
 }
 #endif
 
+int EXAM_IMPL(sort_test::parallel)
+{
+#if defined (STLPORT)
+  // big enough to be split between threads
+  const int n = 300000;
+  vector<int> v( n );
+  unsigned r = 1;
+  for ( int i = 0; i < n; ++i ) {
+    r = r * 1103515245 + 12345;
+    v[i] = static_cast<int>((r >> 8) % 100000);
+  }
+  vector<int> ref( v );
+  sort( ref.begin(), ref.end() );
+
+  for ( size_t conc = 0; conc <= 3; ++conc ) {
+    execution::parallel_policy pol( conc );
+
+    vector<int> a( v );
+    sort( pol, a.begin(), a.end() );
+    EXAM_CHECK( a == ref );
+
+    a = v;
+    sort( pol, a.begin(), a.end(), greater<int>() );
+    EXAM_CHECK( equal( a.begin(), a.end(), ref.rbegin() ) );
+
+    // stable: equal values keep order of indexes
+    vector<Data> d;
+    for ( int i = 0; i < n; ++i ) {
+      d.push_back( Data( i, v[i] % 1000 ) );
+    }
+    vector<Data> dref( d );
+    stable_sort( dref.begin(), dref.end() );
+    stable_sort( pol, d.begin(), d.end() );
+    EXAM_CHECK( d == dref );
+
+    for ( int k = 0; k < 3; ++k ) {
+      int nth = n / 4 * (k + 1);
+      a = v;
+      nth_element( pol, a.begin(), a.begin() + nth, a.end() );
+      EXAM_CHECK( a[nth] == ref[nth] );
+      EXAM_CHECK( *max_element( a.begin(), a.begin() + nth ) <= a[nth] );
+      EXAM_CHECK( *min_element( a.begin() + nth, a.end() ) >= a[nth] );
+    }
+  }
+
+  // many equal elements
+  vector<int> e( n, 7 );
+  e[n / 2] = 3;
+  sort( execution::par, e.begin(), e.end() );
+  EXAM_CHECK( e[0] == 3 && e[1] == 7 && e[n - 1] == 7 );
+
+  vector<int> s( v );
+  sort( execution::seq, s.begin(), s.end() );
+  EXAM_CHECK( s == ref );
+  s = v;
+  stable_sort( execution::par_unseq, s.begin(), s.end() );
+  EXAM_CHECK( s == ref );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+#if defined (STLPORT)
+struct Rec {
+  Rec(int index, short key)
+    : m_index(index), m_key(key) {}
+
+  int m_index;
+  short m_key;
+};
+
+struct RecKey {
+  short operator ()(const Rec& r) const
+  { return r.m_key; }
+};
+#endif
+
+int EXAM_IMPL(sort_test::radix)
+{
+#if defined (STLPORT)
+  // above radix sort threshold, with negative values
+  const int n = 5000;
+  vector<int> v( n );
+  vector<double> d( n );
+  unsigned r = 1;
+  for ( int i = 0; i < n; ++i ) {
+    r = r * 1103515245 + 12345;
+    v[i] = static_cast<int>(r >> 4) - (1 << 26);
+    d[i] = static_cast<double>(v[i]) / 3.0;
+  }
+  d[0] = -0.0;
+  d[1] = 0.0;
+  d[2] = -1.0e300;
+  d[3] = 1.0e-310; // denormal
+
+  vector<int> a( v );
+  sort( a.begin(), a.end() );
+  for ( int i = 1; i < n; ++i ) {
+    EXAM_CHECK( a[i - 1] <= a[i] );
+  }
+  vector<int> b( v );
+  sort( b.begin(), b.end(), greater<int>() );
+  EXAM_CHECK( equal( b.begin(), b.end(), a.rbegin() ) );
+  b = v;
+  radix_sort( b.begin(), b.end() );
+  EXAM_CHECK( a == b );
+
+  vector<double> e( d );
+  sort( e.begin(), e.end() );
+  EXAM_CHECK( e[0] == -1.0e300 );
+  for ( int i = 1; i < n; ++i ) {
+    EXAM_CHECK( !(e[i] < e[i - 1]) );
+  }
+  vector<float> f( d.begin(), d.end() );
+  sort( f.begin(), f.end(), greater<float>() );
+  for ( int i = 1; i < n; ++i ) {
+    EXAM_CHECK( !(f[i - 1] < f[i]) );
+  }
+
+  // radix_sort with key is stable
+  vector<Rec> recs;
+  for ( int i = 0; i < n; ++i ) {
+    recs.push_back( Rec( i, static_cast<short>(v[i] % 100) ) );
+  }
+  radix_sort( recs.begin(), recs.end(), RecKey() );
+  for ( int i = 1; i < n; ++i ) {
+    EXAM_CHECK( recs[i - 1].m_key < recs[i].m_key ||
+                (recs[i - 1].m_key == recs[i].m_key && recs[i - 1].m_index < recs[i].m_index) );
+  }
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+struct CountLess {
+  CountLess(size_t* count)
+    : m_count(count) {}
+
+  bool operator ()(int a, int b) const
+  { ++*m_count; return a < b; }
+
+  size_t* m_count;
+};
+
+int EXAM_IMPL(sort_test::patterns)
+{
+  const int n = 20000;
+  for ( int kind = 0; kind < 6; ++kind ) {
+    vector<int> v( n );
+    unsigned r = 1;
+    for ( int i = 0; i < n; ++i ) {
+      r = r * 1103515245 + 12345;
+      switch ( kind ) {
+        case 0: v[i] = i; break;                          // sorted
+        case 1: v[i] = n - i; break;                      // reversed
+        case 2: v[i] = i < n / 2 ? i : n - i; break;      // organ pipe
+        case 3: v[i] = (r >> 16) % 4; break;              // few distinct
+        case 4: v[i] = 5; break;                          // all equal
+        default: v[i] = (r >> 16) % 50 == 0 ? (r >> 8) % n : i; break; // sorted with noise
+      }
+    }
+    vector<int> ref( v );
+    stable_sort( ref.begin(), ref.end() );
+
+    // deque iterators and less: branchless partition
+    deque<int> d( v.begin(), v.end() );
+    sort( d.begin(), d.end() );
+    EXAM_CHECK( equal( d.begin(), d.end(), ref.begin() ) );
+
+    d.assign( v.begin(), v.end() );
+    sort( d.begin(), d.end(), greater<int>() );
+    EXAM_CHECK( equal( d.begin(), d.end(), ref.rbegin() ) );
+
+    // user's comparator: no quadratic behaviour on patterns
+    size_t count = 0;
+    vector<int> a( v );
+    sort( a.begin(), a.end(), CountLess( &count ) );
+    EXAM_CHECK( a == ref );
+    EXAM_CHECK( count < static_cast<size_t>(n) * 64 );
+  }
+
+  return EXAM_RESULT;
+}
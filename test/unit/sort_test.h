@@ -14,6 +14,9 @@ class sort_test
     int EXAM_DECL(sort4);
     int EXAM_DECL(stblsrt1);
     int EXAM_DECL(stblsrt2);
+    int EXAM_DECL(parallel);
+    int EXAM_DECL(radix);
+    int EXAM_DECL(patterns);
     // int EXAM_DECL(bad_predicate_detected);
 
   private:
@@ -680,6 +680,170 @@ int EXAM_IMPL(sstream_test::negative)
   return EXAM_RESULT;
 }
 
+int EXAM_IMPL(sstream_test::growth)
+{
+  // large contents, written by chars and by blocks
+  ostringstream os;
+  string expect;
+  for (int i = 0; i < 100000; ++i) {
+    os << i << ' ';
+    os.put( 'x' );
+    os.write( "0123456789", i % 11 );
+    ostringstream one;
+    one << i << ' ' << 'x' << string( "0123456789", i % 11 );
+    expect += one.str();
+  }
+  EXAM_CHECK( os.good() );
+  EXAM_CHECK( os.tellp() == streampos(expect.size()) );
+  EXAM_CHECK( os.str() == expect );
+
+  // overwrite inside, contents keep their length
+  os.seekp( 3 );
+  os << "ABC";
+  expect.replace( 3, 3, "ABC" );
+  EXAM_CHECK( os.str() == expect );
+  EXAM_CHECK( os.tellp() == streampos(6) );
+  os.seekp( 0, ios_base::end );
+  EXAM_CHECK( os.tellp() == streampos(expect.size()) );
+
+  // input sees output
+  stringstream ss;
+  for (int i = 0; i < 5000; ++i) {
+    ss << i << ' ';
+  }
+  int v = -1;
+  for (int i = 0; i < 5000; ++i) {
+    ss >> v;
+    if ( v != i ) {
+      break;
+    }
+  }
+  EXAM_CHECK( v == 4999 );
+  ss << "7777 ";
+  ss >> v;
+  EXAM_CHECK( v == 7777 );
+  ss >> v;
+  EXAM_CHECK( ss.eof() );
+
+#if defined (STLPORT)
+  // in app mode output goes to end, wherever put position is
+  ostringstream app( "abc", ios_base::out | ios_base::app );
+  app << "de";
+  app.seekp( 1 );
+  app << 'X' << "YZ";
+  EXAM_CHECK( app.str() == "abcdeXYZ" );
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sstream_test::reserve)
+{
+#if defined (STLPORT)
+  ostringstream os;
+  os.reserve( 100000 );
+  for (int i = 0; i < 10000; ++i) {
+    os << "line " << i << '\n';
+  }
+  string s = os.str();
+  EXAM_CHECK( s.size() == 10000 * 6 + 38890 ); // "line \n" and digits of 0..9999
+  EXAM_CHECK( s.compare( 0, 7, "line 0\n" ) == 0 );
+
+  // move out: no copy, stream is empty after
+  string m = move( os ).str();
+  EXAM_CHECK( m == s );
+  EXAM_CHECK( m.capacity() >= 100000 );
+  EXAM_CHECK( os.str().empty() );
+  os << "next";
+  EXAM_CHECK( os.str() == "next" );
+
+  stringbuf sb;
+  sb.reserve( 10 );
+  EXAM_CHECK( sb.sputn( "0123456789", 10 ) == 10 );
+  EXAM_CHECK( sb.str() == "0123456789" );
+  string t = move( sb ).str();
+  EXAM_CHECK( t == "0123456789" );
+  EXAM_CHECK( sb.str().empty() );
+
+  // reserve keeps contents and positions
+  stringstream ss( "12 34" );
+  int v = 0;
+  ss >> v;
+  ss.reserve( 4096 );
+  EXAM_CHECK( ss.str() == "12 34" );
+  ss >> v;
+  EXAM_CHECK( v == 34 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sstream_test::readsome)
+{
+#if defined (STLPORT)
+  // output is available for input at once
+  stringstream ss;
+  ss << "hello";
+  EXAM_CHECK( ss.rdbuf()->in_avail() == 5 );
+  char buf[10];
+  EXAM_CHECK( ss.readsome( buf, 10 ) == 5 );
+  EXAM_CHECK( string( buf, 5 ) == "hello" );
+  EXAM_CHECK( ss.rdbuf()->in_avail() == 0 );
+  EXAM_CHECK( ss.readsome( buf, 10 ) == 0 );
+  EXAM_CHECK( ss.good() );
+
+  ss << " world";
+  EXAM_CHECK( ss.readsome( buf, 3 ) == 3 );
+  EXAM_CHECK( string( buf, 3 ) == " wo" );
+  EXAM_CHECK( ss.rdbuf()->in_avail() == 3 );
+  EXAM_CHECK( ss.readsome( buf, 10 ) == 3 );
+  EXAM_CHECK( string( buf, 3 ) == "rld" );
+
+  // output after initial contents
+  stringstream s2( "ab" );
+  s2.seekp( 0, ios_base::end );
+  s2 << "cd";
+  EXAM_CHECK( s2.rdbuf()->in_avail() > 0 );
+  string r;
+  streamsize n;
+  while ( (n = s2.readsome( buf, 10 )) > 0 ) {
+    r.append( buf, n );
+  }
+  EXAM_CHECK( r == "abcd" );
+
+  ostringstream os;
+  os << "x";
+  EXAM_CHECK( os.rdbuf()->in_avail() == -1 );
+#else
+  throw exam::skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(sstream_test::read_eof_exception)
+{
+  istringstream s( "abc" );
+  char buf[10];
+
+  s.exceptions( ios_base::eofbit );
+  try {
+    s.read( buf, 10 );
+    EXAM_ERROR( "ios_base::failure exception expected" );
+  }
+  catch ( const ios_base::failure& ) {
+    // short read is end of file, not failure of streambuf
+    EXAM_CHECK( s.eof() );
+    EXAM_CHECK( !s.bad() );
+    EXAM_CHECK( s.gcount() == 3 );
+    EXAM_CHECK( string( buf, 3 ) == "abc" );
+  }
+
+  return EXAM_RESULT;
+}
+
 /*
  * Note: Strstreams are really broken in STLport. But strstreams are 
  * obsolete, and even if ones was mentioned in D7.1--D7.4 of 
@@ -55,6 +55,10 @@ class sstream_test
     int EXAM_DECL(negative);
     int EXAM_DECL(extra0_bug_id_2728232);
     int EXAM_DECL(fail_bit);
+    int EXAM_DECL(growth);
+    int EXAM_DECL(reserve);
+    int EXAM_DECL(readsome);
+    int EXAM_DECL(read_eof_exception);
 };
 
 class fstream_test
@@ -79,6 +83,9 @@ class fstream_test
     int EXAM_DECL(null_buf);
     int EXAM_DECL(offset);
     int EXAM_DECL(big_file);
+    int EXAM_DECL(large_blocks);
+    int EXAM_DECL(mmap_view);
+    int EXAM_DECL(write_behind);
     int EXAM_DECL(custom_facet);
     int EXAM_DECL(tell_binary_wce);
 };
@@ -1465,3 +1465,161 @@ int EXAM_IMPL(string_test::assign_from_char)
 
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(string_test::move_short_long)
+{
+  string const ref_short("key");
+  string const ref_long("a string that is too long for any inline buffer");
+
+  {
+    string s1(ref_short);
+    string s2(std::move(s1));
+    EXAM_CHECK( s2 == ref_short );
+    EXAM_CHECK( s1.empty() && (*s1.c_str() == 0) );
+    s1 = "reused";
+    EXAM_CHECK( s1 == "reused" );
+  }
+
+  {
+    string l1(ref_long);
+    const char* data = l1.data();
+    string l2(std::move(l1));
+    EXAM_CHECK( l2 == ref_long );
+    EXAM_CHECK( l2.data() == data ); // storage stolen, not copied
+    EXAM_CHECK( l1.empty() && (*l1.c_str() == 0) );
+    l1 = ref_long;
+    EXAM_CHECK( l1 == ref_long );
+  }
+
+  {
+    string s(ref_short), l(ref_long);
+    s = std::move(l);
+    EXAM_CHECK( s == ref_long );
+    EXAM_CHECK( l.empty() );
+    l = std::move(s);
+    EXAM_CHECK( l == ref_long );
+    s = ref_short;
+    l = std::move(s);
+    EXAM_CHECK( l == ref_short );
+    EXAM_CHECK( s.empty() );
+    l = std::move(l);
+    EXAM_CHECK( l == ref_short );
+  }
+
+  {
+    vector<string> v;
+    for (int i = 0; i < 100; ++i) {
+      v.push_back(i % 3 == 0 ? ref_long : ref_short); // reallocations move strings
+    }
+    for (int i = 0; i < 100; ++i) {
+      EXAM_CHECK( v[i] == (i % 3 == 0 ? ref_long : ref_short) );
+    }
+  }
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(string_test::find_long)
+{
+  // long enough for vectorized search; marks around block boundaries
+  string s(200, 'a');
+  for (size_t i = 0; i < s.size(); i += 7) {
+    s[i] = 'b';
+  }
+  s[37] = 'x';
+  s[38] = 'y';
+  s[150] = 'x';
+  s[151] = 'y';
+  s[199] = 'z';
+  s[180] = '\xe9'; // char above 0x7f
+
+  EXAM_CHECK( s.find('x') == 37 );
+  EXAM_CHECK( s.find('x', 38) == 150 );
+  EXAM_CHECK( s.rfind('x') == 150 );
+  EXAM_CHECK( s.rfind('x', 149) == 37 );
+  EXAM_CHECK( s.find('q') == string::npos );
+  EXAM_CHECK( s.rfind('q') == string::npos );
+
+  EXAM_CHECK( s.find("xy") == 37 );
+  EXAM_CHECK( s.find("xy", 38) == 150 );
+  EXAM_CHECK( s.rfind("xy") == 150 );
+  EXAM_CHECK( s.rfind("xy", 149) == 37 );
+  EXAM_CHECK( s.find(s.substr(140, 20)) == 140 );
+  EXAM_CHECK( s.find("xyz") == string::npos );
+  EXAM_CHECK( s.rfind("yx") == string::npos );
+  EXAM_CHECK( s.find(s.substr(1, 60)) == 1 );
+  EXAM_CHECK( s.rfind(s.substr(1, 60)) == 1 );
+
+  EXAM_CHECK( s.find_first_of("zyx") == 37 );
+  EXAM_CHECK( s.find_first_of("0123456789z") == 199 );
+  EXAM_CHECK( s.find_first_of("\xe9") == 180 );
+  EXAM_CHECK( s.find_last_of("xy") == 151 );
+  EXAM_CHECK( s.find_last_of("0123456789x", 149) == 37 );
+  EXAM_CHECK( s.find_first_not_of("ab") == 37 );
+  EXAM_CHECK( s.find_first_not_of("abxy", 40) == 180 );
+  EXAM_CHECK( s.find_last_not_of("abz\xe9") == 151 );
+  EXAM_CHECK( s.find_last_not_of('z') == 198 );
+  EXAM_CHECK( s.find_first_not_of('a', 1) == 7 );
+  EXAM_CHECK( s.find_first_not_of('a', 300) == string::npos );
+  EXAM_CHECK( s.find_first_of("") == string::npos );
+  EXAM_CHECK( s.find_first_not_of("") == 0 );
+
+  return EXAM_RESULT;
+}
+
+// character type wider than whole inline buffer of short string
+struct wide_char
+{
+    unsigned long long v[8];
+};
+
+static bool operator ==(const wide_char& l, const wide_char& r)
+{ return l.v[0] == r.v[0] && l.v[7] == r.v[7]; }
+
+static bool operator <(const wide_char& l, const wide_char& r)
+{ return l.v[0] < r.v[0]; }
+
+static wide_char make_wide_char(unsigned long long x)
+{
+  wide_char c = wide_char();
+  c.v[0] = x;
+  c.v[7] = ~x;
+  return c;
+}
+
+int EXAM_IMPL(string_test::wide_char_type)
+{
+  typedef basic_string<wide_char> wstr;
+
+  wstr s;
+  EXAM_CHECK( s.empty() );
+  EXAM_CHECK( s.c_str()[0] == wide_char() );
+
+  s.push_back(make_wide_char(1));
+  EXAM_CHECK( s.size() == 1 );
+  EXAM_CHECK( s[0] == make_wide_char(1) );
+  EXAM_CHECK( s.c_str()[1] == wide_char() );
+
+  wstr c(s);
+  EXAM_CHECK( c == s );
+
+  for (unsigned long long i = 2; i < 20; ++i) {
+    s.push_back(make_wide_char(i));
+  }
+  EXAM_CHECK( s.size() == 19 );
+  for (size_t i = 0; i < s.size(); ++i) {
+    EXAM_CHECK( s[i] == make_wide_char(i + 1) );
+  }
+  EXAM_CHECK( s.c_str()[19] == wide_char() );
+  EXAM_CHECK( s.find(make_wide_char(7)) == 6 );
+
+  wstr m(std::move(s));
+  EXAM_CHECK( m.size() == 19 );
+  EXAM_CHECK( s.empty() );
+  s = std::move(c);
+  EXAM_CHECK( s.size() == 1 && s[0] == make_wide_char(1) );
+  m.resize(1);
+  EXAM_CHECK( m == s );
+
+  return EXAM_RESULT;
+}
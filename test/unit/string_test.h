@@ -58,6 +58,9 @@ class string_test
     int EXAM_DECL(capacity);
     int EXAM_DECL(concat24);
     int EXAM_DECL(assign_from_char);
+    int EXAM_DECL(move_short_long);
+    int EXAM_DECL(find_long);
+    int EXAM_DECL(wide_char_type);
 };
 
 #endif // __TEST_STRING_TEST_H
@@ -196,6 +196,7 @@ int main( int argc, const char** argv )
   bvector_test bvc_test;
 
   t.add( &bvector_test::bvec1, bvc_test, "bvec1" );
+  t.add( &bvector_test::bit_ops, bvc_test, "vector<bool> count, find and bitwise operations" );
 
   deque_test deq_test;
 
@@ -212,6 +213,7 @@ int main( int argc, const char** argv )
   t.add( &deque_test::optimizations_check, deq_test, "deque optimizations_check" );
   t.add( &deque_test::init_integral, deq_test, "deque ctor for deque(size,value)" );
   t.add( &deque_test::init_range, deq_test, "deque ctor for deque(from,to)" );
+  t.add( &deque_test::block_size, deq_test, "deque block size and node reuse" );
 
   queue_test que_test;
 
@@ -237,6 +239,8 @@ int main( int argc, const char** argv )
   t.add( &list_test::allocator_with_state, lst_test, "list allocator_with_state" );
   t.add( &list_test::adl, lst_test, "list adl" );
   t.add( &list_test::insert, lst_test, "list insert" );
+  t.add( &list_test::sort, lst_test, "list sort" );
+  t.add( &list_test::node_pool, lst_test, "list node pool" );
   // t.add( &list_test::const_list, lst_test, "const_list" );
 
   forward_list_test slst_test;
@@ -249,6 +253,8 @@ int main( int argc, const char** argv )
   t.add( &forward_list_test::allocator_with_state, slst_test, "forward_list allocator_with_state", fwd_l_tc[0] );
   t.add( &forward_list_test::move, slst_test, "forward_list move", fwd_l_tc[0] );
   t.add( &forward_list_test::assign, slst_test, "forward_list assign" );
+  t.add( &forward_list_test::sort, slst_test, "forward_list sort" );
+  t.add( &forward_list_test::node_pool, slst_test, "forward_list node pool" );
 
 
   string_test str_test;
@@ -283,6 +289,9 @@ int main( int argc, const char** argv )
   t.add( &string_test::capacity, str_test, "capacity" );
   t.add( &string_test::concat24, str_test, "concat24" );
   t.add( &string_test::assign_from_char, str_test, "string assign from char buf" );
+  t.add( &string_test::move_short_long, str_test, "string move between short and long" );
+  t.add( &string_test::find_long, str_test, "string find in long strings" );
+  t.add( &string_test::wide_char_type, str_test, "string of char type wider than inline buffer" );
 
   cstring_test cst_test;
 
@@ -390,6 +399,10 @@ int main( int argc, const char** argv )
   t.add( &sstream_test::tellp, sstrm_test, "sstream tellp" );
   t.add( &sstream_test::extra0_bug_id_2728232, sstrm_test, "extra 0; bug ID: 2728232" );
   t.add( &sstream_test::negative, sstrm_test, "sstream negative" );
+  t.add( &sstream_test::growth, sstrm_test, "sstream growth of contents" );
+  t.add( &sstream_test::reserve, sstrm_test, "sstream reserve and move out str()" );
+  t.add( &sstream_test::readsome, sstrm_test, "sstream readsome and in_avail after output" );
+  t.add( &sstream_test::read_eof_exception, sstrm_test, "sstream short read with exceptions(eofbit)" );
 
   numerics num_test;
 
@@ -422,6 +435,8 @@ int main( int argc, const char** argv )
   t.add( &map_test::equal_range, m_test, "map equal_range" );
   t.add( &map_test::allocator_with_state, m_test, "map allocator_with_state" );
   t.add( &map_test::template_methods, m_test, "map template_methods" );
+  t.add( &map_test::node_transfer, m_test, "map extract, insert node, merge" );
+  t.add( &map_test::mmap_range_order, m_test, "multimap range insert keep order of equal keys" );
 
   set_test s_test;
 
@@ -436,6 +451,8 @@ int main( int argc, const char** argv )
   t.add( &set_test::allocator_with_state, s_test, "set allocator_with_state" );
   t.add( &set_test::reverse_iterator_test, s_test, "set reverse_iterator_test" );
   t.add( &set_test::template_methods, s_test, "set template_methods" );
+  t.add( &set_test::range_insert, s_test, "set insert of sorted and unsorted ranges" );
+  t.add( &set_test::node_transfer, s_test, "set extract, insert node, merge" );
 
   set_union_test su_test;
 
@@ -475,6 +492,7 @@ int main( int argc, const char** argv )
   t.add( &hash_test::insert_erase, h_test, "hash insert_erase", fwd_l_tc[0] );
   t.add( &hash_test::allocator_with_state, h_test, "hash allocator_with_state", fwd_l_tc[0] );
   t.add( &hash_test::remains, h_test, "erase in hash_map", fwd_l_tc[0] );
+  t.add( &hash_test::hash_functions, h_test, "hash functions" );
 
   unordered_test uo_test;
 
@@ -485,12 +503,31 @@ int main( int argc, const char** argv )
   t.add( &unordered_test::user_case, uo_test, "unordered user_case", fwd_l_tc[0] );
   t.add( &unordered_test::hash_policy, uo_test, "unordered hash_policy", fwd_l_tc[0] );
   t.add( &unordered_test::buckets, uo_test, "unordered buckets", fwd_l_tc[0] );
+  t.add( &unordered_test::pow2_buckets, uo_test, "unordered power of 2 buckets", fwd_l_tc[0] );
+  t.add( &unordered_test::with_forward_list, uo_test, "unordered_map and forward_list together", fwd_l_tc[0] );
   t.add( &unordered_test::equal_range, uo_test, "unordered equal_range", fwd_l_tc[0] );
   t.add( &unordered_test::template_methods, uo_test, "unordered template_methods", fwd_l_tc[0] );
   t.add( &unordered_test::remains, uo_test, "erase in unordered_map" );
 
+  flat_hash_test fh_test;
+
+  t.add( &flat_hash_test::fset, fh_test, "flat_hash_set" );
+  t.add( &flat_hash_test::fmap, fh_test, "flat_hash_map" );
+  t.add( &flat_hash_test::erase_insert, fh_test, "flat_hash_set erase and insert" );
+  t.add( &flat_hash_test::copy_move, fh_test, "flat_hash_map copy and move" );
+  t.add( &flat_hash_test::reserve, fh_test, "flat_hash_map reserve" );
+
+  flat_map_test fm_test;
+
+  t.add( &flat_map_test::fset, fm_test, "flat_set and flat_multiset" );
+  t.add( &flat_map_test::fmap, fm_test, "flat_map and flat_multimap" );
+  t.add( &flat_map_test::range_insert, fm_test, "flat_map and flat_set range insert" );
+
   valarray_test val_test;
   t.add( &valarray_test::transcendentals, val_test, "transcendentals" );
+  t.add( &valarray_test::expressions, val_test, "valarray expressions" );
+  t.add( &valarray_test::math, val_test, "valarray math functions" );
+  t.add( &valarray_test::signed_zero, val_test, "valarray signed zero" );
 
   fstream_test fstrm_test;
   exam::test_suite::test_case_type fstream_tc[10];
@@ -517,6 +554,9 @@ int main( int argc, const char** argv )
   t.add( &fstream_test::null_buf, fstrm_test, "fstream null_buf", fstream_tc[0] );
   t.add( &fstream_test::offset, fstrm_test, "fstream offset", fstream_tc[0] );
   t.add( &fstream_test::big_file, fstrm_test, "fstream big_file", fstream_tc[0] );
+  t.add( &fstream_test::large_blocks, fstrm_test, "fstream large blocks read/write", fstream_tc[0] );
+  t.add( &fstream_test::mmap_view, fstrm_test, "filebuf mmap policy and view", fstream_tc[0] );
+  t.add( &fstream_test::write_behind, fstrm_test, "filebuf write-behind output", fstream_tc[0] );
   fstream_tc[2] = t.add( &fstream_test::custom_facet, fstrm_test, "fstream custom_facet", fstream_tc[0] );
 
   t.add( &fstream_test::rewind, fstrm_test, "fstream write after read fail", fstream_tc[1] );
@@ -535,6 +575,9 @@ int main( int argc, const char** argv )
   t.add( &sort_test::sort4, srt_test, "sort4" );
   t.add( &sort_test::stblsrt1, srt_test, "stblsrt1" );
   t.add( &sort_test::stblsrt2, srt_test, "stblsrt2" );
+  t.add( &sort_test::parallel, srt_test, "sort, stable_sort and nth_element with execution policy" );
+  t.add( &sort_test::radix, srt_test, "radix sort of arithmetic values" );
+  t.add( &sort_test::patterns, srt_test, "sort of sorted, reversed, organ-pipe and few distinct values" );
   // t.add( &sort_test::bad_predicate_detected, srt_test, "bad_predicate_detected" );
 
   adj_test a_test;
@@ -845,6 +888,13 @@ int main( int argc, const char** argv )
 
   t.add( &bitset_test::bitset1, bts_test, "bitset1" );
   t.add( &bitset_test::iostream, bts_test, "iostream" );
+  t.add( &bitset_test::count_find, bts_test, "bitset count and find on long bitsets" );
+
+  dynamic_bitset_test dbts_test;
+
+  t.add( &dynamic_bitset_test::basic, dbts_test, "dynamic_bitset construction, resize and access" );
+  t.add( &dynamic_bitset_test::set_operations, dbts_test, "dynamic_bitset set operations" );
+  t.add( &dynamic_bitset_test::iteration, dbts_test, "dynamic_bitset iteration over set bits" );
 
   cmath_test cmt_test;
   t.add( &cmath_test::import_checks, cmt_test, "cmath_test::import_checks" );
@@ -880,6 +930,15 @@ int main( int argc, const char** argv )
   t.add( &num_put_get_test::pointer, nmg_test, "pointer" );
   t.add( &num_put_get_test::fix_float_long, nmg_test, "fix_float_long" );
   t.add( &num_put_get_test::custom_numpunct, nmg_test, "custom_numpunct" );
+  t.add( &num_put_get_test::float_round_trip, nmg_test, "float_round_trip" );
+
+  charconv_test chc_test;
+
+  t.add( &charconv_test::integers, chc_test, "to_chars/from_chars integers" );
+  t.add( &charconv_test::floats, chc_test, "to_chars/from_chars floating point" );
+  t.add( &charconv_test::round_trip, chc_test, "to_chars/from_chars round trip" );
+  t.add( &charconv_test::stream_fast_path, chc_test, "num_get reading from get area" );
+  t.add( &charconv_test::long_double_hex, chc_test, "from_chars long double hex rounding" );
 
   codecvt_test cvt_test;
   exam::test_suite::test_case_type cvt_tc[10];
@@ -915,6 +974,7 @@ int main( int argc, const char** argv )
       shp_tc[0] = t.add( &shared_ptr_test::shared_ptr_base, shp_test, "shared_ptr basic" ) ) );
   t.add( &shared_ptr_test::convert, shp_test, "shared_ptr convertions", shp_tc[0] );
   t.add( &shared_ptr_test::casts, shp_test, "shared_ptr casts", shp_tc[0] );
+  t.add( &shared_ptr_test::threads, shp_test, "shared_ptr in threads", shp_tc[0] );
   shp_tc[1] = utility_tc[0];
   shp_tc[3] =
     t.add( &shared_ptr_test::allocate, shp_test, "shared_ptr allocate_shared",
@@ -969,7 +1029,18 @@ int main( int argc, const char** argv )
 
   atomic_test test_atomic;
 
-  t.add( &atomic_test::atomic_int, test_atomic, "atomic int" );
+  exam::test_suite::test_case_type atomic_tc[2];
+
+  atomic_tc[0] = t.add( &atomic_test::atomic_int, test_atomic, "atomic int" );
+  t.add( &atomic_test::integral, test_atomic, "atomic integral types", atomic_tc[0] );
+  t.add( &atomic_test::pointer, test_atomic, "atomic pointer", atomic_tc[0] );
+  t.add( &atomic_test::not_lock_free, test_atomic, "atomic not lock-free type", atomic_tc[0] );
+  atomic_tc[1] = t.add( &atomic_test::flag, test_atomic, "atomic_flag", atomic_tc[0] );
+  t.add( &atomic_test::relaxed, test_atomic, "atomic relaxed", atomic_tc[1] );
+  t.add( &atomic_test::acquire_release, test_atomic, "atomic acquire/release", atomic_tc[1] );
+  t.add( &atomic_test::consume, test_atomic, "atomic consume", atomic_tc[1] );
+  t.add( &atomic_test::acq_rel, test_atomic, "atomic acq_rel", atomic_tc[1] );
+  t.add( &atomic_test::seq_cst, test_atomic, "atomic seq_cst", atomic_tc[1] );
 
   thread_test test_thr;
   exam::test_suite::test_case_type thr_tc[10];
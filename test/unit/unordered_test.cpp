@@ -25,6 +25,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <forward_list>
 
 #if !defined (STLPORT) || defined(_STLP_USE_NAMESPACES)
 using namespace std;
@@ -338,6 +339,86 @@ int EXAM_IMPL(unordered_test::buckets)
   return EXAM_RESULT;
 }
 
+int EXAM_IMPL(unordered_test::pow2_buckets)
+{
+#if defined (STLPORT)
+  typedef _STLP_PRIV hashtable<size_t, size_t, hash<size_t>, _STLP_PRIV _Identity<size_t>,
+                               equal_to<size_t>, allocator<size_t>, _STLP_PRIV _Stl_pow2_type> htype;
+  htype ht( 0, hash<size_t>(), equal_to<size_t>() );
+
+  // keys with same low bits: mask without hash mixing would put all in one bucket
+  size_t i;
+  for (i = 0; i < NB_ELEMS; ++i) {
+    ht.insert_unique(i * 1024);
+    EXAM_CHECK( (ht.bucket_count() & (ht.bucket_count() - 1)) == 0 );
+  }
+  EXAM_CHECK( ht.size() == NB_ELEMS );
+  EXAM_CHECK( ht.load_factor() <= ht.max_load_factor() );
+
+  size_t maxBucket = 0;
+  for (i = 0; i < ht.bucket_count(); ++i) {
+    if (ht.elems_in_bucket(i) > maxBucket) {
+      maxBucket = ht.elems_in_bucket(i);
+    }
+  }
+  EXAM_CHECK( maxBucket < 16 );
+
+  ht.rehash(ht.bucket_count() + 1);
+  EXAM_CHECK( (ht.bucket_count() & (ht.bucket_count() - 1)) == 0 );
+  for (i = 0; i < NB_ELEMS; ++i) {
+    EXAM_CHECK( ht.count(i * 1024) == 1 );
+    EXAM_CHECK( ht.count(i * 1024 + 1) == 0 );
+  }
+
+  for (i = 0; i < NB_ELEMS; i += 2) {
+    EXAM_CHECK( ht.erase(i * 1024) == 1 );
+  }
+  ht.max_load_factor(ht.max_load_factor()); // may reduce buckets
+  EXAM_CHECK( (ht.bucket_count() & (ht.bucket_count() - 1)) == 0 );
+  for (i = 0; i < NB_ELEMS; ++i) {
+    EXAM_CHECK( ht.count(i * 1024) == (i % 2) );
+  }
+#else
+  throw skip_exception();
+#endif
+
+  return EXAM_RESULT;
+}
+
+// hashtable is built on forward_list and is friend of its iterators
+int EXAM_IMPL(unordered_test::with_forward_list)
+{
+  forward_list<int> l;
+  unordered_map<int, string> m;
+
+  for (int i = 0; i < 100; ++i) {
+    l.push_front(i);
+    m[i] = string(1, static_cast<char>('a' + i % 26));
+  }
+
+  int n = 0;
+  for (forward_list<int>::const_iterator i = l.begin(); i != l.end(); ++i) {
+    unordered_map<int, string>::const_iterator j = m.find(*i);
+    EXAM_CHECK( j != m.end() );
+    if ( j != m.end() ) {
+      EXAM_CHECK( j->second[0] == 'a' + *i % 26 );
+    }
+    ++n;
+  }
+  EXAM_CHECK( n == 100 );
+
+  n = 0;
+  for (unordered_map<int, string>::iterator j = m.begin(); j != m.end(); ++j) {
+    ++n;
+  }
+  EXAM_CHECK( n == 100 );
+
+  unordered_multiset<int> s(l.begin(), l.end());
+  EXAM_CHECK( s.size() == 100 );
+
+  return EXAM_RESULT;
+}
+
 int EXAM_IMPL(unordered_test::equal_range)
 {
 #if defined (STLPORT)
@@ -103,3 +103,219 @@ int EXAM_IMPL(valarray_test::transcendentals)
 
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(valarray_test::expressions)
+{
+  // sizes around SIMD packet width: packets and tail
+  for ( size_t n = 0; n < 21; ++n ) {
+    valarray<double> a(n), b(n), c(n), d(n);
+    valarray<int> i(n), j(n);
+    for ( size_t k = 0; k < n; ++k ) {
+      a[k] = 0.5 * k;
+      b[k] = 3.0 - k;
+      c[k] = k % 4 + 1;
+      d[k] = 2.0 * k;
+      i[k] = static_cast<int>(k * 7 + 1);
+      j[k] = static_cast<int>(k % 5 + 1);
+    }
+
+    valarray<double> r = a * b + c * d;
+    EXAM_CHECK( r.size() == n );
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( r[k] == a[k] * b[k] + c[k] * d[k] );
+    }
+
+    r = 2.0 * a - b / c + (-d);
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( r[k] == 2.0 * a[k] - b[k] / c[k] - d[k] );
+    }
+
+    // operands may be the assigned array
+    r = a;
+    r = r * b + r;
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( r[k] == a[k] * b[k] + a[k] );
+    }
+
+    r = a;
+    r += b * c;
+    r -= 1.0;
+    r *= c;
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( r[k] == (a[k] + b[k] * c[k] - 1.0) * c[k] );
+    }
+
+    valarray<int> ri = (i & j) | (~i ^ j);
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( ri[k] == ((i[k] & j[k]) | (~i[k] ^ j[k])) );
+    }
+    ri = i % j + (j << 2) - i * j;
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( ri[k] == i[k] % j[k] + (j[k] << 2) - i[k] * j[k] );
+    }
+
+    valarray<bool> m = !(a * 2.0 >= b) || (c == 3.0);
+    for ( size_t k = 0; k < n; ++k ) {
+      EXAM_CHECK( m[k] == (!(a[k] * 2.0 >= b[k]) || c[k] == 3.0) );
+    }
+
+    if ( n != 0 ) {
+      double s = 0.0;
+      for ( size_t k = 0; k < n; ++k ) {
+        s += a[k] * c[k];
+      }
+      EXAM_CHECK( (a * c).sum() == s );
+      EXAM_CHECK( (a + d).max() == a[n - 1] + d[n - 1] );
+      EXAM_CHECK( (b - a).min() == b[n - 1] - a[n - 1] );
+    }
+  }
+
+  valarray<double> v(2.0, 10);
+  v[slice(0, 5, 2)] = 5.0;
+  valarray<double> w = (v + v)[slice(1, 3, 3)];
+  EXAM_CHECK( w.size() == 3 );
+  EXAM_CHECK( w[0] == 4.0 && w[1] == 10.0 && w[2] == 4.0 );
+
+  valarray<double> x = v;
+  x[!(v > 3.0)] = 0.0;
+  EXAM_CHECK( x.sum() == 25.0 );
+
+  valarray<double> y = (v * 2.0).shift(1);
+  EXAM_CHECK( y[0] == 4.0 && y[9] == 0.0 );
+
+  valarray<double> z = -(-v + 1.0);
+  EXAM_CHECK( z[0] == 4.0 && z[1] == 1.0 );
+
+  return EXAM_RESULT;
+}
+
+namespace {
+
+template <class _Tp>
+bool close( _Tp x, _Tp y, _Tp eps )
+{
+  if ( x != x ) {
+    return y != y;
+  }
+  if ( x == y ) {
+    return true;
+  }
+  _Tp d = x > y ? x - y : y - x;
+  _Tp ay = y < 0 ? -y : y;
+  return d <= eps * (ay > 1 ? ay : 1);
+}
+
+template <class _Tp>
+bool check_math( const valarray<_Tp>& a, _Tp eps )
+{
+  size_t n = a.size();
+  valarray<_Tp> p = abs(a) + static_cast<_Tp>(0.25);
+  valarray<_Tp> r(n);
+
+  r = sin(a);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::sin(a[k]), eps ) ) return false;
+  }
+  r = cos(a);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::cos(a[k]), eps ) ) return false;
+  }
+  r = exp(a);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::exp(a[k]), eps ) ) return false;
+  }
+  r = log(p);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::log(p[k]), eps ) ) return false;
+  }
+  r = sqrt(p) * abs(a);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::sqrt(p[k]) * (a[k] < 0 ? -a[k] : a[k]), eps ) ) return false;
+  }
+  // argument is expression
+  r = exp(-a * a) * sin(a + static_cast<_Tp>(1));
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !close<_Tp>( r[k], ::exp(-a[k] * a[k]) * ::sin(a[k] + 1), eps ) ) return false;
+  }
+  return true;
+}
+
+// -0 == 0, but 1 / -0 is -inf
+template <class _Tp>
+bool neg_zero( _Tp x )
+{
+  return x == 0 && static_cast<_Tp>(1) / x < 0;
+}
+
+template <class _Tp>
+bool check_signed_zero( size_t n )
+{
+  const _Tp nz = -static_cast<_Tp>(0);
+  valarray<_Tp> z( nz, n );
+  valarray<_Tp> a( static_cast<_Tp>(2), n );
+  valarray<_Tp> r(n);
+
+  r = sin(z);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !neg_zero( r[k] ) ) return false;
+  }
+  r = a * nz;
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !neg_zero( r[k] ) ) return false;
+  }
+  r = nz * a;
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !neg_zero( r[k] ) ) return false;
+  }
+  r = sin(a * nz);
+  for ( size_t k = 0; k < n; ++k ) {
+    if ( !neg_zero( r[k] ) ) return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int EXAM_IMPL(valarray_test::math)
+{
+  const size_t n = 1001;
+  valarray<double> d(n);
+  valarray<float> f(n);
+  for ( size_t k = 0; k < n; ++k ) {
+    d[k] = -700.0 + 1.4 * k + 0.001 * (k % 7);
+    f[k] = -80.0f + 0.16f * k;
+  }
+  EXAM_CHECK( check_math( d, 4.0e-16 ) );
+  EXAM_CHECK( check_math( f, 3.0e-7f ) );
+
+  // special values
+  valarray<double> s(5);
+  s[0] = 0.0;
+  s[1] = -1.0;
+  s[2] = 1000.0;
+  s[3] = -1000.0;
+  s[4] = 1.0e10;
+  valarray<double> e = exp(s);
+  EXAM_CHECK( e[0] == 1.0 );
+  EXAM_CHECK( e[2] > 1.0e308 );
+  EXAM_CHECK( e[3] == 0.0 );
+  valarray<double> l = log(s);
+  EXAM_CHECK( l[0] < -1.0e308 );
+  EXAM_CHECK( l[1] != l[1] );
+  valarray<double> sn = sin(s);
+  EXAM_CHECK( sn[0] == 0.0 );
+  EXAM_CHECK( sn[4] == ::sin(1.0e10) );
+
+  return EXAM_RESULT;
+}
+
+int EXAM_IMPL(valarray_test::signed_zero)
+{
+  // sizes cover whole packets and scalar tail
+  for ( size_t n = 1; n <= 19; ++n ) {
+    EXAM_CHECK( check_signed_zero<double>( n ) );
+    EXAM_CHECK( check_signed_zero<float>( n ) );
+  }
+
+  return EXAM_RESULT;
+}
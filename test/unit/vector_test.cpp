@@ -634,3 +634,58 @@ int EXAM_IMPL(bvector_test::bvec1)
 #endif
   return EXAM_RESULT;
 }
+
+int EXAM_IMPL(bvector_test::bit_ops)
+{
+#if defined (STLPORT)
+  vector<bool> a( 300 );
+  EXAM_CHECK( a.count() == 0 );
+  EXAM_CHECK( a.none() );
+  EXAM_CHECK( a.find_first() == a.size() );
+
+  for ( size_t i = 5; i < a.size(); i += 11 ) {
+    a[i] = true;
+  }
+  EXAM_CHECK( a.count() == 27 );
+  EXAM_CHECK( a.any() );
+  EXAM_CHECK( a.find_first() == 5 );
+
+  size_t n = 0;
+  for ( size_t i = a.find_first(); i != a.size(); i = a.find_next( i ) ) {
+    EXAM_CHECK( i % 11 == 5 );
+    ++n;
+  }
+  EXAM_CHECK( n == 27 );
+
+  // bits beyond end() must not be seen
+  vector<bool> b( 300, true );
+  b.resize( 70 );
+  EXAM_CHECK( b.count() == 70 );
+  b.flip();
+  EXAM_CHECK( b.count() == 0 );
+  EXAM_CHECK( b.find_first() == 70 );
+  b[69] = true;
+  EXAM_CHECK( b.find_next( 0 ) == 69 );
+  EXAM_CHECK( b.find_next( 69 ) == 70 );
+
+  vector<bool> c( 300 ), d( 300 );
+  for ( size_t i = 0; i < c.size(); ++i ) {
+    c[i] = i % 2 == 0;
+    d[i] = i % 3 == 0;
+  }
+  vector<bool> r( c );
+  r &= d;
+  EXAM_CHECK( r.count() == 50 );
+  EXAM_CHECK( r.find_next( 0 ) == 6 );
+  r = c;
+  r |= d;
+  EXAM_CHECK( r.count() == 200 );
+  r = c;
+  r ^= d;
+  EXAM_CHECK( r.count() == 150 );
+  EXAM_CHECK( !r[0] && r[2] && r[3] && !r[6] );
+#else
+  throw exam::skip_exception();
+#endif
+  return EXAM_RESULT;
+}
@@ -50,6 +50,7 @@ class bvector_test
 {
   public:
     int EXAM_DECL(bvec1);
+    int EXAM_DECL(bit_ops);
 };
 
 #endif // __TEST_VECTOR_TEST_H